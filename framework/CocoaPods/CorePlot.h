@@ -66,6 +66,7 @@
 #import "CPTTextStyle.h"
 #import "CPTTheme.h"
 #import "CPTTimeFormatter.h"
+#import "CPTTradingRangeDataSource.h"
 #import "CPTTradingRangePlot.h"
 #import "CPTUtilities.h"
 #import "CPTXYAxis.h"
@@ -71,6 +71,7 @@
 #import <CorePlot/CPTTextStyle.h>
 #import <CorePlot/CPTTheme.h>
 #import <CorePlot/CPTTimeFormatter.h>
+#import <CorePlot/CPTTradingRangeDataSource.h>
 #import <CorePlot/CPTTradingRangePlot.h>
 #import <CorePlot/CPTUtilities.h>
 #import <CorePlot/CPTXYAxis.h>
@@ -18,6 +18,35 @@
 #import "CPTTextLayer.h"
 #import "CPTUtilities.h"
 #import "NSCoderExtensions.h"
+#import "_CPTSortedTickLocations.h"
+
+/// @cond
+
+/**
+ *  @internal
+ *  @brief The major and minor intervals of automatically generated linear ticks.
+ *
+ *  Tick number @par{n} lies at @par{n} * @par{mantissa} * 10^@par{exponent} / @par{minorTicks}. Tick numbers that are
+ *  multiples of @par{minorTicks} are major ticks.
+ **/
+typedef struct _CPTAutoTickIntervals {
+    double    mantissa;      ///< The integer mantissa of the major interval.
+    double    minorMantissa; ///< The integer mantissa of the minor interval, or zero if it is not a terminating decimal.
+    int64_t   minorTicks;    ///< The number of minor intervals per major interval.
+    NSDecimal majorInterval; ///< The major interval.
+    NSDecimal minorInterval; ///< The minor interval.
+    int       exponent;      ///< The power of ten of the major interval.
+    int       minorExponent; ///< The power of ten of the minor interval.
+}
+CPTAutoTickIntervals;
+
+/// @endcond
+
+static const int kCPTMaximumExactPowerOfTen    = 22;                 // largest power of ten exactly representable as a double
+static const double kCPTMaximumExactInteger    = 9007199254740992.0; // 2^53
+static const double kCPTAutoTickTolerance      = 1.0e-9;             // relative distance from a rounding boundary decided in NSDecimal
+static const double kCPTAutoTickMaximumCount   = 65536.0;            // larger tick counts use the NSDecimal generator
+static const int kCPTAutoTickMaximumMinorShift = 4;                  // extra decimal places tried for the minor interval
 
 /** @defgroup axisAnimation Axes
  *  @brief Axis properties that can be animated using Core Animation.
@@ -42,6 +71,8 @@
 @property (nonatomic, readonly) CGFloat tickOffset;
 @property (nonatomic, readwrite, assign) BOOL inTitleUpdate;
 @property (nonatomic, readwrite, assign) BOOL labelsUpdated;
+@property (nonatomic, readwrite, strong, nullable) _CPTSortedTickLocations *sortedMajorTickLocations;
+@property (nonatomic, readwrite, strong, nullable) _CPTSortedTickLocations *sortedMinorTickLocations;
 
 -(void)generateFixedIntervalMajorTickLocations:(CPTNumberSet *__nonnull __autoreleasing *)newMajorLocations minorTickLocations:(CPTNumberSet *__nonnull __autoreleasing *)newMinorLocations;
 -(void)autoGenerateMajorTickLocations:(CPTNumberSet *__nonnull __autoreleasing *)newMajorLocations minorTickLocations:(CPTNumberSet *__nonnull __autoreleasing *)newMinorLocations;
@@ -52,6 +83,8 @@
 -(void)updateMajorTickLabelOffsets;
 -(void)updateMinorTickLabelOffsets;
 
+BOOL CPTAutoLinearTickLocations(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations);
+void CPTAutoLinearTickLocationsDecimal(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations);
 NSDecimal CPTNiceNum(NSDecimal x);
 NSDecimal CPTNiceLength(NSDecimal length);
 
@@ -473,6 +506,18 @@ NSDecimal CPTNiceLength(NSDecimal length);
 @synthesize inTitleUpdate;
 @synthesize labelsUpdated;
 
+/** @internal
+ *  @property nullable _CPTSortedTickLocations *sortedMajorTickLocations
+ *  @brief The major tick locations in ascending order, created from @ref majorTickLocations when first needed.
+ **/
+@synthesize sortedMajorTickLocations;
+
+/** @internal
+ *  @property nullable _CPTSortedTickLocations *sortedMinorTickLocations
+ *  @brief The minor tick locations in ascending order, created from @ref minorTickLocations when first needed.
+ **/
+@synthesize sortedMinorTickLocations;
+
 #pragma mark -
 #pragma mark Init/Dealloc
 
@@ -607,6 +652,8 @@ NSDecimal CPTNiceLength(NSDecimal length);
         pointingDeviceDownTickLabel = nil;
         inTitleUpdate               = NO;
         labelsUpdated               = NO;
+        sortedMajorTickLocations    = nil;
+        sortedMinorTickLocations    = nil;
 
         self.needsDisplayOnBoundsChange = YES;
     }
@@ -681,6 +728,8 @@ NSDecimal CPTNiceLength(NSDecimal length);
         pointingDeviceDownTickLabel = theLayer->pointingDeviceDownTickLabel;
         inTitleUpdate               = theLayer->inTitleUpdate;
         labelsUpdated               = theLayer->labelsUpdated;
+        sortedMajorTickLocations    = theLayer->sortedMajorTickLocations;
+        sortedMinorTickLocations    = theLayer->sortedMinorTickLocations;
     }
     return self;
 }
@@ -1083,64 +1132,8 @@ NSDecimal CPTNiceLength(NSDecimal length);
                         break;
                 }
 
-                NSDecimal zero = CPTDecimalFromInteger(0);
-                NSDecimal one  = CPTDecimalFromInteger(1);
-
-                NSDecimal majorInterval;
-                if ( numTicks == 2 ) {
-                    majorInterval = CPTNiceLength(range.lengthDecimal);
-                }
-                else {
-                    majorInterval = CPTDecimalDivide(range.lengthDecimal, CPTDecimalFromUnsignedInteger(numTicks - 1));
-                    majorInterval = CPTNiceNum(majorInterval);
-                }
-                if ( CPTDecimalLessThan(majorInterval, zero)) {
-                    majorInterval = CPTDecimalMultiply(majorInterval, CPTDecimalFromInteger(-1));
-                }
-
-                NSDecimal minorInterval;
-                if ( minorTicks > 1 ) {
-                    minorInterval = CPTDecimalDivide(majorInterval, CPTDecimalFromUnsignedInteger(minorTicks));
-                }
-                else {
-                    minorInterval = zero;
-                }
-
-                // Calculate actual range limits
-                NSDecimal minLimit = range.minLimitDecimal;
-                NSDecimal maxLimit = range.maxLimitDecimal;
-
-                // Determine the initial and final major indexes for the actual visible range
-                NSDecimal initialIndex = CPTDecimalDivide(minLimit, majorInterval);
-                NSDecimalRound(&initialIndex, &initialIndex, 0, NSRoundDown);
-
-                NSDecimal finalIndex = CPTDecimalDivide(maxLimit, majorInterval);
-                NSDecimalRound(&finalIndex, &finalIndex, 0, NSRoundUp);
-
-                // Iterate through the indexes with visible ticks and build the locations sets
-                for ( NSDecimal i = initialIndex; CPTDecimalLessThanOrEqualTo(i, finalIndex); i = CPTDecimalAdd(i, one)) {
-                    NSDecimal pointLocation      = CPTDecimalMultiply(majorInterval, i);
-                    NSDecimal minorPointLocation = pointLocation;
-
-                    for ( NSUInteger j = 1; j < minorTicks; j++ ) {
-                        minorPointLocation = CPTDecimalAdd(minorPointLocation, minorInterval);
-
-                        if ( CPTDecimalLessThan(minorPointLocation, minLimit)) {
-                            continue;
-                        }
-                        if ( CPTDecimalGreaterThan(minorPointLocation, maxLimit)) {
-                            continue;
-                        }
-                        [minorLocations addObject:[NSDecimalNumber decimalNumberWithDecimal:minorPointLocation]];
-                    }
-
-                    if ( CPTDecimalLessThan(pointLocation, minLimit)) {
-                        continue;
-                    }
-                    if ( CPTDecimalGreaterThan(pointLocation, maxLimit)) {
-                        continue;
-                    }
-                    [majorLocations addObject:[NSDecimalNumber decimalNumberWithDecimal:pointLocation]];
+                if ( !CPTAutoLinearTickLocations(range, numTicks, minorTicks, majorLocations, minorLocations)) {
+                    CPTAutoLinearTickLocationsDecimal(range, numTicks, minorTicks, majorLocations, minorLocations);
                 }
             }
             break;
@@ -1373,6 +1366,402 @@ NSDecimal CPTNiceLength(NSDecimal length);
     *newMinorLocations = minorLocations;
 }
 
+/**
+ *  @internal
+ *  @brief Multiplies a number by a power of ten with a single rounding.
+ *  @param x The number to scale.
+ *  @param exponent The power of ten, no larger than @par{kCPTMaximumExactPowerOfTen} in magnitude.
+ *  @return The scaled number.
+ */
+static double CPTScaleByPowerOfTen(double x, int exponent)
+{
+    static const double powersOfTen[] = {
+        1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9, 1.0e10, 1.0e11,
+        1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22
+    };
+
+    return (exponent >= 0) ? x * powersOfTen[exponent] : x / powersOfTen[-exponent];
+}
+
+/**
+ *  @internal
+ *  @brief Determines whether a positive number lies within the rounding tolerance of a boundary value.
+ *  @param x The number to check.
+ *  @param boundary The boundary value.
+ *  @return @YES if @par{x} is too close to @par{boundary} to round it reliably in double precision.
+ */
+static BOOL CPTIsNearBoundary(double x, double boundary)
+{
+    return fabs(x - boundary) <= boundary * kCPTAutoTickTolerance;
+}
+
+/**
+ *  @internal
+ *  @brief Splits a decimal number into an integer mantissa and a power of ten, both exactly representable as doubles.
+ *  @param value The decimal number. The sign is ignored.
+ *  @param mantissa Returns the integer mantissa.
+ *  @param exponent Returns the power of ten.
+ *  @return @YES if the decimal number is non-zero and could be split.
+ */
+static BOOL CPTDecimalMantissaAndExponent(NSDecimal value, double *__nonnull mantissa, int *__nonnull exponent)
+{
+    NSDecimalCompact(&value);
+
+    unsigned int length = value._length;
+    int power           = value._exponent;
+
+    if ((length == 0) || (length > 3) || (abs(power) > kCPTMaximumExactPowerOfTen)) {
+        return NO;
+    }
+
+    double integerMantissa = 0.0;
+    for ( unsigned int k = length; k > 0; k-- ) {
+        integerMantissa = integerMantissa * 65536.0 + (double)value._mantissa[k - 1];
+    }
+
+    *mantissa = integerMantissa;
+    *exponent = power;
+
+    return YES;
+}
+
+/**
+ *  @internal
+ *  @brief Double precision version of CPTNiceNum() for positive numbers.
+ *  @param x The number to round.
+ *  @param mantissa Returns the integer mantissa of the @quote{nice} number.
+ *  @param exponent Returns the power of ten of the @quote{nice} number.
+ *  @return @YES if the result is the same as CPTNiceNum(); @NO if @par{x} is too close to a rounding boundary.
+ */
+static BOOL CPTNiceNumDouble(double x, double *__nonnull mantissa, int *__nonnull exponent)
+{
+    if ((x <= 0.0) || isnan(x) || isinf(x)) {
+        return NO;
+    }
+
+    int power = (int)lrint(floor(log10(x)));
+
+    if ( abs(power) >= kCPTMaximumExactPowerOfTen ) {
+        return NO;
+    }
+
+    double fraction = CPTScaleByPowerOfTen(x, -power);
+
+    if ( CPTIsNearBoundary(fraction, 1.0) || CPTIsNearBoundary(fraction, 1.5) || CPTIsNearBoundary(fraction, 3.0) ||
+         CPTIsNearBoundary(fraction, 7.0) || CPTIsNearBoundary(fraction, 10.0)) {
+        return NO;
+    }
+
+    if ( fraction < 1.5 ) {
+        *mantissa = 1.0;
+    }
+    else if ( fraction < 3.0 ) {
+        *mantissa = 2.0;
+    }
+    else if ( fraction < 7.0 ) {
+        *mantissa = 5.0;
+    }
+    else {
+        *mantissa = 1.0;
+        power++;
+    }
+    *exponent = power;
+
+    return YES;
+}
+
+/**
+ *  @internal
+ *  @brief Double precision version of CPTNiceLength() for positive lengths.
+ *  @param length The length to round.
+ *  @param mantissa Returns the integer mantissa of the @quote{nice} length.
+ *  @param exponent Returns the power of ten of the @quote{nice} length.
+ *  @return @YES if the result is the same as CPTNiceLength(); @NO if @par{length} is too close to a rounding boundary.
+ */
+static BOOL CPTNiceLengthDouble(double length, double *__nonnull mantissa, int *__nonnull exponent)
+{
+    if ((length <= 0.0) || isnan(length) || isinf(length) || CPTIsNearBoundary(length, 10.0)) {
+        return NO;
+    }
+
+    int power = 0;
+
+    if ( length < 10.0 ) {
+        power = (int)lrint(floor(log10(length))) - 1;
+
+        if ( abs(power) > kCPTMaximumExactPowerOfTen ) {
+            return NO;
+        }
+    }
+
+    double scaledLength = CPTScaleByPowerOfTen(length, -power);
+    double roundedValue = floor(scaledLength);
+
+    if ((scaledLength >= kCPTMaximumExactInteger) || CPTIsNearBoundary(scaledLength, roundedValue) || CPTIsNearBoundary(scaledLength, roundedValue + 1.0)) {
+        return NO;
+    }
+
+    *mantissa = roundedValue;
+    *exponent = power;
+
+    return YES;
+}
+
+/**
+ *  @internal
+ *  @brief Returns the exact location of an automatically generated linear tick.
+ *
+ *  The result has the same value the NSDecimal tick generator computes for the tick.
+ *
+ *  @param tickNumber The tick number.
+ *  @param intervals The tick intervals.
+ *  @return The tick location.
+ */
+static NSDecimalNumber *__nonnull CPTAutoTickLocation(int64_t tickNumber, const CPTAutoTickIntervals *__nonnull intervals)
+{
+    int64_t majorIndex = tickNumber / intervals->minorTicks;
+    int64_t minorIndex = tickNumber % intervals->minorTicks;
+
+    if ( minorIndex < 0 ) {
+        minorIndex += intervals->minorTicks;
+        majorIndex--;
+    }
+
+    if ( minorIndex == 0 ) {
+        return [NSDecimalNumber decimalNumberWithMantissa:(unsigned long long)llabs(majorIndex) * (unsigned long long)intervals->mantissa
+                                                 exponent:(short)intervals->exponent
+                                               isNegative:(majorIndex < 0)];
+    }
+    else if ( intervals->minorMantissa > 0.0 ) {
+        return [NSDecimalNumber decimalNumberWithMantissa:(unsigned long long)llabs(tickNumber) * (unsigned long long)intervals->minorMantissa
+                                                 exponent:(short)intervals->minorExponent
+                                               isNegative:(tickNumber < 0)];
+    }
+    else {
+        // Non-terminating minor interval--add it up the same way as the NSDecimal tick generator
+        NSDecimal location = CPTDecimalMultiply(intervals->majorInterval, CPTDecimalFromLongLong(majorIndex));
+
+        for ( int64_t j = 0; j < minorIndex; j++ ) {
+            location = CPTDecimalAdd(location, intervals->minorInterval);
+        }
+
+        return [NSDecimalNumber decimalNumberWithDecimal:location];
+    }
+}
+
+/**
+ *  @internal
+ *  @brief Generates major and minor tick locations for a linear scale using the automatic labeling policy.
+ *
+ *  The interval and the tick locations are computed in double precision and the visible ticks are collected
+ *  in sorted arrays of tick numbers before they are boxed. Values too close to a rounding boundary or to an end
+ *  of the range are decided exactly in NSDecimal, so the result is the same as CPTAutoLinearTickLocationsDecimal().
+ *
+ *  @param range The plot range to generate ticks in.
+ *  @param numTicks The preferred number of major ticks, at least two.
+ *  @param minorTicks The number of minor intervals per major interval.
+ *  @param majorLocations The set to add the major tick locations to.
+ *  @param minorLocations The set to add the minor tick locations to.
+ *  @return @YES if the ticks were generated; @NO if the range cannot be represented exactly enough in double precision.
+ */
+BOOL CPTAutoLinearTickLocations(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations)
+{
+    CPTAutoTickIntervals intervals;
+
+    intervals.minorTicks = (int64_t)minorTicks;
+
+    // Determine interval value
+    BOOL isNice;
+    double length = fabs(range.lengthDouble);
+
+    if ( numTicks == 2 ) {
+        isNice = CPTNiceLengthDouble(length, &intervals.mantissa, &intervals.exponent) ||
+                 CPTDecimalMantissaAndExponent(CPTNiceLength(range.lengthDecimal), &intervals.mantissa, &intervals.exponent);
+    }
+    else {
+        isNice = CPTNiceNumDouble(length / (double)(numTicks - 1), &intervals.mantissa, &intervals.exponent) ||
+                 CPTDecimalMantissaAndExponent(CPTNiceNum(CPTDecimalDivide(range.lengthDecimal, CPTDecimalFromUnsignedInteger(numTicks - 1))), &intervals.mantissa, &intervals.exponent);
+    }
+
+    if ( !isNice || (intervals.minorTicks < 1) || (abs(intervals.exponent) > kCPTMaximumExactPowerOfTen)) {
+        return NO;
+    }
+
+    // Tick number n lies at n * scaledMantissa / denominator with a single rounding
+    double minorCount     = (double)intervals.minorTicks;
+    double majorInterval  = CPTScaleByPowerOfTen(intervals.mantissa, intervals.exponent);
+    double scaledMantissa = (intervals.exponent > 0) ? majorInterval : intervals.mantissa;
+    double denominator    = (intervals.exponent < 0) ? CPTScaleByPowerOfTen(minorCount, -intervals.exponent) : minorCount;
+
+    double minLimit   = range.minLimitDouble;
+    double maxLimit   = range.maxLimitDouble;
+    double firstIndex = floor(minLimit / majorInterval) - 1.0;
+    double lastIndex  = ceil(maxLimit / majorInterval) + 1.0;
+
+    double largestTickNumber = (fmax(fabs(firstIndex), fabs(lastIndex)) + 1.0) * minorCount;
+
+    if ( !((lastIndex - firstIndex + 1.0) * minorCount <= kCPTAutoTickMaximumCount) ||
+         !(largestTickNumber * scaledMantissa < kCPTMaximumExactInteger) || !(denominator < kCPTMaximumExactInteger)) {
+        return NO;
+    }
+
+    // Use an exact decimal minor interval if there is one
+    intervals.minorMantissa = 0.0;
+    intervals.minorExponent = 0;
+
+    for ( int shift = 0; shift <= kCPTAutoTickMaximumMinorShift; shift++ ) {
+        double shiftedMantissa = CPTScaleByPowerOfTen(intervals.mantissa, shift);
+
+        if ( shiftedMantissa >= kCPTMaximumExactInteger ) {
+            break;
+        }
+        if ( fmod(shiftedMantissa, minorCount) == 0.0 ) {
+            double minorMantissa = shiftedMantissa / minorCount;
+
+            if ( largestTickNumber * minorMantissa < kCPTMaximumExactInteger ) {
+                intervals.minorMantissa = minorMantissa;
+                intervals.minorExponent = intervals.exponent - shift;
+            }
+            break;
+        }
+    }
+
+    intervals.majorInterval = CPTDecimalFromUnsignedLongLong((unsigned long long)intervals.mantissa);
+    NSDecimalMultiplyByPowerOf10(&intervals.majorInterval, &intervals.majorInterval, (short)intervals.exponent, NSRoundPlain);
+    intervals.minorInterval = CPTDecimalDivide(intervals.majorInterval, CPTDecimalFromLongLong(intervals.minorTicks));
+
+    // Ticks within this distance of an end of the range are checked in NSDecimal
+    double tolerance = majorInterval * kCPTAutoTickTolerance +
+                       8.0 * DBL_EPSILON * (fabs(range.locationDouble) + fabs(range.lengthDouble));
+
+    BOOL hasDecimalLimits = NO;
+    NSDecimal minLimitDecimal = CPTDecimalNaN();
+    NSDecimal maxLimitDecimal = CPTDecimalNaN();
+
+    // Collect the visible tick numbers in sorted order
+    NSMutableData *majorTickNumbers = [NSMutableData data];
+    NSMutableData *minorTickNumbers = [NSMutableData data];
+
+    int64_t lastTickNumber = (int64_t)lastIndex * intervals.minorTicks;
+
+    for ( int64_t tickNumber = (int64_t)firstIndex * intervals.minorTicks; tickNumber <= lastTickNumber; tickNumber++ ) {
+        double location = ((double)tickNumber * scaledMantissa) / denominator;
+
+        if ((location < minLimit - tolerance) || (location > maxLimit + tolerance)) {
+            continue;
+        }
+        if ((location < minLimit + tolerance) || (location > maxLimit - tolerance)) {
+            if ( !hasDecimalLimits ) {
+                minLimitDecimal  = range.minLimitDecimal;
+                maxLimitDecimal  = range.maxLimitDecimal;
+                hasDecimalLimits = YES;
+            }
+
+            NSDecimal locationDecimal = CPTAutoTickLocation(tickNumber, &intervals).decimalValue;
+
+            if ( CPTDecimalLessThan(locationDecimal, minLimitDecimal) || CPTDecimalGreaterThan(locationDecimal, maxLimitDecimal)) {
+                continue;
+            }
+        }
+
+        if ( tickNumber % intervals.minorTicks == 0 ) {
+            [majorTickNumbers appendBytes:&tickNumber length:sizeof(int64_t)];
+        }
+        else {
+            [minorTickNumbers appendBytes:&tickNumber length:sizeof(int64_t)];
+        }
+    }
+
+    // Box the visible ticks
+    const int64_t *tickNumbers = (const int64_t *)majorTickNumbers.bytes;
+    NSUInteger tickCount       = majorTickNumbers.length / sizeof(int64_t);
+
+    for ( NSUInteger k = 0; k < tickCount; k++ ) {
+        [majorLocations addObject:CPTAutoTickLocation(tickNumbers[k], &intervals)];
+    }
+
+    tickNumbers = (const int64_t *)minorTickNumbers.bytes;
+    tickCount   = minorTickNumbers.length / sizeof(int64_t);
+
+    for ( NSUInteger k = 0; k < tickCount; k++ ) {
+        [minorLocations addObject:CPTAutoTickLocation(tickNumbers[k], &intervals)];
+    }
+
+    return YES;
+}
+
+/**
+ *  @internal
+ *  @brief Generates major and minor tick locations for a linear scale using the automatic labeling policy in NSDecimal arithmetic.
+ *  @param range The plot range to generate ticks in.
+ *  @param numTicks The preferred number of major ticks, at least two.
+ *  @param minorTicks The number of minor intervals per major interval.
+ *  @param majorLocations The set to add the major tick locations to.
+ *  @param minorLocations The set to add the minor tick locations to.
+ */
+void CPTAutoLinearTickLocationsDecimal(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations)
+{
+    NSDecimal zero = CPTDecimalFromInteger(0);
+    NSDecimal one  = CPTDecimalFromInteger(1);
+
+    NSDecimal majorInterval;
+    if ( numTicks == 2 ) {
+        majorInterval = CPTNiceLength(range.lengthDecimal);
+    }
+    else {
+        majorInterval = CPTDecimalDivide(range.lengthDecimal, CPTDecimalFromUnsignedInteger(numTicks - 1));
+        majorInterval = CPTNiceNum(majorInterval);
+    }
+    if ( CPTDecimalLessThan(majorInterval, zero)) {
+        majorInterval = CPTDecimalMultiply(majorInterval, CPTDecimalFromInteger(-1));
+    }
+
+    NSDecimal minorInterval;
+    if ( minorTicks > 1 ) {
+        minorInterval = CPTDecimalDivide(majorInterval, CPTDecimalFromUnsignedInteger(minorTicks));
+    }
+    else {
+        minorInterval = zero;
+    }
+
+    // Calculate actual range limits
+    NSDecimal minLimit = range.minLimitDecimal;
+    NSDecimal maxLimit = range.maxLimitDecimal;
+
+    // Determine the initial and final major indexes for the actual visible range
+    NSDecimal initialIndex = CPTDecimalDivide(minLimit, majorInterval);
+    NSDecimalRound(&initialIndex, &initialIndex, 0, NSRoundDown);
+
+    NSDecimal finalIndex = CPTDecimalDivide(maxLimit, majorInterval);
+    NSDecimalRound(&finalIndex, &finalIndex, 0, NSRoundUp);
+
+    // Iterate through the indexes with visible ticks and build the locations sets
+    for ( NSDecimal i = initialIndex; CPTDecimalLessThanOrEqualTo(i, finalIndex); i = CPTDecimalAdd(i, one)) {
+        NSDecimal pointLocation      = CPTDecimalMultiply(majorInterval, i);
+        NSDecimal minorPointLocation = pointLocation;
+
+        for ( NSUInteger j = 1; j < minorTicks; j++ ) {
+            minorPointLocation = CPTDecimalAdd(minorPointLocation, minorInterval);
+
+            if ( CPTDecimalLessThan(minorPointLocation, minLimit)) {
+                continue;
+            }
+            if ( CPTDecimalGreaterThan(minorPointLocation, maxLimit)) {
+                continue;
+            }
+            [minorLocations addObject:[NSDecimalNumber decimalNumberWithDecimal:minorPointLocation]];
+        }
+
+        if ( CPTDecimalLessThan(pointLocation, minLimit)) {
+            continue;
+        }
+        if ( CPTDecimalGreaterThan(pointLocation, maxLimit)) {
+            continue;
+        }
+        [majorLocations addObject:[NSDecimalNumber decimalNumberWithDecimal:pointLocation]];
+    }
+}
+
 /**
  *  @internal
  *  @brief Determines a @quote{nice} number (a multiple of @num{2}, @num{5}, or @num{10}) near the given number.
@@ -1620,13 +2009,7 @@ NSDecimal CPTNiceLength(NSDecimal length)
     CPTPlotArea *thePlotArea = self.plotArea;
     [thePlotArea setAxisSetLayersForType:CPTGraphLayerTypeAxisLabels];
 
-    CPTMutableAxisLabelSet *oldAxisLabels;
-    if ( useMajorAxisLabels ) {
-        oldAxisLabels = [self.axisLabels mutableCopy];
-    }
-    else {
-        oldAxisLabels = [self.minorTickAxisLabels mutableCopy];
-    }
+    CPTAxisLabelSet *oldAxisLabels = useMajorAxisLabels ? self.axisLabels : self.minorTickAxisLabels;
 
     CPTMutableAxisLabelSet *newAxisLabels = [[NSMutableSet alloc] initWithCapacity:locations.count];
     CPTAxisLabel *blankLabel              = [[CPTAxisLabel alloc] initWithText:nil textStyle:nil];
@@ -1639,9 +2022,9 @@ NSDecimal CPTNiceLength(NSDecimal length)
         }
 
         CPTAxisLabel *newAxisLabel;
-        BOOL needsNewContentLayer = NO;
+        BOOL needsNewContentLayer = theLabelFormatterChanged;
 
-        // reuse axis labels where possible--will prevent flicker when updating layers
+        // reuse the labels of ticks that are still present--only labels of new ticks need text layers
         blankLabel.tickLocation = tickLocation;
         CPTAxisLabel *oldAxisLabel = [oldAxisLabels member:blankLabel];
 
@@ -1658,7 +2041,7 @@ NSDecimal CPTNiceLength(NSDecimal length)
         newAxisLabel.offset    = theLabelOffset;
         newAxisLabel.alignment = theLabelAlignment;
 
-        if ( needsNewContentLayer || theLabelFormatterChanged ) {
+        if ( needsNewContentLayer ) {
             CPTTextLayer *newLabelLayer = nil;
             if ( hasCategories ) {
                 NSString *labelString = [thePlotSpace categoryForCoordinate:myCoordinate atIndex:tickLocation.unsignedIntegerValue];
@@ -1676,6 +2059,7 @@ NSDecimal CPTNiceLength(NSDecimal length)
             }
             [oldAxisLabel.contentLayer removeFromSuperlayer];
             if ( newLabelLayer ) {
+                newLabelLayer.shadow      = theShadow;
                 newAxisLabel.contentLayer = newLabelLayer;
 
                 if ( lastLayer ) {
@@ -1687,16 +2071,28 @@ NSDecimal CPTNiceLength(NSDecimal length)
             }
         }
 
-        lastLayer        = newAxisLabel.contentLayer;
-        lastLayer.shadow = theShadow;
+        // the shadow of existing layers is kept up to date by the shadow setters
+        lastLayer = newAxisLabel.contentLayer;
 
         [newAxisLabels addObject:newAxisLabel];
     }
 
-    // remove old labels that are not needed any more from the layer hierarchy
-    [oldAxisLabels minusSet:newAxisLabels];
+    // remove labels of ticks that went away from the layer hierarchy
     for ( CPTAxisLabel *label in oldAxisLabels ) {
-        [label.contentLayer removeFromSuperlayer];
+        if ( ![newAxisLabels containsObject:label] ) {
+            [label.contentLayer removeFromSuperlayer];
+        }
+    }
+
+    // if the ticks did not change, only move the existing labels
+    if ( !theLabelFormatterChanged && [newAxisLabels isEqualToSet:oldAxisLabels] ) {
+        if ( useMajorAxisLabels ) {
+            [self updateMajorTickLabels];
+        }
+        else {
+            [self updateMinorTickLabels];
+        }
+        return;
     }
 
     self.labelsUpdated = YES;
@@ -2609,10 +3005,21 @@ NSDecimal CPTNiceLength(NSDecimal length)
     }
 }
 
+-(nullable _CPTSortedTickLocations *)sortedMajorTickLocations
+{
+    if ( !sortedMajorTickLocations ) {
+        sortedMajorTickLocations = [[_CPTSortedTickLocations alloc] initWithLocations:self.majorTickLocations];
+    }
+    return sortedMajorTickLocations;
+}
+
 -(void)setMajorTickLocations:(nullable CPTNumberSet *)newLocations
 {
     if ( newLocations != majorTickLocations ) {
         majorTickLocations = newLocations;
+
+        self.sortedMajorTickLocations = nil;
+
         if ( self.separateLayers ) {
             CPTGridLines *gridlines = self.majorGridLines;
             [gridlines setNeedsDisplay];
@@ -2626,10 +3033,21 @@ NSDecimal CPTNiceLength(NSDecimal length)
     }
 }
 
+-(nullable _CPTSortedTickLocations *)sortedMinorTickLocations
+{
+    if ( !sortedMinorTickLocations ) {
+        sortedMinorTickLocations = [[_CPTSortedTickLocations alloc] initWithLocations:self.minorTickLocations];
+    }
+    return sortedMinorTickLocations;
+}
+
 -(void)setMinorTickLocations:(nullable CPTNumberSet *)newLocations
 {
     if ( newLocations != minorTickLocations ) {
         minorTickLocations = newLocations;
+
+        self.sortedMinorTickLocations = nil;
+
         if ( self.separateLayers ) {
             CPTGridLines *gridlines = self.minorGridLines;
             [gridlines setNeedsDisplay];
@@ -352,10 +352,15 @@
     NSUInteger hashValue = 0;
 
     // Equal objects must hash the same.
+    // Hash the rounded mantissa and the exponent so fractional tick locations such as 0.1 and 0.2
+    // spread across the hash table instead of all rounding to the same integer.
     double tickLocationAsDouble = self.tickLocation.doubleValue;
 
-    if ( !isnan(tickLocationAsDouble)) {
-        hashValue = (NSUInteger)lrint(fmod(ABS(tickLocationAsDouble), (double)NSUIntegerMax));
+    if ( isfinite(tickLocationAsDouble)) {
+        int exponent    = 0;
+        double mantissa = frexp(ABS(tickLocationAsDouble), &exponent);
+
+        hashValue = (NSUInteger)lrint(ldexp(mantissa, 24)) ^ ((NSUInteger)(exponent + 1100) << 24);
     }
 
     return hashValue;
@@ -3,7 +3,12 @@
 #import "CPTAxisLabel.h"
 #import "CPTBorderedLayer.h"
 #import "CPTMutableTextStyle.h"
+#import "CPTPlotRange.h"
 #import "CPTUtilities.h"
+#import "CPTXYAxis.h"
+#import "CPTXYAxisSet.h"
+#import "CPTXYGraph.h"
+#import "CPTXYPlotSpace.h"
 #import <tgmath.h>
 
 static const CGFloat precision = CPTFloat(1.0e-6);
@@ -158,4 +163,68 @@ static CGPoint roundPoint(CGPoint position, CGSize contentSize, CGPoint anchor)
     }
 }
 
+#pragma mark -
+#pragma mark Relabeling
+
+-(void)testHashSpreadsFractionalTickLocations
+{
+    CPTAxisLabel *label1 = [[CPTAxisLabel alloc] initWithText:@"0.1" textStyle:nil];
+    CPTAxisLabel *label2 = [[CPTAxisLabel alloc] initWithText:@"0.2" textStyle:nil];
+    CPTAxisLabel *label3 = [[CPTAxisLabel alloc] initWithText:@"0.2" textStyle:nil];
+
+    label1.tickLocation = [NSDecimalNumber decimalNumberWithString:@"0.1"];
+    label2.tickLocation = [NSDecimalNumber decimalNumberWithString:@"0.2"];
+    label3.tickLocation = [NSDecimalNumber decimalNumberWithString:@"0.20"];
+
+    XCTAssertNotEqual(label1.hash, label2.hash, @"Fractional tick locations should not collide");
+    XCTAssertEqualObjects(label2, label3, @"Equal tick locations");
+    XCTAssertEqual(label2.hash, label3.hash, @"Equal labels must hash the same");
+}
+
+-(void)testRelabelReusesLabelsOfRemainingTicks
+{
+    CPTXYGraph *graph = [[CPTXYGraph alloc] initWithFrame:CPTRectMake(0.0, 0.0, 400.0, 300.0)];
+
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)graph.defaultPlotSpace;
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@10.0];
+
+    CPTXYAxis *xAxis = ((CPTXYAxisSet *)graph.axisSet).xAxis;
+
+    xAxis.labelingPolicy        = CPTAxisLabelingPolicyFixedInterval;
+    xAxis.majorIntervalLength   = @1.0;
+    xAxis.minorTicksPerInterval = 0;
+    [xAxis setNeedsRelabel];
+    [xAxis relabel];
+
+    NSMutableDictionary<NSNumber *, CPTLayer *> *oldLayers = [[NSMutableDictionary alloc] init];
+
+    for ( CPTAxisLabel *label in xAxis.axisLabels ) {
+        oldLayers[label.tickLocation] = label.contentLayer;
+    }
+    XCTAssertGreaterThan(oldLayers.count, 0, @"No labels");
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@2.0 length:@10.0];
+    [xAxis setNeedsRelabel];
+    [xAxis relabel];
+
+    NSUInteger reusedCount = 0;
+
+    for ( CPTAxisLabel *label in xAxis.axisLabels ) {
+        CPTLayer *oldLayer = oldLayers[label.tickLocation];
+        if ( oldLayer ) {
+            XCTAssertEqual(label.contentLayer, oldLayer, @"Label at %@ was rebuilt", label.tickLocation);
+            reusedCount++;
+        }
+        XCTAssertNotNil(label.contentLayer.superlayer, @"Label at %@ is not shown", label.tickLocation);
+    }
+    XCTAssertGreaterThan(reusedCount, 0, @"No labels reused");
+
+    for ( NSNumber *location in oldLayers ) {
+        if ( location.doubleValue < 2.0 ) {
+            XCTAssertNil(oldLayers[location].superlayer, @"Label at %@ was not removed", location);
+        }
+    }
+}
+
 @end
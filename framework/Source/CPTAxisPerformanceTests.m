@@ -0,0 +1,80 @@
+#import "CPTAxisPerformanceTests.h"
+
+#import "CPTPlotRange.h"
+#import "CPTUtilities.h"
+
+static const NSUInteger numberOfZoomSteps = 1000;
+static const NSUInteger numberOfAxes      = 5;
+
+BOOL CPTAutoLinearTickLocations(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations);
+void CPTAutoLinearTickLocationsDecimal(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations);
+
+@interface CPTAxisPerformanceTests()
+
+-(nonnull NSArray<CPTPlotRange *> *)zoomRanges;
+
+@end
+
+#pragma mark -
+
+@implementation CPTAxisPerformanceTests
+
+#pragma mark -
+#pragma mark Automatic Tick Generation
+
+-(void)testAutoLinearTicksDecimal
+{
+    NSArray<CPTPlotRange *> *ranges = [self zoomRanges];
+
+    [self measureBlock: ^{
+        for ( CPTPlotRange *range in ranges ) {
+            for ( NSUInteger axis = 0; axis < numberOfAxes; axis++ ) {
+                CPTMutableNumberSet *majorLocations = [NSMutableSet set];
+                CPTMutableNumberSet *minorLocations = [NSMutableSet set];
+
+                CPTAutoLinearTickLocationsDecimal(range, 5, 5, majorLocations, minorLocations);
+            }
+        }
+    }];
+}
+
+-(void)testAutoLinearTicksDouble
+{
+    NSArray<CPTPlotRange *> *ranges = [self zoomRanges];
+
+    [self measureBlock: ^{
+        for ( CPTPlotRange *range in ranges ) {
+            for ( NSUInteger axis = 0; axis < numberOfAxes; axis++ ) {
+                CPTMutableNumberSet *majorLocations = [NSMutableSet set];
+                CPTMutableNumberSet *minorLocations = [NSMutableSet set];
+
+                if ( !CPTAutoLinearTickLocations(range, 5, 5, majorLocations, minorLocations)) {
+                    CPTAutoLinearTickLocationsDecimal(range, 5, 5, majorLocations, minorLocations);
+                }
+            }
+        }
+    }];
+}
+
+#pragma mark -
+#pragma mark Private Methods
+
+/** @brief The plot ranges of an interactive zoom from @par{[-1000, 1000]} down to a width of about @num{0.002}.
+ **/
+-(nonnull NSArray<CPTPlotRange *> *)zoomRanges
+{
+    NSMutableArray<CPTPlotRange *> *ranges = [NSMutableArray arrayWithCapacity:numberOfZoomSteps];
+
+    double length = 2000.0;
+
+    for ( NSUInteger i = 0; i < numberOfZoomSteps; i++ ) {
+        double center = 12.34 * (double)i / (double)numberOfZoomSteps;
+
+        [ranges addObject:[CPTPlotRange plotRangeWithLocation:@(center - length / 2.0) length:@(length)]];
+        length *= 0.986;
+    }
+
+    return ranges;
+}
+
+@end
@@ -0,0 +1,5 @@
+#import "CPTTestCase.h"
+
+@interface CPTAxisTests : CPTTestCase
+
+@end
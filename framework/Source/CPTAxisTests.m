@@ -0,0 +1,217 @@
+#import "CPTAxisTests.h"
+
+#import "CPTPlotRange.h"
+#import "CPTUtilities.h"
+#import "CPTXYAxis.h"
+#import "_CPTSortedTickLocations.h"
+
+static const NSUInteger numberOfRandomRanges = 2000;
+
+BOOL CPTAutoLinearTickLocations(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations);
+void CPTAutoLinearTickLocationsDecimal(CPTPlotRange *__nonnull range, NSUInteger numTicks, NSUInteger minorTicks, CPTMutableNumberSet *__nonnull majorLocations, CPTMutableNumberSet *__nonnull minorLocations);
+
+@interface CPTAxis(SortedTickLocationsTesting)
+
+-(nullable _CPTSortedTickLocations *)sortedMajorTickLocations;
+
+@end
+
+@interface CPTAxisTests()
+
+-(BOOL)compareTicksInRange:(nonnull CPTPlotRange *)range numTicks:(NSUInteger)numTicks minorTicks:(NSUInteger)minorTicks;
+
+@end
+
+#pragma mark -
+
+@implementation CPTAxisTests
+
+#pragma mark -
+#pragma mark Automatic Tick Generation
+
+-(void)testAutoLinearTicksIncludeRangeEnds
+{
+    CPTPlotRange *range = [CPTPlotRange plotRangeWithLocation:@0.0 length:@1.0];
+
+    CPTMutableNumberSet *majorLocations = [NSMutableSet set];
+    CPTMutableNumberSet *minorLocations = [NSMutableSet set];
+
+    XCTAssertTrue(CPTAutoLinearTickLocations(range, 5, 2, majorLocations, minorLocations), @"Ticks in [0, 1]");
+
+    CPTNumberArray *expectedMajorLocations = @[[NSDecimalNumber decimalNumberWithString:@"0"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.2"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.4"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.6"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.8"],
+                                               [NSDecimalNumber decimalNumberWithString:@"1"]];
+    CPTNumberArray *expectedMinorLocations = @[[NSDecimalNumber decimalNumberWithString:@"0.1"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.3"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.5"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.7"],
+                                               [NSDecimalNumber decimalNumberWithString:@"0.9"]];
+
+    XCTAssertEqualObjects([majorLocations.allObjects sortedArrayUsingSelector:@selector(compare:)], expectedMajorLocations, @"Major ticks");
+    XCTAssertEqualObjects([minorLocations.allObjects sortedArrayUsingSelector:@selector(compare:)], expectedMinorLocations, @"Minor ticks");
+}
+
+-(void)testAutoLinearTicksMatchDecimalTicks
+{
+    NSArray<NSArray<NSString *> *> *ranges = @[@[@"0", @"1"],
+                                               @[@"0", @"10"],
+                                               @[@"0", @"100"],
+                                               @[@"0.1", @"0.6"],
+                                               @[@"1", @"-1"],
+                                               @[@"1.1", @"-1.1"],
+                                               @[@"-5", @"10"],
+                                               @[@"-0.003", @"0.0075"],
+                                               @[@"0.3", @"0.000001"],
+                                               @[@"123456.7", @"0.03"],
+                                               @[@"-1000000", @"2500000"],
+                                               @[@"7", @"0.7"],
+                                               @[@"2.5", @"15"]];
+
+    for ( NSArray<NSString *> *limits in ranges ) {
+        CPTPlotRange *range = [CPTPlotRange plotRangeWithLocationDecimal:CPTDecimalFromString(limits[0])
+                                                           lengthDecimal:CPTDecimalFromString(limits[1])];
+
+        for ( NSUInteger numTicks = 2; numTicks <= 11; numTicks++ ) {
+            for ( NSUInteger minorTicks = 1; minorTicks <= 10; minorTicks++ ) {
+                XCTAssertTrue([self compareTicksInRange:range numTicks:numTicks minorTicks:minorTicks],
+                              @"Double precision ticks in %@ with %lu major and %lu minor ticks", range, (unsigned long)numTicks, (unsigned long)minorTicks);
+            }
+        }
+    }
+}
+
+-(void)testAutoLinearTicksInRandomRangesMatchDecimalTicks
+{
+    srand48(24);
+
+    NSUInteger fastRangeCount = 0;
+
+    for ( NSUInteger i = 0; i < numberOfRandomRanges; i++ ) {
+        NSDecimal location = CPTDecimalFromLongLong((int64_t)lrint(drand48() * 2000000.0 - 1000000.0));
+        NSDecimal length   = CPTDecimalFromLongLong((int64_t)lrint(drand48() * 200000.0 - 100000.0) ?: 1);
+
+        NSDecimalMultiplyByPowerOf10(&location, &location, (short)(lrint(drand48() * 12.0) - 8), NSRoundPlain);
+        NSDecimalMultiplyByPowerOf10(&length, &length, (short)(lrint(drand48() * 8.0) - 6), NSRoundPlain);
+
+        CPTPlotRange *range = [CPTPlotRange plotRangeWithLocationDecimal:location lengthDecimal:length];
+
+        NSUInteger numTicks   = 2 + (NSUInteger)lrint(drand48() * 9.0);
+        NSUInteger minorTicks = 1 + (NSUInteger)lrint(drand48() * 9.0);
+
+        if ( [self compareTicksInRange:range numTicks:numTicks minorTicks:minorTicks] ) {
+            fastRangeCount++;
+        }
+    }
+
+    XCTAssertGreaterThan(fastRangeCount, numberOfRandomRanges * 9 / 10, @"Ranges using double precision ticks");
+}
+
+-(void)testAutoLinearTicksFallBackForLargeOffsets
+{
+    CPTPlotRange *range = [CPTPlotRange plotRangeWithLocationDecimal:CPTDecimalFromString(@"100000000000000000000")
+                                                       lengthDecimal:CPTDecimalFromString(@"0.5")];
+
+    CPTMutableNumberSet *majorLocations = [NSMutableSet set];
+    CPTMutableNumberSet *minorLocations = [NSMutableSet set];
+
+    XCTAssertFalse(CPTAutoLinearTickLocations(range, 5, 2, majorLocations, minorLocations), @"Ticks at 1e20");
+    XCTAssertEqual(majorLocations.count, (NSUInteger)0, @"Major tick count");
+    XCTAssertEqual(minorLocations.count, (NSUInteger)0, @"Minor tick count");
+}
+
+#pragma mark -
+#pragma mark Sorted Tick Locations
+
+-(void)testSortedTickLocationsAreAscending
+{
+    CPTNumberSet *locations = [NSSet setWithArray:@[@3.0, @(NAN), [NSDecimalNumber decimalNumberWithString:@"2"], @1.0, @(-0.5)]];
+
+    _CPTSortedTickLocations *sortedLocations = [[_CPTSortedTickLocations alloc] initWithLocations:locations];
+
+    XCTAssertEqual(sortedLocations.count, (NSUInteger)4, @"Location count");
+
+    const double expected[] = { -0.5, 1.0, 2.0, 3.0 };
+
+    for ( NSUInteger i = 0; i < 4; i++ ) {
+        XCTAssertEqual(sortedLocations.doubleValues[i], expected[i], @"Location %lu", (unsigned long)i);
+        XCTAssertEqual(CPTDecimalDoubleValue(sortedLocations.decimalValues[i]), expected[i], @"Decimal location %lu", (unsigned long)i);
+    }
+
+    _CPTSortedTickLocations *emptyLocations = [[_CPTSortedTickLocations alloc] initWithLocations:nil];
+    XCTAssertEqual(emptyLocations.count, (NSUInteger)0, @"Empty location count");
+}
+
+-(void)testSortedTickLocationsMatchPlotRangeContainment
+{
+    CPTPlotRange *range = [CPTPlotRange plotRangeWithLocationDecimal:CPTDecimalFromString(@"0.1")
+                                                       lengthDecimal:CPTDecimalFromString(@"0.2")];
+
+    CPTNumberSet *locations = [NSSet setWithArray:@[[NSDecimalNumber decimalNumberWithString:@"0.1"],
+                                                    [NSDecimalNumber decimalNumberWithString:@"0.3"],
+                                                    [NSDecimalNumber decimalNumberWithString:@"0.30000000000000001"],
+                                                    @0.2,
+                                                    @0.35]];
+
+    _CPTSortedTickLocations *sortedLocations = [[_CPTSortedTickLocations alloc] initWithLocations:locations];
+
+    NSUInteger containedCount = 0;
+
+    for ( NSUInteger i = 0; i < sortedLocations.count; i++ ) {
+        if ( [sortedLocations locationAtIndex:i isInRange:range] ) {
+            containedCount++;
+        }
+        XCTAssertTrue([sortedLocations locationAtIndex:i isInRange:nil], @"Location %lu without a range", (unsigned long)i);
+    }
+
+    XCTAssertEqual(containedCount, (NSUInteger)3, @"Locations in %@", range);
+}
+
+-(void)testSortedTickLocationsFollowTickLocations
+{
+    CPTXYAxis *axis = [[CPTXYAxis alloc] init];
+
+    axis.majorTickLocations = [NSSet setWithArray:@[@2.0, @1.0]];
+
+    XCTAssertEqual(axis.sortedMajorTickLocations.count, (NSUInteger)2, @"Location count");
+    XCTAssertEqual(axis.sortedMajorTickLocations.doubleValues[0], 1.0, @"First location");
+
+    axis.majorTickLocations = [NSSet setWithArray:@[@5.0, @4.0, @3.0]];
+
+    XCTAssertEqual(axis.sortedMajorTickLocations.count, (NSUInteger)3, @"Location count after update");
+    XCTAssertEqual(axis.sortedMajorTickLocations.doubleValues[0], 3.0, @"First location after update");
+}
+
+#pragma mark -
+#pragma mark Private Methods
+
+/** @brief Compares the double precision tick generator with the NSDecimal one.
+ *  @return @YES if the double precision generator handled the range.
+ **/
+-(BOOL)compareTicksInRange:(nonnull CPTPlotRange *)range numTicks:(NSUInteger)numTicks minorTicks:(NSUInteger)minorTicks
+{
+    CPTMutableNumberSet *majorLocations = [NSMutableSet set];
+    CPTMutableNumberSet *minorLocations = [NSMutableSet set];
+
+    if ( !CPTAutoLinearTickLocations(range, numTicks, minorTicks, majorLocations, minorLocations)) {
+        return NO;
+    }
+
+    CPTMutableNumberSet *decimalMajorLocations = [NSMutableSet set];
+    CPTMutableNumberSet *decimalMinorLocations = [NSMutableSet set];
+
+    CPTAutoLinearTickLocationsDecimal(range, numTicks, minorTicks, decimalMajorLocations, decimalMinorLocations);
+
+    XCTAssertEqualObjects([majorLocations.allObjects sortedArrayUsingSelector:@selector(compare:)],
+                          [decimalMajorLocations.allObjects sortedArrayUsingSelector:@selector(compare:)],
+                          @"Major ticks in %@ with %lu major and %lu minor ticks", range, (unsigned long)numTicks, (unsigned long)minorTicks);
+    XCTAssertEqualObjects([minorLocations.allObjects sortedArrayUsingSelector:@selector(compare:)],
+                          [decimalMinorLocations.allObjects sortedArrayUsingSelector:@selector(compare:)],
+                          @"Minor ticks in %@ with %lu major and %lu minor ticks", range, (unsigned long)numTicks, (unsigned long)minorTicks);
+
+    return YES;
+}
+
+@end
@@ -13,6 +13,8 @@
 #import "CPTUtilities.h"
 #import "CPTXYPlotSpace.h"
 #import "NSCoderExtensions.h"
+#import "_CPTRectIndex.h"
+#import "_CPTStyleBatches.h"
 #import <tgmath.h>
 
 /** @defgroup plotAnimationBarPlot Bar Plot
@@ -44,14 +46,21 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
 @property (nonatomic, readwrite, copy, nullable) CPTLineStyleArray *barLineStyles;
 @property (nonatomic, readwrite, copy, nullable) CPTLineStyleArray *barWidths;
 @property (nonatomic, readwrite, assign) NSUInteger pointingDeviceDownIndex;
+@property (nonatomic, readwrite, strong, nullable) _CPTRectIndex *barRectIndex;
+@property (nonatomic, readwrite, assign) CGRect barRectIndexBounds;
 
 -(BOOL)barAtRecordIndex:(NSUInteger)idx basePoint:(nonnull CGPoint *)basePoint tipPoint:(nonnull CGPoint *)tipPoint;
+-(void)calculateBasePoints:(nonnull CGPoint *)basePoints tipPoints:(nonnull CGPoint *)tipPoints indexRange:(NSRange)indexRange;
+-(NSRange)visibleBarIndexRangeForNumberOfBars:(NSUInteger)barCount;
 -(nullable CGMutablePathRef)newBarPathWithContext:(nullable CGContextRef)context recordIndex:(NSUInteger)recordIndex;
 -(nonnull CGMutablePathRef)newBarPathWithContext:(nullable CGContextRef)context basePoint:(CGPoint)basePoint tipPoint:(CGPoint)tipPoint width:(NSNumber *)width;
+-(void)addBarToPath:(nonnull CGMutablePathRef)path context:(nullable CGContextRef)context basePoint:(CGPoint)basePoint tipPoint:(CGPoint)tipPoint widthLength:(CGFloat)barWidthLength;
+-(CGRect)barRectWithBasePoint:(CGPoint)basePoint tipPoint:(CGPoint)tipPoint widthLength:(CGFloat)barWidthLength;
+-(nonnull _CPTRectIndex *)newBarRectIndex;
 -(nullable CPTFill *)barFillForIndex:(NSUInteger)idx;
 -(nullable CPTLineStyle *)barLineStyleForIndex:(NSUInteger)idx;
 -(nonnull NSNumber *)barWidthForIndex:(NSUInteger)idx;
--(void)drawBarInContext:(nonnull CGContextRef)context recordIndex:(NSUInteger)idx;
+-(void)drawBarInContext:(nonnull CGContextRef)context recordIndex:(NSUInteger)idx basePoint:(CGPoint)basePoint tipPoint:(CGPoint)tipPoint;
 
 -(CGFloat)lengthInView:(NSDecimal)plotLength;
 -(double)doubleLengthInPlotCoordinates:(NSDecimal)decimalLength;
@@ -60,6 +69,15 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
 
 @end
 
+@interface CPTPlot()
+
+// inherited private methods
+-(NSRange)indexRangeForSortedField:(NSUInteger)fieldEnum plotRange:(nonnull CPTPlotRange *)plotRange;
+
+@end
+
+static const NSUInteger kCPTBarPlotMaximumStyleBatches = 16; // distinct fill and line style pairs drawn as compound paths
+
 /// @endcond
 
 #pragma mark -
@@ -164,6 +182,18 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
  **/
 @synthesize pointingDeviceDownIndex;
 
+/** @internal
+ *  @property nullable _CPTRectIndex *barRectIndex
+ *  @brief The bounding rectangles of the bars used for hit testing. Discarded whenever the plot needs to be redrawn.
+ **/
+@synthesize barRectIndex;
+
+/** @internal
+ *  @property CGRect barRectIndexBounds
+ *  @brief The bounds of the plot when @ref barRectIndex was built.
+ **/
+@synthesize barRectIndexBounds;
+
 #pragma mark -
 #pragma mark Convenience Factory Methods
 
@@ -255,6 +285,8 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
         barBasesVary                  = NO;
         plotRange                     = nil;
         pointingDeviceDownIndex       = NSNotFound;
+        barRectIndex                  = nil;
+        barRectIndexBounds            = CGRectNull;
 
         self.labelOffset = CPTFloat(10.0);
         self.labelField  = CPTBarPlotFieldBarTip;
@@ -283,6 +315,8 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
         barsAreHorizontal             = theLayer->barsAreHorizontal;
         plotRange                     = theLayer->plotRange;
         pointingDeviceDownIndex       = NSNotFound;
+        barRectIndex                  = nil;
+        barRectIndexBounds            = CGRectNull;
     }
     return self;
 }
@@ -312,6 +346,8 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
 
     // No need to archive these properties:
     // pointingDeviceDownIndex
+    // barRectIndex
+    // barRectIndexBounds
 }
 
 -(nullable instancetype)initWithCoder:(nonnull NSCoder *)coder
@@ -340,6 +376,8 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
         plotRange                     = [[coder decodeObjectOfClass:[CPTPlotRange class]
                                                              forKey:@"CPTBarPlot.plotRange"] copy];
         pointingDeviceDownIndex = NSNotFound;
+        barRectIndex            = nil;
+        barRectIndexBounds      = CGRectNull;
     }
     return self;
 }
@@ -412,7 +450,7 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
         if ( self.plotRange ) {
             // Spread bars evenly over the plot range
             CPTMutableNumericData *locationData = nil;
-            if ( self.doublePrecisionCache ) {
+            if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
                 locationData = [[CPTMutableNumericData alloc] initWithData:[NSData data]
                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), CFByteOrderGetCurrent())
                                                                      shape:nil];
@@ -460,7 +498,7 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
         else {
             // Make evenly spaced locations starting at zero
             CPTMutableNumericData *locationData = nil;
-            if ( self.doublePrecisionCache ) {
+            if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
                 locationData = [[CPTMutableNumericData alloc] initWithData:[NSData data]
                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), CFByteOrderGetCurrent())
                                                                      shape:nil];
@@ -903,14 +941,244 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
 
     [super renderAsVectorInContext:context];
 
+    // Skip the bars outside of the plot area
+    NSRange barRange = [self visibleBarIndexRangeForNumberOfBars:barCount];
+    if ( barRange.length == 0 ) {
+        return;
+    }
+
+    CGPoint *basePoints = calloc(barRange.length, sizeof(CGPoint));
+    CGPoint *tipPoints  = calloc(barRange.length, sizeof(CGPoint));
+
+    [self calculateBasePoints:basePoints tipPoints:tipPoints indexRange:barRange];
+
+    BOOL horizontalBars = self.barsAreHorizontal;
+    CGRect plotBounds   = self.plotArea.bounds;
+    CGFloat lowerBound  = (horizontalBars ? CGRectGetMinY(plotBounds) : CGRectGetMinX(plotBounds));
+    CGFloat upperBound  = (horizontalBars ? CGRectGetMaxY(plotBounds) : CGRectGetMaxX(plotBounds));
+
+    NSNumber *defaultWidth     = self.barWidth;
+    CGFloat defaultWidthLength = [self lengthInView:defaultWidth.decimalValue];
+    BOOL hasBarWidths          = ([self cachedArrayForKey:CPTBarPlotBindingBarWidths] != nil);
+
+    // Bars with the same solid fill and line style are collected into one path and drawn together.
+    // The batches are flushed before a bar that would overlap them so the bars stack in record order.
+    _CPTStyleBatches *batches = [[_CPTStyleBatches alloc] initWithMaximumBatchCount:kCPTBarPlotMaximumStyleBatches];
+
     CGContextBeginTransparencyLayer(context, NULL);
 
-    for ( NSUInteger ii = 0; ii < barCount; ii++ ) {
-        // Draw
-        [self drawBarInContext:context recordIndex:ii];
+    for ( NSUInteger j = 0; j < barRange.length; j++ ) {
+        NSUInteger ii     = barRange.location + j;
+        CGPoint basePoint = basePoints[j];
+        CGPoint tipPoint  = tipPoints[j];
+
+        // Skip bars with missing values
+        if ( isnan(basePoint.x) || isnan(tipPoint.x)) {
+            continue;
+        }
+
+        CGFloat widthLength = defaultWidthLength;
+        if ( hasBarWidths ) {
+            NSNumber *width = [self barWidthForIndex:ii];
+            if ( width != defaultWidth ) {
+                widthLength = [self lengthInView:width.decimalValue];
+            }
+        }
+
+        // Skip bars that are off screen
+        CGFloat base         = (horizontalBars ? basePoint.y : basePoint.x);
+        CGFloat halfBarWidth = CPTFloat(0.5) * ABS(widthLength);
+        if ((base + halfBarWidth < lowerBound) || (base - halfBarWidth > upperBound)) {
+            continue;
+        }
+
+        CPTFill *theBarFill = [self barFillForIndex:ii];
+        if ( ![theBarFill isKindOfClass:[CPTFill class]] ) {
+            theBarFill = nil;
+        }
+
+        CPTLineStyle *theLineStyle = [self barLineStyleForIndex:ii];
+        if ( ![theLineStyle isKindOfClass:[CPTLineStyle class]] ) {
+            theLineStyle = nil;
+        }
+
+        if ( !theBarFill && !theLineStyle ) {
+            continue;
+        }
+
+        // The bar covers its width plus half of the outline on either side
+        CGFloat halfLineWidth = (theLineStyle ? CPTFloat(0.5) * theLineStyle.lineWidth : CPTFloat(0.0));
+        CGFloat minExtent     = base - halfBarWidth - halfLineWidth;
+        CGFloat maxExtent     = base + halfBarWidth + halfLineWidth;
+
+        if ( [batches shapeOverlapsBatchesFrom:minExtent to:maxExtent] ) {
+            [batches flushInContext:context];
+        }
+
+        NSUInteger batch = [batches batchIndexForFill:theBarFill lineStyle:theLineStyle];
+
+        if ((batch == NSNotFound) && (batches.batchCount > 0)) {
+            // Make room for another style, or draw the earlier bars before this one
+            [batches flushInContext:context];
+            batch = [batches batchIndexForFill:theBarFill lineStyle:theLineStyle];
+        }
+
+        if ( batch != NSNotFound ) {
+            [batches addShapeExtentFrom:minExtent to:maxExtent];
+            [self addBarToPath:[batches sharedPathForBatchAtIndex:batch]
+                       context:context
+                     basePoint:basePoint
+                      tipPoint:tipPoint
+                   widthLength:widthLength];
+        }
+        else {
+            // Fills and line styles that depend on the bounds of the bar are drawn one bar at a time
+            [self drawBarInContext:context recordIndex:ii basePoint:basePoint tipPoint:tipPoint];
+        }
     }
 
+    [batches flushInContext:context];
+
     CGContextEndTransparencyLayer(context);
+
+    free(basePoints);
+    free(tipPoints);
+}
+
+/** @internal
+ *  @brief Finds the bars that can be inside the plot area.
+ *
+ *  When the bar locations are sorted and all bars have the same width, the edges of the plot area, widened by
+ *  half of the bar width and shifted by the bar offset, are converted to location values and the bars between
+ *  them are found with a binary search. Otherwise, every bar is returned and each is tested when drawn.
+ *
+ *  @param barCount The number of bars.
+ *  @return The range of bar indices.
+ **/
+-(NSRange)visibleBarIndexRangeForNumberOfBars:(NSUInteger)barCount
+{
+    NSRange allBars = NSMakeRange(0, barCount);
+
+    CPTPlotArea *thePlotArea   = self.plotArea;
+    CPTPlotSpace *thePlotSpace = self.plotSpace;
+
+    if ((barCount == 0) || !thePlotArea || !thePlotSpace || [self cachedArrayForKey:CPTBarPlotBindingBarWidths] ) {
+        return allBars;
+    }
+
+    BOOL horizontalBars            = self.barsAreHorizontal;
+    CPTCoordinate independentCoord = (horizontalBars ? CPTCoordinateY : CPTCoordinateX);
+    CGRect plotBounds              = thePlotArea.bounds;
+
+    // widen by a pixel to allow for rounding
+    CGFloat halfBarWidth    = CPTFloat(0.5) * ABS([self lengthInView:self.barWidth.decimalValue]) + CPTFloat(1.0);
+    CGFloat barOffsetLength = [self lengthInView:self.barOffset.decimalValue];
+
+    CGPoint lowerViewPoint, upperViewPoint;
+
+    if ( horizontalBars ) {
+        lowerViewPoint = CPTPointMake(CGRectGetMidX(plotBounds), CGRectGetMinY(plotBounds) - barOffsetLength - halfBarWidth);
+        upperViewPoint = CPTPointMake(CGRectGetMidX(plotBounds), CGRectGetMaxY(plotBounds) - barOffsetLength + halfBarWidth);
+    }
+    else {
+        lowerViewPoint = CPTPointMake(CGRectGetMinX(plotBounds) - barOffsetLength - halfBarWidth, CGRectGetMidY(plotBounds));
+        upperViewPoint = CPTPointMake(CGRectGetMaxX(plotBounds) - barOffsetLength + halfBarWidth, CGRectGetMidY(plotBounds));
+    }
+
+    double lowerPlotPoint[2], upperPlotPoint[2];
+
+    [thePlotSpace doublePrecisionPlotPoint:lowerPlotPoint numberOfCoordinates:2 forPlotAreaViewPoint:lowerViewPoint];
+    [thePlotSpace doublePrecisionPlotPoint:upperPlotPoint numberOfCoordinates:2 forPlotAreaViewPoint:upperViewPoint];
+
+    // the axis may be reversed
+    double minValue = MIN(lowerPlotPoint[independentCoord], upperPlotPoint[independentCoord]);
+    double maxValue = MAX(lowerPlotPoint[independentCoord], upperPlotPoint[independentCoord]);
+
+    if ( isnan(minValue) || isnan(maxValue)) {
+        return allBars;
+    }
+
+    CPTPlotRange *locationRange = [CPTPlotRange plotRangeWithLocation:@(minValue) length:@(maxValue - minValue)];
+    NSRange barRange            = [self indexRangeForSortedField:CPTBarPlotFieldBarLocation plotRange:locationRange];
+
+    return (barRange.location == NSNotFound) ? allBars : barRange;
+}
+
+/** @internal
+ *  @brief Calculates the base and tip points of a range of bars.
+ *
+ *  When the cache holds @double or @float values, all of the points are converted to view coordinates at once
+ *  with the batch conversion methods of the plot space.
+ *
+ *  @param basePoints Returns the base point of each bar, or @NAN coordinates if the bar has a missing value.
+ *  @param tipPoints Returns the tip point of each bar, or @NAN coordinates if the bar has a missing value.
+ *  @param indexRange The range of bars. The first bar in the range is stored at the start of each array.
+ **/
+-(void)calculateBasePoints:(nonnull CGPoint *)basePoints tipPoints:(nonnull CGPoint *)tipPoints indexRange:(NSRange)indexRange
+{
+    NSUInteger barCount = indexRange.length;
+
+    if ( !self.doublePrecisionCache && !self.floatPrecisionCache ) {
+        for ( NSUInteger i = 0; i < barCount; i++ ) {
+            if ( ![self barAtRecordIndex:indexRange.location + i basePoint:&basePoints[i] tipPoint:&tipPoints[i]] ) {
+                basePoints[i] = CPTPointMake(NAN, NAN);
+                tipPoints[i]  = CPTPointMake(NAN, NAN);
+            }
+        }
+        return;
+    }
+
+    BOOL horizontalBars          = self.barsAreHorizontal;
+    CPTXYPlotSpace *thePlotSpace = (CPTXYPlotSpace *)self.plotSpace;
+
+    NSRange barRange = indexRange;
+
+    const double *locations = (const double *)[self cachedDoublesForField:CPTBarPlotFieldBarLocation recordIndexRange:barRange].bytes;
+    const double *tips      = (const double *)[self cachedDoublesForField:CPTBarPlotFieldBarTip recordIndexRange:barRange].bytes;
+    const double *bases     = NULL;
+    double *constantBases   = NULL;
+
+    if ( self.barBasesVary ) {
+        bases = (const double *)[self cachedDoublesForField:CPTBarPlotFieldBarBase recordIndexRange:barRange].bytes;
+    }
+    else {
+        double baseDouble = self.baseValue.doubleValue;
+
+        constantBases = malloc(barCount * sizeof(double));
+        for ( NSUInteger i = 0; i < barCount; i++ ) {
+            constantBases[i] = baseDouble;
+        }
+        bases = constantBases;
+    }
+
+    if ( horizontalBars ) {
+        [thePlotSpace plotAreaViewPoints:tipPoints forDoublePrecisionXValues:tips yValues:locations numberOfPoints:barCount];
+        [thePlotSpace plotAreaViewPoints:basePoints forDoublePrecisionXValues:bases yValues:locations numberOfPoints:barCount];
+    }
+    else {
+        [thePlotSpace plotAreaViewPoints:tipPoints forDoublePrecisionXValues:locations yValues:tips numberOfPoints:barCount];
+        [thePlotSpace plotAreaViewPoints:basePoints forDoublePrecisionXValues:locations yValues:bases numberOfPoints:barCount];
+    }
+
+    // Offset
+    CGFloat barOffsetLength = [self lengthInView:self.barOffset.decimalValue];
+
+    for ( NSUInteger i = 0; i < barCount; i++ ) {
+        if ( isnan(locations[i]) || isnan(tips[i]) || isnan(bases[i])) {
+            basePoints[i] = CPTPointMake(NAN, NAN);
+            tipPoints[i]  = CPTPointMake(NAN, NAN);
+        }
+        else if ( horizontalBars ) {
+            basePoints[i].y += barOffsetLength;
+            tipPoints[i].y  += barOffsetLength;
+        }
+        else {
+            basePoints[i].x += barOffsetLength;
+            tipPoints[i].x  += barOffsetLength;
+        }
+    }
+
+    free(constantBases);
 }
 
 -(BOOL)barAtRecordIndex:(NSUInteger)idx basePoint:(nonnull CGPoint *)basePoint tipPoint:(nonnull CGPoint *)tipPoint
@@ -921,7 +1189,7 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
 
     CPTPlotSpace *thePlotSpace = self.plotSpace;
 
-    if ( self.doublePrecisionCache ) {
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
         double plotPoint[2];
         plotPoint[independentCoord] = [self cachedDoubleForField:CPTBarPlotFieldBarLocation recordIndex:idx];
         if ( isnan(plotPoint[independentCoord])) {
@@ -1014,19 +1282,32 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
 {
     // This function is used to create a path which is used for both
     // drawing a bar and for doing hit-testing on a click/touch event
-    BOOL horizontalBars = self.barsAreHorizontal;
+    CGMutablePathRef path = CGPathCreateMutable();
 
-    CGFloat barWidthLength = [self lengthInView:width.decimalValue];
-    CGFloat halfBarWidth   = CPTFloat(0.5) * barWidthLength;
+    [self addBarToPath:path
+               context:context
+             basePoint:basePoint
+              tipPoint:tipPoint
+           widthLength:[self lengthInView:width.decimalValue]];
 
-    CGRect barRect;
+    return path;
+}
 
-    if ( horizontalBars ) {
-        barRect = CPTRectMake(basePoint.x, basePoint.y - halfBarWidth, tipPoint.x - basePoint.x, barWidthLength);
-    }
-    else {
-        barRect = CPTRectMake(basePoint.x - halfBarWidth, basePoint.y, barWidthLength, tipPoint.y - basePoint.y);
-    }
+/** @internal
+ *  @brief Adds the outline of a bar to a path.
+ *  @param path The path.
+ *  @param context The graphics context used to align the bar to device pixels, or @NULL when hit testing.
+ *  @param basePoint The base point of the bar.
+ *  @param tipPoint The tip point of the bar.
+ *  @param barWidthLength The width of the bar in view coordinates.
+ **/
+-(void)addBarToPath:(nonnull CGMutablePathRef)path context:(nullable CGContextRef)context basePoint:(CGPoint)basePoint tipPoint:(CGPoint)tipPoint widthLength:(CGFloat)barWidthLength
+{
+    BOOL horizontalBars = self.barsAreHorizontal;
+
+    CGRect barRect = [self barRectWithBasePoint:basePoint
+                                       tipPoint:tipPoint
+                                    widthLength:barWidthLength];
 
     int widthNegative  = signbit(barRect.size.width);
     int heightNegative = signbit(barRect.size.height);
@@ -1065,7 +1346,6 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
         barRect.size.height = -barRect.size.height;
     }
 
-    CGMutablePathRef path = CGPathCreateMutable();
     if ( radius == CPTFloat(0.0)) {
         if ( baseRadius == CPTFloat(0.0)) {
             // square corners
@@ -1129,8 +1409,25 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
             CGPathCloseSubpath(path);
         }
     }
+}
 
-    return path;
+/** @internal
+ *  @brief Computes the rectangle covered by a bar before it is aligned to device pixels.
+ *  @param basePoint The base point of the bar.
+ *  @param tipPoint The tip point of the bar.
+ *  @param barWidthLength The width of the bar in view coordinates.
+ *  @return The bar rectangle. The width or height is negative if the tip is left of or below the base.
+ **/
+-(CGRect)barRectWithBasePoint:(CGPoint)basePoint tipPoint:(CGPoint)tipPoint widthLength:(CGFloat)barWidthLength
+{
+    CGFloat halfBarWidth = CPTFloat(0.5) * barWidthLength;
+
+    if ( self.barsAreHorizontal ) {
+        return CPTRectMake(basePoint.x, basePoint.y - halfBarWidth, tipPoint.x - basePoint.x, barWidthLength);
+    }
+    else {
+        return CPTRectMake(basePoint.x - halfBarWidth, basePoint.y, barWidthLength, tipPoint.y - basePoint.y);
+    }
 }
 
 -(BOOL)barIsVisibleWithBasePoint:(CGPoint)basePoint width:(NSNumber *)width
@@ -1181,13 +1478,10 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
     return theBarWidth;
 }
 
--(void)drawBarInContext:(nonnull CGContextRef)context recordIndex:(NSUInteger)idx
+-(void)drawBarInContext:(nonnull CGContextRef)context recordIndex:(NSUInteger)idx basePoint:(CGPoint)basePoint tipPoint:(CGPoint)tipPoint
 {
-    // Get base and tip points
-    CGPoint basePoint, tipPoint;
-    BOOL barExists = [self barAtRecordIndex:idx basePoint:&basePoint tipPoint:&tipPoint];
-
-    if ( !barExists ) {
+    // Skip bars with missing values
+    if ( isnan(basePoint.x) || isnan(tipPoint.x)) {
         return;
     }
 
@@ -1312,7 +1606,7 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
     }
 
     NSNumber *offsetLocation;
-    if ( self.doublePrecisionCache ) {
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
         offsetLocation = @(location.doubleValue + [self doubleLengthInPlotCoordinates:self.barOffset.decimalValue]);
     }
     else {
@@ -1423,23 +1717,88 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
 
 -(NSUInteger)dataIndexFromInteractionPoint:(CGPoint)point
 {
-    NSUInteger idx      = NSNotFound;
+    _CPTRectIndex *rectIndex = self.barRectIndex;
+    CGRect plotBounds        = self.bounds;
+
+    if ( !rectIndex || !CGRectEqualToRect(plotBounds, self.barRectIndexBounds)) {
+        rectIndex               = [self newBarRectIndex];
+        self.barRectIndex       = rectIndex;
+        self.barRectIndexBounds = plotBounds;
+    }
+
+    // only bars with rounded corners need an exact test of the bar path
+    CPTRectIndexTestBlock pathTest = nil;
+
+    if ((self.barCornerRadius > CPTFloat(0.0)) || (self.barBaseCornerRadius > CPTFloat(0.0))) {
+        pathTest = ^BOOL (NSUInteger idx) {
+            CGMutablePathRef path = [self newBarPathWithContext:NULL recordIndex:idx];
+            BOOL containsPoint    = NO;
+
+            if ( path ) {
+                containsPoint = CGPathContainsPoint(path, NULL, point, false);
+                CGPathRelease(path);
+            }
+
+            return containsPoint;
+        };
+    }
+
+    return [rectIndex firstIndexOfRectContainingPoint:point passingTest:pathTest];
+}
+
+/** @internal
+ *  @brief Builds a sorted index of the bar rectangles for hit testing.
+ *
+ *  The base and tip points of all bars are calculated together and bars with missing values are left out.
+ *  The rectangles are sorted along the independent axis, where the bars normally do not overlap, so a hit test
+ *  takes logarithmic time instead of testing the path of every bar.
+ *
+ *  @return A new rectangle index.
+ **/
+-(nonnull _CPTRectIndex *)newBarRectIndex
+{
     NSUInteger barCount = self.cachedDataCount;
-    NSUInteger ii       = 0;
 
-    while ((ii < barCount) && (idx == NSNotFound)) {
-        CGMutablePathRef path = [self newBarPathWithContext:NULL recordIndex:ii];
+    if ( barCount == 0 ) {
+        return [[_CPTRectIndex alloc] init];
+    }
+
+    CGPoint *basePoints = calloc(barCount, sizeof(CGPoint));
+    CGPoint *tipPoints  = calloc(barCount, sizeof(CGPoint));
+    CGRect *barRects    = calloc(barCount, sizeof(CGRect));
+
+    [self calculateBasePoints:basePoints tipPoints:tipPoints indexRange:NSMakeRange(0, barCount)];
 
-        if ( CGPathContainsPoint(path, NULL, point, false)) {
-            idx = ii;
+    NSNumber *defaultWidth     = self.barWidth;
+    CGFloat defaultWidthLength = [self lengthInView:defaultWidth.decimalValue];
+    BOOL hasBarWidths          = ([self cachedArrayForKey:CPTBarPlotBindingBarWidths] != nil);
+
+    for ( NSUInteger i = 0; i < barCount; i++ ) {
+        if ( isnan(basePoints[i].x) || isnan(basePoints[i].y) || isnan(tipPoints[i].x) || isnan(tipPoints[i].y)) {
+            barRects[i] = CGRectNull;
+            continue;
         }
 
-        CGPathRelease(path);
+        CGFloat widthLength = defaultWidthLength;
+        if ( hasBarWidths ) {
+            NSNumber *width = [self barWidthForIndex:i];
+            if ( width != defaultWidth ) {
+                widthLength = [self lengthInView:width.decimalValue];
+            }
+        }
 
-        ii++;
+        barRects[i] = [self barRectWithBasePoint:basePoints[i] tipPoint:tipPoints[i] widthLength:widthLength];
     }
 
-    return idx;
+    _CPTRectIndex *rectIndex = [[_CPTRectIndex alloc] initWithRects:barRects
+                                                              count:barCount
+                                                          sortedByX:!self.barsAreHorizontal];
+
+    free(basePoints);
+    free(tipPoints);
+    free(barRects);
+
+    return rectIndex;
 }
 
 /// @endcond
@@ -1663,6 +2022,22 @@ CPTBarPlotBinding const CPTBarPlotBindingBarWidths     = @"barWidths";     ///<
     }
 }
 
+-(void)setNeedsDisplay
+{
+    [super setNeedsDisplay];
+
+    // the bars may have moved
+    self.barRectIndex = nil;
+}
+
+-(void)setBarWidthsAreInViewCoordinates:(BOOL)newBarWidthsAreInViewCoordinates
+{
+    if ( barWidthsAreInViewCoordinates != newBarWidthsAreInViewCoordinates ) {
+        barWidthsAreInViewCoordinates = newBarWidthsAreInViewCoordinates;
+        [self setNeedsDisplay];
+    }
+}
+
 -(void)setBarWidth:(nonnull NSNumber *)newBarWidth
 {
     if ( ![barWidth isEqualToNumber:newBarWidth] ) {
@@ -0,0 +1,11 @@
+#import "CPTBarPlot.h"
+#import "CPTTestCase.h"
+
+@class CPTXYGraph;
+
+@interface CPTBarPlotTests : CPTTestCase<CPTBarPlotDataSource>
+
+@property (nonatomic, readwrite, strong, nullable) CPTXYGraph *graph;
+@property (nonatomic, readwrite, strong, nullable) CPTBarPlot *plot;
+
+@end
@@ -0,0 +1,227 @@
+#import "CPTBarPlotTests.h"
+
+#import "CPTColor.h"
+#import "CPTFill.h"
+#import "CPTPlotRange.h"
+#import "CPTUtilities.h"
+#import "CPTXYGraph.h"
+#import "CPTXYPlotSpace.h"
+
+// location, tip, and width of each bar in plot coordinates
+static const double barData[][3] = {
+    { 2.0, 5.0, 2.0 },
+    { 3.0, 8.0, 2.0 },        // overlaps the first bar
+    { 7.0, 6.0, -2.0 },       // negative width
+    { 9.0, (double)NAN, 2.0 }, // missing tip
+    { 3.5, 3.0, 1.0 }         // overlaps the second bar
+};
+
+@interface CPTBarPlot(Testing)
+
+-(NSRange)visibleBarIndexRangeForNumberOfBars:(NSUInteger)barCount;
+-(void)setBarLocations:(nullable CPTNumberArray *)newLocations;
+-(void)setBarTips:(nullable CPTNumberArray *)newTips;
+
+@end
+
+@implementation CPTBarPlotTests
+
+@synthesize graph;
+@synthesize plot;
+
+-(void)setUp
+{
+    self.graph = [[CPTXYGraph alloc] initWithFrame:CPTRectMake(0.0, 0.0, 100.0, 100.0)];
+
+    self.graph.paddingLeft   = 0.0;
+    self.graph.paddingRight  = 0.0;
+    self.graph.paddingTop    = 0.0;
+    self.graph.paddingBottom = 0.0;
+
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)self.graph.defaultPlotSpace;
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@10.0];
+    plotSpace.yRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@10.0];
+
+    self.plot = [[CPTBarPlot alloc] init];
+
+    self.plot.cachePrecision = CPTPlotCachePrecisionDouble;
+    self.plot.dataSource     = self;
+    [self.graph addPlot:self.plot];
+
+    [self.graph layoutIfNeeded];
+    [self.plot reloadDataIfNeeded];
+}
+
+-(void)tearDown
+{
+    self.plot  = nil;
+    self.graph = nil;
+}
+
+#pragma mark -
+#pragma mark Hit testing
+
+-(void)testDataIndexFromInteractionPointFindsOverlappingBars
+{
+    CPTBarPlot *barPlot = self.plot;
+
+    // ten view units per plot unit
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(25.0, 20.0)], (NSUInteger)0, @"Lowest index of overlapping bars");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(15.0, 20.0)], (NSUInteger)0, @"First bar only");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(25.0, 70.0)], (NSUInteger)1, @"Above the tip of the first bar");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(35.0, 20.0)], (NSUInteger)1, @"Lowest index of the second and last bars");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(50.0, 10.0)], (NSUInteger)NSNotFound, @"Between bars");
+}
+
+-(void)testDataIndexFromInteractionPointFindsNegativeWidthBars
+{
+    CPTBarPlot *barPlot = self.plot;
+
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(65.0, 30.0)], (NSUInteger)2, @"Left half of a negative width bar");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(75.0, 30.0)], (NSUInteger)2, @"Right half of a negative width bar");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(75.0, 70.0)], (NSUInteger)NSNotFound, @"Above a negative width bar");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(90.0, 5.0)], (NSUInteger)NSNotFound, @"Bar with a missing tip");
+
+    // horizontal bars swap the roles of the axes
+    barPlot.barsAreHorizontal = YES;
+
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(30.0, 65.0)], (NSUInteger)2, @"Horizontal negative width bar");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(20.0, 25.0)], (NSUInteger)0, @"Horizontal overlapping bars");
+    XCTAssertEqual([barPlot dataIndexFromInteractionPoint:CPTPointMake(65.0, 30.0)], (NSUInteger)1, @"Horizontal bar past the tip of the first bar");
+}
+
+#pragma mark -
+#pragma mark Drawing
+
+-(void)testBarsAreDrawnInRecordOrder
+{
+    const size_t width  = 100;
+    const size_t height = 100;
+
+    size_t bytesPerRow = 4 * width;
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context       = CGBitmapContextCreate(NULL, width, height, 8, bytesPerRow, colorSpace, (CGBitmapInfo)kCGImageAlphaPremultipliedLast);
+
+    CPTBarPlot *barPlot = self.plot;
+
+    barPlot.fill      = [CPTFill fillWithColor:[CPTColor redColor]];
+    barPlot.lineStyle = nil;
+    [barPlot renderAsVectorInContext:context];
+
+    const uint8_t *pixels = (const uint8_t *)CGBitmapContextGetData(context);
+
+    // the last bar is red and drawn over the blue second bar even though the first bar is also red
+    const uint8_t *pixel = pixels + (height - 1 - 15) * bytesPerRow + 4 * 35;
+
+    XCTAssertGreaterThan(pixel[0], 200, @"Later bar on top");
+    XCTAssertLessThan(pixel[2], 50, @"Later bar on top");
+
+    // the blue second bar is drawn over the first bar
+    pixel = pixels + (height - 1 - 20) * bytesPerRow + 4 * 25;
+
+    XCTAssertLessThan(pixel[0], 50, @"Second bar on top of the first");
+    XCTAssertGreaterThan(pixel[2], 200, @"Second bar on top of the first");
+
+    CGContextRelease(context);
+    CGColorSpaceRelease(colorSpace);
+}
+
+#pragma mark -
+#pragma mark Culling
+
+-(void)testVisibleBarIndexRange
+{
+    CPTBarPlot *barPlot = [[CPTBarPlot alloc] init];
+
+    [self.graph addPlot:barPlot];
+    [self.graph layoutIfNeeded];
+    [barPlot reloadDataIfNeeded];
+
+    CPTMutableNumberArray *locations = [NSMutableArray arrayWithCapacity:20];
+    CPTMutableNumberArray *tips      = [NSMutableArray arrayWithCapacity:20];
+
+    for ( NSUInteger i = 0; i < 20; i++ ) {
+        [locations addObject:@(i)];
+        [tips addObject:@1.0];
+    }
+
+    barPlot.cachePrecision = CPTPlotCachePrecisionDouble;
+    barPlot.barWidth       = @0.5;
+    [barPlot setBarLocations:locations];
+    [barPlot setBarTips:tips];
+
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)self.graph.defaultPlotSpace;
+
+    // the plot area is widened by half of the bar width
+    NSRange barRange = [barPlot visibleBarIndexRangeForNumberOfBars:20];
+
+    XCTAssertEqual(barRange.location, (NSUInteger)0, @"Location of visible bars");
+    XCTAssertEqual(barRange.length, (NSUInteger)11, @"Number of visible bars");
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@5.5 length:@10.0];
+    barRange         = [barPlot visibleBarIndexRangeForNumberOfBars:20];
+
+    XCTAssertEqual(barRange.location, (NSUInteger)6, @"Location of scrolled visible bars");
+    XCTAssertEqual(barRange.length, (NSUInteger)10, @"Number of scrolled visible bars");
+
+    // reversed axis
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@15.5 length:@(-10.0)];
+    barRange         = [barPlot visibleBarIndexRangeForNumberOfBars:20];
+
+    XCTAssertEqual(barRange.location, (NSUInteger)6, @"Location of visible bars on a reversed axis");
+    XCTAssertEqual(barRange.length, (NSUInteger)10, @"Number of visible bars on a reversed axis");
+
+    // unsorted locations are tested one bar at a time
+    [locations exchangeObjectAtIndex:3 withObjectAtIndex:15];
+    [barPlot setBarLocations:locations];
+    barRange = [barPlot visibleBarIndexRangeForNumberOfBars:20];
+
+    XCTAssertEqual(barRange.location, (NSUInteger)0, @"Location of unsorted bars");
+    XCTAssertEqual(barRange.length, (NSUInteger)20, @"Number of unsorted bars");
+}
+
+-(void)testVisibleBarIndexRangeWithBarWidths
+{
+    // the data source supplies a width for each bar, so the bars cannot be culled by location
+    NSRange barRange = [self.plot visibleBarIndexRangeForNumberOfBars:self.plot.cachedDataCount];
+
+    XCTAssertEqual(barRange.location, (NSUInteger)0, @"Location of bars with widths");
+    XCTAssertEqual(barRange.length, self.plot.cachedDataCount, @"Number of bars with widths");
+}
+
+#pragma mark -
+#pragma mark Plot Data Source Methods
+
+-(NSUInteger)numberOfRecordsForPlot:(nonnull CPTPlot *__unused)thePlot
+{
+    return sizeof(barData) / sizeof(barData[0]);
+}
+
+-(nullable id)numberForPlot:(nonnull CPTPlot *__unused)thePlot field:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx
+{
+    switch ( fieldEnum ) {
+        case CPTBarPlotFieldBarLocation:
+            return @(barData[idx][0]);
+
+        case CPTBarPlotFieldBarTip:
+            return @(barData[idx][1]);
+
+        default:
+            return nil;
+    }
+}
+
+-(nullable NSNumber *)barWidthForBarPlot:(nonnull CPTBarPlot *__unused)barPlot recordIndex:(NSUInteger)idx
+{
+    return @(barData[idx][2]);
+}
+
+-(nullable CPTFill *)barFillForBarPlot:(nonnull CPTBarPlot *__unused)barPlot recordIndex:(NSUInteger)idx
+{
+    // the other bars share the fill of the plot
+    return (idx == 1) ? [CPTFill fillWithColor:[CPTColor blueColor]] : nil;
+}
+
+@end
@@ -733,6 +733,7 @@ CPTGraphPlotSpaceKey const CPTGraphPlotSpaceNotificationKey       = @"CPTGraphPl
     }
     for ( CPTPlot *plot in self.plots ) {
         if ( plot.plotSpace == plotSpace ) {
+            [plot setNeedsLabelWindowUpdate];
             [plot setNeedsDisplay];
         }
     }
@@ -13,10 +13,21 @@
 @property (nonatomic, readwrite, copy, nonnull) CPTNumberArray *shape;
 /// @}
 
+/// @name Rolling Window
+/// @{
+@property (nonatomic, readwrite, assign) NSUInteger capacity;
+/// @}
+
 /// @name Samples
 /// @{
 -(nullable void *)mutableSamplePointer:(NSUInteger)sample NS_RETURNS_INNER_POINTER;
 -(nullable void *)mutableSamplePointerAtIndex:(NSUInteger)idx, ... NS_RETURNS_INNER_POINTER;
 /// @}
 
+/// @name Inserting and Removing Samples
+/// @{
+-(void)insertSamplesAtIndex:(NSUInteger)idx numberOfSamples:(NSUInteger)sampleCount;
+-(void)removeSamplesInRange:(NSRange)indexRange;
+/// @}
+
 @end
@@ -3,8 +3,13 @@
 /// @cond
 @interface CPTNumericData()
 
-// inherited private method
+// inherited private properties and methods
+@property (nonatomic, readwrite, strong, nonnull) NSData *dataBuffer;
+@property (nonatomic, readwrite, assign) NSUInteger startOffset;
+
 -(NSUInteger)sampleIndex:(NSUInteger)idx indexList:(va_list)indexList;
+-(void)compactDataBuffer;
+-(void)unshareData;
 
 @end
 
@@ -21,6 +26,9 @@
  *  which can be more than one byte in size, is referred to as a @quote{sample}.
  *  The structure of this object is similar to the NumPy <code>ndarray</code>
  *  object.
+ *
+ *  A mutable copy of an immutable CPTNumericData object shares the original data buffer
+ *  until the copy is first changed, so copying large arrays is inexpensive.
  **/
 @implementation CPTMutableNumericData
 
@@ -39,6 +47,18 @@
  **/
 @dynamic shape;
 
+/** @property NSUInteger capacity
+ *  @brief The number of samples expected to be held in a rolling window of data.
+ *
+ *  When non-zero, removing samples from the start of the buffer with
+ *  @link CPTMutableNumericData::removeSamplesInRange: -removeSamplesInRange: @endlink
+ *  does not move the remaining samples. The unused space is reclaimed once it grows
+ *  larger than both the capacity and the number of samples in use, so appending new samples
+ *  to the end and removing old ones from the start takes constant amortized time.
+ *  If zero (the default), the remaining samples are moved immediately.
+ **/
+@synthesize capacity;
+
 #pragma mark -
 #pragma mark Samples
 
@@ -80,14 +100,116 @@
     return [self mutableSamplePointer:newIndex];
 }
 
+#pragma mark -
+#pragma mark Inserting and Removing Samples
+
+/** @brief Inserts new samples into a one-dimensional data buffer.
+ *
+ *  The new samples are filled with zeros. Appending samples to the end of the buffer
+ *  and inserting samples at the start when there is unused space left over from
+ *  earlier removals do not move any existing samples.
+ *  @param idx The zero-based index of the first new sample.
+ *  @param sampleCount The number of samples to insert.
+ **/
+-(void)insertSamplesAtIndex:(NSUInteger)idx numberOfSamples:(NSUInteger)sampleCount
+{
+    NSParameterAssert(self.numberOfDimensions <= 1);
+    NSParameterAssert(idx <= self.numberOfSamples);
+
+    if ( sampleCount == 0 ) {
+        return;
+    }
+
+    [self unshareData];
+
+    NSUInteger oldCount    = self.numberOfSamples;
+    size_t sampleSize      = self.sampleBytes;
+    NSUInteger insertBytes = sampleCount * sampleSize;
+    NSUInteger offset      = self.startOffset;
+
+    if ((idx == 0) && (offset >= insertBytes)) {
+        self.startOffset = offset - insertBytes;
+        memset(self.mutableBytes, 0, insertBytes);
+    }
+    else {
+        NSMutableData *dataBuffer = (NSMutableData *)self.dataBuffer;
+        [dataBuffer increaseLengthBy:insertBytes];
+
+        int8_t *start = (int8_t *)self.mutableBytes + idx * sampleSize;
+        if ( idx < oldCount ) {
+            memmove(start + insertBytes, start, (oldCount - idx) * sampleSize);
+            memset(start, 0, insertBytes);
+        }
+    }
+
+    self.shape = @[@(oldCount + sampleCount)];
+}
+
+/** @brief Removes samples from a one-dimensional data buffer.
+ *
+ *  If the @ref capacity is non-zero, samples removed from the start of the buffer
+ *  are dropped without moving the remaining samples.
+ *  @param indexRange The range of samples to remove.
+ **/
+-(void)removeSamplesInRange:(NSRange)indexRange
+{
+    NSParameterAssert(self.numberOfDimensions <= 1);
+    NSParameterAssert(NSMaxRange(indexRange) <= self.numberOfSamples);
+
+    if ( indexRange.length == 0 ) {
+        return;
+    }
+
+    [self unshareData];
+
+    NSUInteger oldCount = self.numberOfSamples;
+    NSUInteger newCount = oldCount - indexRange.length;
+    size_t sampleSize   = self.sampleBytes;
+
+    if ( newCount == 0 ) {
+        NSMutableData *dataBuffer = (NSMutableData *)self.dataBuffer;
+        dataBuffer.length = 0;
+        self.startOffset  = 0;
+    }
+    else if ((indexRange.location == 0) && (self.capacity > 0)) {
+        NSUInteger newOffset = self.startOffset + indexRange.length * sampleSize;
+        self.startOffset = newOffset;
+
+        if ( newOffset / sampleSize >= MAX(self.capacity, newCount)) {
+            [self compactDataBuffer];
+        }
+    }
+    else {
+        int8_t *start = (int8_t *)self.mutableBytes + indexRange.location * sampleSize;
+        memmove(start, start + indexRange.length * sampleSize, (oldCount - NSMaxRange(indexRange)) * sampleSize);
+
+        NSMutableData *dataBuffer = (NSMutableData *)self.dataBuffer;
+        dataBuffer.length = self.startOffset + newCount * sampleSize;
+    }
+
+    self.shape = @[@(newCount)];
+}
+
 #pragma mark -
 #pragma mark Accessors
 
 /// @cond
 
+-(nonnull NSData *)data
+{
+    // move a rolling window to the start of its buffer so the buffer can be returned without copying it
+    if ( self.startOffset > 0 ) {
+        [self compactDataBuffer];
+    }
+
+    return super.data;
+}
+
 -(nonnull void *)mutableBytes
 {
-    return ((NSMutableData *)self.data).mutableBytes;
+    [self unshareData];
+
+    return (int8_t *)((NSMutableData *)self.dataBuffer).mutableBytes + self.startOffset;
 }
 
 /// @endcond
@@ -254,4 +254,140 @@
     ndCopy.dataType = CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder());
 }
 
+-(void)testMutableCopySharesDataUntilChanged
+{
+    const double samples[] = { 1.0, 2.0, 3.0 };
+    CPTNumericData *nd     = [[CPTNumericData alloc] initWithData:[NSData dataWithBytes:samples length:sizeof(samples)]
+                                                         dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                            shape:nil];
+
+    CPTMutableNumericData *ndCopy = [nd mutableCopy];
+
+    XCTAssertEqual(ndCopy.bytes, nd.bytes, @"copy shares the data buffer");
+    XCTAssertEqualObjects(ndCopy.shape, nd.shape, @"shape");
+
+    *(double *)[ndCopy mutableSamplePointer:1] = 5.0;
+
+    XCTAssertNotEqual(ndCopy.bytes, nd.bytes, @"copy made its own buffer");
+    XCTAssertEqual(((const double *)ndCopy.bytes)[1], 5.0, @"changed sample");
+    XCTAssertEqual(((const double *)nd.bytes)[1], 2.0, @"original sample");
+}
+
+-(void)testInsertSamplesAppendsZeros
+{
+    const double samples[]    = { 1.0, 2.0, 3.0 };
+    NSData *data              = [NSData dataWithBytes:samples length:sizeof(samples)];
+    CPTMutableNumericData *nd = [[CPTMutableNumericData alloc] initWithData:data
+                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                      shape:nil];
+
+    [nd insertSamplesAtIndex:1 numberOfSamples:2];
+
+    XCTAssertEqual(nd.numberOfSamples, (NSUInteger)5, @"numberOfSamples");
+    XCTAssertEqualObjects(nd.shape, @[@5], @"shape");
+
+    const double expected[] = { 1.0, 0.0, 0.0, 2.0, 3.0 };
+    const double *bytes     = (const double *)nd.bytes;
+    for ( NSUInteger i = 0; i < 5; i++ ) {
+        XCTAssertEqual(bytes[i], expected[i], @"sample %lu", (unsigned long)i);
+    }
+}
+
+-(void)testRollingWindowKeepsSamplesInOrder
+{
+    CPTMutableNumericData *nd = [[CPTMutableNumericData alloc] initWithData:[NSData data]
+                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                      shape:nil];
+
+    const NSUInteger windowSize = 8;
+
+    nd.capacity = windowSize;
+
+    for ( NSUInteger i = 0; i < 100; i++ ) {
+        NSUInteger count = nd.numberOfSamples;
+        [nd insertSamplesAtIndex:count numberOfSamples:1];
+        *(double *)[nd mutableSamplePointer:count] = (double)i;
+
+        if ( nd.numberOfSamples > windowSize ) {
+            [nd removeSamplesInRange:NSMakeRange(0, 1)];
+        }
+
+        NSUInteger first = (i + 1 > windowSize) ? i + 1 - windowSize : 0;
+        XCTAssertEqual(nd.numberOfSamples, i + 1 - first, @"numberOfSamples");
+        XCTAssertEqual(nd.length, nd.numberOfSamples * sizeof(double), @"length");
+        XCTAssertEqual(nd.data.length, nd.length, @"data length");
+
+        const double *bytes = (const double *)nd.bytes;
+        for ( NSUInteger j = first; j <= i; j++ ) {
+            XCTAssertEqual(bytes[j - first], (double)j, @"sample %lu", (unsigned long)j);
+        }
+        XCTAssertEqual([[nd sampleValue:0] doubleValue], (double)first, @"first sample value");
+    }
+}
+
+-(void)testRollingWindowConvertsType
+{
+    const double samples[]    = { 1.0, 2.0, 3.0, 4.0 };
+    NSData *data              = [NSData dataWithBytes:samples length:sizeof(samples)];
+    CPTMutableNumericData *nd = [[CPTMutableNumericData alloc] initWithData:data
+                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                      shape:nil];
+
+    nd.capacity = 10;
+    [nd removeSamplesInRange:NSMakeRange(0, 2)];
+
+    nd.dataType = CPTDataType(CPTFloatingPointDataType, sizeof(float), NSHostByteOrder());
+
+    XCTAssertEqual(nd.numberOfSamples, (NSUInteger)2, @"numberOfSamples");
+    XCTAssertEqual(((const float *)nd.bytes)[0], 3.0f, @"first sample");
+    XCTAssertEqual(((const float *)nd.bytes)[1], 4.0f, @"second sample");
+}
+
+-(void)testRollingWindowDataIsBuffer
+{
+    const double samples[]    = { 1.0, 2.0, 3.0, 4.0 };
+    NSData *data              = [NSData dataWithBytes:samples length:sizeof(samples)];
+    CPTMutableNumericData *nd = [[CPTMutableNumericData alloc] initWithData:data
+                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                      shape:nil];
+
+    nd.capacity = 10;
+    [nd removeSamplesInRange:NSMakeRange(0, 1)];
+
+    NSData *windowData = nd.data;
+    XCTAssertEqual(windowData.length, 3 * sizeof(double), @"data length");
+    XCTAssertEqual(windowData.bytes, nd.bytes, @"the window is moved to the start of the buffer");
+    XCTAssertEqual(nd.data, windowData, @"later calls do not copy");
+    XCTAssertEqualObjects(nd.sampleArray, (@[@2.0, @3.0, @4.0]), @"samples");
+}
+
+-(void)testRollingWindowCopiesSamplesInUse
+{
+    const double samples[]    = { 1.0, 2.0, 3.0, 4.0 };
+    NSData *data              = [NSData dataWithBytes:samples length:sizeof(samples)];
+    CPTMutableNumericData *nd = [[CPTMutableNumericData alloc] initWithData:data
+                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                      shape:nil];
+
+    nd.capacity = 10;
+    [nd removeSamplesInRange:NSMakeRange(0, 1)];
+
+    CPTNumericData *copied = [nd copy];
+    XCTAssertEqualObjects(copied.sampleArray, (@[@2.0, @3.0, @4.0]), @"copy");
+    XCTAssertEqual(copied.length, 3 * sizeof(double), @"copy length");
+
+    CPTMutableNumericData *mutableCopied = [nd mutableCopy];
+    XCTAssertEqualObjects(mutableCopied.sampleArray, (@[@2.0, @3.0, @4.0]), @"mutable copy");
+
+    CPTNumericData *floats = [nd dataByConvertingToDataType:CPTDataType(CPTFloatingPointDataType, sizeof(float), NSHostByteOrder())];
+    XCTAssertEqual(floats.numberOfSamples, (NSUInteger)3, @"converted numberOfSamples");
+    XCTAssertEqual(((const float *)floats.bytes)[0], 2.0f, @"first converted sample");
+    XCTAssertEqual(((const float *)floats.bytes)[2], 4.0f, @"last converted sample");
+
+    // the copies do not change with the original
+    *(double *)[nd mutableSamplePointer:0] = -1.0;
+    XCTAssertEqualObjects([copied sampleValue:0], @2.0, @"copy unchanged");
+    XCTAssertEqualObjects([mutableCopied sampleValue:0], @2.0, @"mutable copy unchanged");
+}
+
 @end
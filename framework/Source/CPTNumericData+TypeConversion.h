@@ -2,7 +2,7 @@
 #import "CPTNumericDataType.h"
 
 /** @category CPTNumericData(TypeConversion)
- *  @brief Type conversion methods for CPTNumericData.
+ *  @brief Type and data order conversion methods for CPTNumericData.
  **/
 @interface CPTNumericData(TypeConversion)
 
@@ -13,10 +13,18 @@
 -(nonnull CPTNumericData *)dataByConvertingToType:(CPTDataTypeFormat)newDataType sampleBytes:(size_t)newSampleBytes byteOrder:(CFByteOrder)newByteOrder;
 /// @}
 
+/// @name Data Order Conversion
+/// @{
+-(nonnull CPTNumericData *)dataByConvertingToDataOrder:(CPTDataOrder)newDataOrder;
+/// @}
+
 /// @name Data Conversion Utilities
 /// @{
 -(void)convertData:(nonnull NSData *)sourceData dataType:(nonnull CPTNumericDataType *)sourceDataType toData:(nonnull NSMutableData *)destData dataType:(nonnull CPTNumericDataType *)destDataType;
+-(void)convertAndSwapData:(nonnull NSData *)sourceData dataType:(nonnull CPTNumericDataType *)sourceDataType toData:(nonnull NSMutableData *)destData dataType:(nonnull CPTNumericDataType *)destDataType;
 -(void)swapByteOrderForData:(nonnull NSMutableData *)sourceData sampleSize:(size_t)sampleSize;
+-(void)swapByteOrderForData:(nonnull NSMutableData *)sourceData dataType:(CPTNumericDataType)dataType;
+-(void)transposeData:(nonnull NSData *)sourceData sampleSize:(size_t)sampleSize rowCount:(NSUInteger)rowCount columnCount:(NSUInteger)columnCount toData:(nonnull NSMutableData *)destData;
 /// @}
 
 @end
@@ -1,8 +1,362 @@
 #import "CPTNumericData+TypeConversion.h"
 
 #import "complex.h"
+#import "CPTMutableNumericData.h"
 #import "CPTUtilities.h"
 
+/// @cond
+
+/**
+ *  @brief A function that converts samples from one data type to another.
+ *  @param fromBytes The source samples.
+ *  @param toBytes The destination samples.
+ *  @param sampleCount The number of samples to convert.
+ **/
+typedef void (*CPTConversionKernel)(const void *__nonnull fromBytes, void *__nonnull toBytes, NSUInteger sampleCount);
+
+static const NSUInteger kCPTConversionParallelThreshold = 262144; // buffers with at least this many samples are converted on several threads
+static const NSUInteger kCPTConversionChunkSize         = 65536;  // number of samples converted by each thread at a time
+static const NSUInteger kCPTConversionBlockSize         = 4096;   // number of samples swapped and converted together so the intermediate values stay in the cache
+static const NSUInteger kCPTTransposeTileSize          = 32;     // number of rows and columns in each tile of a transpose so the source and destination lines stay in the cache
+
+// Number of samples converted together. The compiler splits each vector into as many native SIMD registers as needed.
+#define CPT_CONVERSION_VECTOR_LENGTH 8
+
+/**
+ *  @brief Defines a conversion kernel that converts samples in vectors using the clang vector extensions.
+ *
+ *  The same kernel compiles to SSE or AVX instructions on Intel and to NEON instructions on ARM.
+ *  Each element is converted exactly like a C cast, so the results match the scalar loops.
+ *
+ *  @param name The name of the kernel function.
+ *  @param fromType The data type of the source samples.
+ *  @param toType The data type of the destination samples.
+ **/
+#define CPT_DEFINE_CONVERSION_KERNEL(name, fromType, toType)                                                              \
+    static void name(const void *__nonnull fromBytes, void *__nonnull toBytes, NSUInteger sampleCount)                    \
+    {                                                                                                                     \
+        typedef fromType CPTFromVector __attribute__((ext_vector_type(CPT_CONVERSION_VECTOR_LENGTH)));                    \
+        typedef toType CPTToVector     __attribute__((ext_vector_type(CPT_CONVERSION_VECTOR_LENGTH)));                    \
+                                                                                                                          \
+        const fromType *fromSamples = (const fromType *)fromBytes;                                                        \
+        toType *toSamples           = (toType *)toBytes;                                                                  \
+        NSUInteger i                = 0;                                                                                  \
+                                                                                                                          \
+        for ( ; i + CPT_CONVERSION_VECTOR_LENGTH <= sampleCount; i += CPT_CONVERSION_VECTOR_LENGTH ) {                    \
+            CPTFromVector fromVector;                                                                                     \
+            memcpy(&fromVector, fromSamples + i, sizeof(fromVector));                                                     \
+            CPTToVector toVector = __builtin_convertvector(fromVector, CPTToVector);                                      \
+            memcpy(toSamples + i, &toVector, sizeof(toVector));                                                           \
+        }                                                                                                                 \
+        for ( ; i < sampleCount; i++ ) {                                                                                  \
+            toSamples[i] = (toType)fromSamples[i];                                                                        \
+        }                                                                                                                 \
+    }
+
+// Code generated with "CPTNumericData+TypeConversions_Generation.py"
+// ========================================================================
+
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToInt16, int8_t, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToInt32, int8_t, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToInt64, int8_t, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToUInt8, int8_t, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToUInt16, int8_t, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToUInt32, int8_t, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToUInt64, int8_t, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToFloat, int8_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt8ToDouble, int8_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToInt8, int16_t, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToInt32, int16_t, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToInt64, int16_t, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToUInt8, int16_t, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToUInt16, int16_t, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToUInt32, int16_t, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToUInt64, int16_t, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToFloat, int16_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt16ToDouble, int16_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToInt8, int32_t, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToInt16, int32_t, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToInt64, int32_t, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToUInt8, int32_t, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToUInt16, int32_t, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToUInt32, int32_t, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToUInt64, int32_t, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToFloat, int32_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt32ToDouble, int32_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToInt8, int64_t, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToInt16, int64_t, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToInt32, int64_t, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToUInt8, int64_t, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToUInt16, int64_t, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToUInt32, int64_t, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToUInt64, int64_t, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToFloat, int64_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertInt64ToDouble, int64_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToInt8, uint8_t, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToInt16, uint8_t, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToInt32, uint8_t, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToInt64, uint8_t, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToUInt16, uint8_t, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToUInt32, uint8_t, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToUInt64, uint8_t, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToFloat, uint8_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt8ToDouble, uint8_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToInt8, uint16_t, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToInt16, uint16_t, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToInt32, uint16_t, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToInt64, uint16_t, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToUInt8, uint16_t, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToUInt32, uint16_t, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToUInt64, uint16_t, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToFloat, uint16_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt16ToDouble, uint16_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToInt8, uint32_t, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToInt16, uint32_t, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToInt32, uint32_t, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToInt64, uint32_t, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToUInt8, uint32_t, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToUInt16, uint32_t, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToUInt64, uint32_t, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToFloat, uint32_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt32ToDouble, uint32_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToInt8, uint64_t, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToInt16, uint64_t, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToInt32, uint64_t, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToInt64, uint64_t, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToUInt8, uint64_t, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToUInt16, uint64_t, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToUInt32, uint64_t, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToFloat, uint64_t, float)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertUInt64ToDouble, uint64_t, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToInt8, float, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToInt16, float, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToInt32, float, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToInt64, float, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToUInt8, float, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToUInt16, float, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToUInt32, float, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToUInt64, float, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertFloatToDouble, float, double)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToInt8, double, int8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToInt16, double, int16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToInt32, double, int32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToInt64, double, int64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToUInt8, double, uint8_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToUInt16, double, uint16_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToUInt32, double, uint32_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToUInt64, double, uint64_t)
+CPT_DEFINE_CONVERSION_KERNEL(CPTConvertDoubleToFloat, double, float)
+
+// End of code generated with "CPTNumericData+TypeConversions_Generation.py"
+// ========================================================================
+
+// Sixteen bytes fill one SSE or NEON register
+typedef uint8_t CPTByteVector __attribute__((ext_vector_type(16)));
+
+/**
+ *  @brief Defines a kernel that reverses the bytes of each element using vector shuffles.
+ *
+ *  Sixteen bytes are swapped at a time with a single shuffle instruction; the remaining elements are swapped one byte at a time.
+ *  The source and destination may be the same buffer.
+ *
+ *  @param name The name of the kernel function.
+ *  @param elementBytes The number of bytes in each element.
+ *  @param ... The shuffle indices that reverse the elements in one CPTByteVector.
+ **/
+#define CPT_DEFINE_BYTE_SWAP_KERNEL(name, elementBytes, ...)                                                              \
+    static void name(const void *__nonnull fromBytes, void *__nonnull toBytes, NSUInteger elementCount)                   \
+    {                                                                                                                     \
+        const uint8_t *fromElements = (const uint8_t *)fromBytes;                                                         \
+        uint8_t *toElements         = (uint8_t *)toBytes;                                                                 \
+        NSUInteger byteCount        = elementCount * (elementBytes);                                                      \
+        NSUInteger i                = 0;                                                                                  \
+                                                                                                                          \
+        for ( ; i + sizeof(CPTByteVector) <= byteCount; i += sizeof(CPTByteVector)) {                                     \
+            CPTByteVector fromVector;                                                                                     \
+            memcpy(&fromVector, fromElements + i, sizeof(fromVector));                                                    \
+            CPTByteVector toVector = __builtin_shufflevector(fromVector, fromVector, __VA_ARGS__);                        \
+            memcpy(toElements + i, &toVector, sizeof(toVector));                                                          \
+        }                                                                                                                 \
+        for ( ; i < byteCount; i += (elementBytes)) {                                                                     \
+            uint8_t element[elementBytes];                                                                                \
+            for ( size_t j = 0; j < (elementBytes); j++ ) {                                                               \
+                element[j] = fromElements[i + (elementBytes) - 1 - j];                                                    \
+            }                                                                                                             \
+            memcpy(toElements + i, element, (elementBytes));                                                              \
+        }                                                                                                                 \
+    }
+
+CPT_DEFINE_BYTE_SWAP_KERNEL(CPTSwapBytes2, 2, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+CPT_DEFINE_BYTE_SWAP_KERNEL(CPTSwapBytes4, 4, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+CPT_DEFINE_BYTE_SWAP_KERNEL(CPTSwapBytes8, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8)
+CPT_DEFINE_BYTE_SWAP_KERNEL(CPTSwapBytes16, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+/**
+ *  @brief Swaps the byte order of each field of an array of NSDecimal values.
+ *
+ *  The exponent, length, and flags share the first 32-bit word. The mantissa is an array of 16-bit words
+ *  that fills exactly one CPTByteVector.
+ *  @param fromBytes The source values.
+ *  @param toBytes The destination values. May be the same buffer as @par{fromBytes}.
+ *  @param decimalCount The number of values to swap.
+ **/
+static void CPTSwapDecimalBytes(const void *__nonnull fromBytes, void *__nonnull toBytes, NSUInteger decimalCount)
+{
+    const uint8_t *fromDecimals = (const uint8_t *)fromBytes;
+    uint8_t *toDecimals         = (uint8_t *)toBytes;
+
+    for ( NSUInteger i = 0; i < decimalCount; i++ ) {
+        size_t offset = i * sizeof(NSDecimal);
+
+        CPTSwapBytes4(fromDecimals + offset, toDecimals + offset, 1);
+        CPTSwapBytes2(fromDecimals + offset + offsetof(NSDecimal, _mantissa),
+                      toDecimals + offset + offsetof(NSDecimal, _mantissa),
+                      NSDecimalMaxSize);
+    }
+}
+
+/**
+ *  @brief Returns the byte swap kernel that reverses elements of the given size.
+ *  @param elementBytes The number of bytes in each element.
+ *  @return The byte swap kernel or @NULL if elements of that size do not need swapping.
+ **/
+static CPTConversionKernel __nullable CPTByteSwapKernelForElementSize(size_t elementBytes)
+{
+    switch ( elementBytes ) {
+        case sizeof(uint16_t):
+            return CPTSwapBytes2;
+
+        case sizeof(uint32_t):
+            return CPTSwapBytes4;
+
+        case sizeof(uint64_t):
+            return CPTSwapBytes8;
+
+        case 2 * sizeof(uint64_t):
+            return CPTSwapBytes16;
+
+        default:
+            return NULL;
+    }
+}
+
+/**
+ *  @brief Returns the byte swap kernel for samples of the given data type.
+ *
+ *  Complex samples are swapped as two separate real values.
+ *  @param dataType The data type of the samples.
+ *  @param elementsPerSample Returns the number of elements the kernel swaps for each sample.
+ *  @return The byte swap kernel or @NULL if samples of that data type do not need swapping.
+ **/
+static CPTConversionKernel __nullable CPTByteSwapKernelForDataType(CPTNumericDataType dataType, NSUInteger *__nonnull elementsPerSample)
+{
+    CPTConversionKernel swapKernel = NULL;
+
+    *elementsPerSample = 1;
+
+    switch ( dataType.dataTypeFormat ) {
+        case CPTUndefinedDataType:
+            break;
+
+        case CPTIntegerDataType:
+        case CPTUnsignedIntegerDataType:
+        case CPTFloatingPointDataType:
+            swapKernel = CPTByteSwapKernelForElementSize(dataType.sampleBytes);
+            break;
+
+        case CPTComplexFloatingPointDataType:
+            *elementsPerSample = 2;
+            swapKernel         = CPTByteSwapKernelForElementSize(dataType.sampleBytes / 2);
+            break;
+
+        case CPTDecimalDataType:
+            swapKernel = CPTSwapDecimalBytes;
+            break;
+    }
+
+    return swapKernel;
+}
+
+/**
+ *  @brief A function that transposes a band of rows of a two-dimensional array of samples stored in row-major order.
+ *  @param fromBytes The source samples.
+ *  @param toBytes The destination samples. Must not overlap the source samples.
+ *  @param rowCount The number of rows in the source array.
+ *  @param columnCount The number of columns in the source array.
+ *  @param firstRow The first source row to transpose.
+ *  @param lastRow The source row after the last row to transpose.
+ **/
+typedef void (*CPTTransposeKernel)(const void *__nonnull fromBytes, void *__nonnull toBytes, NSUInteger rowCount, NSUInteger columnCount, NSUInteger firstRow, NSUInteger lastRow);
+
+/**
+ *  @brief Defines a kernel that transposes samples of a fixed size one square tile at a time.
+ *
+ *  Each tile is small enough that the source rows it reads and the destination rows it writes stay in the cache,
+ *  so wide arrays do not reload a cache line for every sample.
+ *
+ *  @param name The name of the kernel function.
+ *  @param sampleType An integer type the same size as the samples.
+ **/
+#define CPT_DEFINE_TRANSPOSE_KERNEL(name, sampleType)                                                                     \
+    static void name(const void *__nonnull fromBytes, void *__nonnull toBytes,                                            \
+                     NSUInteger rowCount, NSUInteger columnCount, NSUInteger firstRow, NSUInteger lastRow)                \
+    {                                                                                                                     \
+        const sampleType *fromSamples = (const sampleType *)fromBytes;                                                    \
+        sampleType *toSamples         = (sampleType *)toBytes;                                                            \
+                                                                                                                          \
+        for ( NSUInteger tileRow = firstRow; tileRow < lastRow; tileRow += kCPTTransposeTileSize ) {                      \
+            NSUInteger endRow = MIN(tileRow + kCPTTransposeTileSize, lastRow);                                            \
+                                                                                                                          \
+            for ( NSUInteger tileColumn = 0; tileColumn < columnCount; tileColumn += kCPTTransposeTileSize ) {            \
+                NSUInteger endColumn = MIN(tileColumn + kCPTTransposeTileSize, columnCount);                              \
+                                                                                                                          \
+                for ( NSUInteger column = tileColumn; column < endColumn; column++ ) {                                    \
+                    sampleType *toRow = toSamples + column * rowCount;                                                    \
+                    for ( NSUInteger row = tileRow; row < endRow; row++ ) {                                               \
+                        toRow[row] = fromSamples[row * columnCount + column];                                             \
+                    }                                                                                                     \
+                }                                                                                                         \
+            }                                                                                                             \
+        }                                                                                                                 \
+    }
+
+CPT_DEFINE_TRANSPOSE_KERNEL(CPTTranspose1, uint8_t)
+CPT_DEFINE_TRANSPOSE_KERNEL(CPTTranspose2, uint16_t)
+CPT_DEFINE_TRANSPOSE_KERNEL(CPTTranspose4, uint32_t)
+CPT_DEFINE_TRANSPOSE_KERNEL(CPTTranspose8, uint64_t)
+
+/**
+ *  @brief Returns the transpose kernel for samples of the given size.
+ *  @param sampleBytes The number of bytes in each sample.
+ *  @return The transpose kernel or @NULL if samples of that size are copied with @par{memcpy()}.
+ **/
+static CPTTransposeKernel __nullable CPTTransposeKernelForSampleSize(size_t sampleBytes)
+{
+    switch ( sampleBytes ) {
+        case sizeof(uint8_t):
+            return CPTTranspose1;
+
+        case sizeof(uint16_t):
+            return CPTTranspose2;
+
+        case sizeof(uint32_t):
+            return CPTTranspose4;
+
+        case sizeof(uint64_t):
+            return CPTTranspose8;
+
+        default:
+            return NULL;
+    }
+}
+
+static void CPTConvertBytes(const void *__nonnull sourceBytes, const CPTNumericDataType *__nonnull sourceDataType, void *__nonnull destBytes, const CPTNumericDataType *__nonnull destDataType, NSUInteger sampleCount);
+static void CPTTransposeSamples(const void *__nonnull fromBytes, void *__nonnull toBytes, size_t sampleBytes, NSUInteger rowCount, NSUInteger columnCount);
+static void CPTConvertAndSwapBytes(const void *__nonnull sourceBytes, const CPTNumericDataType *__nonnull sourceDataType, void *__nonnull destBytes, const CPTNumericDataType *__nonnull destDataType, NSUInteger sampleCount);
+static void CPTConvertSamples(CPTConversionKernel kernel, const void *__nonnull fromBytes, size_t fromSampleBytes, void *__nonnull toBytes, size_t toSampleBytes, NSUInteger sampleCount);
+
+/// @endcond
+
 @implementation CPTNumericData(TypeConversion)
 
 /** @brief Copies the current numeric data and converts the data to a new data type.
@@ -33,8 +387,12 @@
     NSParameterAssert(newDataType.dataTypeFormat != CPTUndefinedDataType);
     NSParameterAssert(newDataType.byteOrder != CFByteOrderUnknown);
 
-    NSData *newData           = nil;
-    CFByteOrder hostByteOrder = CFByteOrderGetCurrent();
+    if ( CPTDataTypeEqualToDataType(myDataType, newDataType) && ![self isKindOfClass:[CPTMutableNumericData class]] ) {
+        // an immutable copy shares the buffer
+        return [self copy];
+    }
+
+    NSData *newData = nil;
 
     if ( CPTDataTypeEqualToDataType(myDataType, newDataType)) {
         newData = self.data;
@@ -43,29 +401,71 @@
         newData = self.data;
     }
     else {
-        NSUInteger sampleCount = self.data.length / myDataType.sampleBytes;
+        NSUInteger sampleCount = self.length / myDataType.sampleBytes;
 
-        newData = [[NSMutableData alloc] initWithLength:(sampleCount * newDataType.sampleBytes)];
+        NSMutableData *convertedData = [[NSMutableData alloc] initWithLength:(sampleCount * newDataType.sampleBytes)];
 
-        NSData *sourceData = nil;
-        if ( myDataType.byteOrder != hostByteOrder ) {
-            sourceData = [self.data mutableCopy];
-            [self swapByteOrderForData:(NSMutableData *)sourceData sampleSize:myDataType.sampleBytes];
-        }
-        else {
-            sourceData = self.data;
-        }
+        // read contiguous samples in place; self.data would copy a window or slice first
+        NSData *stridedSamples = (self.sampleStride > 1) ? self.data : nil;
+        const void *samples    = stridedSamples ? stridedSamples.bytes : self.bytes;
 
-        [self convertData:sourceData dataType:&myDataType toData:(NSMutableData *)newData dataType:&newDataType];
+        CPTConvertAndSwapBytes(samples, &myDataType, convertedData.mutableBytes, &newDataType, sampleCount);
 
-        if ( newDataType.byteOrder != hostByteOrder ) {
-            [self swapByteOrderForData:(NSMutableData *)newData sampleSize:newDataType.sampleBytes];
-        }
+        newData = convertedData;
     }
 
     CPTNumericData *result = [CPTNumericData numericDataWithData:newData
                                                         dataType:newDataType
-                                                           shape:self.shape];
+                                                           shape:self.shape
+                                                       dataOrder:self.dataOrder];
+    return result;
+}
+
+#pragma mark -
+#pragma mark Data order conversion
+
+/** @brief Copies the current numeric data and rearranges the samples in a new data order.
+ *
+ *  A two-dimensional array is transposed one small tile at a time so wide arrays stay cache-friendly.
+ *  Large arrays are transposed on several threads. Arrays with fewer than two dimensions
+ *  are the same in either order and the copy shares the original data buffer.
+ *  @param newDataOrder The new data order.
+ *  @return A copy of the current numeric data in the new data order.
+ **/
+-(nonnull CPTNumericData *)dataByConvertingToDataOrder:(CPTDataOrder)newDataOrder
+{
+    NSParameterAssert(self.numberOfDimensions <= 2);
+
+    CPTNumberArray *myShape = self.shape;
+    NSData *newData         = nil;
+
+    if ((newDataOrder == self.dataOrder) || (self.numberOfDimensions < 2)) {
+        newData = self.data;
+    }
+    else {
+        NSUInteger rowCount    = myShape[0].unsignedIntegerValue;
+        NSUInteger columnCount = myShape[1].unsignedIntegerValue;
+
+        NSMutableData *transposedData = [[NSMutableData alloc] initWithLength:self.length];
+
+        // the source buffer holds the rows of a rows-first array and the columns of a columns-first array
+        switch ( self.dataOrder ) {
+            case CPTDataOrderRowsFirst:
+                CPTTransposeSamples(self.bytes, transposedData.mutableBytes, self.sampleBytes, rowCount, columnCount);
+                break;
+
+            case CPTDataOrderColumnsFirst:
+                CPTTransposeSamples(self.bytes, transposedData.mutableBytes, self.sampleBytes, columnCount, rowCount);
+                break;
+        }
+
+        newData = transposedData;
+    }
+
+    CPTNumericData *result = [CPTNumericData numericDataWithData:newData
+                                                        dataType:self.dataType
+                                                           shape:myShape
+                                                       dataOrder:newDataOrder];
     return result;
 }
 
@@ -87,6 +487,41 @@
 {
     NSUInteger sampleCount = sourceData.length / sourceDataType->sampleBytes;
 
+    CPTConvertBytes(sourceData.bytes, sourceDataType, destData.mutableBytes, destDataType, sampleCount);
+}
+
+/** @brief Converts the data to a new data type and byte order in a single pass.
+ *
+ *  The samples are swapped and converted in small blocks, so each sample is read from and written to memory only once.
+ *  The source and destination may be the same buffer when the destination samples are not larger than the source samples.
+ *  @param sourceData The source data buffer.
+ *  @param sourceDataType The data type and byte order of the source.
+ *  @param destData The destination data buffer.
+ *  @param destDataType The new data type and byte order.
+ **/
+-(void)convertAndSwapData:(nonnull NSData *)sourceData
+                 dataType:(nonnull CPTNumericDataType *)sourceDataType
+                   toData:(nonnull NSMutableData *)destData
+                 dataType:(nonnull CPTNumericDataType *)destDataType
+{
+    NSUInteger sampleCount = sourceData.length / sourceDataType->sampleBytes;
+
+    CPTConvertAndSwapBytes(sourceData.bytes, sourceDataType, destData.mutableBytes, destDataType, sampleCount);
+}
+
+/// @cond
+
+/** @brief Converts samples to a new data type without changing the byte order.
+ *
+ *  The source and destination may be the same buffer when the destination samples are not larger than the source samples.
+ *  @param sourceBytes The source samples.
+ *  @param sourceDataType The data type of the source.
+ *  @param destBytes The destination samples.
+ *  @param destDataType The new data type.
+ *  @param sampleCount The number of samples to convert.
+ **/
+static void CPTConvertBytes(const void *__nonnull sourceBytes, const CPTNumericDataType *__nonnull sourceDataType, void *__nonnull destBytes, const CPTNumericDataType *__nonnull destDataType, NSUInteger sampleCount)
+{
     // Code generated with "CPTNumericData+TypeConversions_Generation.py"
     // ========================================================================
 
@@ -105,40 +540,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // int8_t -> int8_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(int8_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(int8_t));
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // int8_t -> int16_t
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes         = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToInt16, sourceBytes, sizeof(int8_t), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // int8_t -> int32_t
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes         = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToInt32, sourceBytes, sizeof(int8_t), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // int8_t -> int64_t
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes         = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToInt64, sourceBytes, sizeof(int8_t), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -148,45 +568,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // int8_t -> uint8_t
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes         = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToUInt8, sourceBytes, sizeof(int8_t), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // int8_t -> uint16_t
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes        = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToUInt16, sourceBytes, sizeof(int8_t), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // int8_t -> uint32_t
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes        = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToUInt32, sourceBytes, sizeof(int8_t), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // int8_t -> uint64_t
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes        = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToUInt64, sourceBytes, sizeof(int8_t), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -196,23 +596,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // int8_t -> float
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes           = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToFloat, sourceBytes, sizeof(int8_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // int8_t -> double
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
-                                    const int8_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes          = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt8ToDouble, sourceBytes, sizeof(int8_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -222,9 +612,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // int8_t -> float complex
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
+                                    const int8_t *fromBytes  = (const int8_t *)sourceBytes;
                                     const int8_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes   = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes   = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -233,9 +623,9 @@
 
                                 case sizeof(double complex):
                                 { // int8_t -> double complex
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
+                                    const int8_t *fromBytes  = (const int8_t *)sourceBytes;
                                     const int8_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes  = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes  = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -248,9 +638,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // int8_t -> NSDecimal
-                                    const int8_t *fromBytes  = (const int8_t *)sourceData.bytes;
+                                    const int8_t *fromBytes  = (const int8_t *)sourceBytes;
                                     const int8_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes       = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes       = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromChar(*fromBytes++);
                                     }
@@ -270,40 +660,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // int16_t -> int8_t
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes           = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToInt8, sourceBytes, sizeof(int16_t), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // int16_t -> int16_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(int16_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(int16_t));
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // int16_t -> int32_t
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes          = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToInt32, sourceBytes, sizeof(int16_t), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // int16_t -> int64_t
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes          = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToInt64, sourceBytes, sizeof(int16_t), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -313,45 +688,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // int16_t -> uint8_t
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes          = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToUInt8, sourceBytes, sizeof(int16_t), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // int16_t -> uint16_t
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes         = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToUInt16, sourceBytes, sizeof(int16_t), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // int16_t -> uint32_t
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes         = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToUInt32, sourceBytes, sizeof(int16_t), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // int16_t -> uint64_t
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes         = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToUInt64, sourceBytes, sizeof(int16_t), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -361,23 +716,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // int16_t -> float
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes            = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToFloat, sourceBytes, sizeof(int16_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // int16_t -> double
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
-                                    const int16_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes           = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt16ToDouble, sourceBytes, sizeof(int16_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -387,9 +732,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // int16_t -> float complex
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
+                                    const int16_t *fromBytes  = (const int16_t *)sourceBytes;
                                     const int16_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes    = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes    = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -398,9 +743,9 @@
 
                                 case sizeof(double complex):
                                 { // int16_t -> double complex
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
+                                    const int16_t *fromBytes  = (const int16_t *)sourceBytes;
                                     const int16_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes   = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes   = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -413,9 +758,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // int16_t -> NSDecimal
-                                    const int16_t *fromBytes  = (const int16_t *)sourceData.bytes;
+                                    const int16_t *fromBytes  = (const int16_t *)sourceBytes;
                                     const int16_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes        = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes        = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromShort(*fromBytes++);
                                     }
@@ -435,40 +780,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // int32_t -> int8_t
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes           = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToInt8, sourceBytes, sizeof(int32_t), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // int32_t -> int16_t
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes          = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToInt16, sourceBytes, sizeof(int32_t), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // int32_t -> int32_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(int32_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(int32_t));
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // int32_t -> int64_t
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes          = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToInt64, sourceBytes, sizeof(int32_t), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -478,45 +808,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // int32_t -> uint8_t
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes          = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToUInt8, sourceBytes, sizeof(int32_t), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // int32_t -> uint16_t
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes         = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToUInt16, sourceBytes, sizeof(int32_t), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // int32_t -> uint32_t
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes         = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToUInt32, sourceBytes, sizeof(int32_t), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // int32_t -> uint64_t
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes         = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToUInt64, sourceBytes, sizeof(int32_t), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -526,23 +836,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // int32_t -> float
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes            = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToFloat, sourceBytes, sizeof(int32_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // int32_t -> double
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
-                                    const int32_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes           = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt32ToDouble, sourceBytes, sizeof(int32_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -552,9 +852,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // int32_t -> float complex
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
+                                    const int32_t *fromBytes  = (const int32_t *)sourceBytes;
                                     const int32_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes    = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes    = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -563,9 +863,9 @@
 
                                 case sizeof(double complex):
                                 { // int32_t -> double complex
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
+                                    const int32_t *fromBytes  = (const int32_t *)sourceBytes;
                                     const int32_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes   = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes   = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -578,9 +878,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // int32_t -> NSDecimal
-                                    const int32_t *fromBytes  = (const int32_t *)sourceData.bytes;
+                                    const int32_t *fromBytes  = (const int32_t *)sourceBytes;
                                     const int32_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes        = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes        = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromLong(*fromBytes++);
                                     }
@@ -600,40 +900,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // int64_t -> int8_t
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes           = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToInt8, sourceBytes, sizeof(int64_t), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // int64_t -> int16_t
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes          = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToInt16, sourceBytes, sizeof(int64_t), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // int64_t -> int32_t
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes          = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToInt32, sourceBytes, sizeof(int64_t), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // int64_t -> int64_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(int64_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(int64_t));
                                 }
                                 break;
                             }
@@ -643,45 +928,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // int64_t -> uint8_t
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes          = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToUInt8, sourceBytes, sizeof(int64_t), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // int64_t -> uint16_t
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes         = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToUInt16, sourceBytes, sizeof(int64_t), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // int64_t -> uint32_t
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes         = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToUInt32, sourceBytes, sizeof(int64_t), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // int64_t -> uint64_t
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes         = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToUInt64, sourceBytes, sizeof(int64_t), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -691,23 +956,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // int64_t -> float
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes            = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToFloat, sourceBytes, sizeof(int64_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // int64_t -> double
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
-                                    const int64_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes           = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertInt64ToDouble, sourceBytes, sizeof(int64_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -717,9 +972,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // int64_t -> float complex
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
+                                    const int64_t *fromBytes  = (const int64_t *)sourceBytes;
                                     const int64_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes    = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes    = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -728,9 +983,9 @@
 
                                 case sizeof(double complex):
                                 { // int64_t -> double complex
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
+                                    const int64_t *fromBytes  = (const int64_t *)sourceBytes;
                                     const int64_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes   = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes   = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -743,9 +998,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // int64_t -> NSDecimal
-                                    const int64_t *fromBytes  = (const int64_t *)sourceData.bytes;
+                                    const int64_t *fromBytes  = (const int64_t *)sourceBytes;
                                     const int64_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes        = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes        = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromLongLong(*fromBytes++);
                                     }
@@ -769,45 +1024,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // uint8_t -> int8_t
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes           = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToInt8, sourceBytes, sizeof(uint8_t), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // uint8_t -> int16_t
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes          = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToInt16, sourceBytes, sizeof(uint8_t), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // uint8_t -> int32_t
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes          = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToInt32, sourceBytes, sizeof(uint8_t), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // uint8_t -> int64_t
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes          = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToInt64, sourceBytes, sizeof(uint8_t), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -817,40 +1052,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // uint8_t -> uint8_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(uint8_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(uint8_t));
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // uint8_t -> uint16_t
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes         = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToUInt16, sourceBytes, sizeof(uint8_t), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // uint8_t -> uint32_t
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes         = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToUInt32, sourceBytes, sizeof(uint8_t), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // uint8_t -> uint64_t
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes         = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToUInt64, sourceBytes, sizeof(uint8_t), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -860,23 +1080,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // uint8_t -> float
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes            = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToFloat, sourceBytes, sizeof(uint8_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // uint8_t -> double
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
-                                    const uint8_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes           = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt8ToDouble, sourceBytes, sizeof(uint8_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -886,9 +1096,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // uint8_t -> float complex
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
+                                    const uint8_t *fromBytes  = (const uint8_t *)sourceBytes;
                                     const uint8_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes    = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes    = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -897,9 +1107,9 @@
 
                                 case sizeof(double complex):
                                 { // uint8_t -> double complex
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
+                                    const uint8_t *fromBytes  = (const uint8_t *)sourceBytes;
                                     const uint8_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes   = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes   = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -912,9 +1122,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // uint8_t -> NSDecimal
-                                    const uint8_t *fromBytes  = (const uint8_t *)sourceData.bytes;
+                                    const uint8_t *fromBytes  = (const uint8_t *)sourceBytes;
                                     const uint8_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes        = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes        = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromUnsignedChar(*fromBytes++);
                                     }
@@ -934,45 +1144,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // uint16_t -> int8_t
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes            = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToInt8, sourceBytes, sizeof(uint16_t), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // uint16_t -> int16_t
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes           = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToInt16, sourceBytes, sizeof(uint16_t), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // uint16_t -> int32_t
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes           = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToInt32, sourceBytes, sizeof(uint16_t), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // uint16_t -> int64_t
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes           = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToInt64, sourceBytes, sizeof(uint16_t), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -982,40 +1172,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // uint16_t -> uint8_t
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes           = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToUInt8, sourceBytes, sizeof(uint16_t), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // uint16_t -> uint16_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(uint16_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(uint16_t));
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // uint16_t -> uint32_t
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes          = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToUInt32, sourceBytes, sizeof(uint16_t), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // uint16_t -> uint64_t
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes          = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToUInt64, sourceBytes, sizeof(uint16_t), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1025,23 +1200,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // uint16_t -> float
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes             = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToFloat, sourceBytes, sizeof(uint16_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // uint16_t -> double
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
-                                    const uint16_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes            = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt16ToDouble, sourceBytes, sizeof(uint16_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -1051,9 +1216,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // uint16_t -> float complex
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
+                                    const uint16_t *fromBytes  = (const uint16_t *)sourceBytes;
                                     const uint16_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes     = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes     = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -1062,9 +1227,9 @@
 
                                 case sizeof(double complex):
                                 { // uint16_t -> double complex
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
+                                    const uint16_t *fromBytes  = (const uint16_t *)sourceBytes;
                                     const uint16_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes    = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes    = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -1077,9 +1242,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // uint16_t -> NSDecimal
-                                    const uint16_t *fromBytes  = (const uint16_t *)sourceData.bytes;
+                                    const uint16_t *fromBytes  = (const uint16_t *)sourceBytes;
                                     const uint16_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes         = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes         = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromUnsignedShort(*fromBytes++);
                                     }
@@ -1099,45 +1264,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // uint32_t -> int8_t
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes            = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToInt8, sourceBytes, sizeof(uint32_t), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // uint32_t -> int16_t
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes           = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToInt16, sourceBytes, sizeof(uint32_t), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // uint32_t -> int32_t
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes           = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToInt32, sourceBytes, sizeof(uint32_t), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // uint32_t -> int64_t
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes           = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToInt64, sourceBytes, sizeof(uint32_t), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1147,40 +1292,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // uint32_t -> uint8_t
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes           = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToUInt8, sourceBytes, sizeof(uint32_t), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // uint32_t -> uint16_t
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes          = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToUInt16, sourceBytes, sizeof(uint32_t), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // uint32_t -> uint32_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(uint32_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(uint32_t));
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // uint32_t -> uint64_t
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes          = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToUInt64, sourceBytes, sizeof(uint32_t), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1190,23 +1320,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // uint32_t -> float
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes             = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToFloat, sourceBytes, sizeof(uint32_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // uint32_t -> double
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
-                                    const uint32_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes            = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt32ToDouble, sourceBytes, sizeof(uint32_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -1216,9 +1336,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // uint32_t -> float complex
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
+                                    const uint32_t *fromBytes  = (const uint32_t *)sourceBytes;
                                     const uint32_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes     = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes     = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -1227,9 +1347,9 @@
 
                                 case sizeof(double complex):
                                 { // uint32_t -> double complex
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
+                                    const uint32_t *fromBytes  = (const uint32_t *)sourceBytes;
                                     const uint32_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes    = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes    = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -1242,9 +1362,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // uint32_t -> NSDecimal
-                                    const uint32_t *fromBytes  = (const uint32_t *)sourceData.bytes;
+                                    const uint32_t *fromBytes  = (const uint32_t *)sourceBytes;
                                     const uint32_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes         = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes         = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromUnsignedLong(*fromBytes++);
                                     }
@@ -1264,45 +1384,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // uint64_t -> int8_t
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes            = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToInt8, sourceBytes, sizeof(uint64_t), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // uint64_t -> int16_t
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes           = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToInt16, sourceBytes, sizeof(uint64_t), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // uint64_t -> int32_t
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes           = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToInt32, sourceBytes, sizeof(uint64_t), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // uint64_t -> int64_t
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes           = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToInt64, sourceBytes, sizeof(uint64_t), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1312,40 +1412,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // uint64_t -> uint8_t
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes           = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToUInt8, sourceBytes, sizeof(uint64_t), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // uint64_t -> uint16_t
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes          = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToUInt16, sourceBytes, sizeof(uint64_t), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // uint64_t -> uint32_t
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes          = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToUInt32, sourceBytes, sizeof(uint64_t), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // uint64_t -> uint64_t
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(uint64_t));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(uint64_t));
                                 }
                                 break;
                             }
@@ -1355,23 +1440,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // uint64_t -> float
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    float *toBytes             = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToFloat, sourceBytes, sizeof(uint64_t), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // uint64_t -> double
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
-                                    const uint64_t *lastSample = fromBytes + sampleCount;
-                                    double *toBytes            = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertUInt64ToDouble, sourceBytes, sizeof(uint64_t), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -1381,9 +1456,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // uint64_t -> float complex
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
+                                    const uint64_t *fromBytes  = (const uint64_t *)sourceBytes;
                                     const uint64_t *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes     = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes     = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -1392,9 +1467,9 @@
 
                                 case sizeof(double complex):
                                 { // uint64_t -> double complex
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
+                                    const uint64_t *fromBytes  = (const uint64_t *)sourceBytes;
                                     const uint64_t *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes    = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes    = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -1407,9 +1482,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // uint64_t -> NSDecimal
-                                    const uint64_t *fromBytes  = (const uint64_t *)sourceData.bytes;
+                                    const uint64_t *fromBytes  = (const uint64_t *)sourceBytes;
                                     const uint64_t *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes         = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes         = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromUnsignedLongLong(*fromBytes++);
                                     }
@@ -1433,45 +1508,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // float -> int8_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes         = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToInt8, sourceBytes, sizeof(float), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // float -> int16_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes        = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToInt16, sourceBytes, sizeof(float), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // float -> int32_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes        = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToInt32, sourceBytes, sizeof(float), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // float -> int64_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes        = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToInt64, sourceBytes, sizeof(float), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1481,45 +1536,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // float -> uint8_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes        = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToUInt8, sourceBytes, sizeof(float), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // float -> uint16_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes       = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToUInt16, sourceBytes, sizeof(float), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // float -> uint32_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes       = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToUInt32, sourceBytes, sizeof(float), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // float -> uint64_t
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes       = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToUInt64, sourceBytes, sizeof(float), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1529,18 +1564,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // float -> float
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(float));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(float));
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // float -> double
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
-                                    const float *lastSample = fromBytes + sampleCount;
-                                    double *toBytes         = (double *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (double)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertFloatToDouble, sourceBytes, sizeof(float), destBytes, sizeof(double), sampleCount);
                                 }
                                 break;
                             }
@@ -1550,9 +1580,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // float -> float complex
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
+                                    const float *fromBytes  = (const float *)sourceBytes;
                                     const float *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes  = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes  = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -1561,9 +1591,9 @@
 
                                 case sizeof(double complex):
                                 { // float -> double complex
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
+                                    const float *fromBytes  = (const float *)sourceBytes;
                                     const float *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -1576,9 +1606,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // float -> NSDecimal
-                                    const float *fromBytes  = (const float *)sourceData.bytes;
+                                    const float *fromBytes  = (const float *)sourceBytes;
                                     const float *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes      = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes      = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromFloat(*fromBytes++);
                                     }
@@ -1598,45 +1628,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // double -> int8_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes          = (int8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToInt8, sourceBytes, sizeof(double), destBytes, sizeof(int8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int16_t):
                                 { // double -> int16_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes         = (int16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToInt16, sourceBytes, sizeof(double), destBytes, sizeof(int16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int32_t):
                                 { // double -> int32_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes         = (int32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToInt32, sourceBytes, sizeof(double), destBytes, sizeof(int32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(int64_t):
                                 { // double -> int64_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes         = (int64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (int64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToInt64, sourceBytes, sizeof(double), destBytes, sizeof(int64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1646,45 +1656,25 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // double -> uint8_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes         = (uint8_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint8_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToUInt8, sourceBytes, sizeof(double), destBytes, sizeof(uint8_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint16_t):
                                 { // double -> uint16_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes        = (uint16_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint16_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToUInt16, sourceBytes, sizeof(double), destBytes, sizeof(uint16_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint32_t):
                                 { // double -> uint32_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes        = (uint32_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint32_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToUInt32, sourceBytes, sizeof(double), destBytes, sizeof(uint32_t), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(uint64_t):
                                 { // double -> uint64_t
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes        = (uint64_t *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (uint64_t)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToUInt64, sourceBytes, sizeof(double), destBytes, sizeof(uint64_t), sampleCount);
                                 }
                                 break;
                             }
@@ -1694,18 +1684,13 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // double -> float
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
-                                    const double *lastSample = fromBytes + sampleCount;
-                                    float *toBytes           = (float *)destData.mutableBytes;
-                                    while ( fromBytes < lastSample ) {
-                                        *toBytes++ = (float)*fromBytes++;
-                                    }
+                                    CPTConvertSamples(CPTConvertDoubleToFloat, sourceBytes, sizeof(double), destBytes, sizeof(float), sampleCount);
                                 }
                                 break;
 
                                 case sizeof(double):
                                 { // double -> double
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(double));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(double));
                                 }
                                 break;
                             }
@@ -1715,9 +1700,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // double -> float complex
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
+                                    const double *fromBytes  = (const double *)sourceBytes;
                                     const double *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes   = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes   = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -1726,9 +1711,9 @@
 
                                 case sizeof(double complex):
                                 { // double -> double complex
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
+                                    const double *fromBytes  = (const double *)sourceBytes;
                                     const double *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes  = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes  = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -1741,9 +1726,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // double -> NSDecimal
-                                    const double *fromBytes  = (const double *)sourceData.bytes;
+                                    const double *fromBytes  = (const double *)sourceBytes;
                                     const double *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes       = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes       = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromDouble(*fromBytes++);
                                     }
@@ -1767,9 +1752,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // float complex -> int8_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes                 = (int8_t *)destData.mutableBytes;
+                                    int8_t *toBytes                 = (int8_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int8_t)*fromBytes++;
                                     }
@@ -1778,9 +1763,9 @@
 
                                 case sizeof(int16_t):
                                 { // float complex -> int16_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes                = (int16_t *)destData.mutableBytes;
+                                    int16_t *toBytes                = (int16_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int16_t)*fromBytes++;
                                     }
@@ -1789,9 +1774,9 @@
 
                                 case sizeof(int32_t):
                                 { // float complex -> int32_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes                = (int32_t *)destData.mutableBytes;
+                                    int32_t *toBytes                = (int32_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int32_t)*fromBytes++;
                                     }
@@ -1800,9 +1785,9 @@
 
                                 case sizeof(int64_t):
                                 { // float complex -> int64_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes                = (int64_t *)destData.mutableBytes;
+                                    int64_t *toBytes                = (int64_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int64_t)*fromBytes++;
                                     }
@@ -1815,9 +1800,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // float complex -> uint8_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes                = (uint8_t *)destData.mutableBytes;
+                                    uint8_t *toBytes                = (uint8_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint8_t)*fromBytes++;
                                     }
@@ -1826,9 +1811,9 @@
 
                                 case sizeof(uint16_t):
                                 { // float complex -> uint16_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes               = (uint16_t *)destData.mutableBytes;
+                                    uint16_t *toBytes               = (uint16_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint16_t)*fromBytes++;
                                     }
@@ -1837,9 +1822,9 @@
 
                                 case sizeof(uint32_t):
                                 { // float complex -> uint32_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes               = (uint32_t *)destData.mutableBytes;
+                                    uint32_t *toBytes               = (uint32_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint32_t)*fromBytes++;
                                     }
@@ -1848,9 +1833,9 @@
 
                                 case sizeof(uint64_t):
                                 { // float complex -> uint64_t
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes               = (uint64_t *)destData.mutableBytes;
+                                    uint64_t *toBytes               = (uint64_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint64_t)*fromBytes++;
                                     }
@@ -1863,9 +1848,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // float complex -> float
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    float *toBytes                  = (float *)destData.mutableBytes;
+                                    float *toBytes                  = (float *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float)*fromBytes++;
                                     }
@@ -1874,9 +1859,9 @@
 
                                 case sizeof(double):
                                 { // float complex -> double
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    double *toBytes                 = (double *)destData.mutableBytes;
+                                    double *toBytes                 = (double *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double)*fromBytes++;
                                     }
@@ -1889,15 +1874,15 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // float complex -> float complex
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(float complex));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(float complex));
                                 }
                                 break;
 
                                 case sizeof(double complex):
                                 { // float complex -> double complex
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes         = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes         = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double complex)*fromBytes++;
                                     }
@@ -1910,9 +1895,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // float complex -> NSDecimal
-                                    const float complex *fromBytes  = (const float complex *)sourceData.bytes;
+                                    const float complex *fromBytes  = (const float complex *)sourceBytes;
                                     const float complex *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes              = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes              = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromFloat(crealf(*fromBytes++));
                                     }
@@ -1932,9 +1917,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // double complex -> int8_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes                  = (int8_t *)destData.mutableBytes;
+                                    int8_t *toBytes                  = (int8_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int8_t)*fromBytes++;
                                     }
@@ -1943,9 +1928,9 @@
 
                                 case sizeof(int16_t):
                                 { // double complex -> int16_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes                 = (int16_t *)destData.mutableBytes;
+                                    int16_t *toBytes                 = (int16_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int16_t)*fromBytes++;
                                     }
@@ -1954,9 +1939,9 @@
 
                                 case sizeof(int32_t):
                                 { // double complex -> int32_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes                 = (int32_t *)destData.mutableBytes;
+                                    int32_t *toBytes                 = (int32_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int32_t)*fromBytes++;
                                     }
@@ -1965,9 +1950,9 @@
 
                                 case sizeof(int64_t):
                                 { // double complex -> int64_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes                 = (int64_t *)destData.mutableBytes;
+                                    int64_t *toBytes                 = (int64_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (int64_t)*fromBytes++;
                                     }
@@ -1980,9 +1965,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // double complex -> uint8_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes                 = (uint8_t *)destData.mutableBytes;
+                                    uint8_t *toBytes                 = (uint8_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint8_t)*fromBytes++;
                                     }
@@ -1991,9 +1976,9 @@
 
                                 case sizeof(uint16_t):
                                 { // double complex -> uint16_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes                = (uint16_t *)destData.mutableBytes;
+                                    uint16_t *toBytes                = (uint16_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint16_t)*fromBytes++;
                                     }
@@ -2002,9 +1987,9 @@
 
                                 case sizeof(uint32_t):
                                 { // double complex -> uint32_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes                = (uint32_t *)destData.mutableBytes;
+                                    uint32_t *toBytes                = (uint32_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint32_t)*fromBytes++;
                                     }
@@ -2013,9 +1998,9 @@
 
                                 case sizeof(uint64_t):
                                 { // double complex -> uint64_t
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes                = (uint64_t *)destData.mutableBytes;
+                                    uint64_t *toBytes                = (uint64_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (uint64_t)*fromBytes++;
                                     }
@@ -2028,9 +2013,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // double complex -> float
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    float *toBytes                   = (float *)destData.mutableBytes;
+                                    float *toBytes                   = (float *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float)*fromBytes++;
                                     }
@@ -2039,9 +2024,9 @@
 
                                 case sizeof(double):
                                 { // double complex -> double
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    double *toBytes                  = (double *)destData.mutableBytes;
+                                    double *toBytes                  = (double *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (double)*fromBytes++;
                                     }
@@ -2054,9 +2039,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // double complex -> float complex
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes           = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes           = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = (float complex)*fromBytes++;
                                     }
@@ -2065,7 +2050,7 @@
 
                                 case sizeof(double complex):
                                 { // double complex -> double complex
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(double complex));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(double complex));
                                 }
                                 break;
                             }
@@ -2075,9 +2060,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // double complex -> NSDecimal
-                                    const double complex *fromBytes  = (const double complex *)sourceData.bytes;
+                                    const double complex *fromBytes  = (const double complex *)sourceBytes;
                                     const double complex *lastSample = fromBytes + sampleCount;
-                                    NSDecimal *toBytes               = (NSDecimal *)destData.mutableBytes;
+                                    NSDecimal *toBytes               = (NSDecimal *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFromDouble(creal(*fromBytes++));
                                     }
@@ -2101,9 +2086,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(int8_t):
                                 { // NSDecimal -> int8_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    int8_t *toBytes             = (int8_t *)destData.mutableBytes;
+                                    int8_t *toBytes             = (int8_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalCharValue(*fromBytes++);
                                     }
@@ -2112,9 +2097,9 @@
 
                                 case sizeof(int16_t):
                                 { // NSDecimal -> int16_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    int16_t *toBytes            = (int16_t *)destData.mutableBytes;
+                                    int16_t *toBytes            = (int16_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalShortValue(*fromBytes++);
                                     }
@@ -2123,9 +2108,9 @@
 
                                 case sizeof(int32_t):
                                 { // NSDecimal -> int32_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    int32_t *toBytes            = (int32_t *)destData.mutableBytes;
+                                    int32_t *toBytes            = (int32_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalLongValue(*fromBytes++);
                                     }
@@ -2134,9 +2119,9 @@
 
                                 case sizeof(int64_t):
                                 { // NSDecimal -> int64_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    int64_t *toBytes            = (int64_t *)destData.mutableBytes;
+                                    int64_t *toBytes            = (int64_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalLongLongValue(*fromBytes++);
                                     }
@@ -2149,9 +2134,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(uint8_t):
                                 { // NSDecimal -> uint8_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    uint8_t *toBytes            = (uint8_t *)destData.mutableBytes;
+                                    uint8_t *toBytes            = (uint8_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalUnsignedCharValue(*fromBytes++);
                                     }
@@ -2160,9 +2145,9 @@
 
                                 case sizeof(uint16_t):
                                 { // NSDecimal -> uint16_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    uint16_t *toBytes           = (uint16_t *)destData.mutableBytes;
+                                    uint16_t *toBytes           = (uint16_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalUnsignedShortValue(*fromBytes++);
                                     }
@@ -2171,9 +2156,9 @@
 
                                 case sizeof(uint32_t):
                                 { // NSDecimal -> uint32_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    uint32_t *toBytes           = (uint32_t *)destData.mutableBytes;
+                                    uint32_t *toBytes           = (uint32_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalUnsignedLongValue(*fromBytes++);
                                     }
@@ -2182,9 +2167,9 @@
 
                                 case sizeof(uint64_t):
                                 { // NSDecimal -> uint64_t
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    uint64_t *toBytes           = (uint64_t *)destData.mutableBytes;
+                                    uint64_t *toBytes           = (uint64_t *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalUnsignedLongLongValue(*fromBytes++);
                                     }
@@ -2197,9 +2182,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float):
                                 { // NSDecimal -> float
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    float *toBytes              = (float *)destData.mutableBytes;
+                                    float *toBytes              = (float *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFloatValue(*fromBytes++);
                                     }
@@ -2208,9 +2193,9 @@
 
                                 case sizeof(double):
                                 { // NSDecimal -> double
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    double *toBytes             = (double *)destData.mutableBytes;
+                                    double *toBytes             = (double *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalDoubleValue(*fromBytes++);
                                     }
@@ -2223,9 +2208,9 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(float complex):
                                 { // NSDecimal -> float complex
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    float complex *toBytes      = (float complex *)destData.mutableBytes;
+                                    float complex *toBytes      = (float complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalFloatValue(*fromBytes++);
                                     }
@@ -2234,9 +2219,9 @@
 
                                 case sizeof(double complex):
                                 { // NSDecimal -> double complex
-                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceData.bytes;
+                                    const NSDecimal *fromBytes  = (const NSDecimal *)sourceBytes;
                                     const NSDecimal *lastSample = fromBytes + sampleCount;
-                                    double complex *toBytes     = (double complex *)destData.mutableBytes;
+                                    double complex *toBytes     = (double complex *)destBytes;
                                     while ( fromBytes < lastSample ) {
                                         *toBytes++ = CPTDecimalDoubleValue(*fromBytes++);
                                     }
@@ -2249,7 +2234,7 @@
                             switch ( destDataType->sampleBytes ) {
                                 case sizeof(NSDecimal):
                                 { // NSDecimal -> NSDecimal
-                                    memcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(NSDecimal));
+                                    memcpy(destBytes, sourceBytes, sampleCount * sizeof(NSDecimal));
                                 }
                                 break;
                             }
@@ -2264,58 +2249,298 @@
     // ========================================================================
 }
 
+/// @endcond
+
 /** @brief Swaps the byte order for each sample stored in a data buffer.
+ *
+ *  Each sample is reversed as a whole. Use @link CPTNumericData::swapByteOrderForData:dataType: -swapByteOrderForData:dataType: @endlink
+ *  to swap complex and NSDecimal samples.
  *  @param sourceData The data buffer.
  *  @param sampleSize The number of bytes in each sample stored in sourceData.
  **/
 -(void)swapByteOrderForData:(nonnull NSMutableData *)sourceData sampleSize:(size_t)sampleSize
 {
-    NSUInteger sampleCount;
+    CPTConversionKernel swapKernel = CPTByteSwapKernelForElementSize(sampleSize);
 
-    switch ( sampleSize ) {
-        case sizeof(uint16_t):
-        {
-            uint16_t *samples = (uint16_t *)sourceData.mutableBytes;
-            sampleCount = sourceData.length / sampleSize;
-            uint16_t *lastSample = samples + sampleCount;
-
-            while ( samples < lastSample ) {
-                uint16_t swapped = CFSwapInt16(*samples);
-                *samples++ = swapped;
-            }
+    if ( swapKernel ) {
+        NSUInteger sampleCount = sourceData.length / sampleSize;
+        void *samples          = sourceData.mutableBytes;
+
+        CPTConvertSamples(swapKernel, samples, sampleSize, samples, sampleSize, sampleCount);
+    }
+}
+
+/** @brief Swaps the byte order for each sample stored in a data buffer.
+ *
+ *  The real and imaginary parts of complex samples and the fields of NSDecimal samples are swapped separately.
+ *  @param sourceData The data buffer.
+ *  @param dataType The data type of the samples stored in sourceData.
+ **/
+-(void)swapByteOrderForData:(nonnull NSMutableData *)sourceData dataType:(CPTNumericDataType)dataType
+{
+    NSUInteger elementsPerSample   = 1;
+    CPTConversionKernel swapKernel = CPTByteSwapKernelForDataType(dataType, &elementsPerSample);
+
+    if ( swapKernel ) {
+        size_t elementBytes     = dataType.sampleBytes / elementsPerSample;
+        NSUInteger elementCount = sourceData.length / elementBytes;
+        void *samples           = sourceData.mutableBytes;
+
+        CPTConvertSamples(swapKernel, samples, elementBytes, samples, elementBytes, elementCount);
+    }
+}
+
+/** @brief Transposes a two-dimensional array of samples stored in row-major order.
+ *
+ *  The samples are copied one small tile at a time, and large arrays are split into bands of rows
+ *  that are transposed concurrently. The data type and byte order of the samples are not changed.
+ *  @param sourceData The source data buffer. It holds @par{rowCount} rows of @par{columnCount} samples each.
+ *  @param sampleSize The number of bytes in each sample.
+ *  @param rowCount The number of rows in the source array.
+ *  @param columnCount The number of columns in the source array.
+ *  @param destData The destination data buffer. It receives @par{columnCount} rows of @par{rowCount} samples each
+ *  and must not overlap the source buffer.
+ **/
+-(void)transposeData:(nonnull NSData *)sourceData
+          sampleSize:(size_t)sampleSize
+            rowCount:(NSUInteger)rowCount
+         columnCount:(NSUInteger)columnCount
+              toData:(nonnull NSMutableData *)destData
+{
+    NSParameterAssert(sampleSize > 0);
+    NSParameterAssert(sourceData.length >= rowCount * columnCount * sampleSize);
+    NSParameterAssert(destData.length >= rowCount * columnCount * sampleSize);
+    NSParameterAssert(sourceData != destData);
+
+    CPTTransposeSamples(sourceData.bytes, destData.mutableBytes, sampleSize, rowCount, columnCount);
+}
+
+/// @cond
+
+/**
+ *  @brief Determines whether two sample buffers share any memory.
+ *  @param fromBytes The source samples.
+ *  @param fromSampleBytes The number of bytes in each source sample.
+ *  @param toBytes The destination samples.
+ *  @param toSampleBytes The number of bytes in each destination sample.
+ *  @param sampleCount The number of samples in each buffer.
+ *  @return @YES if the buffers overlap.
+ **/
+static BOOL CPTBuffersOverlap(const void *__nonnull fromBytes, size_t fromSampleBytes, const void *__nonnull toBytes, size_t toSampleBytes, NSUInteger sampleCount)
+{
+    uintptr_t fromStart = (uintptr_t)fromBytes;
+    uintptr_t toStart   = (uintptr_t)toBytes;
+
+    return (toStart < fromStart + sampleCount * fromSampleBytes) && (fromStart < toStart + sampleCount * toSampleBytes);
+}
+
+/**
+ *  @brief Converts samples with a conversion kernel, splitting large buffers into chunks that are converted concurrently.
+ *
+ *  The source and destination may be the same buffer when the destination samples are not larger than the source samples.
+ *  Such conversions are not split.
+ *  @param kernel The conversion kernel.
+ *  @param fromBytes The source samples.
+ *  @param fromSampleBytes The number of bytes in each source sample.
+ *  @param toBytes The destination samples.
+ *  @param toSampleBytes The number of bytes in each destination sample.
+ *  @param sampleCount The number of samples to convert.
+ **/
+static void CPTConvertSamples(CPTConversionKernel kernel, const void *__nonnull fromBytes, size_t fromSampleBytes, void *__nonnull toBytes, size_t toSampleBytes, NSUInteger sampleCount)
+{
+    // In-place conversions must run in order so no chunk overwrites samples another chunk has not read yet.
+    // Samples that stay the same size in the same place, such as in-place byte swaps, are independent of each other.
+    BOOL overlapping = CPTBuffersOverlap(fromBytes, fromSampleBytes, toBytes, toSampleBytes, sampleCount) &&
+                       !((fromBytes == toBytes) && (fromSampleBytes == toSampleBytes));
+
+    if ((sampleCount < kCPTConversionParallelThreshold) || overlapping ) {
+        kernel(fromBytes, toBytes, sampleCount);
+        return;
+    }
+
+    size_t chunkCount = (sampleCount + kCPTConversionChunkSize - 1) / kCPTConversionChunkSize;
+
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+        NSUInteger start = chunk * kCPTConversionChunkSize;
+
+        kernel((const int8_t *)fromBytes + start * fromSampleBytes,
+               (int8_t *)toBytes + start * toSampleBytes,
+               MIN(kCPTConversionChunkSize, sampleCount - start));
+    });
+}
+
+/**
+ *  @brief Converts samples to a new data type and byte order in a single pass.
+ *
+ *  Samples that only differ in byte order are swapped directly from the source to the destination.
+ *  Otherwise, each block of source samples is swapped into a small scratch buffer if needed, converted into the destination,
+ *  and swapped in place while it is still in the cache. Large buffers are split into chunks that are converted concurrently.
+ *
+ *  The source and destination may be the same buffer when the destination samples are not larger than the source samples.
+ *  Such conversions are not split.
+ *  @param sourceBytes The source samples.
+ *  @param sourceDataType The data type and byte order of the source.
+ *  @param destBytes The destination samples.
+ *  @param destDataType The new data type and byte order.
+ *  @param sampleCount The number of samples to convert.
+ **/
+static void CPTConvertAndSwapBytes(const void *__nonnull sourceBytes, const CPTNumericDataType *__nonnull sourceDataType, void *__nonnull destBytes, const CPTNumericDataType *__nonnull destDataType, NSUInteger sampleCount)
+{
+    size_t sourceSampleBytes = sourceDataType->sampleBytes;
+    size_t destSampleBytes   = destDataType->sampleBytes;
+
+    if ((sourceDataType->dataTypeFormat == destDataType->dataTypeFormat) && (sourceSampleBytes == destSampleBytes)) {
+        NSUInteger elementsPerSample   = 1;
+        CPTConversionKernel swapKernel = NULL;
+
+        if ( sourceDataType->byteOrder != destDataType->byteOrder ) {
+            swapKernel = CPTByteSwapKernelForDataType(*sourceDataType, &elementsPerSample);
         }
-        break;
 
-        case sizeof(uint32_t):
-        {
-            uint32_t *samples = (uint32_t *)sourceData.mutableBytes;
-            sampleCount = sourceData.length / sampleSize;
-            uint32_t *lastSample = samples + sampleCount;
-
-            while ( samples < lastSample ) {
-                uint32_t swapped = CFSwapInt32(*samples);
-                *samples++ = swapped;
+        if ( swapKernel ) {
+            size_t elementBytes = sourceSampleBytes / elementsPerSample;
+
+            CPTConvertSamples(swapKernel, sourceBytes, elementBytes, destBytes, elementBytes, sampleCount * elementsPerSample);
+        }
+        else if ( sourceBytes != destBytes ) {
+            memmove(destBytes, sourceBytes, sampleCount * sourceSampleBytes);
+        }
+        return;
+    }
+
+    CFByteOrder hostByteOrder = CFByteOrderGetCurrent();
+
+    NSUInteger sourceElementsPerSample   = 1;
+    NSUInteger destElementsPerSample     = 1;
+    CPTConversionKernel sourceSwapKernel = NULL;
+    CPTConversionKernel destSwapKernel   = NULL;
+
+    if ( sourceDataType->byteOrder != hostByteOrder ) {
+        sourceSwapKernel = CPTByteSwapKernelForDataType(*sourceDataType, &sourceElementsPerSample);
+    }
+    if ( destDataType->byteOrder != hostByteOrder ) {
+        destSwapKernel = CPTByteSwapKernelForDataType(*destDataType, &destElementsPerSample);
+    }
+
+    void (^convertSampleRange)(NSUInteger, NSUInteger) = ^(NSUInteger start, NSUInteger count) {
+        uint8_t *scratch = NULL;
+
+        if ( sourceSwapKernel ) {
+            scratch = malloc(MIN(count, kCPTConversionBlockSize) * sourceSampleBytes);
+        }
+
+        for ( NSUInteger blockStart = start; blockStart < start + count; blockStart += kCPTConversionBlockSize ) {
+            NSUInteger blockCount = MIN(kCPTConversionBlockSize, start + count - blockStart);
+            const void *fromBytes = (const uint8_t *)sourceBytes + blockStart * sourceSampleBytes;
+            void *toBytes         = (uint8_t *)destBytes + blockStart * destSampleBytes;
+
+            if ( sourceSwapKernel ) {
+                sourceSwapKernel(fromBytes, scratch, blockCount * sourceElementsPerSample);
+                fromBytes = scratch;
+            }
+
+            CPTConvertBytes(fromBytes, sourceDataType, toBytes, destDataType, blockCount);
+
+            if ( destSwapKernel ) {
+                destSwapKernel(toBytes, toBytes, blockCount * destElementsPerSample);
             }
         }
-        break;
 
-        case sizeof(uint64_t):
-        {
-            uint64_t *samples = (uint64_t *)sourceData.mutableBytes;
-            sampleCount = sourceData.length / sampleSize;
-            uint64_t *lastSample = samples + sampleCount;
-
-            while ( samples < lastSample ) {
-                uint64_t swapped = CFSwapInt64(*samples);
-                *samples++ = swapped;
+        free(scratch);
+    };
+
+    if ((sampleCount < kCPTConversionParallelThreshold) ||
+        CPTBuffersOverlap(sourceBytes, sourceSampleBytes, destBytes, destSampleBytes, sampleCount)) {
+        convertSampleRange(0, sampleCount);
+        return;
+    }
+
+    size_t chunkCount = (sampleCount + kCPTConversionChunkSize - 1) / kCPTConversionChunkSize;
+
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+        NSUInteger start = chunk * kCPTConversionChunkSize;
+
+        convertSampleRange(start, MIN(kCPTConversionChunkSize, sampleCount - start));
+    });
+}
+
+/**
+ *  @brief Transposes a band of rows of samples of any size, one square tile at a time.
+ *  @param fromBytes The source samples.
+ *  @param toBytes The destination samples. Must not overlap the source samples.
+ *  @param sampleBytes The number of bytes in each sample.
+ *  @param rowCount The number of rows in the source array.
+ *  @param columnCount The number of columns in the source array.
+ *  @param firstRow The first source row to transpose.
+ *  @param lastRow The source row after the last row to transpose.
+ **/
+static void CPTTransposeBytes(const void *__nonnull fromBytes, void *__nonnull toBytes, size_t sampleBytes, NSUInteger rowCount, NSUInteger columnCount, NSUInteger firstRow, NSUInteger lastRow)
+{
+    const int8_t *fromSamples = (const int8_t *)fromBytes;
+    int8_t *toSamples         = (int8_t *)toBytes;
+
+    for ( NSUInteger tileRow = firstRow; tileRow < lastRow; tileRow += kCPTTransposeTileSize ) {
+        NSUInteger endRow = MIN(tileRow + kCPTTransposeTileSize, lastRow);
+
+        for ( NSUInteger tileColumn = 0; tileColumn < columnCount; tileColumn += kCPTTransposeTileSize ) {
+            NSUInteger endColumn = MIN(tileColumn + kCPTTransposeTileSize, columnCount);
+
+            for ( NSUInteger column = tileColumn; column < endColumn; column++ ) {
+                for ( NSUInteger row = tileRow; row < endRow; row++ ) {
+                    memcpy(toSamples + (column * rowCount + row) * sampleBytes,
+                           fromSamples + (row * columnCount + column) * sampleBytes,
+                           sampleBytes);
+                }
             }
         }
-        break;
+    }
+}
 
-        default:
-            // do nothing
-            break;
+/**
+ *  @brief Transposes a two-dimensional array of samples stored in row-major order.
+ *
+ *  Large arrays are split into bands of whole tile rows that are transposed concurrently.
+ *  Each band writes a separate part of every destination row, so the bands never write the same samples.
+ *  @param fromBytes The source samples.
+ *  @param toBytes The destination samples. Must not overlap the source samples.
+ *  @param sampleBytes The number of bytes in each sample.
+ *  @param rowCount The number of rows in the source array.
+ *  @param columnCount The number of columns in the source array.
+ **/
+static void CPTTransposeSamples(const void *__nonnull fromBytes, void *__nonnull toBytes, size_t sampleBytes, NSUInteger rowCount, NSUInteger columnCount)
+{
+    NSUInteger sampleCount = rowCount * columnCount;
+
+    if ( sampleCount == 0 ) {
+        return;
+    }
+
+    CPTTransposeKernel kernel = CPTTransposeKernelForSampleSize(sampleBytes);
+
+    void (^transposeRows)(NSUInteger, NSUInteger) = ^(NSUInteger firstRow, NSUInteger lastRow) {
+        if ( kernel ) {
+            kernel(fromBytes, toBytes, rowCount, columnCount, firstRow, lastRow);
+        }
+        else {
+            CPTTransposeBytes(fromBytes, toBytes, sampleBytes, rowCount, columnCount, firstRow, lastRow);
+        }
+    };
+
+    if ( sampleCount < kCPTConversionParallelThreshold ) {
+        transposeRows(0, rowCount);
+        return;
     }
+
+    NSUInteger rowsPerBand = MAX(kCPTConversionChunkSize / columnCount / kCPTTransposeTileSize, (NSUInteger)1) * kCPTTransposeTileSize;
+    size_t bandCount       = (rowCount + rowsPerBand - 1) / rowsPerBand;
+
+    dispatch_apply(bandCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t band) {
+        NSUInteger firstRow = band * rowsPerBand;
+
+        transposeRows(firstRow, MIN(firstRow + rowsPerBand, rowCount));
+    });
 }
 
+/// @endcond
+
 @end
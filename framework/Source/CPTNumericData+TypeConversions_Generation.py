@@ -52,6 +52,34 @@ null_values = { "int8_t" : "0",
              "NSDecimal" : "CPTDecimalNaN()"
 }
 
+vector_types = ["int8_t", "int16_t", "int32_t", "int64_t", "uint8_t", "uint16_t", "uint32_t", "uint64_t", "float", "double"]
+
+kernel_names = { "int8_t" : "Int8",
+                "int16_t" : "Int16",
+                "int32_t" : "Int32",
+                "int64_t" : "Int64",
+                "uint8_t" : "UInt8",
+               "uint16_t" : "UInt16",
+               "uint32_t" : "UInt32",
+               "uint64_t" : "UInt64",
+                  "float" : "Float",
+                 "double" : "Double"
+}
+
+def kernel_name(t, nt):
+    return "CPTConvert%sTo%s" % (kernel_names[t], kernel_names[nt])
+
+print "[CPTNumericData(TypeConversion) conversion kernels]"
+print ""
+for t in vector_types:
+    for nt in vector_types:
+        if ( t != nt ):
+            print "CPT_DEFINE_CONVERSION_KERNEL(%s, %s, %s)" % (kernel_name(t, nt), t, nt)
+
+print "\n\n"
+print "---------------"
+print "\n\n"
+
 print "[CPTNumericData sampleValue:]"
 print ""
 print "switch ( self.dataTypeFormat ) {"
@@ -110,7 +138,7 @@ print "\n\n"
 print "---------------"
 print "\n\n"
 
-print "[CPTNumericData convertData:dataType:toData:dataType:]"
+print "CPTConvertBytes()"
 print ""
 print "switch ( sourceDataType->dataTypeFormat ) {"
 for dt in dataTypes:
@@ -127,11 +155,13 @@ for dt in dataTypes:
                     for nt in types[ndt]:
                         print "\t\t\t\t\t\t\tcase sizeof(%s): { // %s -> %s" % (nt, t, nt)
                         if ( t == nt ):
-                            print "\t\t\t\t\t\t\t\t\tmemcpy(destData.mutableBytes, sourceData.bytes, sampleCount * sizeof(%s));" % t
+                            print "\t\t\t\t\t\t\t\t\tmemcpy(destBytes, sourceBytes, sampleCount * sizeof(%s));" % t
+                        elif ( (t in vector_types) and (nt in vector_types) ):
+                            print "\t\t\t\t\t\t\t\t\tCPTConvertSamples(%s, sourceBytes, sizeof(%s), destBytes, sizeof(%s), sampleCount);" % (kernel_name(t, nt), t, nt)
                         else:
-                            print "\t\t\t\t\t\t\t\t\tconst %s *fromBytes = (const %s *)sourceData.bytes;" % (t, t)
+                            print "\t\t\t\t\t\t\t\t\tconst %s *fromBytes = (const %s *)sourceBytes;" % (t, t)
                             print "\t\t\t\t\t\t\t\t\tconst %s *lastSample = fromBytes + sampleCount;" % t
-                            print "\t\t\t\t\t\t\t\t\t%s *toBytes = (%s *)destData.mutableBytes;" % (nt, nt)
+                            print "\t\t\t\t\t\t\t\t\t%s *toBytes = (%s *)destBytes;" % (nt, nt)
                             if ( t == "NSDecimal" ):
                                 print "\t\t\t\t\t\t\t\t\twhile ( fromBytes < lastSample ) *toBytes++ = CPTDecimal%sValue(*fromBytes++);" % nsnumber_factory[nt]
                             elif ( nt == "NSDecimal" ):
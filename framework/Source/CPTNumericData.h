@@ -24,6 +24,7 @@
 @property (nonatomic, readonly) NSUInteger numberOfDimensions;
 @property (nonatomic, readonly) NSUInteger numberOfSamples;
 @property (nonatomic, readonly) CPTDataOrder dataOrder;
+@property (nonatomic, readonly) NSUInteger sampleStride;
 /// @}
 
 /// @name Factory Methods
@@ -37,6 +38,8 @@
 +(nonnull instancetype)numericDataWithData:(nonnull NSData *)newData dataTypeString:(nonnull NSString *)newDataTypeString shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order;
 +(nonnull instancetype)numericDataWithArray:(nonnull CPTNumberArray *)newData dataType:(CPTNumericDataType)newDataType shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order;
 +(nonnull instancetype)numericDataWithArray:(nonnull CPTNumberArray *)newData dataTypeString:(nonnull NSString *)newDataTypeString shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order;
+
++(nullable instancetype)numericDataWithContentsOfURL:(nonnull NSURL *)url offset:(NSUInteger)offset length:(NSUInteger)length dataType:(CPTNumericDataType)newDataType shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order error:(NSError *__nullable *__nullable)error;
 /// @}
 
 /// @name Initialization
@@ -51,6 +54,8 @@
 -(nonnull instancetype)initWithArray:(nonnull CPTNumberArray *)newData dataType:(CPTNumericDataType)newDataType shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order;
 -(nonnull instancetype)initWithArray:(nonnull CPTNumberArray *)newData dataTypeString:(nonnull NSString *)newDataTypeString shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order;
 
+-(nullable instancetype)initWithContentsOfURL:(nonnull NSURL *)url offset:(NSUInteger)offset length:(NSUInteger)length dataType:(CPTNumericDataType)newDataType shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order error:(NSError *__nullable *__nullable)error;
+
 -(nullable instancetype)initWithCoder:(nonnull NSCoder *)coder NS_DESIGNATED_INITIALIZER;
 /// @}
 
@@ -61,7 +66,15 @@
 -(nullable const void *)samplePointerAtIndex:(NSUInteger)idx, ... NS_RETURNS_INNER_POINTER;
 -(nullable NSNumber *)sampleValue:(NSUInteger)sample;
 -(nullable NSNumber *)sampleValueAtIndex:(NSUInteger)idx, ...;
+-(nullable const void *)samplePointerAtRow:(NSUInteger)row column:(NSUInteger)column NS_RETURNS_INNER_POINTER;
 -(nonnull CPTNumberArray *)sampleArray;
 /// @}
 
+/// @name Slices
+/// @{
+// Slicing a CPTMutableNumericData object makes its next change copy its whole buffer.
+-(nonnull CPTNumericData *)sliceWithOffset:(NSUInteger)offset stride:(NSUInteger)stride count:(NSUInteger)count;
+-(nonnull CPTNumericData *)sliceForColumn:(NSUInteger)column;
+/// @}
+
 @end
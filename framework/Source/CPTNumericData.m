@@ -1,5 +1,6 @@
 #import "CPTNumericData.h"
 
+#import "_CPTMappedData.h"
 #import "complex.h"
 #import "CPTExceptions.h"
 #import "CPTMutableNumericData.h"
@@ -13,10 +14,20 @@
 @property (nonatomic, readwrite, assign) CPTNumericDataType dataType;
 @property (nonatomic, readwrite, copy, nonnull) CPTNumberArray *shape;
 @property (nonatomic, readwrite, assign) CPTDataOrder dataOrder;
+@property (nonatomic, readwrite, strong, nonnull) NSData *dataBuffer;
+@property (nonatomic, readwrite, assign) NSUInteger startOffset;
+@property (nonatomic, readwrite, assign, getter = isSharingData) BOOL sharingData;
+@property (nonatomic, readwrite, assign) NSUInteger sampleStride;
+@property (nonatomic, readwrite, assign) NSUInteger sliceSampleCount;
 
+-(nonnull instancetype)initWithSharedData:(nonnull NSData *)newData dataType:(CPTNumericDataType)newDataType shape:(nonnull CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order;
 -(void)commonInitWithData:(nonnull NSData *)newData dataType:(CPTNumericDataType)newDataType shape:(nullable CPTNumberArray *)shapeArray dataOrder:(CPTDataOrder)order;
 -(NSUInteger)sampleIndex:(NSUInteger)idx indexList:(va_list)indexList;
 -(nonnull NSData *)dataFromArray:(nonnull CPTNumberArray *)newData dataType:(CPTNumericDataType)newDataType;
+-(void)compactDataBuffer;
+-(void)unshareData;
+-(void)packSlice;
+-(nonnull NSMutableData *)contiguousSamples;
 
 @end
 
@@ -43,21 +54,75 @@
  *
  *  All integer and floating point types can be represented using big endian or little endian
  *  byte order. Complex and decimal types support only the the host system&rsquo;s native byte order.
+ *
+ *  A slice is a view of some of the samples of another CPTNumericData object. It shares the other object&rsquo;s
+ *  buffer and may skip samples, for example to read one column of a rows-first matrix without copying it.
+ *  Making or reading a slice never copies its samples: @ref bytes points to the first sample of the slice and
+ *  consecutive samples are @ref sampleStride samples apart. The samples are packed into a private contiguous
+ *  buffer only when the slice is first changed, such as through a mutable copy.
+ *
+ *  Samples can also be read directly from a file that is mapped into memory instead of being loaded.
+ *  The operating system reads each page of the file the first time it is used, so large files open quickly
+ *  and only the parts that are accessed take up memory.
  **/
 @implementation CPTNumericData
 
 /** @property nonnull NSData *data
  *  @brief The data buffer.
+ *
+ *  If the samples in use do not fill the whole underlying buffer, as for a slice of another object,
+ *  this returns a new copy of them every time it is called. Use @ref bytes and @ref length to read the samples
+ *  without copying them. After samples have been removed from the start of a mutable buffer without moving
+ *  the remaining samples (see @link CPTMutableNumericData::capacity capacity @endlink), the first call moves
+ *  them to the start of the buffer once and returns the buffer itself.
+ *  The copy of a slice with a @ref sampleStride greater than one holds only the samples of the slice.
  **/
 @synthesize data;
 
+/** @internal
+ *  @property nonnull NSData *dataBuffer
+ *  @brief The underlying storage, including any unused bytes before @ref startOffset.
+ **/
+@dynamic dataBuffer;
+
+/** @internal
+ *  @property NSUInteger startOffset
+ *  @brief The byte offset of the first sample in the @ref dataBuffer.
+ **/
+@synthesize startOffset;
+
+/** @internal
+ *  @property BOOL sharingData
+ *  @brief If @YES, the @ref dataBuffer is an immutable buffer shared with another object and must be copied before it is changed.
+ **/
+@synthesize sharingData;
+
+/** @property NSUInteger sampleStride
+ *  @brief The distance between consecutive samples in the data buffer, measured in samples.
+ *
+ *  This is @num{1} for contiguous samples. A slice with a larger stride reads every
+ *  @par{sampleStride}-th sample of a buffer it shares with another object, such as one column of a rows-first matrix.
+ **/
+@synthesize sampleStride;
+
+/** @internal
+ *  @property NSUInteger sliceSampleCount
+ *  @brief The number of samples in a slice or @ref NSNotFound if the samples extend to the end of the @ref dataBuffer.
+ **/
+@synthesize sliceSampleCount;
+
 /** @property nonnull const void *bytes
- *  @brief Returns a pointer to the data buffer’s contents.
+ *  @brief Returns a pointer to the first sample in the data buffer.
+ *
+ *  If the @ref sampleStride is greater than one, the samples are not contiguous; sample @par{i}
+ *  starts @par{i} &times; @ref sampleStride &times; @ref sampleBytes bytes after this pointer.
  **/
 @dynamic bytes;
 
 /** @property NSUInteger length
- *  @brief Returns the number of bytes contained in the data buffer.
+ *  @brief Returns the number of bytes of samples in the data buffer.
+ *
+ *  This is always @ref numberOfSamples &times; @ref sampleBytes, even if the @ref sampleStride is greater than one.
  **/
 @dynamic length;
 
@@ -257,6 +322,33 @@
                              dataOrder:order];
 }
 
+/** @brief Creates and returns a new CPTNumericData instance that reads its samples from a file.
+ *  @param url A file URL.
+ *  @param offset The byte offset of the first sample in the file.
+ *  @param length The number of bytes of sample data. Must be a multiple of the sample size.
+ *  @param newDataType The type of data stored in the file.
+ *  @param shapeArray The shape of the data buffer array.
+ *  @param order The data order for a multi-dimensional data array (row-major or column-major).
+ *  @param error Returns the reason the file could not be mapped.
+ *  @return A new CPTNumericData instance or @nil if the file could not be mapped.
+ **/
++(nullable instancetype)numericDataWithContentsOfURL:(nonnull NSURL *)url
+                                              offset:(NSUInteger)offset
+                                              length:(NSUInteger)length
+                                            dataType:(CPTNumericDataType)newDataType
+                                               shape:(nullable CPTNumberArray *)shapeArray
+                                           dataOrder:(CPTDataOrder)order
+                                               error:(NSError *__nullable *__nullable)error
+{
+    return [[self alloc] initWithContentsOfURL:url
+                                        offset:offset
+                                        length:length
+                                      dataType:newDataType
+                                         shape:shapeArray
+                                     dataOrder:order
+                                         error:error];
+}
+
 #pragma mark -
 #pragma mark Init/Dealloc
 
@@ -413,8 +505,95 @@
                      dataOrder:order];
 }
 
+/** @brief Initializes a newly allocated CPTNumericData object that reads its samples from a file.
+ *
+ *  The part of the file between @par{offset} and @par{offset} + @par{length} is mapped into memory read-only
+ *  instead of being copied. Pages are read from the file the first time they are accessed.
+ *  A mutable receiver copies the samples into memory the first time they change; the file is never modified.
+ *
+ *  Samples stored in a byte order other than the host byte order are kept as they are in the file
+ *  and are swapped when they are converted to another data type, for example when a plot caches them.
+ *  @param url A file URL.
+ *  @param offset The byte offset of the first sample in the file.
+ *  @param length The number of bytes of sample data. Must be a multiple of the sample size.
+ *  @param newDataType The type of data stored in the file.
+ *  @param shapeArray The shape of the data buffer array.
+ *  @param order The data order for a multi-dimensional data array (row-major or column-major).
+ *  @param error Returns the reason the file could not be mapped.
+ *  @return The initialized CPTNumericData instance or @nil if the file could not be mapped.
+ **/
+-(nullable instancetype)initWithContentsOfURL:(nonnull NSURL *)url
+                                       offset:(NSUInteger)offset
+                                       length:(NSUInteger)length
+                                     dataType:(CPTNumericDataType)newDataType
+                                        shape:(nullable CPTNumberArray *)shapeArray
+                                    dataOrder:(CPTDataOrder)order
+                                        error:(NSError *__nullable *__nullable)error
+{
+    NSParameterAssert(CPTDataTypeIsSupported(newDataType));
+    NSParameterAssert(newDataType.dataTypeFormat != CPTUndefinedDataType);
+    NSParameterAssert(length % newDataType.sampleBytes == 0);
+
+    NSUInteger sampleCount   = length / newDataType.sampleBytes;
+    CPTNumberArray *theShape = shapeArray;
+
+    if ( theShape == nil ) {
+        theShape = @[@(sampleCount)];
+    }
+    else {
+        NSUInteger prod = 1;
+        for ( NSNumber *cNum in theShape ) {
+            prod *= cNum.unsignedIntegerValue;
+        }
+
+        if ( prod != sampleCount ) {
+            [NSException raise:CPTNumericDataException
+                        format:@"Shape product (%lu) does not match data size (%lu)", (unsigned long)prod, (unsigned long)sampleCount];
+        }
+    }
+
+    NSData *mappedData = [_CPTMappedData dataWithContentsOfURL:url offset:offset length:length error:error];
+
+    if ( !mappedData ) {
+        return nil;
+    }
+
+    // adopt the mapping without copying; a mutable receiver copies the samples the first time they change
+    return [self initWithSharedData:mappedData
+                           dataType:newDataType
+                              shape:theShape
+                          dataOrder:order];
+}
+
 /// @cond
 
+/** @internal
+ *  @brief Initializes a newly allocated CPTNumericData object that shares an immutable data buffer.
+ *
+ *  The buffer is adopted without copying. A mutable receiver copies it the first time the data changes.
+ *  @param newData The immutable data buffer.
+ *  @param newDataType The type of data stored in the buffer.
+ *  @param shapeArray The shape of the data buffer array.
+ *  @param order The data order for a multi-dimensional data array (row-major or column-major).
+ *  @return The initialized CPTNumericData instance.
+ **/
+-(nonnull instancetype)initWithSharedData:(nonnull NSData *)newData
+                                 dataType:(CPTNumericDataType)newDataType
+                                    shape:(nonnull CPTNumberArray *)shapeArray
+                                dataOrder:(CPTDataOrder)order
+{
+    if ((self = [self initWithData:[NSData data]
+                          dataType:newDataType
+                             shape:nil
+                         dataOrder:order])) {
+        data        = newData;
+        shape       = [shapeArray copy];
+        sharingData = YES;
+    }
+
+    return self;
+}
+
 -(nonnull instancetype)init
 {
     return [self initWithData:[NSData data]
@@ -429,6 +608,9 @@
 {
     NSParameterAssert(CPTDataTypeIsSupported(newDataType));
 
+    self.sampleStride     = 1;
+    self.sliceSampleCount = NSNotFound;
+
     self.data      = newData;
     self.dataType  = newDataType;
     self.dataOrder = order;
@@ -467,12 +649,50 @@
 
 -(nonnull const void *)bytes
 {
-    return self.data.bytes;
+    return (const int8_t *)data.bytes + self.startOffset;
 }
 
 -(NSUInteger)length
 {
-    return self.data.length;
+    NSUInteger sliceCount = self.sliceSampleCount;
+
+    if ( sliceCount != NSNotFound ) {
+        return sliceCount * self.sampleBytes;
+    }
+    else {
+        return data.length - self.startOffset;
+    }
+}
+
+-(nonnull NSData *)data
+{
+    if ( self.sampleStride > 1 ) {
+        return [self contiguousSamples];
+    }
+
+    NSUInteger offset   = self.startOffset;
+    NSUInteger myLength = self.length;
+
+    if ((offset == 0) && (myLength == data.length)) {
+        return data;
+    }
+    else {
+        return [data subdataWithRange:NSMakeRange(offset, myLength)];
+    }
+}
+
+-(nonnull NSData *)dataBuffer
+{
+    return data;
+}
+
+-(void)setDataBuffer:(nonnull NSData *)newDataBuffer
+{
+    data                  = newDataBuffer;
+    self.startOffset      = 0;
+    self.sampleStride     = 1;
+    self.sliceSampleCount = NSNotFound;
+    self.sharingData      = NO;
 }
 
 -(NSUInteger)numberOfSamples
@@ -504,6 +724,10 @@
         else {
             data = [newData copy];
         }
+        self.startOffset      = 0;
+        self.sampleStride     = 1;
+        self.sliceSampleCount = NSNotFound;
+        self.sharingData      = NO;
     }
 }
 
@@ -519,6 +743,9 @@
     NSParameterAssert(newDataType.dataTypeFormat != CPTUndefinedDataType);
     NSParameterAssert(newDataType.byteOrder != CFByteOrderUnknown);
 
+    // gather the samples of a slice while they can still be read with the old sample size
+    [self packSlice];
+
     dataType = newDataType;
 
     if ((oldDataType.sampleBytes == sizeof(int8_t)) && (newDataType.sampleBytes == sizeof(int8_t))) {
@@ -526,37 +753,33 @@
     }
 
     if ((oldDataType.dataTypeFormat != CPTUndefinedDataType) && (oldDataType.byteOrder != CFByteOrderUnknown)) {
-        NSMutableData *myData     = (NSMutableData *)self.data;
-        CFByteOrder hostByteOrder = CFByteOrderGetCurrent();
+        [self unshareData];
+        [self compactDataBuffer];
 
-        NSUInteger sampleCount = myData.length / oldDataType.sampleBytes;
+        NSMutableData *myData = (NSMutableData *)data;
 
-        if ( oldDataType.byteOrder != hostByteOrder ) {
-            [self swapByteOrderForData:myData sampleSize:oldDataType.sampleBytes];
-        }
+        NSUInteger sampleCount = myData.length / oldDataType.sampleBytes;
 
         if ( newDataType.sampleBytes > oldDataType.sampleBytes ) {
             NSData *oldData = [myData copy];
             myData.length = sampleCount * newDataType.sampleBytes;
-            [self convertData:oldData dataType:&oldDataType toData:myData dataType:&newDataType];
+            [self convertAndSwapData:oldData dataType:&oldDataType toData:myData dataType:&newDataType];
         }
         else {
-            [self convertData:myData dataType:&oldDataType toData:myData dataType:&newDataType];
+            [self convertAndSwapData:myData dataType:&oldDataType toData:myData dataType:&newDataType];
             myData.length = sampleCount * newDataType.sampleBytes;
         }
-
-        if ( newDataType.byteOrder != hostByteOrder ) {
-            [self swapByteOrderForData:myData sampleSize:newDataType.sampleBytes];
-        }
     }
 }
 
 -(void)setShape:(nonnull CPTNumberArray *)newShape
 {
     if ( newShape != shape ) {
+        [self unshareData];
+
         shape = [newShape copy];
 
-        NSMutableData *myData = (NSMutableData *)self.data;
+        NSMutableData *myData = (NSMutableData *)data;
 
         if ( [myData isKindOfClass:[NSMutableData class]] ) {
             NSUInteger sampleCount = 1;
@@ -564,7 +787,7 @@
                 sampleCount *= num.unsignedIntegerValue;
             }
 
-            myData.length = sampleCount * self.sampleBytes;
+            myData.length = self.startOffset + sampleCount * self.sampleBytes;
         }
     }
 }
@@ -728,7 +951,7 @@
 -(nullable const void *)samplePointer:(NSUInteger)sample
 {
     if ( sample < self.numberOfSamples ) {
-        return (const void *)((const char *)self.bytes + sample * self.sampleBytes);
+        return (const void *)((const char *)data.bytes + self.startOffset + sample * self.sampleStride * self.sampleBytes);
     }
     else {
         return NULL;
@@ -759,6 +982,41 @@
     return [self samplePointer:newIndex];
 }
 
+/** @brief Gets a pointer to a given sample in a two-dimensional data buffer.
+ *
+ *  Unlike @link CPTNumericData::samplePointerAtIndex: -samplePointerAtIndex: @endlink, this method does not
+ *  read a variable argument list, so it is suited to accessing many samples in a loop.
+ *  @param row The zero-based row index.
+ *  @param column The zero-based column index.
+ *  @return A pointer to the sample or @NULL if either index is out of bounds.
+ **/
+-(nullable const void *)samplePointerAtRow:(NSUInteger)row column:(NSUInteger)column
+{
+    NSParameterAssert(self.numberOfDimensions == 2);
+
+    CPTNumberArray *theShape = self.shape;
+    NSUInteger rowCount      = theShape[0].unsignedIntegerValue;
+    NSUInteger columnCount   = theShape[1].unsignedIntegerValue;
+
+    if ((row >= rowCount) || (column >= columnCount)) {
+        return NULL;
+    }
+
+    NSUInteger idx = 0;
+
+    switch ( self.dataOrder ) {
+        case CPTDataOrderRowsFirst:
+            idx = row * columnCount + column;
+            break;
+
+        case CPTDataOrderColumnsFirst:
+            idx = row + column * rowCount;
+            break;
+    }
+
+    return [self samplePointer:idx];
+}
+
 /** @brief Gets an array data samples from the receiver.
  *  @return An NSArray of NSNumber objects representing the data from the receiver.
  *
@@ -863,6 +1121,87 @@
     return newIndex;
 }
 
+/** @internal
+ *  @brief Moves the samples in use to the start of the data buffer and releases any unused leading bytes.
+ **/
+-(void)compactDataBuffer
+{
+    [self packSlice];
+
+    NSUInteger offset = self.startOffset;
+
+    if ( offset > 0 ) {
+        [self unshareData];
+
+        NSMutableData *myData = (NSMutableData *)data;
+        NSUInteger newLength  = myData.length - offset;
+        int8_t *buffer        = (int8_t *)myData.mutableBytes;
+
+        memmove(buffer, buffer + offset, newLength);
+        myData.length    = newLength;
+        self.startOffset = 0;
+    }
+}
+
+/** @internal
+ *  @brief Replaces a shared data buffer with a private mutable copy so it can be changed.
+ **/
+-(void)unshareData
+{
+    if ( self.sharingData ) {
+        if ( self.sliceSampleCount != NSNotFound ) {
+            [self packSlice];
+        }
+        else {
+            data             = [data mutableCopy];
+            self.sharingData = NO;
+        }
+    }
+}
+
+/** @internal
+ *  @brief Copies the samples of a slice into a private contiguous buffer before the slice is changed.
+ *
+ *  Does nothing if the receiver is not a slice.
+ **/
+-(void)packSlice
+{
+    if ( self.sliceSampleCount == NSNotFound ) {
+        return;
+    }
+
+    data                  = [self contiguousSamples];
+    self.startOffset      = 0;
+    self.sampleStride     = 1;
+    self.sliceSampleCount = NSNotFound;
+    self.sharingData      = NO;
+}
+
+/** @internal
+ *  @brief Copies the samples in use into a new contiguous buffer without changing the receiver.
+ *  @return The samples.
+ **/
+-(nonnull NSMutableData *)contiguousSamples
+{
+    size_t sampleSize      = self.sampleBytes;
+    NSUInteger stride      = self.sampleStride;
+    NSUInteger sampleCount = self.numberOfSamples;
+    const int8_t *source   = (const int8_t *)data.bytes + self.startOffset;
+
+    if ( stride == 1 ) {
+        return [[NSMutableData alloc] initWithBytes:source length:sampleCount * sampleSize];
+    }
+
+    NSMutableData *samples = [[NSMutableData alloc] initWithLength:sampleCount * sampleSize];
+    int8_t *destination    = (int8_t *)samples.mutableBytes;
+
+    for ( NSUInteger i = 0; i < sampleCount; i++ ) {
+        memcpy(destination + i * sampleSize, source + i * stride * sampleSize, sampleSize);
+    }
+
+    return samples;
+}
+
 -(nonnull NSData *)dataFromArray:(nonnull CPTNumberArray *)newData dataType:(CPTNumericDataType)newDataType
 {
     NSParameterAssert(CPTDataTypeIsSupported(newDataType));
@@ -1086,7 +1425,7 @@
     // ========================================================================
 
     if ((newDataType.byteOrder != CFByteOrderGetCurrent()) && (newDataType.byteOrder != CFByteOrderUnknown)) {
-        [self swapByteOrderForData:sampleData sampleSize:newDataType.sampleBytes];
+        [self swapByteOrderForData:sampleData dataType:newDataType];
     }
 
     return sampleData;
@@ -1094,6 +1433,81 @@
 
 /// @endcond
 
+#pragma mark -
+#pragma mark Slices
+
+/** @brief Creates a one-dimensional view of some of the samples of the receiver without copying them.
+ *
+ *  The slice shares the receiver&rsquo;s buffer and reads the samples in place. A mutable receiver copies its
+ *  buffer the next time it is changed, so later changes to the receiver do not show in the slice.
+ *
+ *  @note Slicing a CPTMutableNumericData object is cheap, but the next change to that object, such as
+ *  an append, a removal or a write through @link CPTMutableNumericData::mutableBytes mutableBytes @endlink,
+ *  copies its whole buffer. Slice a copy instead, or make the changes before slicing, when
+ *  a large buffer is changed often.
+ *
+ *  @param offset The index of the first sample of the slice. The receiver is treated as if it only has one dimension.
+ *  @param stride The distance between consecutive samples of the slice, measured in samples of the receiver. Must be greater than zero.
+ *  @param count The number of samples in the slice.
+ *  @return A new CPTNumericData instance.
+ **/
+-(nonnull CPTNumericData *)sliceWithOffset:(NSUInteger)offset stride:(NSUInteger)stride count:(NSUInteger)count
+{
+    NSParameterAssert(stride > 0);
+    NSParameterAssert((count == 0) || (offset + (count - 1) * stride < self.numberOfSamples));
+
+    // the receiver copies the shared buffer before it changes it
+    if ( [self isKindOfClass:[CPTMutableNumericData class]] ) {
+        self.sharingData = YES;
+    }
+
+    size_t sampleSize       = self.sampleBytes;
+    NSUInteger bufferStride = self.sampleStride;
+
+    CPTNumericData *slice = [[CPTNumericData alloc] initWithSharedData:data
+                                                              dataType:self.dataType
+                                                                 shape:@[@(count)]
+                                                             dataOrder:CPTDataOrderRowsFirst];
+
+    slice.startOffset      = self.startOffset + offset * bufferStride * sampleSize;
+    slice.sampleStride     = bufferStride * stride;
+    slice.sliceSampleCount = count;
+
+    return slice;
+}
+
+/** @brief Creates a view of one column of a two-dimensional data buffer without copying the samples.
+ *
+ *  The samples of a column of a #CPTDataOrderColumnsFirst array are contiguous. The slice of a column
+ *  of a #CPTDataOrderRowsFirst array has a @ref sampleStride equal to the number of columns.
+ *  @param column The zero-based column index.
+ *  @return A new one-dimensional CPTNumericData instance with one sample for each row.
+ **/
+-(nonnull CPTNumericData *)sliceForColumn:(NSUInteger)column
+{
+    NSParameterAssert(self.numberOfDimensions == 2);
+
+    CPTNumberArray *theShape = self.shape;
+    NSUInteger rowCount      = theShape[0].unsignedIntegerValue;
+    NSUInteger columnCount   = theShape[1].unsignedIntegerValue;
+
+    NSParameterAssert(column < columnCount);
+
+    CPTNumericData *slice = nil;
+
+    switch ( self.dataOrder ) {
+        case CPTDataOrderRowsFirst:
+            slice = [self sliceWithOffset:column stride:columnCount count:rowCount];
+            break;
+
+        case CPTDataOrderColumnsFirst:
+            slice = [self sliceWithOffset:column * rowCount stride:1 count:rowCount];
+            break;
+    }
+
+    return slice;
+}
+
 #pragma mark -
 #pragma mark Description
 
@@ -1128,10 +1542,31 @@
 
 -(nonnull id)mutableCopyWithZone:(nullable NSZone *)zone
 {
-    return [[CPTMutableNumericData allocWithZone:zone] initWithData:self.data
-                                                           dataType:self.dataType
-                                                              shape:self.shape
-                                                          dataOrder:self.dataOrder];
+    if ( [self isKindOfClass:[CPTMutableNumericData class]] && !self.sharingData ) {
+        CPTMutableNumericData *numericData = [[CPTMutableNumericData allocWithZone:zone] initWithSharedData:[NSData data]
+                                                                                                   dataType:self.dataType
+                                                                                                      shape:self.shape
+                                                                                                  dataOrder:self.dataOrder];
+
+        // copy only the samples in use, once
+        numericData.dataBuffer = [[NSMutableData alloc] initWithBytes:self.bytes length:self.length];
+
+        return numericData;
+    }
+    else {
+        // the data buffer of an immutable object or a shared buffer never changes, so the copy can share it until the copy is modified
+        CPTMutableNumericData *numericData = [[CPTMutableNumericData allocWithZone:zone] initWithSharedData:data
+                                                                                                   dataType:self.dataType
+                                                                                                      shape:self.shape
+                                                                                                  dataOrder:self.dataOrder];
+
+        // a copy of a slice shares the same samples of the buffer
+        numericData.startOffset      = self.startOffset;
+        numericData.sampleStride     = self.sampleStride;
+        numericData.sliceSampleCount = self.sliceSampleCount;
+
+        return numericData;
+    }
 }
 
 /// @endcond
@@ -1143,10 +1578,25 @@
 
 -(nonnull id)copyWithZone:(nullable NSZone *)zone
 {
-    return [[[self class] allocWithZone:zone] initWithData:self.data
-                                                  dataType:self.dataType
-                                                     shape:self.shape
-                                                 dataOrder:self.dataOrder];
+    CPTNumericData *numericData = [[[self class] allocWithZone:zone] initWithSharedData:data
+                                                                               dataType:self.dataType
+                                                                                  shape:self.shape
+                                                                              dataOrder:self.dataOrder];
+
+    if ( [self isKindOfClass:[CPTMutableNumericData class]] && !self.sharingData ) {
+        // the buffer of a mutable object can change, so copy only the samples in use, once
+        Class bufferClass = [numericData isKindOfClass:[CPTMutableNumericData class]] ? [NSMutableData class] : [NSData class];
+
+        numericData.dataBuffer = [[bufferClass alloc] initWithBytes:self.bytes length:self.length];
+    }
+    else {
+        // a copy of a slice shares the same samples of the buffer
+        numericData.startOffset      = self.startOffset;
+        numericData.sampleStride     = self.sampleStride;
+        numericData.sliceSampleCount = self.sliceSampleCount;
+    }
+
+    return numericData;
 }
 
 /// @endcond
@@ -1,6 +1,7 @@
 #import "CPTNumericDataTests.h"
 
 #import "CPTExceptions.h"
+#import "CPTMutableNumericData.h"
 #import "CPTNumericData+TypeConversion.h"
 
 @implementation CPTNumericDataTests
@@ -321,4 +322,254 @@
     }
 }
 
+#pragma mark -
+#pragma mark Slices
+
+-(void)testSliceForColumnSharesRowsFirstBuffer
+{
+    const NSUInteger rows = 4;
+    const NSUInteger cols = 3;
+
+    NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sizeof(double)];
+    double *samples     = (double *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < rows * cols; i++ ) {
+        samples[i] = (double)i;
+    }
+
+    CPTNumericData *nd = [[CPTNumericData alloc] initWithData:data
+                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                        shape:@[@(rows), @(cols)]
+                                                    dataOrder:CPTDataOrderRowsFirst];
+
+    CPTNumericData *column = [nd sliceForColumn:1];
+
+    XCTAssertEqual(column.numberOfSamples, rows, @"one sample per row");
+    XCTAssertEqual(column.length, rows * sizeof(double), @"length");
+    XCTAssertEqual(column.sampleStride, cols, @"stride spans one row");
+    XCTAssertEqual(column.bytes, [nd samplePointerAtRow:0 column:1], @"the slice shares the buffer");
+
+    for ( NSUInteger i = 0; i < rows; i++ ) {
+        XCTAssertEqual([column samplePointer:i], [nd samplePointerAtRow:i column:1], @"sample %lu is shared", (unsigned long)i);
+        XCTAssertEqualObjects([column sampleValue:i], @(i * cols + 1), @"sample %lu", (unsigned long)i);
+    }
+    XCTAssertNil([column sampleValue:rows], @"out of bounds");
+
+    // the samples are read through the stride
+    const double *columnSamples = (const double *)column.bytes;
+
+    for ( NSUInteger i = 0; i < rows; i++ ) {
+        XCTAssertEqual(columnSamples[i * column.sampleStride], (double)(i * cols + 1), @"strided sample %lu", (unsigned long)i);
+    }
+
+    // the data property gathers the samples without changing the slice
+    NSData *gathered = column.data;
+
+    XCTAssertEqual(gathered.length, rows * sizeof(double), @"gathered length");
+    for ( NSUInteger i = 0; i < rows; i++ ) {
+        XCTAssertEqual(((const double *)gathered.bytes)[i], (double)(i * cols + 1), @"gathered sample %lu", (unsigned long)i);
+    }
+    XCTAssertEqual(column.sampleStride, cols, @"still strided");
+    XCTAssertEqual(column.bytes, [nd samplePointerAtRow:0 column:1], @"still shared");
+}
+
+-(void)testSliceForColumnSharesColumnsFirstBuffer
+{
+    const NSUInteger rows = 4;
+    const NSUInteger cols = 3;
+
+    NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sizeof(double)];
+    double *samples     = (double *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < rows * cols; i++ ) {
+        samples[i] = (double)i;
+    }
+
+    CPTNumericData *nd = [[CPTNumericData alloc] initWithData:data
+                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                        shape:@[@(rows), @(cols)]
+                                                    dataOrder:CPTDataOrderColumnsFirst];
+
+    CPTNumericData *column = [nd sliceForColumn:2];
+
+    XCTAssertEqual(column.numberOfSamples, rows, @"one sample per row");
+    XCTAssertEqual(column.length, rows * sizeof(double), @"length");
+
+    for ( NSUInteger i = 0; i < rows; i++ ) {
+        XCTAssertEqual([column samplePointer:i], [nd samplePointerAtRow:i column:2], @"sample %lu is shared", (unsigned long)i);
+        XCTAssertEqualObjects([column sampleValue:i], @(2 * rows + i), @"sample %lu", (unsigned long)i);
+    }
+    XCTAssertEqual(column.data.length, rows * sizeof(double), @"data ends with the slice");
+}
+
+-(void)testSliceOfSliceSharesBufferWithCombinedStride
+{
+    const NSUInteger nElems = 20;
+
+    NSMutableData *data = [NSMutableData dataWithLength:nElems * sizeof(int32_t)];
+    int32_t *samples    = (int32_t *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < nElems; i++ ) {
+        samples[i] = (int32_t)i;
+    }
+
+    CPTNumericData *nd = [[CPTNumericData alloc] initWithData:data
+                                                     dataType:CPTDataType(CPTIntegerDataType, sizeof(int32_t), NSHostByteOrder())
+                                                        shape:nil];
+
+    CPTNumericData *evens = [nd sliceWithOffset:2 stride:2 count:9];
+    CPTNumericData *slice = [evens sliceWithOffset:1 stride:3 count:3];
+
+    XCTAssertEqual(slice.sampleStride, (NSUInteger)6, @"combined stride");
+    XCTAssertEqual(slice.bytes, [nd samplePointer:4], @"the slice shares the original buffer");
+    XCTAssertEqual([slice samplePointer:2], [nd samplePointer:16], @"last sample is shared");
+    XCTAssertEqualObjects(slice.sampleArray, (@[@4, @10, @16]), @"samples");
+    XCTAssertEqual(slice.length, 3 * sizeof(int32_t), @"length");
+}
+
+-(void)testMutableCopyOfSliceCopiesOnWrite
+{
+    const NSUInteger rows = 5;
+    const NSUInteger cols = 2;
+
+    NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sizeof(float)];
+    float *samples      = (float *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < rows * cols; i++ ) {
+        samples[i] = (float)i;
+    }
+
+    CPTNumericData *nd = [[CPTNumericData alloc] initWithData:data
+                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(float), NSHostByteOrder())
+                                                        shape:@[@(rows), @(cols)]
+                                                    dataOrder:CPTDataOrderRowsFirst];
+
+    CPTMutableNumericData *column = [[nd sliceForColumn:1] mutableCopy];
+
+    XCTAssertEqual(column.sampleStride, cols, @"the copy shares the slice");
+    XCTAssertEqual([column samplePointer:0], [nd samplePointerAtRow:0 column:1], @"the copy shares the buffer");
+
+    float *columnSamples = (float *)column.mutableBytes;
+    columnSamples[0] = -1.0f;
+
+    XCTAssertEqual(column.sampleStride, (NSUInteger)1, @"packed before changing");
+    XCTAssertNotEqual([column samplePointer:0], [nd samplePointerAtRow:0 column:1], @"copied before changing");
+    XCTAssertEqual(*(const float *)[nd samplePointerAtRow:0 column:1], 1.0f, @"original is unchanged");
+    XCTAssertEqual(*(const float *)[column samplePointer:1], 3.0f, @"other samples are copied");
+    XCTAssertEqual(column.numberOfSamples, rows, @"only the slice is copied");
+}
+
+-(void)testSliceOfMutableDataCopiesOnWrite
+{
+    const NSUInteger nElems = 10;
+
+    CPTMutableNumericData *nd = [[CPTMutableNumericData alloc] initWithData:[NSMutableData dataWithLength:nElems * sizeof(double)]
+                                                                   dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                      shape:nil];
+    double *samples = (double *)nd.mutableBytes;
+
+    for ( NSUInteger i = 0; i < nElems; i++ ) {
+        samples[i] = (double)i;
+    }
+
+    CPTNumericData *odds = [nd sliceWithOffset:1 stride:2 count:nElems / 2];
+
+    XCTAssertEqual(odds.bytes, [nd samplePointer:1], @"the slice shares the buffer");
+
+    ((double *)nd.mutableBytes)[1] = -1.0;
+
+    XCTAssertNotEqual(odds.bytes, [nd samplePointer:1], @"the receiver copies its buffer before changing it");
+    XCTAssertEqualObjects([odds sampleValue:0], @1.0, @"the slice is unchanged");
+    XCTAssertEqualObjects([nd sampleValue:1], @(-1.0), @"the receiver is changed");
+}
+
+#pragma mark -
+#pragma mark File-backed data
+
+-(void)testFileBackedDataReadsSamples
+{
+    const NSUInteger headerLength = 12;
+    const NSUInteger nElems       = 1000;
+
+    NSMutableData *fileData = [NSMutableData dataWithLength:headerLength + nElems * sizeof(double)];
+    double *samples         = (double *)((int8_t *)fileData.mutableBytes + headerLength);
+
+    for ( NSUInteger i = 0; i < nElems; i++ ) {
+        samples[i] = sin(i);
+    }
+
+    NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+    XCTAssertTrue([fileData writeToURL:url atomically:NO], @"write test file");
+
+    NSError *error     = nil;
+    CPTNumericData *nd = [CPTNumericData numericDataWithContentsOfURL:url
+                                                               offset:headerLength
+                                                               length:nElems * sizeof(double)
+                                                             dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                shape:@[@(nElems / 2), @2]
+                                                            dataOrder:CPTDataOrderColumnsFirst
+                                                                error:&error];
+
+    XCTAssertNotNil(nd, @"mapped data: %@", error);
+    XCTAssertEqual(nd.numberOfSamples, nElems, @"number of samples");
+    XCTAssertEqual(nd.numberOfDimensions, (NSUInteger)2, @"number of dimensions");
+    XCTAssertEqual(memcmp(nd.bytes, samples, nElems * sizeof(double)), 0, @"samples match the file");
+
+    // subranges share the mapping
+    NSData *column = [nd.data subdataWithRange:NSMakeRange(nElems / 2 * sizeof(double), nElems / 2 * sizeof(double))];
+    XCTAssertEqual(column.bytes, (const void *)((const double *)nd.bytes + nElems / 2), @"subrange shares the mapping");
+
+    [[NSFileManager defaultManager] removeItemAtURL:url error:NULL];
+}
+
+-(void)testFileBackedMutableDataCopiesOnWrite
+{
+    const NSUInteger nElems = 10;
+
+    NSMutableData *fileData = [NSMutableData dataWithLength:nElems * sizeof(float)];
+    float *samples          = (float *)fileData.mutableBytes;
+
+    for ( NSUInteger i = 0; i < nElems; i++ ) {
+        samples[i] = sinf(i);
+    }
+
+    NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+    XCTAssertTrue([fileData writeToURL:url atomically:NO], @"write test file");
+
+    CPTMutableNumericData *nd = [CPTMutableNumericData numericDataWithContentsOfURL:url
+                                                                             offset:0
+                                                                             length:nElems * sizeof(float)
+                                                                           dataType:CPTDataType(CPTFloatingPointDataType, sizeof(float), NSHostByteOrder())
+                                                                              shape:nil
+                                                                          dataOrder:CPTDataOrderRowsFirst
+                                                                              error:NULL];
+
+    XCTAssertNotNil(nd, @"mapped data");
+
+    float *mutableSamples = (float *)nd.mutableBytes;
+    mutableSamples[0] = 42.0f;
+
+    XCTAssertEqual(*(const float *)[nd samplePointer:0], 42.0f, @"changed sample");
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:url], fileData, @"file is unchanged");
+
+    [[NSFileManager defaultManager] removeItemAtURL:url error:NULL];
+}
+
+-(void)testFileBackedDataReportsMissingFile
+{
+    NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+
+    NSError *error     = nil;
+    CPTNumericData *nd = [CPTNumericData numericDataWithContentsOfURL:url
+                                                               offset:0
+                                                               length:sizeof(double)
+                                                             dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                shape:nil
+                                                            dataOrder:CPTDataOrderRowsFirst
+                                                                error:&error];
+
+    XCTAssertNil(nd, @"no data for a missing file");
+    XCTAssertNotNil(error, @"error for a missing file");
+}
+
 @end
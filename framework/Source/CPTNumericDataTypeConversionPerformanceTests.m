@@ -87,4 +87,48 @@ static const size_t numberOfSamples = 10000000;
     }];
 }
 
+-(void)testSwappedDoubleToDoubleConversion
+{
+    NSMutableData *data = [[NSMutableData alloc] initWithLength:numberOfSamples * sizeof(double)];
+    double *samples     = (double *)[data mutableBytes];
+
+    for ( NSUInteger i = 0; i < numberOfSamples; i++ ) {
+        samples[i] = sin(i);
+    }
+
+    CFByteOrder swappedByteOrder = (CFByteOrderGetCurrent() == CFByteOrderBigEndian) ? CFByteOrderLittleEndian : CFByteOrderBigEndian;
+
+    CPTNumericData *swappedNumericData = [[CPTNumericData alloc] initWithData:data
+                                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), swappedByteOrder)
+                                                                        shape:nil];
+
+    __block CPTNumericData *doubleNumericData = nil;
+
+    [self measureBlock: ^{
+        doubleNumericData = [swappedNumericData dataByConvertingToType:CPTFloatingPointDataType sampleBytes:sizeof(double) byteOrder:CFByteOrderGetCurrent()];
+    }];
+}
+
+-(void)testSwappedFloatToDoubleConversion
+{
+    NSMutableData *data = [[NSMutableData alloc] initWithLength:numberOfSamples * sizeof(float)];
+    float *samples      = (float *)[data mutableBytes];
+
+    for ( NSUInteger i = 0; i < numberOfSamples; i++ ) {
+        samples[i] = sinf(i);
+    }
+
+    CFByteOrder swappedByteOrder = (CFByteOrderGetCurrent() == CFByteOrderBigEndian) ? CFByteOrderLittleEndian : CFByteOrderBigEndian;
+
+    CPTNumericData *swappedNumericData = [[CPTNumericData alloc] initWithData:data
+                                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(float), swappedByteOrder)
+                                                                        shape:nil];
+
+    __block CPTNumericData *doubleNumericData = nil;
+
+    [self measureBlock: ^{
+        doubleNumericData = [swappedNumericData dataByConvertingToType:CPTFloatingPointDataType sampleBytes:sizeof(double) byteOrder:CFByteOrderGetCurrent()];
+    }];
+}
+
 @end
@@ -1,5 +1,6 @@
 #import "CPTNumericDataTypeConversionTests.h"
 
+#import "complex.h"
 #import "CPTNumericData+TypeConversion.h"
 #import "CPTUtilities.h"
 
@@ -100,6 +101,117 @@ static const double precision           = 1.0e-6;
     }
 }
 
+-(void)testLargeConversionMatchesScalarConversion
+{
+    // long enough to be split into chunks, with samples left over after the last full vector
+    const NSUInteger largeNumberOfSamples = 300003;
+
+    NSMutableData *data = [NSMutableData dataWithLength:largeNumberOfSamples * sizeof(int32_t)];
+    int32_t *samples    = (int32_t *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < largeNumberOfSamples; i++ ) {
+        samples[i] = (int32_t)(sin(i) * 30000.0);
+    }
+
+    CPTNumericData *intData = [[CPTNumericData alloc] initWithData:data
+                                                          dataType:CPTDataType(CPTIntegerDataType, sizeof(int32_t), NSHostByteOrder())
+                                                             shape:nil];
+
+    CPTNumericData *dd = [intData dataByConvertingToType:CPTFloatingPointDataType
+                                             sampleBytes:sizeof(double)
+                                               byteOrder:NSHostByteOrder()];
+
+    CPTNumericData *sd = [dd dataByConvertingToType:CPTIntegerDataType
+                                        sampleBytes:sizeof(int16_t)
+                                          byteOrder:NSHostByteOrder()];
+
+    const double *doubleSamples = (const double *)dd.data.bytes;
+    const int16_t *shortSamples = (const int16_t *)sd.data.bytes;
+
+    NSUInteger mismatches = 0;
+    for ( NSUInteger i = 0; i < largeNumberOfSamples; i++ ) {
+        if ((doubleSamples[i] != (double)samples[i]) || (shortSamples[i] != (int16_t)doubleSamples[i])) {
+            mismatches++;
+        }
+    }
+    XCTAssertEqual(mismatches, (NSUInteger)0, @"converted samples differ from a scalar cast");
+}
+
+-(void)testLargeSwappedConversionMatchesScalarConversion
+{
+    // long enough to be split into chunks, with samples left over after the last full block
+    const NSUInteger largeNumberOfSamples = 300003;
+
+    CFByteOrder hostByteOrder    = CFByteOrderGetCurrent();
+    CFByteOrder swappedByteOrder = (hostByteOrder == CFByteOrderBigEndian) ? CFByteOrderLittleEndian : CFByteOrderBigEndian;
+
+    NSMutableData *data = [NSMutableData dataWithLength:largeNumberOfSamples * sizeof(float)];
+    uint32_t *samples   = (uint32_t *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < largeNumberOfSamples; i++ ) {
+        float sample = sinf(i);
+        memcpy(&samples[i], &sample, sizeof(float));
+        samples[i] = CFSwapInt32(samples[i]);
+    }
+
+    CPTNumericData *swappedData = [[CPTNumericData alloc] initWithData:data
+                                                              dataType:CPTDataType(CPTFloatingPointDataType, sizeof(float), swappedByteOrder)
+                                                                 shape:nil];
+
+    CPTNumericData *dd = [swappedData dataByConvertingToType:CPTFloatingPointDataType
+                                                 sampleBytes:sizeof(double)
+                                                   byteOrder:swappedByteOrder];
+
+    const uint64_t *doubleSamples = (const uint64_t *)dd.data.bytes;
+
+    NSUInteger mismatches = 0;
+    for ( NSUInteger i = 0; i < largeNumberOfSamples; i++ ) {
+        uint64_t swappedSample = CFSwapInt64(doubleSamples[i]);
+        double doubleSample;
+        memcpy(&doubleSample, &swappedSample, sizeof(double));
+
+        if ( doubleSample != (double)sinf(i)) {
+            mismatches++;
+        }
+    }
+    XCTAssertEqual(mismatches, (NSUInteger)0, @"swapped and converted samples differ from a scalar cast");
+}
+
+-(void)testTypeConversionSwapsComplexComponents
+{
+    CFByteOrder hostByteOrder    = CFByteOrderGetCurrent();
+    CFByteOrder swappedByteOrder = (hostByteOrder == CFByteOrderBigEndian) ? CFByteOrderLittleEndian : CFByteOrderBigEndian;
+
+    NSMutableData *data = [NSMutableData dataWithLength:numberOfSamples * sizeof(double complex)];
+    double *samples     = (double *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < numberOfSamples; i++ ) {
+        samples[2 * i]     = sin(i);
+        samples[2 * i + 1] = cos(i);
+    }
+
+    CPTNumericData *complexData = [[CPTNumericData alloc] initWithData:data
+                                                              dataType:CPTDataType(CPTComplexFloatingPointDataType, sizeof(double complex), hostByteOrder)
+                                                                 shape:nil];
+
+    CPTNumericData *swappedData = [complexData dataByConvertingToType:CPTComplexFloatingPointDataType
+                                                          sampleBytes:sizeof(double complex)
+                                                            byteOrder:swappedByteOrder];
+
+    const uint64_t *swappedSamples = (const uint64_t *)swappedData.data.bytes;
+    const uint64_t *hostSamples    = (const uint64_t *)data.bytes;
+
+    for ( NSUInteger i = 0; i < 2 * numberOfSamples; i++ ) {
+        XCTAssertEqual(swappedSamples[i], CFSwapInt64(hostSamples[i]), @"Complex component %lu", (unsigned long)i);
+    }
+
+    CPTNumericData *roundTripData = [swappedData dataByConvertingToType:CPTComplexFloatingPointDataType
+                                                            sampleBytes:sizeof(double complex)
+                                                              byteOrder:hostByteOrder];
+
+    XCTAssertEqualObjects(roundTripData.data, data, @"Round trip through swapped byte order");
+}
+
 -(void)testTypeConversionSwapsByteOrderInteger
 {
     CFByteOrder hostByteOrder    = CFByteOrderGetCurrent();
@@ -296,4 +408,126 @@ static const double precision           = 1.0e-6;
     }
 }
 
+#pragma mark -
+#pragma mark Data order conversion
+
+-(void)testDataOrderConversionTransposesAllSampleSizes
+{
+    const NSUInteger rows = 37;
+    const NSUInteger cols = 45;
+
+    CPTNumericDataType dataTypes[] = {
+        CPTDataType(CPTIntegerDataType, sizeof(int8_t), NSHostByteOrder()),
+        CPTDataType(CPTIntegerDataType, sizeof(int16_t), NSHostByteOrder()),
+        CPTDataType(CPTFloatingPointDataType, sizeof(float), NSHostByteOrder()),
+        CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder()),
+        CPTDataType(CPTComplexFloatingPointDataType, sizeof(double complex), NSHostByteOrder()),
+        CPTDataType(CPTDecimalDataType, sizeof(NSDecimal), NSHostByteOrder())
+    };
+
+    for ( NSUInteger t = 0; t < sizeof(dataTypes) / sizeof(dataTypes[0]); t++ ) {
+        CPTNumericDataType theDataType = dataTypes[t];
+        size_t sampleBytes             = theDataType.sampleBytes;
+
+        NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sampleBytes];
+        uint8_t *bytes      = (uint8_t *)data.mutableBytes;
+
+        for ( NSUInteger i = 0; i < data.length; i++ ) {
+            bytes[i] = (uint8_t)(i * 31 + i / sampleBytes);
+        }
+
+        CPTNumericData *rowsFirst = [[CPTNumericData alloc] initWithData:data
+                                                                dataType:theDataType
+                                                                   shape:@[@(rows), @(cols)]
+                                                               dataOrder:CPTDataOrderRowsFirst];
+
+        CPTNumericData *columnsFirst = [rowsFirst dataByConvertingToDataOrder:CPTDataOrderColumnsFirst];
+
+        XCTAssertEqual(columnsFirst.dataOrder, CPTDataOrderColumnsFirst, @"data order for %lu byte samples", (unsigned long)sampleBytes);
+        XCTAssertEqualObjects(columnsFirst.shape, rowsFirst.shape, @"shape for %lu byte samples", (unsigned long)sampleBytes);
+
+        BOOL samplesMatch = YES;
+        for ( NSUInteger row = 0; row < rows; row++ ) {
+            for ( NSUInteger col = 0; col < cols; col++ ) {
+                const void *original   = [rowsFirst samplePointerAtRow:row column:col];
+                const void *transposed = [columnsFirst samplePointerAtRow:row column:col];
+                samplesMatch = samplesMatch && (memcmp(original, transposed, sampleBytes) == 0);
+            }
+        }
+        XCTAssertTrue(samplesMatch, @"transposed samples for %lu byte samples", (unsigned long)sampleBytes);
+
+        CPTNumericData *roundTrip = [columnsFirst dataByConvertingToDataOrder:CPTDataOrderRowsFirst];
+        XCTAssertEqualObjects(roundTrip.data, data, @"round trip for %lu byte samples", (unsigned long)sampleBytes);
+    }
+}
+
+-(void)testLargeDataOrderConversion
+{
+    const NSUInteger rows = 3001;
+    const NSUInteger cols = 203;
+
+    NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sizeof(double)];
+    double *samples     = (double *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < rows * cols; i++ ) {
+        samples[i] = (double)i;
+    }
+
+    CPTNumericData *rowsFirst = [[CPTNumericData alloc] initWithData:data
+                                                            dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                               shape:@[@(rows), @(cols)]
+                                                           dataOrder:CPTDataOrderRowsFirst];
+
+    CPTNumericData *columnsFirst = [rowsFirst dataByConvertingToDataOrder:CPTDataOrderColumnsFirst];
+
+    const double *transposed = (const double *)columnsFirst.bytes;
+    BOOL samplesMatch        = YES;
+
+    for ( NSUInteger col = 0; col < cols; col++ ) {
+        for ( NSUInteger row = 0; row < rows; row++ ) {
+            samplesMatch = samplesMatch && (transposed[col * rows + row] == samples[row * cols + col]);
+        }
+    }
+    XCTAssertTrue(samplesMatch, @"transposed samples");
+}
+
+-(void)testOneDimensionalDataOrderConversionSharesData
+{
+    NSMutableData *data = [NSMutableData dataWithLength:numberOfSamples * sizeof(double)];
+
+    CPTNumericData *dd = [[CPTNumericData alloc] initWithData:data
+                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                        shape:nil];
+
+    CPTNumericData *converted = [dd dataByConvertingToDataOrder:CPTDataOrderColumnsFirst];
+
+    XCTAssertEqual(converted.dataOrder, CPTDataOrderColumnsFirst, @"data order");
+    XCTAssertEqual(converted.bytes, dd.bytes, @"shares the data buffer");
+}
+
+-(void)testTypeConversionKeepsDataOrder
+{
+    const NSUInteger rows = 3;
+    const NSUInteger cols = 2;
+
+    NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sizeof(float)];
+    float *samples      = (float *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < rows * cols; i++ ) {
+        samples[i] = (float)i;
+    }
+
+    CPTNumericData *fd = [[CPTNumericData alloc] initWithData:data
+                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(float), NSHostByteOrder())
+                                                        shape:@[@(rows), @(cols)]
+                                                    dataOrder:CPTDataOrderColumnsFirst];
+
+    CPTNumericData *dd = [fd dataByConvertingToType:CPTFloatingPointDataType
+                                        sampleBytes:sizeof(double)
+                                          byteOrder:NSHostByteOrder()];
+
+    XCTAssertEqual(dd.dataOrder, CPTDataOrderColumnsFirst, @"data order");
+    XCTAssertEqual(*(const double *)[dd samplePointerAtRow:2 column:1], 5.0, @"sample at row 2, column 1");
+}
+
 @end
@@ -379,9 +379,10 @@ static const CGFloat colorLookupTable[10][3] =
 
     if ( sampleCount > 0 ) {
         CPTMutableNumericData *rawSliceValues = [self cachedNumbersForField:CPTPieChartFieldSliceWidth];
-        if ( self.doublePrecisionCache ) {
+        if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+            NSData *sliceWidths     = [self cachedDoublesForField:CPTPieChartFieldSliceWidth recordIndexRange:NSMakeRange(0, sampleCount)];
             double valueSum         = 0.0;
-            const double *dataBytes = (const double *)rawSliceValues.bytes;
+            const double *dataBytes = (const double *)sliceWidths.bytes;
             const double *dataEnd   = dataBytes + sampleCount;
             while ( dataBytes < dataEnd ) {
                 double currentWidth = *dataBytes++;
@@ -399,7 +400,7 @@ static const CGFloat colorLookupTable[10][3] =
 
             double cumulativeSum = 0.0;
 
-            dataBytes = (const double *)rawSliceValues.bytes;
+            dataBytes = (const double *)sliceWidths.bytes;
             double *normalizedBytes = normalizedSliceValues.mutableBytes;
             double *cumulativeBytes = cumulativeSliceValues.mutableBytes;
             while ( dataBytes < dataEnd ) {
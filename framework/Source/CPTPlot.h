@@ -28,9 +28,10 @@ extern CPTPlotBinding __nonnull const CPTPlotBindingDataLabels;
  *  @brief Enumeration of cache precisions.
  **/
 typedef NS_ENUM (NSInteger, CPTPlotCachePrecision) {
-    CPTPlotCachePrecisionAuto,   ///< Cache precision is determined automatically from the data. All cached data will be converted to match the last data loaded.
-    CPTPlotCachePrecisionDouble, ///< All cached data will be converted to double precision.
-    CPTPlotCachePrecisionDecimal ///< All cached data will be converted to @ref NSDecimal.
+    CPTPlotCachePrecisionAuto,    ///< Cache precision is determined automatically from the data. All cached data will be converted to match the last data loaded.
+    CPTPlotCachePrecisionDouble,  ///< All cached data will be converted to double precision.
+    CPTPlotCachePrecisionDecimal, ///< All cached data will be converted to @ref NSDecimal.
+    CPTPlotCachePrecisionFloat    ///< All cached data will be converted to single precision, using half the memory of double precision.
 };
 
 /**
@@ -111,6 +112,11 @@ typedef NSMutableArray<__kindof CPTPlot *> CPTMutablePlotArray;
 
 /** @brief @optional Gets a range of plot data for the given plot and field.
  *  Implement one and only one of the optional methods in this section.
+ *
+ *  If the returned object is an immutable CPTNumericData whose data type matches the plot cache,
+ *  the plot adopts its data buffer without copying it. The buffer is copied only if the cached
+ *  data is later changed, for example, when records are inserted or a part of the data is reloaded.
+ *
  *  @param plot The plot.
  *  @param fieldEnum The field index.
  *  @param indexRange The range of the data indexes of interest.
@@ -286,9 +292,12 @@ typedef NSMutableArray<__kindof CPTPlot *> CPTMutablePlotArray;
 /// @{
 @property (nonatomic, readonly) NSUInteger cachedDataCount;
 @property (nonatomic, readonly) BOOL doublePrecisionCache;
+@property (nonatomic, readonly) BOOL floatPrecisionCache;
 @property (nonatomic, readwrite, assign) CPTPlotCachePrecision cachePrecision;
+@property (nonatomic, readwrite, assign) NSUInteger cacheCapacity;
 @property (nonatomic, readonly) CPTNumericDataType doubleDataType;
 @property (nonatomic, readonly) CPTNumericDataType decimalDataType;
+@property (nonatomic, readonly) CPTNumericDataType floatDataType;
 /// @}
 
 /// @name Data Labels
@@ -319,6 +328,7 @@ typedef NSMutableArray<__kindof CPTPlot *> CPTMutablePlotArray;
 -(void)setNeedsRelabel;
 -(void)relabel;
 -(void)relabelIndexRange:(NSRange)indexRange;
+-(void)setNeedsLabelWindowUpdate;
 -(void)repositionAllLabelAnnotations;
 -(void)reloadDataLabels;
 -(void)reloadDataLabelsInIndexRange:(NSRange)indexRange;
@@ -351,6 +361,7 @@ typedef NSMutableArray<__kindof CPTPlot *> CPTMutablePlotArray;
 -(nullable NSNumber *)cachedNumberForField:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx;
 -(double)cachedDoubleForField:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx;
 -(NSDecimal)cachedDecimalForField:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx;
+-(nullable NSData *)cachedDoublesForField:(NSUInteger)fieldEnum recordIndexRange:(NSRange)indexRange;
 -(nullable NSArray *)cachedArrayForKey:(nonnull NSString *)key;
 -(nullable id)cachedValueForKey:(nonnull NSString *)key recordIndex:(NSUInteger)idx;
 
@@ -360,9 +371,17 @@ typedef NSMutableArray<__kindof CPTPlot *> CPTMutablePlotArray;
 -(void)cacheArray:(nullable NSArray *)array forKey:(nonnull NSString *)key atRecordIndex:(NSUInteger)idx;
 /// @}
 
+/// @name Implicit Fields
+/// @{
+-(void)setImplicitValuesForField:(NSUInteger)fieldEnum origin:(nonnull NSNumber *)origin step:(nonnull NSNumber *)step;
+-(void)removeImplicitValuesForField:(NSUInteger)fieldEnum;
+-(BOOL)hasImplicitValuesForField:(NSUInteger)fieldEnum;
+/// @}
+
 /// @name Plot Data Ranges
 /// @{
 -(nullable CPTPlotRange *)plotRangeForField:(NSUInteger)fieldEnum;
+-(nullable CPTPlotRange *)plotRangeForField:(NSUInteger)fieldEnum recordIndexRange:(NSRange)indexRange;
 -(nullable CPTPlotRange *)plotRangeForCoordinate:(CPTCoordinate)coord;
 -(nullable CPTPlotRange *)plotRangeEnclosingField:(NSUInteger)fieldEnum;
 -(nullable CPTPlotRange *)plotRangeEnclosingCoordinate:(CPTCoordinate)coord;
@@ -7,6 +7,7 @@
 #import "CPTLineStyle.h"
 #import "CPTMutableNumericData+TypeConversion.h"
 #import "CPTMutablePlotRange.h"
+#import "CPTNumericData+TypeConversion.h"
 #import "CPTPathExtensions.h"
 #import "CPTPlotArea.h"
 #import "CPTPlotAreaFrame.h"
@@ -16,6 +17,8 @@
 #import "CPTTextLayer.h"
 #import "CPTUtilities.h"
 #import "NSCoderExtensions.h"
+#import "_CPTDataRangeIndex.h"
+#import "_CPTImplicitField.h"
 #import <tgmath.h>
 
 /** @defgroup plotAnimation Plots
@@ -51,10 +54,15 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
 @property (nonatomic, readwrite, assign) BOOL dataNeedsReloading;
 @property (nonatomic, readwrite, strong, nonnull) NSMutableDictionary *cachedData;
+@property (nonatomic, readwrite, strong, nonnull) NSMutableDictionary<NSNumber *, _CPTDataRangeIndex *> *cachedRangeIndexes;
+@property (nonatomic, readwrite, strong, nonnull) NSMutableDictionary<NSNumber *, _CPTImplicitField *> *implicitFields;
 
 @property (nonatomic, readwrite, assign) BOOL needsRelabel;
 @property (nonatomic, readwrite, assign) NSRange labelIndexRange;
-@property (nonatomic, readwrite, strong, nullable) CPTMutableAnnotationArray *labelAnnotations;
+@property (nonatomic, readwrite, strong, nullable) NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *labelAnnotations;
+@property (nonatomic, readwrite, strong, nullable) NSMutableArray<CPTTextLayer *> *labelLayerPool;
+@property (nonatomic, readwrite, strong, nullable) NSMutableSet<CPTTextLayer *> *pooledLabelLayers;
+@property (nonatomic, readwrite, assign) CGFloat largestLabelExtent;
 @property (nonatomic, readwrite, copy, nullable) CPTLayerArray *dataLabels;
 
 @property (nonatomic, readwrite, assign) NSUInteger pointingDeviceDownLabelIndex;
@@ -64,8 +72,21 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 @property (nonatomic, readonly, assign) NSUInteger numberOfRecords;
 
 -(nonnull CPTMutableNumericData *)numericDataForNumbers:(nonnull id)numbers;
+-(CPTNumericDataType)categoryDataType;
+-(nullable _CPTDataRangeIndex *)rangeIndexForField:(NSUInteger)fieldEnum;
+-(nullable _CPTImplicitField *)implicitFieldForField:(NSUInteger)fieldEnum;
+-(BOOL)isSortedField:(NSUInteger)fieldEnum;
+-(NSRange)indexRangeForSortedField:(NSUInteger)fieldEnum plotRange:(nonnull CPTPlotRange *)plotRange;
+-(NSUInteger)firstIndexOfSortedField:(NSUInteger)fieldEnum notLessThanValue:(double)value inIndexRange:(NSRange)indexRange;
+-(CPTNumericDataType)implicitFieldDataType;
 -(void)setCachedDataType:(CPTNumericDataType)newDataType;
 -(void)updateContentAnchorForLabel:(nonnull CPTPlotSpaceAnnotation *)label;
+-(BOOL)getLabelWindowMinimum:(nonnull double *)minimum maximum:(nonnull double *)maximum;
+-(nonnull NSIndexSet *)labelIndexesForWindowFields:(nonnull const NSUInteger *)fields minimum:(nonnull const double *)minimum maximum:(nonnull const double *)maximum;
+-(BOOL)labelAtIndex:(NSUInteger)idx isInWindowFields:(nonnull const NSUInteger *)fields minimum:(nonnull const double *)minimum maximum:(nonnull const double *)maximum;
+-(nullable CPTTextLayer *)dequeueLabelLayer;
+-(void)recycleLabelAnnotation:(nonnull CPTPlotSpaceAnnotation *)label;
+-(void)emptyLabelLayerPool;
 
 @end
 
@@ -94,6 +115,10 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
  *  You can also remove data from the plot without reloading anything by using the
  *  @link CPTPlot::deleteDataInIndexRange: -deleteDataInIndexRange: @endlink method.
  *
+ *  Data labels are only created for the records inside the visible part of the plot space.
+ *  Labels that scroll out of view are removed and the text layers made by the plot are
+ *  reused for the labels that scroll into view, so labeling large data sets stays fast.
+ *
  *  @see See @ref plotAnimation "Plots" for a list of animatable properties supported by each plot type.
  *  @if MacOnly
  *  @see See @ref plotBindings "Plot Bindings" for a list of binding identifiers supported by each plot type.
@@ -140,21 +165,53 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
 @synthesize cachedData;
 
+/** @internal
+ *  @property nonnull NSMutableDictionary<NSNumber *, _CPTDataRangeIndex *> *cachedRangeIndexes
+ *  @brief Min/max summaries of the cached numeric fields, keyed by field identifier. Built on demand by
+ *  @link CPTPlot::plotRangeForField:recordIndexRange: -plotRangeForField:recordIndexRange: @endlink
+ *  and kept up to date as the cache changes.
+ **/
+@synthesize cachedRangeIndexes;
+
+/** @internal
+ *  @property nonnull NSMutableDictionary<NSNumber *, _CPTImplicitField *> *implicitFields
+ *  @brief The origin and step of the fields whose values are computed from the record index instead of cached,
+ *  keyed by field identifier.
+ **/
+@synthesize implicitFields;
+
 /** @property NSUInteger cachedDataCount
  *  @brief The number of data points stored in the cache.
  **/
 @synthesize cachedDataCount;
 
 /** @property BOOL doublePrecisionCache
- *  @brief If @YES, the cache holds data of type @double, otherwise it holds @ref NSDecimal.
+ *  @brief If @YES, the cache holds data of type @double, otherwise it holds @ref NSDecimal or @float.
  **/
 @dynamic doublePrecisionCache;
 
+/** @property BOOL floatPrecisionCache
+ *  @brief If @YES, the cache holds data of type @float.
+ **/
+@dynamic floatPrecisionCache;
+
 /** @property CPTPlotCachePrecision cachePrecision
  *  @brief The numeric precision used to cache the plot data and perform all plot calculations. Defaults to #CPTPlotCachePrecisionAuto.
  **/
 @synthesize cachePrecision;
 
+/** @property NSUInteger cacheCapacity
+ *  @brief The number of records expected to be held in the cache when it is used as a rolling window. Defaults to zero (@num{0}).
+ *
+ *  When non-zero, deleting records from the start of the cache with
+ *  @link CPTPlot::deleteDataInIndexRange: -deleteDataInIndexRange: @endlink does not move the
+ *  remaining cached values. Together with
+ *  @link CPTPlot::insertDataAtIndex:numberOfRecords: -insertDataAtIndex:numberOfRecords: @endlink
+ *  at the end of the cache, this lets streaming plots append new data and drop old data in
+ *  constant amortized time per record.
+ **/
+@synthesize cacheCapacity;
+
 /** @property CPTNumericDataType doubleDataType
  *  @brief The CPTNumericDataType used to cache plot data as @double.
  **/
@@ -165,6 +222,11 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
  **/
 @dynamic decimalDataType;
 
+/** @property CPTNumericDataType floatDataType
+ *  @brief The CPTNumericDataType used to cache plot data as @float.
+ **/
+@dynamic floatDataType;
+
 /** @property BOOL needsRelabel
  *  @brief If @YES, the plot needs to be relabeled before the layer content is drawn.
  **/
@@ -220,8 +282,36 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
 @synthesize labelIndexRange;
 
+/** @internal
+ *  @property nullable NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *labelAnnotations
+ *  @brief The annotations of the data labels that are shown, keyed by record index.
+ *
+ *  Records outside of the visible part of the plot space have no entry.
+ **/
 @synthesize labelAnnotations;
 
+/** @internal
+ *  @property nullable NSMutableArray<CPTTextLayer *> *labelLayerPool
+ *  @brief Text layers made by the plot that are not in use and can be reused for new data labels.
+ **/
+@synthesize labelLayerPool;
+
+/** @internal
+ *  @property nullable NSMutableSet<CPTTextLayer *> *pooledLabelLayers
+ *  @brief All of the text layers made by the plot for the current label text style and formatter, in use or not.
+ *
+ *  Layers provided by the datasource are never reused.
+ **/
+@synthesize pooledLabelLayers;
+
+/** @internal
+ *  @property CGFloat largestLabelExtent
+ *  @brief The largest width or height of a data label made so far.
+ *
+ *  The visible window is widened by this amount so labels of records just outside of the plot area are kept.
+ **/
+@synthesize largestLabelExtent;
+
 /** @property BOOL alignsPointsToPixels
  *  @brief If @YES (the default), all plot points will be aligned to device pixels when drawing.
  **/
@@ -268,6 +358,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
  *  This is the designated initializer. The initialized layer will have the following properties:
  *  - @ref cachedDataCount = @num{0}
  *  - @ref cachePrecision = #CPTPlotCachePrecisionAuto
+ *  - @ref cacheCapacity = @num{0}
  *  - @ref dataSource = @nil
  *  - @ref title = @nil
  *  - @ref attributedTitle = @nil
@@ -294,8 +385,11 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 {
     if ((self = [super initWithFrame:newFrame])) {
         cachedData           = [[NSMutableDictionary alloc] initWithCapacity:5];
+        cachedRangeIndexes   = [[NSMutableDictionary alloc] initWithCapacity:5];
+        implicitFields       = [[NSMutableDictionary alloc] init];
         cachedDataCount      = 0;
         cachePrecision       = CPTPlotCachePrecisionAuto;
+        cacheCapacity        = 0;
         dataSource           = nil;
         title                = nil;
         attributedTitle      = nil;
@@ -312,6 +406,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
         labelShadow          = nil;
         labelIndexRange      = NSMakeRange(0, 0);
         labelAnnotations     = nil;
+        labelLayerPool       = nil;
+        pooledLabelLayers    = nil;
+        largestLabelExtent   = CPTFloat(0.0);
         alignsPointsToPixels = YES;
         inTitleUpdate        = NO;
 
@@ -334,8 +431,11 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
         CPTPlot *theLayer = (CPTPlot *)layer;
 
         cachedData           = theLayer->cachedData;
+        cachedRangeIndexes   = theLayer->cachedRangeIndexes;
+        implicitFields       = theLayer->implicitFields;
         cachedDataCount      = theLayer->cachedDataCount;
         cachePrecision       = theLayer->cachePrecision;
+        cacheCapacity        = theLayer->cacheCapacity;
         dataSource           = theLayer->dataSource;
         title                = theLayer->title;
         attributedTitle      = theLayer->attributedTitle;
@@ -352,6 +452,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
         labelShadow          = theLayer->labelShadow;
         labelIndexRange      = theLayer->labelIndexRange;
         labelAnnotations     = theLayer->labelAnnotations;
+        labelLayerPool       = theLayer->labelLayerPool;
+        pooledLabelLayers    = theLayer->pooledLabelLayers;
+        largestLabelExtent   = theLayer->largestLabelExtent;
         alignsPointsToPixels = theLayer->alignsPointsToPixels;
         inTitleUpdate        = theLayer->inTitleUpdate;
 
@@ -380,6 +483,8 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     [coder encodeObject:self.attributedTitle forKey:@"CPTPlot.attributedTitle"];
     [coder encodeObject:self.plotSpace forKey:@"CPTPlot.plotSpace"];
     [coder encodeInteger:self.cachePrecision forKey:@"CPTPlot.cachePrecision"];
+    [coder encodeInteger:(NSInteger)self.cacheCapacity forKey:@"CPTPlot.cacheCapacity"];
+    [coder encodeObject:self.implicitFields forKey:@"CPTPlot.implicitFields"];
     [coder encodeBool:self.needsRelabel forKey:@"CPTPlot.needsRelabel"];
     [coder encodeBool:self.adjustLabelAnchors forKey:@"CPTPlot.adjustLabelAnchors"];
     [coder encodeBool:self.showLabels forKey:@"CPTPlot.showLabels"];
@@ -390,16 +495,20 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     [coder encodeObject:self.labelFormatter forKey:@"CPTPlot.labelFormatter"];
     [coder encodeObject:self.labelShadow forKey:@"CPTPlot.labelShadow"];
     [coder encodeObject:[NSValue valueWithRange:self.labelIndexRange] forKey:@"CPTPlot.labelIndexRange"];
-    [coder encodeObject:self.labelAnnotations forKey:@"CPTPlot.labelAnnotations"];
+    [coder encodeObject:self.labelAnnotations forKey:@"CPTPlot.labelAnnotationsByIndex"];
     [coder encodeBool:self.alignsPointsToPixels forKey:@"CPTPlot.alignsPointsToPixels"];
     [coder encodeBool:self.drawLegendSwatchDecoration forKey:@"CPTPlot.drawLegendSwatchDecoration"];
 
     // No need to archive these properties:
     // dataNeedsReloading
     // cachedData
+    // cachedRangeIndexes
     // cachedDataCount
     // inTitleUpdate
     // pointingDeviceDownLabelIndex
+    // labelLayerPool
+    // pooledLabelLayers
+    // largestLabelExtent
 }
 
 -(nullable instancetype)initWithCoder:(nonnull NSCoder *)coder
@@ -414,6 +523,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
         plotSpace = [coder decodeObjectOfClass:[CPTPlotSpace class]
                                         forKey:@"CPTPlot.plotSpace"];
         cachePrecision     = (CPTPlotCachePrecision)[coder decodeIntegerForKey:@"CPTPlot.cachePrecision"];
+        cacheCapacity      = (NSUInteger)[coder decodeIntegerForKey:@"CPTPlot.cacheCapacity"];
+        implicitFields     = [[coder decodeObjectOfClasses:[NSSet setWithArray:@[[NSDictionary class], [NSNumber class], [_CPTImplicitField class]]]
+                                                    forKey:@"CPTPlot.implicitFields"] mutableCopy];
         needsRelabel       = [coder decodeBoolForKey:@"CPTPlot.needsRelabel"];
         adjustLabelAnchors = [coder decodeBoolForKey:@"CPTPlot.adjustLabelAnchors"];
         showLabels         = [coder decodeBoolForKey:@"CPTPlot.showLabels"];
@@ -428,8 +540,8 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                                           forKey:@"CPTPlot.labelShadow"];
         labelIndexRange = [[coder decodeObjectOfClass:[NSValue class]
                                                forKey:@"CPTPlot.labelIndexRange"] rangeValue];
-        labelAnnotations = [[coder decodeObjectOfClasses:[NSSet setWithArray:@[[NSArray class], [CPTAnnotation class]]]
-                                                  forKey:@"CPTPlot.labelAnnotations"] mutableCopy];
+        labelAnnotations = [[coder decodeObjectOfClasses:[NSSet setWithArray:@[[NSDictionary class], [NSNumber class], [CPTAnnotation class]]]
+                                                  forKey:@"CPTPlot.labelAnnotationsByIndex"] mutableCopy];
         alignsPointsToPixels = [coder decodeBoolForKey:@"CPTPlot.alignsPointsToPixels"];
 
         drawLegendSwatchDecoration = [coder decodeBoolForKey:@"CPTPlot.drawLegendSwatchDecoration"];
@@ -440,8 +552,32 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                                                   forKey:@"CPTPlot.identifier"];
         }
 
+        // old archives store the labels in an array indexed by record, with NSNull for records without a label
+        if ( !labelAnnotations && [coder containsValueForKey:@"CPTPlot.labelAnnotations"] ) {
+            NSArray *labelArray = [coder decodeObjectOfClasses:[NSSet setWithArray:@[[NSArray class], [NSNull class], [CPTAnnotation class]]]
+                                                        forKey:@"CPTPlot.labelAnnotations"];
+
+            if ( [labelArray isKindOfClass:[NSArray class]] ) {
+                NSUInteger labelCount = labelArray.count;
+
+                labelAnnotations = [[NSMutableDictionary alloc] initWithCapacity:labelCount];
+
+                for ( NSUInteger i = 0; i < labelCount; i++ ) {
+                    CPTPlotSpaceAnnotation *label = labelArray[i];
+                    if ( [label isKindOfClass:[CPTPlotSpaceAnnotation class]] ) {
+                        labelAnnotations[@(i)] = label;
+                    }
+                }
+            }
+        }
+
+        if ( !implicitFields ) {
+            implicitFields = [[NSMutableDictionary alloc] init];
+        }
+
         // init other properties
         cachedData         = [[NSMutableDictionary alloc] initWithCapacity:5];
+        cachedRangeIndexes = [[NSMutableDictionary alloc] initWithCapacity:5];
         cachedDataCount    = 0;
         dataNeedsReloading = YES;
         inTitleUpdate      = NO;
@@ -565,6 +701,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 -(void)reloadData
 {
     [self.cachedData removeAllObjects];
+    [self.cachedRangeIndexes removeAllObjects];
     self.cachedDataCount = 0;
 
     [self reloadDataInIndexRange:NSMakeRange(0, self.numberOfRecords)];
@@ -596,6 +733,10 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 }
 
 /** @brief Insert records into the plot data cache at the given index.
+ *
+ *  Inserting records at the start of a non-empty cache moves the origin of each implicit field back
+ *  so the existing records keep their values.
+ *
  *  @param idx The starting index of the new records.
  *  @param numberOfRecords The number of records to insert.
  **/
@@ -604,19 +745,15 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     NSParameterAssert(idx <= self.cachedDataCount);
     Class numericClass = [CPTNumericData class];
 
-    for ( id data in self.cachedData.allValues ) {
+    NSMutableDictionary *dataCache = self.cachedData;
+
+    for ( id key in dataCache.allKeys ) {
+        id data = dataCache[key];
         if ( [data isKindOfClass:numericClass] ) {
             CPTMutableNumericData *numericData = (CPTMutableNumericData *)data;
-            size_t sampleSize                  = numericData.sampleBytes;
-            size_t length                      = sampleSize * numberOfRecords;
-
-            [(NSMutableData *) numericData.data increaseLengthBy:length];
+            [numericData insertSamplesAtIndex:idx numberOfSamples:numberOfRecords];
 
-            int8_t *start      = [numericData mutableSamplePointer:idx];
-            size_t bytesToMove = numericData.data.length - (idx + numberOfRecords) * sampleSize;
-            if ( bytesToMove > 0 ) {
-                memmove(start + length, start, bytesToMove);
-            }
+            [self.cachedRangeIndexes[key] insertData:numericData inIndexRange:NSMakeRange(idx, numberOfRecords)];
         }
         else {
             NSMutableArray *array = (NSMutableArray *)data;
@@ -628,20 +765,37 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
         }
     }
 
-    CPTMutableAnnotationArray *labelArray = self.labelAnnotations;
-    if ( labelArray ) {
-        id nullObject        = [NSNull null];
-        NSUInteger lastIndex = idx + numberOfRecords - 1;
-        for ( NSUInteger i = idx; i <= lastIndex; i++ ) {
-            [labelArray insertObject:nullObject atIndex:i];
+    // keep the values of the existing records in implicit fields
+    if ((idx == 0) && (self.cachedDataCount > 0)) {
+        for ( _CPTImplicitField *implicitField in self.implicitFields.allValues ) {
+            [implicitField offsetOriginByNumberOfRecords:-(NSInteger)numberOfRecords];
         }
     }
 
+    // move the labels of the following records
+    NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *labels = self.labelAnnotations;
+    if ( labels.count > 0 ) {
+        NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *movedLabels = [[NSMutableDictionary alloc] initWithCapacity:labels.count];
+
+        [labels enumerateKeysAndObjectsUsingBlock: ^(NSNumber *key, CPTPlotSpaceAnnotation *label, BOOL *__unused stop) {
+            NSUInteger labelIndex = key.unsignedIntegerValue;
+            if ( labelIndex >= idx ) {
+                labelIndex += numberOfRecords;
+            }
+            movedLabels[@(labelIndex)] = label;
+        }];
+        self.labelAnnotations = movedLabels;
+    }
+
     self.cachedDataCount += numberOfRecords;
     [self reloadDataInIndexRange:NSMakeRange(idx, numberOfRecords)];
 }
 
 /** @brief Delete records in the given index range from the plot data cache.
+ *
+ *  Deleting records from the start of the cache moves the origin of each implicit field forward
+ *  so the remaining records keep their values.
+ *
  *  @param indexRange The index range of the data records to remove.
  **/
 -(void)deleteDataInIndexRange:(NSRange)indexRange
@@ -649,37 +803,50 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     NSParameterAssert(NSMaxRange(indexRange) <= self.cachedDataCount);
     Class numericClass = [CPTNumericData class];
 
-    for ( id data in self.cachedData.allValues ) {
+    NSMutableDictionary *dataCache = self.cachedData;
+
+    for ( id key in dataCache.allKeys ) {
+        id data = dataCache[key];
         if ( [data isKindOfClass:numericClass] ) {
             CPTMutableNumericData *numericData = (CPTMutableNumericData *)data;
-            size_t sampleSize                  = numericData.sampleBytes;
-            int8_t *start                      = [numericData mutableSamplePointer:indexRange.location];
-            size_t length                      = sampleSize * indexRange.length;
-            size_t bytesToMove                 = numericData.data.length - (indexRange.location + indexRange.length) * sampleSize;
-            if ( bytesToMove > 0 ) {
-                memmove(start, start + length, bytesToMove);
-            }
+            [numericData removeSamplesInRange:indexRange];
 
-            NSMutableData *dataBuffer = (NSMutableData *)numericData.data;
-            dataBuffer.length -= length;
+            [self.cachedRangeIndexes[key] removeData:numericData inIndexRange:indexRange];
         }
         else {
             [(NSMutableArray *) data removeObjectsInRange:indexRange];
         }
     }
 
-    CPTMutableAnnotationArray *labelArray = self.labelAnnotations;
+    // keep the values of the remaining records in implicit fields
+    if ( indexRange.location == 0 ) {
+        for ( _CPTImplicitField *implicitField in self.implicitFields.allValues ) {
+            [implicitField offsetOriginByNumberOfRecords:(NSInteger)indexRange.length];
+        }
+    }
+
+    // remove the labels of the deleted records and move the labels of the following records
+    NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *labels = self.labelAnnotations;
+    if ( labels.count > 0 ) {
+        NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *movedLabels = [[NSMutableDictionary alloc] initWithCapacity:labels.count];
+        NSUInteger maxIndex                                                    = NSMaxRange(indexRange);
 
-    NSUInteger maxIndex   = NSMaxRange(indexRange);
-    Class annotationClass = [CPTAnnotation class];
+        for ( NSNumber *key in labels.allKeys ) {
+            NSUInteger labelIndex         = key.unsignedIntegerValue;
+            CPTPlotSpaceAnnotation *label = labels[key];
 
-    for ( NSUInteger i = indexRange.location; i < maxIndex; i++ ) {
-        CPTAnnotation *annotation = labelArray[i];
-        if ( [annotation isKindOfClass:annotationClass] ) {
-            [self removeAnnotation:annotation];
+            if ( labelIndex < indexRange.location ) {
+                movedLabels[key] = label;
+            }
+            else if ( labelIndex >= maxIndex ) {
+                movedLabels[@(labelIndex - indexRange.length)] = label;
+            }
+            else {
+                [self recycleLabelAnnotation:label];
+            }
         }
+        self.labelAnnotations = movedLabels;
     }
-    [labelArray removeObjectsInRange:indexRange];
 
     self.cachedDataCount -= indexRange.length;
     [self setNeedsDisplay];
@@ -694,6 +861,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
     for ( NSNumber *fieldID in self.fieldIdentifiers ) {
         [dataCache removeObjectForKey:fieldID];
+        [self.cachedRangeIndexes removeObjectForKey:fieldID];
     }
 
     [self reloadPlotDataInIndexRange:NSMakeRange(0, self.cachedDataCount)];
@@ -770,7 +938,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 /** @brief Gets a range of plot data for the given plot and field.
  *  @param fieldEnum The field index.
  *  @param indexRange The range of the data indexes of interest.
- *  @return An array of data points.
+ *  @return An array of data points or @nil if the field has implicit values.
  **/
 -(nullable id)numbersFromDataSourceForField:(NSUInteger)fieldEnum recordIndexRange:(NSRange)indexRange
 {
@@ -778,15 +946,22 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
     id<CPTPlotDataSource> theDataSource = self.dataSource;
 
-    if ( theDataSource ) {
+    if ( [self hasImplicitValuesForField:fieldEnum] ) {
+        numbers = nil;
+    }
+    else if ( theDataSource ) {
         if ( [theDataSource respondsToSelector:@selector(dataForPlot:field:recordIndexRange:)] ) {
             numbers = [theDataSource dataForPlot:self field:fieldEnum recordIndexRange:indexRange];
         }
         else if ( [theDataSource respondsToSelector:@selector(doublesForPlot:field:recordIndexRange:)] ) {
-            numbers = [NSMutableData dataWithLength:sizeof(double) * indexRange.length];
-            double *fieldValues  = [numbers mutableBytes];
             double *doubleValues = [theDataSource doublesForPlot:self field:fieldEnum recordIndexRange:indexRange];
-            memcpy(fieldValues, doubleValues, sizeof(double) * indexRange.length);
+            if ( doubleValues ) {
+                // the data source keeps ownership of the values, so copy them once into an immutable buffer the cache can adopt
+                numbers = [NSData dataWithBytes:doubleValues length:sizeof(double) * indexRange.length];
+            }
+            else {
+                numbers = nil;
+            }
         }
         else if ( [theDataSource respondsToSelector:@selector(numbersForPlot:field:recordIndexRange:)] ) {
             NSArray *numberArray = [theDataSource numbersForPlot:self field:fieldEnum recordIndexRange:indexRange];
@@ -856,9 +1031,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
             CPTNumericDataType dataType  = data.dataType;
 
             if ((sampleCount > 0) && (data.numberOfDimensions == 2)) {
-                CPTNumberArray *theShape    = data.shape;
-                const NSUInteger rowCount   = theShape[0].unsignedIntegerValue;
-                const NSUInteger fieldCount = theShape[1].unsignedIntegerValue;
+                const NSUInteger fieldCount = data.shape[1].unsignedIntegerValue;
 
                 if ( fieldCount > 0 ) {
                     // convert data type if needed
@@ -866,92 +1039,45 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                         case CPTPlotCachePrecisionAuto:
                             if ( self.doublePrecisionCache ) {
                                 if ( !CPTDataTypeEqualToDataType(dataType, self.doubleDataType)) {
-                                    CPTMutableNumericData *mutableData = [data mutableCopy];
-                                    mutableData.dataType = self.doubleDataType;
-                                    data                 = mutableData;
+                                    data = [data dataByConvertingToDataType:self.doubleDataType];
+                                }
+                            }
+                            else if ( self.floatPrecisionCache ) {
+                                if ( !CPTDataTypeEqualToDataType(dataType, self.floatDataType)) {
+                                    data = [data dataByConvertingToDataType:self.floatDataType];
                                 }
                             }
                             else {
                                 if ( !CPTDataTypeEqualToDataType(dataType, self.decimalDataType)) {
-                                    CPTMutableNumericData *mutableData = [data mutableCopy];
-                                    mutableData.dataType = self.decimalDataType;
-                                    data                 = mutableData;
+                                    data = [data dataByConvertingToDataType:self.decimalDataType];
                                 }
                             }
                             break;
 
                         case CPTPlotCachePrecisionDecimal:
                             if ( !CPTDataTypeEqualToDataType(dataType, self.decimalDataType)) {
-                                CPTMutableNumericData *mutableData = [data mutableCopy];
-                                mutableData.dataType = self.decimalDataType;
-                                data                 = mutableData;
+                                data = [data dataByConvertingToDataType:self.decimalDataType];
                             }
                             break;
 
                         case CPTPlotCachePrecisionDouble:
                             if ( !CPTDataTypeEqualToDataType(dataType, self.doubleDataType)) {
-                                CPTMutableNumericData *mutableData = [data mutableCopy];
-                                mutableData.dataType = self.doubleDataType;
-                                data                 = mutableData;
+                                data = [data dataByConvertingToDataType:self.doubleDataType];
                             }
                             break;
-                    }
-
-                    // add the data to the cache
-                    const NSUInteger bufferLength = rowCount * dataType.sampleBytes;
-
-                    switch ( data.dataOrder ) {
-                        case CPTDataOrderRowsFirst:
-                        {
-                            const void *sourceEnd = (const int8_t *)(data.bytes) + data.length;
-
-                            for ( NSUInteger fieldNum = 0; fieldNum < fieldCount; fieldNum++ ) {
-                                NSMutableData *tempData = [[NSMutableData alloc] initWithLength:bufferLength];
-
-                                if ( CPTDataTypeEqualToDataType(dataType, self.doubleDataType)) {
-                                    const double *sourceData = [data samplePointerAtIndex:0, fieldNum];
-                                    double *destData         = tempData.mutableBytes;
-
-                                    while ( sourceData < (const double *)sourceEnd ) {
-                                        *destData++ = *sourceData;
-                                        sourceData += fieldCount;
-                                    }
-                                }
-                                else {
-                                    const NSDecimal *sourceData = [data samplePointerAtIndex:0, fieldNum];
-                                    NSDecimal *destData         = tempData.mutableBytes;
-
-                                    while ( sourceData < (const NSDecimal *)sourceEnd ) {
-                                        *destData++ = *sourceData;
-                                        sourceData += fieldCount;
-                                    }
-                                }
-
-                                CPTMutableNumericData *tempNumericData = [[CPTMutableNumericData alloc] initWithData:tempData
-                                                                                                            dataType:dataType
-                                                                                                               shape:nil];
-
-                                [self cacheNumbers:tempNumericData forField:fieldNum atRecordIndex:indexRange.location];
-                            }
-                            hasData = YES;
-                        }
-                        break;
-
-                        case CPTDataOrderColumnsFirst:
-                            for ( NSUInteger fieldNum = 0; fieldNum < fieldCount; fieldNum++ ) {
-                                const void *samples = [data samplePointerAtIndex:0, fieldNum];
-                                NSData *tempData    = [[NSData alloc] initWithBytes:samples
-                                                                             length:bufferLength];
 
-                                CPTMutableNumericData *tempNumericData = [[CPTMutableNumericData alloc] initWithData:tempData
-                                                                                                            dataType:dataType
-                                                                                                               shape:nil];
-
-                                [self cacheNumbers:tempNumericData forField:fieldNum atRecordIndex:indexRange.location];
+                        case CPTPlotCachePrecisionFloat:
+                            if ( !CPTDataTypeEqualToDataType(dataType, self.floatDataType)) {
+                                data = [data dataByConvertingToDataType:self.floatDataType];
                             }
-                            hasData = YES;
                             break;
                     }
+
+                    // add the data to the cache; each field is a slice of the buffer, and a strided one is gathered once as it is cached
+                    for ( NSUInteger fieldNum = 0; fieldNum < fieldCount; fieldNum++ ) {
+                        [self cacheNumbers:[data sliceForColumn:fieldNum] forField:fieldNum atRecordIndex:indexRange.location];
+                    }
+                    hasData = YES;
                 }
             }
         }
@@ -970,13 +1096,22 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 }
 
 /** @brief Copies an array of numbers to the cache.
+ *
+ *  Fields with implicit values are not cached and are left unchanged.
+ *
  *  @param numbers An array of numbers to cache. Can be a CPTNumericData, NSArray, or NSData (NSData is assumed to be a c-style array of type @double).
  *  @param fieldEnum The field enumerator identifying the field.
  **/
 -(void)cacheNumbers:(nullable id)numbers forField:(NSUInteger)fieldEnum
 {
+    if ( [self hasImplicitValuesForField:fieldEnum] ) {
+        return;
+    }
+
     NSNumber *cacheKey = @(fieldEnum);
 
+    [self.cachedRangeIndexes removeObjectForKey:cacheKey];
+
     CPTCoordinate coordinate   = [self coordinateForFieldIdentifier:fieldEnum];
     CPTPlotSpace *thePlotSpace = self.plotSpace;
 
@@ -991,6 +1126,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
                 NSUInteger sampleCount = mutableNumbers.numberOfSamples;
                 if ( sampleCount > 0 ) {
+                    mutableNumbers.capacity     = self.cacheCapacity;
                     (self.cachedData)[cacheKey] = mutableNumbers;
                 }
                 else {
@@ -1011,6 +1147,10 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                     case CPTPlotCachePrecisionDecimal:
                         [self setCachedDataType:self.decimalDataType];
                         break;
+
+                    case CPTPlotCachePrecisionFloat:
+                        [self setCachedDataType:self.floatDataType];
+                        break;
                 }
             }
             break;
@@ -1029,11 +1169,12 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                             [indices addObject:@([thePlotSpace indexOfCategory:category forCoordinate:coordinate])];
                         }
 
-                        CPTNumericDataType dataType = (self.cachePrecision == CPTPlotCachePrecisionDecimal ? self.decimalDataType : self.doubleDataType);
+                        CPTNumericDataType dataType = [self categoryDataType];
 
                         CPTMutableNumericData *mutableNumbers = [[CPTMutableNumericData alloc] initWithArray:indices
                                                                                                     dataType:dataType
                                                                                                        shape:nil];
+                        mutableNumbers.capacity = self.cacheCapacity;
 
                         (self.cachedData)[cacheKey] = mutableNumbers;
 
@@ -1062,13 +1203,16 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 }
 
 /** @brief Copies an array of numbers to replace a part of the cache.
+ *
+ *  Fields with implicit values are not cached and are left unchanged.
+ *
  *  @param numbers An array of numbers to cache. Can be a CPTNumericData, NSArray, or NSData (NSData is assumed to be a c-style array of type @double).
  *  @param fieldEnum The field enumerator identifying the field.
  *  @param idx The index of the first data point to replace.
  **/
 -(void)cacheNumbers:(nullable id)numbers forField:(NSUInteger)fieldEnum atRecordIndex:(NSUInteger)idx
 {
-    if ( numbers ) {
+    if ( numbers && ![self hasImplicitValuesForField:fieldEnum] ) {
         NSNumber *cacheKey     = @(fieldEnum);
         NSUInteger sampleCount = 0;
 
@@ -1108,6 +1252,14 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                             mutableNumbers.dataType = newType;
                         }
                         break;
+
+                        case CPTPlotCachePrecisionFloat:
+                        {
+                            CPTNumericDataType newType = self.floatDataType;
+                            [self setCachedDataType:newType];
+                            mutableNumbers.dataType = newType;
+                        }
+                        break;
                     }
                 }
             }
@@ -1126,7 +1278,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                             [indices addObject:@([thePlotSpace indexOfCategory:category forCoordinate:coordinate])];
                         }
 
-                        CPTNumericDataType dataType = (self.cachePrecision == CPTPlotCachePrecisionDecimal ? self.decimalDataType : self.doubleDataType);
+                        CPTNumericDataType dataType = [self categoryDataType];
 
                         mutableNumbers = [[CPTMutableNumericData alloc] initWithArray:indices
                                                                              dataType:dataType
@@ -1138,20 +1290,41 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
             default:
                 [self.cachedData removeObjectForKey:cacheKey];
+                [self.cachedRangeIndexes removeObjectForKey:cacheKey];
                 break;
         }
 
         if ( mutableNumbers && (sampleCount > 0)) {
+            id<CPTPlotDataSource> theDataSource = self.dataSource;
+            NSUInteger numberOfRecords          = [theDataSource numberOfRecordsForPlot:self];
+
+            // Adopt the new data as the cache when it replaces the whole field; shared buffers are copied only if changed later
+            if ((idx == 0) && (sampleCount == numberOfRecords) && (mutableNumbers.numberOfDimensions == 1)) {
+                CPTMutableNumericData *oldNumbers = (self.cachedData)[cacheKey];
+                if ( !oldNumbers || CPTDataTypeEqualToDataType(oldNumbers.dataType, mutableNumbers.dataType)) {
+                    mutableNumbers.capacity     = self.cacheCapacity;
+                    (self.cachedData)[cacheKey] = mutableNumbers;
+                    self.cachedDataCount        = numberOfRecords;
+
+                    // the range index is rebuilt from the new data the next time it is needed
+                    [self.cachedRangeIndexes removeObjectForKey:cacheKey];
+
+                    [self relabelIndexRange:NSMakeRange(idx, sampleCount)];
+                    [self setNeedsDisplay];
+                    return;
+                }
+            }
+
             // Ensure the data cache exists and is the right size
             CPTMutableNumericData *cachedNumbers = (self.cachedData)[cacheKey];
             if ( !cachedNumbers ) {
                 cachedNumbers = [CPTMutableNumericData numericDataWithData:[NSData data]
                                                                   dataType:mutableNumbers.dataType
                                                                      shape:nil];
+                cachedNumbers.capacity      = self.cacheCapacity;
                 (self.cachedData)[cacheKey] = cachedNumbers;
             }
-            id<CPTPlotDataSource> theDataSource = self.dataSource;
-            NSUInteger numberOfRecords          = [theDataSource numberOfRecordsForPlot:self];
+            NSUInteger oldNumberOfRecords = cachedNumbers.numberOfSamples;
             cachedNumbers.shape = @[@(numberOfRecords)];
 
             // Update the cache
@@ -1159,9 +1332,21 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
             NSUInteger startByte = idx * cachedNumbers.sampleBytes;
             void *cachePtr       = (int8_t *)(cachedNumbers.mutableBytes) + startByte;
-            size_t numberOfBytes = MIN(mutableNumbers.data.length, cachedNumbers.data.length - startByte);
+            size_t numberOfBytes = MIN(mutableNumbers.length, cachedNumbers.length - startByte);
             memcpy(cachePtr, mutableNumbers.bytes, numberOfBytes);
 
+            // Update the range index
+            _CPTDataRangeIndex *rangeIndex = self.cachedRangeIndexes[cacheKey];
+            if ( rangeIndex ) {
+                if ( numberOfRecords > oldNumberOfRecords ) {
+                    [rangeIndex insertData:cachedNumbers inIndexRange:NSMakeRange(oldNumberOfRecords, numberOfRecords - oldNumberOfRecords)];
+                }
+                else if ( numberOfRecords < oldNumberOfRecords ) {
+                    [rangeIndex removeData:cachedNumbers inIndexRange:NSMakeRange(numberOfRecords, oldNumberOfRecords - numberOfRecords)];
+                }
+                [rangeIndex updateData:cachedNumbers inIndexRange:NSMakeRange(idx, numberOfBytes / cachedNumbers.sampleBytes)];
+            }
+
             [self relabelIndexRange:NSMakeRange(idx, sampleCount)];
         }
 
@@ -1177,16 +1362,35 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     CPTNumericDataType loadedDataType;
 
     if ( [numbers isKindOfClass:[CPTNumericData class]] ) {
-        mutableNumbers = [numbers mutableCopy];
+        CPTNumericData *numericData = (CPTNumericData *)numbers;
+
         // ensure the numeric data is in a supported format; default to double if not already NSDecimal
-        if ( !CPTDataTypeEqualToDataType(mutableNumbers.dataType, self.decimalDataType) &&
-             !CPTDataTypeEqualToDataType(mutableNumbers.dataType, self.doubleDataType)) {
-            mutableNumbers.dataType = self.doubleDataType;
+        // float data is kept as is when the cache holds floats so it is not widened and narrowed again
+        BOOL keepFloat = (self.cachePrecision == CPTPlotCachePrecisionFloat) &&
+                         CPTDataTypeEqualToDataType(numericData.dataType, self.floatDataType);
+
+        if ( !keepFloat &&
+             !CPTDataTypeEqualToDataType(numericData.dataType, self.decimalDataType) &&
+             !CPTDataTypeEqualToDataType(numericData.dataType, self.doubleDataType)) {
+            numericData = [numericData dataByConvertingToDataType:self.doubleDataType];
+        }
+
+        if ( numericData.sampleStride > 1 ) {
+            // the cache readers and the public accessors expect contiguous samples, so gather a slice of rows-first data once here
+            mutableNumbers = [[CPTMutableNumericData alloc] initWithData:numericData.data
+                                                                dataType:numericData.dataType
+                                                                   shape:nil];
+        }
+        else {
+            // a mutable copy of immutable data shares its buffer until the cache changes it
+            mutableNumbers = [numericData mutableCopy];
         }
     }
     else if ( [numbers isKindOfClass:[NSData class]] ) {
         loadedDataType = self.doubleDataType;
-        mutableNumbers = [[CPTMutableNumericData alloc] initWithData:numbers dataType:loadedDataType shape:nil];
+
+        CPTNumericData *numericData = [[CPTNumericData alloc] initWithData:numbers dataType:loadedDataType shape:nil];
+        mutableNumbers = [numericData mutableCopy];
     }
     else if ( [numbers isKindOfClass:[NSArray class]] ) {
         if (((CPTNumberArray *)numbers).count == 0 ) {
@@ -1195,6 +1399,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
         else if ( [((NSArray<NSNumber *> *)numbers)[0] isKindOfClass:[NSDecimalNumber class]] ) {
             loadedDataType = self.decimalDataType;
         }
+        else if ( self.cachePrecision == CPTPlotCachePrecisionFloat ) {
+            loadedDataType = self.floatDataType;
+        }
         else {
             loadedDataType = self.doubleDataType;
         }
@@ -1208,6 +1415,24 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     return mutableNumbers;
 }
 
+/** @internal
+ *  @brief The data type used to cache category indices.
+ *  @return The cache data type for the current @ref cachePrecision; @double if it is #CPTPlotCachePrecisionAuto.
+ **/
+-(CPTNumericDataType)categoryDataType
+{
+    switch ( self.cachePrecision ) {
+        case CPTPlotCachePrecisionDecimal:
+            return self.decimalDataType;
+
+        case CPTPlotCachePrecisionFloat:
+            return self.floatDataType;
+
+        default:
+            return self.doubleDataType;
+    }
+}
+
 /// @endcond
 
 -(BOOL)doublePrecisionCache
@@ -1239,12 +1464,57 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     return result;
 }
 
+-(BOOL)floatPrecisionCache
+{
+    BOOL result = NO;
+
+    switch ( self.cachePrecision ) {
+        case CPTPlotCachePrecisionAuto:
+        {
+            // data cached with float precision stays float if the precision is changed to auto
+            NSMutableDictionary<NSString *, CPTNumericData *> *dataCache = self.cachedData;
+            Class numberClass                                            = [NSNumber class];
+            for ( id key in dataCache.allKeys ) {
+                if ( [key isKindOfClass:numberClass] ) {
+                    result = CPTDataTypeEqualToDataType(((CPTMutableNumericData *)dataCache[key]).dataType, self.floatDataType);
+                    break;
+                }
+            }
+        }
+        break;
+
+        case CPTPlotCachePrecisionFloat:
+            result = YES;
+            break;
+
+        default:
+            // not float precision
+            break;
+    }
+    return result;
+}
+
 /** @brief Retrieves an array of numbers from the cache.
+ *
+ *  The values of a field with implicit values are computed the first time they are requested and
+ *  kept until the number of records, the cache precision, or the origin changes.
+ *
  *  @param fieldEnum The field enumerator identifying the field.
  *  @return The array of cached numbers.
  **/
 -(nullable CPTMutableNumericData *)cachedNumbersForField:(NSUInteger)fieldEnum
 {
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        NSUInteger numberOfRecords = self.cachedDataCount;
+
+        if ( numberOfRecords == 0 ) {
+            return nil;
+        }
+        return [implicitField numericDataWithNumberOfRecords:numberOfRecords dataType:[self implicitFieldDataType]];
+    }
+
     return (self.cachedData)[@(fieldEnum)];
 }
 
@@ -1255,6 +1525,20 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
  **/
 -(nullable NSNumber *)cachedNumberForField:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx
 {
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        if ( idx >= self.cachedDataCount ) {
+            return nil;
+        }
+        else if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+            return @([implicitField doubleValueAtIndex:idx]);
+        }
+        else {
+            return [NSDecimalNumber decimalNumberWithDecimal:[implicitField decimalValueAtIndex:idx]];
+        }
+    }
+
     CPTMutableNumericData *numbers = [self cachedNumbersForField:fieldEnum];
 
     return [numbers sampleValue:idx];
@@ -1267,18 +1551,30 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
  **/
 -(double)cachedDoubleForField:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx
 {
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        return (idx < self.cachedDataCount) ? [implicitField doubleValueAtIndex:idx] : (double)NAN;
+    }
+
     CPTMutableNumericData *numbers = [self cachedNumbersForField:fieldEnum];
 
     if ( numbers ) {
         switch ( numbers.dataTypeFormat ) {
             case CPTFloatingPointDataType:
-            {
-                const double *doubleNumber = (const double *)[numbers samplePointer:idx];
-                if ( doubleNumber ) {
-                    return *doubleNumber;
+                if ( numbers.sampleBytes == sizeof(float)) {
+                    const float *floatNumber = (const float *)[numbers samplePointer:idx];
+                    if ( floatNumber ) {
+                        return (double)*floatNumber;
+                    }
                 }
-            }
-            break;
+                else {
+                    const double *doubleNumber = (const double *)[numbers samplePointer:idx];
+                    if ( doubleNumber ) {
+                        return *doubleNumber;
+                    }
+                }
+                break;
 
             case CPTDecimalDataType:
             {
@@ -1304,18 +1600,30 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
  **/
 -(NSDecimal)cachedDecimalForField:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx
 {
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        return (idx < self.cachedDataCount) ? [implicitField decimalValueAtIndex:idx] : CPTDecimalNaN();
+    }
+
     CPTMutableNumericData *numbers = [self cachedNumbersForField:fieldEnum];
 
     if ( numbers ) {
         switch ( numbers.dataTypeFormat ) {
             case CPTFloatingPointDataType:
-            {
-                const double *doubleNumber = (const double *)[numbers samplePointer:idx];
-                if ( doubleNumber ) {
-                    return CPTDecimalFromDouble(*doubleNumber);
+                if ( numbers.sampleBytes == sizeof(float)) {
+                    const float *floatNumber = (const float *)[numbers samplePointer:idx];
+                    if ( floatNumber ) {
+                        return CPTDecimalFromFloat(*floatNumber);
+                    }
                 }
-            }
-            break;
+                else {
+                    const double *doubleNumber = (const double *)[numbers samplePointer:idx];
+                    if ( doubleNumber ) {
+                        return CPTDecimalFromDouble(*doubleNumber);
+                    }
+                }
+                break;
 
             case CPTDecimalDataType:
             {
@@ -1334,10 +1642,98 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     return CPTDecimalNaN();
 }
 
+/** @brief Retrieves a range of numbers from the cache as a C array of @double values.
+ *
+ *  If the cache holds @double values, the returned object refers to the cached values without copying them
+ *  and is only valid until the cache changes. Other cache types are converted to @double. The values of
+ *  a field with implicit values are computed for the requested range only.
+ *
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @param indexRange The range of the data indexes of interest.
+ *  @return The cached numbers or @nil if no data is cached for the requested field.
+ **/
+-(nullable NSData *)cachedDoublesForField:(NSUInteger)fieldEnum recordIndexRange:(NSRange)indexRange
+{
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        NSParameterAssert(NSMaxRange(indexRange) <= self.cachedDataCount);
+
+        NSMutableData *doubleData = [NSMutableData dataWithLength:indexRange.length * sizeof(double)];
+        [implicitField getDoubles:(double *)doubleData.mutableBytes inIndexRange:indexRange];
+
+        return doubleData;
+    }
+
+    CPTMutableNumericData *numbers = [self cachedNumbersForField:fieldEnum];
+
+    if ( !numbers ) {
+        return nil;
+    }
+
+    NSParameterAssert(NSMaxRange(indexRange) <= numbers.numberOfSamples);
+
+    NSUInteger count = indexRange.length;
+
+    if ( count == 0 ) {
+        return [NSData data];
+    }
+
+    const void *samples = [numbers samplePointer:indexRange.location];
+    NSData *result      = nil;
+
+    switch ( numbers.dataTypeFormat ) {
+        case CPTFloatingPointDataType:
+            if ( numbers.sampleBytes == sizeof(float)) {
+                NSMutableData *doubleData = [NSMutableData dataWithLength:count * sizeof(double)];
+                const float *floats       = (const float *)samples;
+                double *doubles           = (double *)doubleData.mutableBytes;
+
+                for ( NSUInteger i = 0; i < count; i++ ) {
+                    doubles[i] = (double)floats[i];
+                }
+                result = doubleData;
+            }
+            else {
+                // the returned data is never written to
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-qual"
+                result = [NSData dataWithBytesNoCopy:(void *)samples
+                                              length:count * sizeof(double)
+                                        freeWhenDone:NO];
+#pragma clang diagnostic pop
+            }
+            break;
+
+        case CPTDecimalDataType:
+        {
+            NSMutableData *doubleData = [NSMutableData dataWithLength:count * sizeof(double)];
+            const NSDecimal *decimals = (const NSDecimal *)samples;
+            double *doubles           = (double *)doubleData.mutableBytes;
+
+            for ( NSUInteger i = 0; i < count; i++ ) {
+                doubles[i] = CPTDecimalDoubleValue(decimals[i]);
+            }
+            result = doubleData;
+        }
+        break;
+
+        default:
+            [NSException raise:CPTException format:@"Unsupported data type format"];
+            break;
+    }
+
+    return result;
+}
+
 /// @cond
 
 -(void)setCachedDataType:(CPTNumericDataType)newDataType
 {
+    NSParameterAssert(CPTDataTypeEqualToDataType(newDataType, self.doubleDataType) ||
+                      CPTDataTypeEqualToDataType(newDataType, self.floatDataType) ||
+                      CPTDataTypeEqualToDataType(newDataType, self.decimalDataType));
+
     Class numberClass = [NSNumber class];
 
     NSMutableDictionary<NSString *, CPTMutableNumericData *> *dataDictionary = self.cachedData;
@@ -1345,6 +1741,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     for ( id key in dataDictionary.allKeys ) {
         if ( [key isKindOfClass:numberClass] ) {
             CPTMutableNumericData *numericData = dataDictionary[key];
+            if ( !CPTDataTypeEqualToDataType(numericData.dataType, newDataType)) {
+                [self.cachedRangeIndexes removeObjectForKey:key];
+            }
             numericData.dataType = newDataType;
         }
     }
@@ -1376,6 +1775,18 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     return dataType;
 }
 
+-(CPTNumericDataType)floatDataType
+{
+    static CPTNumericDataType dataType;
+    static dispatch_once_t onceToken = 0;
+
+    dispatch_once(&onceToken, ^{
+        dataType = CPTDataType(CPTFloatingPointDataType, sizeof(float), CFByteOrderGetCurrent());
+    });
+
+    return dataType;
+}
+
 /** @brief Retrieves an array of values from the cache.
  *  @param key The key identifying the field.
  *  @return The array of cached values.
@@ -1450,74 +1861,411 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 }
 
 #pragma mark -
-#pragma mark Data Ranges
+#pragma mark Implicit Fields
 
-/** @brief Determines the smallest plot range that fully encloses the data for a particular field.
+/** @brief Makes the values of a field evenly spaced and computed from the record index.
+ *
+ *  The value of record @par{i} is @par{origin + i × step}. Only the origin and step are stored; the field is not
+ *  loaded from the datasource or cached, so values, plot ranges, and the records within a range of values are computed
+ *  as needed instead of being read from a cached array. Use this for fields such as sample times or indices that
+ *  advance by a fixed amount from one record to the next.
+ *
+ *  The other fields are still loaded from the datasource and set the number of records.
+ *
  *  @param fieldEnum The field enumerator identifying the field.
- *  @return The plot range enclosing the data.
+ *  @param origin The value of the first record.
+ *  @param step The difference between the values of neighboring records.
  **/
--(nullable CPTPlotRange *)plotRangeForField:(NSUInteger)fieldEnum
+-(void)setImplicitValuesForField:(NSUInteger)fieldEnum origin:(nonnull NSNumber *)origin step:(nonnull NSNumber *)step
 {
-    if ( self.dataNeedsReloading ) {
-        [self reloadData];
-    }
-    CPTMutableNumericData *numbers = [self cachedNumbersForField:fieldEnum];
+    NSParameterAssert(origin);
+    NSParameterAssert(step);
+
+    NSNumber *cacheKey = @(fieldEnum);
+
+    [self.cachedData removeObjectForKey:cacheKey];
+    [self.cachedRangeIndexes removeObjectForKey:cacheKey];
+
+    self.implicitFields[cacheKey] = [[_CPTImplicitField alloc] initWithOrigin:origin.decimalValue
+                                                                         step:step.decimalValue];
+
+    self.needsRelabel = YES;
+    [self setNeedsDisplay];
+}
+
+/** @brief Loads the values of a field from the datasource again instead of computing them from the record index.
+ *  @param fieldEnum The field enumerator identifying the field.
+ **/
+-(void)removeImplicitValuesForField:(NSUInteger)fieldEnum
+{
+    NSNumber *cacheKey = @(fieldEnum);
+
+    if ( self.implicitFields[cacheKey] ) {
+        [self.implicitFields removeObjectForKey:cacheKey];
+
+        [self setDataNeedsReloading];
+        [self setNeedsDisplay];
+    }
+}
+
+/** @brief Determines whether the values of a field are computed from the record index.
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @return @YES if the field has implicit values.
+ **/
+-(BOOL)hasImplicitValuesForField:(NSUInteger)fieldEnum
+{
+    return self.implicitFields[@(fieldEnum)] != nil;
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Gets the origin and step of a field with implicit values.
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @return The implicit field, or @nil if the values of the field are cached.
+ **/
+-(nullable _CPTImplicitField *)implicitFieldForField:(NSUInteger)fieldEnum
+{
+    return self.implicitFields[@(fieldEnum)];
+}
+
+/** @internal
+ *  @brief The data type used when the values of an implicit field are materialized.
+ *  @return The data type of the cached numeric fields.
+ **/
+-(CPTNumericDataType)implicitFieldDataType
+{
+    if ( self.doublePrecisionCache ) {
+        return self.doubleDataType;
+    }
+    else if ( self.floatPrecisionCache ) {
+        return self.floatDataType;
+    }
+    else {
+        return self.decimalDataType;
+    }
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Data Ranges
+
+/** @brief Determines the smallest plot range that fully encloses the data for a particular field.
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @return The plot range enclosing the data.
+ **/
+-(nullable CPTPlotRange *)plotRangeForField:(NSUInteger)fieldEnum
+{
+    if ( self.dataNeedsReloading ) {
+        [self reloadData];
+    }
+    NSUInteger numberOfRecords = 0;
+
+    if ( [self hasImplicitValuesForField:fieldEnum] ) {
+        numberOfRecords = self.cachedDataCount;
+    }
+    else {
+        numberOfRecords = [self cachedNumbersForField:fieldEnum].numberOfSamples;
+    }
+
+    return [self plotRangeForField:fieldEnum recordIndexRange:NSMakeRange(0, numberOfRecords)];
+}
+
+/** @brief Determines the smallest plot range that fully encloses the data for a particular field within a range of records.
+ *
+ *  The extremes are found using a min/max summary of the cached data that is built the first time the field is
+ *  queried and updated incrementally as records are cached, inserted, and deleted, so repeated queries take
+ *  logarithmic time rather than scanning every record. The extremes of a field with implicit values
+ *  are its first and last values, so they are found in constant time.
+ *
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @param indexRange The range of records to include.
+ *  @return The plot range enclosing the data.
+ **/
+-(nullable CPTPlotRange *)plotRangeForField:(NSUInteger)fieldEnum recordIndexRange:(NSRange)indexRange
+{
+    if ( self.dataNeedsReloading ) {
+        [self reloadData];
+    }
+
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        NSUInteger numberOfRecords  = self.cachedDataCount;
+        CPTPlotRange *implicitRange = nil;
+
+        if ( NSMaxRange(indexRange) > numberOfRecords ) {
+            indexRange.length = (indexRange.location < numberOfRecords ? numberOfRecords - indexRange.location : 0);
+        }
+
+        if ( indexRange.length > 0 ) {
+            NSUInteger lastIndex = NSMaxRange(indexRange) - 1;
+
+            if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+                double first = [implicitField doubleValueAtIndex:indexRange.location];
+                double last  = [implicitField doubleValueAtIndex:lastIndex];
+
+                double min = MIN(first, last);
+                double max = MAX(first, last);
+
+                implicitRange = [CPTPlotRange plotRangeWithLocation:@(min) length:@(max - min)];
+            }
+            else {
+                NSDecimal first = [implicitField decimalValueAtIndex:indexRange.location];
+                NSDecimal last  = [implicitField decimalValueAtIndex:lastIndex];
+
+                NSDecimal min = CPTDecimalLessThan(last, first) ? last : first;
+                NSDecimal max = CPTDecimalLessThan(last, first) ? first : last;
+
+                implicitRange = [CPTPlotRange plotRangeWithLocationDecimal:min lengthDecimal:CPTDecimalSubtract(max, min)];
+            }
+        }
+        return implicitRange;
+    }
+
+    NSNumber *cacheKey             = @(fieldEnum);
+    CPTMutableNumericData *numbers = (self.cachedData)[cacheKey];
     CPTPlotRange *range            = nil;
 
     NSUInteger numberOfSamples = numbers.numberOfSamples;
-    if ( numberOfSamples > 0 ) {
-        if ( self.doublePrecisionCache ) {
-            double min = (double)INFINITY;
-            double max = -(double)INFINITY;
 
-            const double *doubles    = (const double *)numbers.bytes;
-            const double *lastSample = doubles + numberOfSamples;
+    if ( NSMaxRange(indexRange) > numberOfSamples ) {
+        indexRange.length = (indexRange.location < numberOfSamples ? numberOfSamples - indexRange.location : 0);
+    }
 
-            while ( doubles < lastSample ) {
-                double value = *doubles++;
+    if ( indexRange.length > 0 ) {
+        _CPTDataRangeIndex *rangeIndex = [self rangeIndexForField:fieldEnum];
 
-                if ( !isnan(value)) {
-                    if ( value < min ) {
-                        min = value;
-                    }
-                    if ( value > max ) {
-                        max = value;
-                    }
-                }
+        NSUInteger minIndex = 0;
+        NSUInteger maxIndex = 0;
+
+        if ( [rangeIndex getMinimumIndex:&minIndex maximumIndex:&maxIndex forData:numbers inIndexRange:indexRange] ) {
+            if ( self.doublePrecisionCache ) {
+                const double *doubles = (const double *)numbers.bytes;
+
+                double min = doubles[minIndex];
+                double max = doubles[maxIndex];
+
+                range = [CPTPlotRange plotRangeWithLocation:@(min) length:@(max - min)];
             }
+            else if ( self.floatPrecisionCache ) {
+                const float *floats = (const float *)numbers.bytes;
+
+                double min = (double)floats[minIndex];
+                double max = (double)floats[maxIndex];
 
-            if ( max >= min ) {
                 range = [CPTPlotRange plotRangeWithLocation:@(min) length:@(max - min)];
             }
+            else {
+                const NSDecimal *decimals = (const NSDecimal *)numbers.bytes;
+
+                NSDecimal min = decimals[minIndex];
+                NSDecimal max = decimals[maxIndex];
+
+                range = [CPTPlotRange plotRangeWithLocationDecimal:min lengthDecimal:CPTDecimalSubtract(max, min)];
+            }
         }
-        else {
-            NSDecimal min = [NSDecimalNumber maximumDecimalNumber].decimalValue;
-            NSDecimal max = [NSDecimalNumber minimumDecimalNumber].decimalValue;
+    }
+    return range;
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Gets the min/max summary of the cached data for a field, building it if needed.
+ *
+ *  The summary finds the extremes of any range of records in logarithmic time, so renderers can use it
+ *  to draw a reduced level of detail for large data sets. It is kept up to date as records are cached,
+ *  inserted, and deleted.
+ *
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @return The summary of the field, or @nil if the field is not cached as numeric data.
+ **/
+-(nullable _CPTDataRangeIndex *)rangeIndexForField:(NSUInteger)fieldEnum
+{
+    NSNumber *cacheKey             = @(fieldEnum);
+    CPTMutableNumericData *numbers = (self.cachedData)[cacheKey];
 
-            const NSDecimal *decimals   = (const NSDecimal *)numbers.bytes;
-            const NSDecimal *lastSample = decimals + numberOfSamples;
+    if ( ![numbers isKindOfClass:[CPTMutableNumericData class]] ) {
+        return nil;
+    }
 
-            while ( decimals < lastSample ) {
-                NSDecimal value = *decimals++;
+    _CPTDataRangeIndex *rangeIndex = self.cachedRangeIndexes[cacheKey];
 
-                if ( !NSDecimalIsNotANumber(&value)) {
-                    if ( CPTDecimalLessThan(value, min)) {
-                        min = value;
-                    }
-                    if ( CPTDecimalGreaterThan(value, max)) {
-                        max = value;
-                    }
-                }
+    if ( !rangeIndex ) {
+        rangeIndex = [[_CPTDataRangeIndex alloc] init];
+        [rangeIndex rebuildWithData:numbers];
+        self.cachedRangeIndexes[cacheKey] = rangeIndex;
+    }
+    else if ( rangeIndex.sampleCount != numbers.numberOfSamples ) {
+        [rangeIndex rebuildWithData:numbers];
+    }
+
+    return rangeIndex;
+}
+
+/** @internal
+ *  @brief Determines whether the values of a field are known to be in ascending order.
+ *
+ *  Implicit fields are sorted when their step is not negative. Other fields must be cached as numeric data
+ *  that the min/max summary finds to be in ascending order. Subclasses can override this method when the
+ *  order of a field is known in advance.
+ *
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @return @YES if the values of the field are sorted.
+ **/
+-(BOOL)isSortedField:(NSUInteger)fieldEnum
+{
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        return implicitField.stepDouble >= 0.0;
+    }
+
+    return [self rangeIndexForField:fieldEnum].sorted;
+}
+
+/** @internal
+ *  @brief Finds the records of a sorted field whose values fall within a range using a binary search.
+ *
+ *  Implicit fields are located arithmetically. Other fields must be cached as numeric data and
+ *  @ref isSortedField: must report them sorted.
+ *
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @param plotRange The range of values.
+ *  @return The range of record indices, or a range with a location of @ref NSNotFound if the field is not known to be sorted.
+ **/
+-(NSRange)indexRangeForSortedField:(NSUInteger)fieldEnum plotRange:(nonnull CPTPlotRange *)plotRange
+{
+    NSUInteger dataCount = self.cachedDataCount;
+
+    if ( ![self isSortedField:fieldEnum] ) {
+        return NSMakeRange(NSNotFound, 0);
+    }
+
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+
+    if ( implicitField ) {
+        return [implicitField indexRangeForPlotRange:plotRange numberOfRecords:dataCount];
+    }
+
+    CPTMutableNumericData *numbers = [self cachedNumbersForField:fieldEnum];
+
+    if ( !numbers || (numbers.numberOfSamples != dataCount)) {
+        return NSMakeRange(NSNotFound, 0);
+    }
+
+    NSUInteger lowIndex  = 0; // first index with value >= minimum
+    NSUInteger highIndex = 0; // first index with value > maximum
+
+    if ( numbers.dataType.dataTypeFormat == CPTDecimalDataType ) {
+        const NSDecimal *decimals = (const NSDecimal *)numbers.bytes;
+        NSDecimal minValue        = plotRange.minLimitDecimal;
+        NSDecimal maxValue        = plotRange.maxLimitDecimal;
+
+        NSUInteger low  = 0;
+        NSUInteger high = dataCount;
+        while ( low < high ) {
+            NSUInteger mid = low + (high - low) / 2;
+            if ( CPTDecimalLessThan(decimals[mid], minValue)) {
+                low = mid + 1;
+            }
+            else {
+                high = mid;
             }
+        }
+        lowIndex = low;
 
-            if ( CPTDecimalGreaterThanOrEqualTo(max, min)) {
-                range = [CPTPlotRange plotRangeWithLocationDecimal:min lengthDecimal:CPTDecimalSubtract(max, min)];
+        high = dataCount;
+        while ( low < high ) {
+            NSUInteger mid = low + (high - low) / 2;
+            if ( CPTDecimalLessThanOrEqualTo(decimals[mid], maxValue)) {
+                low = mid + 1;
+            }
+            else {
+                high = mid;
             }
         }
+        highIndex = low;
     }
-    return range;
+    else {
+        double maxValue = plotRange.maxLimitDouble;
+
+        lowIndex = [self firstIndexOfSortedField:fieldEnum notLessThanValue:plotRange.minLimitDouble inIndexRange:NSMakeRange(0, dataCount)];
+
+        // the first value above the maximum is the first value not less than the next larger double
+        if ( maxValue < (double)INFINITY ) {
+            highIndex = [self firstIndexOfSortedField:fieldEnum
+                                     notLessThanValue:nextafter(maxValue, (double)INFINITY)
+                                         inIndexRange:NSMakeRange(lowIndex, dataCount - lowIndex)];
+        }
+        else {
+            highIndex = dataCount;
+        }
+    }
+
+    return NSMakeRange(lowIndex, highIndex - lowIndex);
+}
+
+/** @internal
+ *  @brief Finds the first record of a sorted field with a value that is not less than a given value using a binary search.
+ *
+ *  Implicit values are computed and @double or @float values are read directly from the cache. @NSDecimal values
+ *  are compared as @double values.
+ *
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @param value The value to find.
+ *  @param indexRange The range of records to search. The values must be sorted in ascending order.
+ *  @return The index of the first record in the range whose value is greater than or equal to @par{value}, or the end of the range if there is none.
+ **/
+-(NSUInteger)firstIndexOfSortedField:(NSUInteger)fieldEnum notLessThanValue:(double)value inIndexRange:(NSRange)indexRange
+{
+    _CPTImplicitField *implicitField = [self implicitFieldForField:fieldEnum];
+    CPTMutableNumericData *numbers   = implicitField ? nil : [self cachedNumbersForField:fieldEnum];
+
+    NSUInteger low  = indexRange.location;
+    NSUInteger high = NSMaxRange(indexRange);
+
+    if ( !implicitField && !numbers ) {
+        return low;
+    }
+
+    const void *bytes           = numbers.bytes;
+    CPTNumericDataType dataType = numbers.dataType;
+    BOOL decimalValues          = (dataType.dataTypeFormat == CPTDecimalDataType);
+    BOOL floatValues            = !decimalValues && (dataType.sampleBytes == sizeof(float));
+
+    while ( low < high ) {
+        NSUInteger mid = low + (high - low) / 2;
+        double midValue;
+
+        if ( implicitField ) {
+            midValue = [implicitField doubleValueAtIndex:mid];
+        }
+        else if ( decimalValues ) {
+            midValue = CPTDecimalDoubleValue(((const NSDecimal *)bytes)[mid]);
+        }
+        else if ( floatValues ) {
+            midValue = (double)((const float *)bytes)[mid];
+        }
+        else {
+            midValue = ((const double *)bytes)[mid];
+        }
+
+        if ( midValue < value ) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    return low;
 }
 
+/// @endcond
+
 /** @brief Determines the smallest plot range that fully encloses the data for a particular coordinate.
  *  @param coord The coordinate identifier.
  *  @return The plot range enclosing the data.
@@ -1593,7 +2341,10 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 }
 
 /**
- *  @brief Updates the data labels in the labelIndexRange.
+ *  @brief Updates the data labels in the labelIndexRange and the labels of records that scrolled into or out of view.
+ *
+ *  Labels are only made for the records inside the visible part of the plot space. The labels of records
+ *  that are no longer visible are removed, and their text layers are reused for new labels.
  **/
 -(void)relabel
 {
@@ -1603,9 +2354,7 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 
     self.needsRelabel = NO;
 
-    id nullObject         = [NSNull null];
-    Class nullClass       = [NSNull class];
-    Class annotationClass = [CPTAnnotation class];
+    Class nullClass = [NSNull class];
 
     CPTTextStyle *dataLabelTextStyle = self.labelTextStyle;
     NSFormatter *dataLabelFormatter  = self.labelFormatter;
@@ -1620,13 +2369,14 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
         }
     }
 
+    NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *labels = self.labelAnnotations;
+
     if ( !self.showLabels || (!hasCachedLabels && !plotProvidesLabels)) {
-        for ( CPTAnnotation *annotation in self.labelAnnotations ) {
-            if ( [annotation isKindOfClass:annotationClass] ) {
-                [self removeAnnotation:annotation];
-            }
+        for ( CPTPlotSpaceAnnotation *label in labels.allValues ) {
+            [self recycleLabelAnnotation:label];
         }
         self.labelAnnotations = nil;
+        [self emptyLabelLayerPool];
         return;
     }
 
@@ -1635,107 +2385,315 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
                                                                   withDefaultAttributes:textAttributes] != nil);
 
     NSUInteger sampleCount = self.cachedDataCount;
-    NSRange indexRange     = self.labelIndexRange;
-    NSUInteger maxIndex    = NSMaxRange(indexRange);
+    NSRange indexRange     = NSIntersectionRange(self.labelIndexRange, NSMakeRange(0, sampleCount));
+
+    if ( !labels ) {
+        labels                = [[NSMutableDictionary alloc] init];
+        self.labelAnnotations = labels;
+    }
+
+    // find the records inside the visible window
+    NSUInteger windowFields[2] = { NSNotFound, NSNotFound };
+    double windowMinimum[2], windowMaximum[2];
+
+    BOOL hasWindow            = [self getLabelWindowMinimum:windowMinimum maximum:windowMaximum];
+    NSIndexSet *windowIndexes = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, sampleCount)];
+
+    if ( hasWindow ) {
+        // only filter on coordinates with a single field; labels of multi-field plots can sit on any of them
+        for ( NSUInteger coord = 0; coord < 2; coord++ ) {
+            CPTNumberArray *fields = [self fieldIdentifiersForCoordinate:(CPTCoordinate)coord];
+            if ( fields.count == 1 ) {
+                windowFields[coord] = fields[0].unsignedIntegerValue;
+            }
+        }
+        windowIndexes = [self labelIndexesForWindowFields:windowFields minimum:windowMinimum maximum:windowMaximum];
+    }
+
+    // recycle the labels that need updating or scrolled out of view
+    for ( NSNumber *key in labels.allKeys ) {
+        NSUInteger i = key.unsignedIntegerValue;
 
-    if ( !self.labelAnnotations ) {
-        self.labelAnnotations = [NSMutableArray arrayWithCapacity:sampleCount];
+        if ( NSLocationInRange(i, indexRange) || ![windowIndexes containsIndex:i] ||
+             (hasWindow && ![self labelAtIndex:i isInWindowFields:windowFields minimum:windowMinimum maximum:windowMaximum])) {
+            [self recycleLabelAnnotation:labels[key]];
+            [labels removeObjectForKey:key];
+        }
     }
 
-    CPTPlotSpace *thePlotSpace            = self.plotSpace;
-    CGFloat theRotation                   = self.labelRotation;
-    CPTMutableAnnotationArray *labelArray = self.labelAnnotations;
-    NSUInteger oldLabelCount              = labelArray.count;
-    id nilObject                          = [CPTPlot nilData];
+    CPTPlotSpace *thePlotSpace = self.plotSpace;
+    CGFloat theRotation        = self.labelRotation;
+    id nilObject               = [CPTPlot nilData];
 
     CPTMutableNumericData *labelFieldDataCache = [self cachedNumbersForField:self.labelField];
     CPTShadow *theShadow                       = self.labelShadow;
 
-    for ( NSUInteger i = indexRange.location; i < maxIndex; i++ ) {
-        NSNumber *dataValue = [labelFieldDataCache sampleValue:i];
+    // make labels for the visible records that do not have one
+    for ( NSUInteger i = windowIndexes.firstIndex; i != NSNotFound; i = [windowIndexes indexGreaterThanIndex:i] ) {
+        NSNumber *key = @(i);
+
+        if ( labels[key] ) {
+            continue;
+        }
+        if ( hasWindow && ![self labelAtIndex:i isInWindowFields:windowFields minimum:windowMinimum maximum:windowMaximum] ) {
+            continue;
+        }
 
-        CPTLayer *newLabelLayer;
+        NSNumber *dataValue = [labelFieldDataCache sampleValue:i];
         if ( isnan([dataValue doubleValue])) {
-            newLabelLayer = nil;
+            continue;
         }
-        else {
-            newLabelLayer = [self cachedValueForKey:CPTPlotBindingDataLabels recordIndex:i];
 
-            if (((newLabelLayer == nil) || (newLabelLayer == nilObject)) && plotProvidesLabels ) {
-                if ( hasAttributedFormatter ) {
-                    NSAttributedString *labelString = [dataLabelFormatter attributedStringForObjectValue:dataValue withDefaultAttributes:textAttributes];
-                    newLabelLayer = [[CPTTextLayer alloc] initWithAttributedText:labelString];
-                }
-                else {
-                    NSString *labelString = [dataLabelFormatter stringForObjectValue:dataValue];
-                    newLabelLayer = [[CPTTextLayer alloc] initWithText:labelString style:dataLabelTextStyle];
-                }
-            }
+        CPTLayer *newLabelLayer = [self cachedValueForKey:CPTPlotBindingDataLabels recordIndex:i];
 
-            if ( [newLabelLayer isKindOfClass:nullClass] || (newLabelLayer == nilObject)) {
-                newLabelLayer = nil;
-            }
-        }
-        newLabelLayer.shadow = theShadow;
+        if (((newLabelLayer == nil) || (newLabelLayer == nilObject)) && plotProvidesLabels ) {
+            CPTTextLayer *textLayer = [self dequeueLabelLayer];
 
-        CPTPlotSpaceAnnotation *labelAnnotation;
-        if ( i < oldLabelCount ) {
-            labelAnnotation = labelArray[i];
-            if ( newLabelLayer ) {
-                if ( [labelAnnotation isKindOfClass:nullClass] ) {
-                    labelAnnotation = [[CPTPlotSpaceAnnotation alloc] initWithPlotSpace:thePlotSpace anchorPlotPoint:nil];
-                    labelArray[i]   = labelAnnotation;
-                    [self addAnnotation:labelAnnotation];
+            if ( hasAttributedFormatter ) {
+                NSAttributedString *labelString = [dataLabelFormatter attributedStringForObjectValue:dataValue withDefaultAttributes:textAttributes];
+                if ( textLayer ) {
+                    textLayer.attributedText = labelString;
+                }
+                else {
+                    textLayer = [[CPTTextLayer alloc] initWithAttributedText:labelString];
                 }
             }
             else {
-                if ( [labelAnnotation isKindOfClass:annotationClass] ) {
-                    labelArray[i] = nullObject;
-                    [self removeAnnotation:labelAnnotation];
+                NSString *labelString = [dataLabelFormatter stringForObjectValue:dataValue];
+                if ( textLayer ) {
+                    textLayer.text = labelString;
+                }
+                else {
+                    textLayer = [[CPTTextLayer alloc] initWithText:labelString style:dataLabelTextStyle];
                 }
             }
-        }
-        else {
-            if ( newLabelLayer ) {
-                labelAnnotation = [[CPTPlotSpaceAnnotation alloc] initWithPlotSpace:thePlotSpace anchorPlotPoint:nil];
-                [labelArray addObject:labelAnnotation];
-                [self addAnnotation:labelAnnotation];
-            }
-            else {
-                [labelArray addObject:nullObject];
+
+            if ( !self.pooledLabelLayers ) {
+                self.pooledLabelLayers = [[NSMutableSet alloc] init];
             }
+            [self.pooledLabelLayers addObject:textLayer];
+
+            newLabelLayer = textLayer;
         }
 
-        if ( newLabelLayer ) {
-            labelAnnotation.contentLayer = newLabelLayer;
-            labelAnnotation.rotation     = theRotation;
-            [self positionLabelAnnotation:labelAnnotation forIndex:i];
-            [self updateContentAnchorForLabel:labelAnnotation];
+        if ( !newLabelLayer || [newLabelLayer isKindOfClass:nullClass] || (newLabelLayer == nilObject)) {
+            continue;
         }
+        newLabelLayer.shadow = theShadow;
+
+        CGSize labelSize        = newLabelLayer.bounds.size;
+        self.largestLabelExtent = MAX(self.largestLabelExtent, MAX(labelSize.width, labelSize.height));
+
+        CPTPlotSpaceAnnotation *labelAnnotation = [[CPTPlotSpaceAnnotation alloc] initWithPlotSpace:thePlotSpace anchorPlotPoint:nil];
+        labels[key]                             = labelAnnotation;
+        [self addAnnotation:labelAnnotation];
+
+        labelAnnotation.contentLayer = newLabelLayer;
+        labelAnnotation.rotation     = theRotation;
+        [self positionLabelAnnotation:labelAnnotation forIndex:i];
+        [self updateContentAnchorForLabel:labelAnnotation];
     }
 
-    // remove labels that are no longer needed
-    while ( labelArray.count > sampleCount ) {
-        CPTAnnotation *oldAnnotation = labelArray[labelArray.count - 1];
-        if ( [oldAnnotation isKindOfClass:annotationClass] ) {
-            [self removeAnnotation:oldAnnotation];
-        }
-        [labelArray removeLastObject];
+    // keep no more unused layers than there are labels on screen
+    NSMutableArray<CPTTextLayer *> *pool = self.labelLayerPool;
+    while ( pool.count > labels.count ) {
+        [self.pooledLabelLayers removeObject:pool.lastObject];
+        [pool removeLastObject];
     }
 }
 
 /** @brief Marks the receiver as needing to update a range of data labels before the content is next drawn.
+ *
+ *  The range is combined with any other range waiting to be updated.
  *  @param indexRange The index range needing update.
  *  @see setNeedsRelabel()
  **/
 -(void)relabelIndexRange:(NSRange)indexRange
 {
+    NSRange pendingRange = self.labelIndexRange;
+
+    if ( self.needsRelabel && (pendingRange.length > 0)) {
+        indexRange = (indexRange.length > 0) ? NSUnionRange(pendingRange, indexRange) : pendingRange;
+    }
+
     self.labelIndexRange = indexRange;
     self.needsRelabel    = YES;
 }
 
+/**
+ *  @brief Marks the receiver as needing to add and remove data labels for the records that moved into or out of view.
+ *
+ *  Existing labels of records that are still visible are kept. The graph calls this method when
+ *  the coordinate mapping of the plot space changes.
+ **/
+-(void)setNeedsLabelWindowUpdate
+{
+    [self relabelIndexRange:NSMakeRange(0, 0)];
+    [self setNeedsLayout];
+}
+
 /// @cond
 
+/** @internal
+ *  @brief Finds the part of the plot space that is visible in the plot area, widened to include labels of nearby points.
+ *  @param minimum Returns the minimum x and y values of the window.
+ *  @param maximum Returns the maximum x and y values of the window.
+ *  @return @YES if the window could be computed, @NO otherwise.
+ **/
+-(BOOL)getLabelWindowMinimum:(nonnull double *)minimum maximum:(nonnull double *)maximum
+{
+    CPTPlotArea *thePlotArea   = self.plotArea;
+    CPTPlotSpace *thePlotSpace = self.plotSpace;
+
+    if ( !thePlotArea || !thePlotSpace ) {
+        return NO;
+    }
+
+    CGRect bounds = thePlotArea.bounds;
+    if ( CGRectIsEmpty(bounds)) {
+        return NO;
+    }
+
+    CGFloat outset = ABS(self.labelOffset) + self.largestLabelExtent;
+    bounds = CGRectInset(bounds, -outset, -outset);
+
+    double lowerLeft[2], upperRight[2];
+
+    [thePlotSpace doublePrecisionPlotPoint:lowerLeft numberOfCoordinates:2 forPlotAreaViewPoint:CGPointMake(CGRectGetMinX(bounds), CGRectGetMinY(bounds))];
+    [thePlotSpace doublePrecisionPlotPoint:upperRight numberOfCoordinates:2 forPlotAreaViewPoint:CGPointMake(CGRectGetMaxX(bounds), CGRectGetMaxY(bounds))];
+
+    for ( NSUInteger i = 0; i < 2; i++ ) {
+        if ( isnan(lowerLeft[i]) || isnan(upperRight[i])) {
+            return NO;
+        }
+        // axes can be reversed
+        minimum[i] = MIN(lowerLeft[i], upperRight[i]);
+        maximum[i] = MAX(lowerLeft[i], upperRight[i]);
+    }
+
+    return YES;
+}
+
+/** @internal
+ *  @brief Finds the records that can have a label inside the window.
+ *
+ *  Sorted window fields narrow the candidates to one run of records with a binary search. The min/max summary
+ *  of the first unsorted window field then picks the records in that run whose values fall inside the window,
+ *  skipping blocks of records that lie outside it. Candidates must still be checked against the other fields.
+ *  @param fields The fields used for the x and y coordinates, or @ref NSNotFound.
+ *  @param minimum The minimum x and y values of the window.
+ *  @param maximum The maximum x and y values of the window.
+ *  @return The indices of the candidate records.
+ **/
+-(nonnull NSIndexSet *)labelIndexesForWindowFields:(nonnull const NSUInteger *)fields minimum:(nonnull const double *)minimum maximum:(nonnull const double *)maximum
+{
+    NSRange candidateRange   = NSMakeRange(0, self.cachedDataCount);
+    NSUInteger unsortedCoord = NSNotFound;
+
+    for ( NSUInteger coord = 0; coord < 2; coord++ ) {
+        if ( fields[coord] != NSNotFound ) {
+            CPTPlotRange *windowRange = [CPTPlotRange plotRangeWithLocationDecimal:CPTDecimalFromDouble(minimum[coord])
+                                                                     lengthDecimal:CPTDecimalFromDouble(maximum[coord] - minimum[coord])];
+
+            NSRange indexRange = [self indexRangeForSortedField:fields[coord] plotRange:windowRange];
+            if ( indexRange.location != NSNotFound ) {
+                candidateRange = NSIntersectionRange(candidateRange, indexRange);
+            }
+            else if ( unsortedCoord == NSNotFound ) {
+                unsortedCoord = coord;
+            }
+        }
+    }
+
+    if ((unsortedCoord != NSNotFound) && (candidateRange.length > 0)) {
+        NSUInteger field               = fields[unsortedCoord];
+        _CPTDataRangeIndex *rangeIndex = [self rangeIndexForField:field];
+        CPTMutableNumericData *numbers = [self cachedNumbersForField:field];
+
+        if ( rangeIndex && (NSMaxRange(candidateRange) <= rangeIndex.sampleCount)) {
+            NSMutableIndexSet *indexes = [[NSMutableIndexSet alloc] init];
+
+            [rangeIndex addIndicesOfValuesFromMinimum:minimum[unsortedCoord]
+                                            toMaximum:maximum[unsortedCoord]
+                                           toIndexSet:indexes
+                                              forData:numbers
+                                         inIndexRange:candidateRange];
+            return indexes;
+        }
+    }
+
+    return [NSIndexSet indexSetWithIndexesInRange:candidateRange];
+}
+
+/** @internal
+ *  @brief Determines whether the data point of a record is inside the window.
+ *  @param idx The index of the record.
+ *  @param fields The fields used for the x and y coordinates, or @ref NSNotFound.
+ *  @param minimum The minimum x and y values of the window.
+ *  @param maximum The maximum x and y values of the window.
+ *  @return @YES if the record can have a visible label, @NO otherwise.
+ **/
+-(BOOL)labelAtIndex:(NSUInteger)idx isInWindowFields:(nonnull const NSUInteger *)fields minimum:(nonnull const double *)minimum maximum:(nonnull const double *)maximum
+{
+    for ( NSUInteger coord = 0; coord < 2; coord++ ) {
+        if ( fields[coord] != NSNotFound ) {
+            double value = [self cachedDoubleForField:fields[coord] recordIndex:idx];
+            if ( !((value >= minimum[coord]) && (value <= maximum[coord]))) {
+                return NO;
+            }
+        }
+    }
+
+    return YES;
+}
+
+/** @internal
+ *  @brief Takes an unused text layer from the label layer pool.
+ *  @return A text layer ready to receive new text, or @nil if the pool is empty.
+ **/
+-(nullable CPTTextLayer *)dequeueLabelLayer
+{
+    NSMutableArray<CPTTextLayer *> *pool = self.labelLayerPool;
+    CPTTextLayer *textLayer              = pool.lastObject;
+
+    if ( textLayer ) {
+        [pool removeLastObject];
+    }
+
+    return textLayer;
+}
+
+/** @internal
+ *  @brief Removes a data label from the plot and returns its text layer to the pool if the plot made it.
+ *  @param label The annotation of the data label.
+ **/
+-(void)recycleLabelAnnotation:(nonnull CPTPlotSpaceAnnotation *)label
+{
+    CPTLayer *contentLayer = label.contentLayer;
+
+    if ( [self.annotations containsObject:label] ) {
+        [self removeAnnotation:label];
+    }
+    label.contentLayer = nil;
+
+    if ( [contentLayer isKindOfClass:[CPTTextLayer class]] && [self.pooledLabelLayers containsObject:(CPTTextLayer *)contentLayer] ) {
+        if ( !self.labelLayerPool ) {
+            self.labelLayerPool = [[NSMutableArray alloc] init];
+        }
+        [self.labelLayerPool addObject:(CPTTextLayer *)contentLayer];
+    }
+}
+
+/** @internal
+ *  @brief Throws away all pooled text layers, e.g., when the label text style or formatter changes.
+ **/
+-(void)emptyLabelLayerPool
+{
+    self.labelLayerPool     = nil;
+    self.pooledLabelLayers  = nil;
+    self.largestLabelExtent = CPTFloat(0.0);
+}
+
 -(void)updateContentAnchorForLabel:(nonnull CPTPlotSpaceAnnotation *)label
 {
     if ( label && self.adjustLabelAnchors ) {
@@ -1767,17 +2725,10 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
  **/
 -(void)repositionAllLabelAnnotations
 {
-    CPTAnnotationArray *annotations = self.labelAnnotations;
-    NSUInteger labelCount           = annotations.count;
-    Class annotationClass           = [CPTAnnotation class];
-
-    for ( NSUInteger i = 0; i < labelCount; i++ ) {
-        CPTPlotSpaceAnnotation *annotation = annotations[i];
-        if ( [annotation isKindOfClass:annotationClass] ) {
-            [self positionLabelAnnotation:annotation forIndex:i];
-            [self updateContentAnchorForLabel:annotation];
-        }
-    }
+    [self.labelAnnotations enumerateKeysAndObjectsUsingBlock: ^(NSNumber *key, CPTPlotSpaceAnnotation *annotation, BOOL *__unused stop) {
+        [self positionLabelAnnotation:annotation forIndex:key.unsignedIntegerValue];
+        [self updateContentAnchorForLabel:annotation];
+    }];
 }
 
 #pragma mark -
@@ -1914,34 +2865,31 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
          [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:)] ||
          [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:withEvent:)] ) {
         // Inform delegate if a label was hit
-        CPTMutableAnnotationArray *labelArray = self.labelAnnotations;
-        NSUInteger labelCount                 = labelArray.count;
-        Class annotationClass                 = [CPTAnnotation class];
-
-        for ( NSUInteger idx = 0; idx < labelCount; idx++ ) {
-            CPTPlotSpaceAnnotation *annotation = labelArray[idx];
-            if ( [annotation isKindOfClass:annotationClass] ) {
-                CPTLayer *labelLayer = annotation.contentLayer;
-                if ( labelLayer && !labelLayer.hidden ) {
-                    CGPoint labelPoint = [theGraph convertPoint:interactionPoint toLayer:labelLayer];
-
-                    if ( CGRectContainsPoint(labelLayer.bounds, labelPoint)) {
-                        self.pointingDeviceDownLabelIndex = idx;
-                        BOOL handled = NO;
-
-                        if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchDownAtRecordIndex:)] ) {
-                            handled = YES;
-                            [theDelegate plot:self dataLabelTouchDownAtRecordIndex:idx];
-                        }
+        NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *labels = self.labelAnnotations;
 
-                        if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchDownAtRecordIndex:withEvent:)] ) {
-                            handled = YES;
-                            [theDelegate plot:self dataLabelTouchDownAtRecordIndex:idx withEvent:event];
-                        }
+        for ( NSNumber *key in [labels.allKeys sortedArrayUsingSelector:@selector(compare:)] ) {
+            NSUInteger idx       = key.unsignedIntegerValue;
+            CPTLayer *labelLayer = labels[key].contentLayer;
 
-                        if ( handled ) {
-                            return YES;
-                        }
+            if ( labelLayer && !labelLayer.hidden ) {
+                CGPoint labelPoint = [theGraph convertPoint:interactionPoint toLayer:labelLayer];
+
+                if ( CGRectContainsPoint(labelLayer.bounds, labelPoint)) {
+                    self.pointingDeviceDownLabelIndex = idx;
+                    BOOL handled = NO;
+
+                    if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchDownAtRecordIndex:)] ) {
+                        handled = YES;
+                        [theDelegate plot:self dataLabelTouchDownAtRecordIndex:idx];
+                    }
+
+                    if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchDownAtRecordIndex:withEvent:)] ) {
+                        handled = YES;
+                        [theDelegate plot:self dataLabelTouchDownAtRecordIndex:idx withEvent:event];
+                    }
+
+                    if ( handled ) {
+                        return YES;
                     }
                 }
             }
@@ -1992,46 +2940,43 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
          [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:)] ||
          [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:withEvent:)] ) {
         // Inform delegate if a label was hit
-        CPTMutableAnnotationArray *labelArray = self.labelAnnotations;
-        NSUInteger labelCount                 = labelArray.count;
-        Class annotationClass                 = [CPTAnnotation class];
+        NSMutableDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *labels = self.labelAnnotations;
 
-        for ( NSUInteger idx = 0; idx < labelCount; idx++ ) {
-            CPTPlotSpaceAnnotation *annotation = labelArray[idx];
-            if ( [annotation isKindOfClass:annotationClass] ) {
-                CPTLayer *labelLayer = annotation.contentLayer;
-                if ( labelLayer && !labelLayer.hidden ) {
-                    CGPoint labelPoint = [theGraph convertPoint:interactionPoint toLayer:labelLayer];
+        for ( NSNumber *key in [labels.allKeys sortedArrayUsingSelector:@selector(compare:)] ) {
+            NSUInteger idx       = key.unsignedIntegerValue;
+            CPTLayer *labelLayer = labels[key].contentLayer;
 
-                    if ( CGRectContainsPoint(labelLayer.bounds, labelPoint)) {
-                        BOOL handled = NO;
+            if ( labelLayer && !labelLayer.hidden ) {
+                CGPoint labelPoint = [theGraph convertPoint:interactionPoint toLayer:labelLayer];
 
-                        if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchUpAtRecordIndex:)] ) {
-                            handled = YES;
-                            [theDelegate plot:self dataLabelTouchUpAtRecordIndex:idx];
-                        }
+                if ( CGRectContainsPoint(labelLayer.bounds, labelPoint)) {
+                    BOOL handled = NO;
 
-                        if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchUpAtRecordIndex:withEvent:)] ) {
-                            handled = YES;
-                            [theDelegate plot:self dataLabelTouchUpAtRecordIndex:idx withEvent:event];
-                        }
+                    if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchUpAtRecordIndex:)] ) {
+                        handled = YES;
+                        [theDelegate plot:self dataLabelTouchUpAtRecordIndex:idx];
+                    }
 
-                        if ( idx == selectedDownIndex ) {
-                            if ( [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:)] ) {
-                                handled = YES;
-                                [theDelegate plot:self dataLabelWasSelectedAtRecordIndex:idx];
-                            }
+                    if ( [theDelegate respondsToSelector:@selector(plot:dataLabelTouchUpAtRecordIndex:withEvent:)] ) {
+                        handled = YES;
+                        [theDelegate plot:self dataLabelTouchUpAtRecordIndex:idx withEvent:event];
+                    }
 
-                            if ( [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:withEvent:)] ) {
-                                handled = YES;
-                                [theDelegate plot:self dataLabelWasSelectedAtRecordIndex:idx withEvent:event];
-                            }
+                    if ( idx == selectedDownIndex ) {
+                        if ( [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:)] ) {
+                            handled = YES;
+                            [theDelegate plot:self dataLabelWasSelectedAtRecordIndex:idx];
                         }
 
-                        if ( handled ) {
-                            return YES;
+                        if ( [theDelegate respondsToSelector:@selector(plot:dataLabelWasSelectedAtRecordIndex:withEvent:)] ) {
+                            handled = YES;
+                            [theDelegate plot:self dataLabelWasSelectedAtRecordIndex:idx withEvent:event];
                         }
                     }
+
+                    if ( handled ) {
+                        return YES;
+                    }
                 }
             }
         }
@@ -2147,7 +3092,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
             self.labelFormatter                = newFormatter;
         }
 
-        self.needsRelabel = YES;
+        // pooled layers use the old style
+        [self emptyLabelLayerPool];
+        [self setNeedsRelabel];
     }
 }
 
@@ -2164,12 +3111,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     if ( newRotation != labelRotation ) {
         labelRotation = newRotation;
 
-        Class annotationClass = [CPTAnnotation class];
-        for ( CPTPlotSpaceAnnotation *label in self.labelAnnotations ) {
-            if ( [label isKindOfClass:annotationClass] ) {
-                label.rotation = labelRotation;
-                [self updateContentAnchorForLabel:label];
-            }
+        for ( CPTPlotSpaceAnnotation *label in self.labelAnnotations.allValues ) {
+            label.rotation = labelRotation;
+            [self updateContentAnchorForLabel:label];
         }
     }
 }
@@ -2177,8 +3121,9 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
 -(void)setLabelFormatter:(nullable NSFormatter *)newTickLabelFormatter
 {
     if ( newTickLabelFormatter != labelFormatter ) {
-        labelFormatter    = newTickLabelFormatter;
-        self.needsRelabel = YES;
+        labelFormatter = newTickLabelFormatter;
+        [self emptyLabelLayerPool];
+        [self setNeedsRelabel];
     }
 }
 
@@ -2187,10 +3132,22 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
     if ( newLabelShadow != labelShadow ) {
         labelShadow = newLabelShadow;
 
-        Class annotationClass = [CPTAnnotation class];
-        for ( CPTAnnotation *label in self.labelAnnotations ) {
-            if ( [label isKindOfClass:annotationClass] ) {
-                label.contentLayer.shadow = labelShadow;
+        for ( CPTPlotSpaceAnnotation *label in self.labelAnnotations.allValues ) {
+            label.contentLayer.shadow = labelShadow;
+        }
+    }
+}
+
+-(void)setCacheCapacity:(NSUInteger)newCapacity
+{
+    if ( newCapacity != cacheCapacity ) {
+        cacheCapacity = newCapacity;
+
+        Class numericClass = [CPTNumericData class];
+
+        for ( id data in self.cachedData.allValues ) {
+            if ( [data isKindOfClass:numericClass] ) {
+                ((CPTMutableNumericData *)data).capacity = newCapacity;
             }
         }
     }
@@ -2212,6 +3169,10 @@ CPTPlotBinding const CPTPlotBindingDataLabels = @"dataLabels"; ///< Plot data la
             case CPTPlotCachePrecisionDecimal:
                 [self setCachedDataType:self.decimalDataType];
                 break;
+
+            case CPTPlotCachePrecisionFloat:
+                [self setCachedDataType:self.floatDataType];
+                break;
         }
     }
 }
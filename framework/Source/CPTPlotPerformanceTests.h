@@ -0,0 +1,6 @@
+#import "CPTScatterPlot.h"
+#import "CPTTestCase.h"
+
+@interface CPTPlotPerformanceTests : CPTTestCase<CPTScatterPlotDataSource>
+
+@end
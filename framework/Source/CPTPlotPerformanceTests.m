@@ -0,0 +1,291 @@
+#import "CPTPlotPerformanceTests.h"
+
+#import "CPTLineStyle.h"
+#import "CPTPlotRange.h"
+#import "CPTTextStyle.h"
+#import "CPTXYGraph.h"
+#import "CPTXYPlotSpace.h"
+
+static const NSUInteger numberOfRecords = 1000000;
+static const NSUInteger numberOfQueries = 100;
+
+static const CGFloat plotWidth  = CPTFloat(1500.0);
+static const CGFloat plotHeight = CPTFloat(500.0);
+
+@interface CPTScatterPlot(PerformanceTesting)
+
+-(void)setXValues:(nullable CPTNumberArray *)newValues;
+-(nullable NSDictionary<NSNumber *, CPTPlotSpaceAnnotation *> *)labelAnnotations;
+
+@end
+
+@interface CPTPlotPerformanceTests()
+
+@property (nonatomic, readwrite, strong, nullable) NSMutableData *xData;
+@property (nonatomic, readwrite, strong, nullable) NSMutableData *yData;
+
+@end
+
+#pragma mark -
+
+@implementation CPTPlotPerformanceTests
+
+@synthesize xData;
+@synthesize yData;
+
+#pragma mark -
+#pragma mark Data Ranges
+
+-(void)testPlotRangeForFieldLinearScan
+{
+    CPTScatterPlot *plot = [self newPlotWithRandomXValues];
+
+    CPTNumericData *xData = [plot cachedNumbersForField:CPTScatterPlotFieldX];
+
+    [self measureBlock: ^{
+        for ( NSUInteger q = 0; q < numberOfQueries; q++ ) {
+            const double *doubles    = (const double *)xData.bytes;
+            const double *lastSample = doubles + xData.numberOfSamples;
+
+            double min = (double)INFINITY;
+            double max = -(double)INFINITY;
+
+            while ( doubles < lastSample ) {
+                double value = *doubles++;
+                if ( !isnan(value)) {
+                    if ( value < min ) {
+                        min = value;
+                    }
+                    if ( value > max ) {
+                        max = value;
+                    }
+                }
+            }
+
+            XCTAssertTrue(max >= min);
+        }
+    }];
+}
+
+-(void)testPlotRangeForFieldIndexed
+{
+    CPTScatterPlot *plot = [self newPlotWithRandomXValues];
+
+    // build the index outside the measured block
+    [plot plotRangeForField:CPTScatterPlotFieldX];
+
+    [self measureBlock: ^{
+        for ( NSUInteger q = 0; q < numberOfQueries; q++ ) {
+            XCTAssertNotNil([plot plotRangeForField:CPTScatterPlotFieldX]);
+        }
+    }];
+}
+
+-(void)testPlotRangeForFieldIndexedSubrange
+{
+    CPTScatterPlot *plot = [self newPlotWithRandomXValues];
+
+    [plot plotRangeForField:CPTScatterPlotFieldX];
+
+    [self measureBlock: ^{
+        for ( NSUInteger q = 0; q < numberOfQueries; q++ ) {
+            NSRange indexRange = NSMakeRange(q * 1000 + 17, numberOfRecords / 2);
+            XCTAssertNotNil([plot plotRangeForField:CPTScatterPlotFieldX recordIndexRange:indexRange]);
+        }
+    }];
+}
+
+-(void)testPlotRangeForFieldRollingWindow
+{
+    CPTScatterPlot *plot = [self newPlotWithRandomXValues];
+
+    plot.cacheCapacity = numberOfRecords;
+    [plot plotRangeForField:CPTScatterPlotFieldX];
+
+    [self measureBlock: ^{
+        for ( NSUInteger q = 0; q < numberOfQueries; q++ ) {
+            [plot deleteDataInIndexRange:NSMakeRange(0, 10)];
+            XCTAssertNotNil([plot plotRangeForField:CPTScatterPlotFieldX]);
+        }
+    }];
+}
+
+#pragma mark -
+#pragma mark Scatter Plot Drawing
+
+-(void)testScatterPlotRendering10k
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:10000 decimated:NO panning:NO];
+}
+
+-(void)testScatterPlotRendering10kDecimated
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:10000 decimated:YES panning:NO];
+}
+
+-(void)testScatterPlotRendering100k
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:100000 decimated:NO panning:NO];
+}
+
+-(void)testScatterPlotRendering100kDecimated
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:100000 decimated:YES panning:NO];
+}
+
+-(void)testScatterPlotRendering1M
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:1000000 decimated:NO panning:NO];
+}
+
+-(void)testScatterPlotRendering1MDecimated
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:1000000 decimated:YES panning:NO];
+}
+
+-(void)testScatterPlotRendering10M
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:10000000 decimated:NO panning:NO];
+}
+
+-(void)testScatterPlotPanning1M
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:1000000 decimated:NO panning:YES];
+}
+
+-(void)testScatterPlotPanning1MDecimated
+{
+    [self measureScatterPlotRenderingWithNumberOfPoints:1000000 decimated:YES panning:YES];
+}
+
+#pragma mark -
+#pragma mark Data Labels
+
+-(void)testScatterPlotLabelPanning50k
+{
+    const NSUInteger pointCount = 50000;
+    const double visibleLength  = 100.0;
+
+    CPTScatterPlot *plot      = [self newPlotWithNumberOfPoints:pointCount];
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)plot.plotSpace;
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@(visibleLength)];
+
+    plot.labelTextStyle = [CPTTextStyle textStyle];
+    [plot layoutIfNeeded];
+
+    // only the labels near the visible window exist
+    XCTAssertGreaterThan(plot.labelAnnotations.count, 0);
+    XCTAssertLessThan(plot.labelAnnotations.count, 2 * (NSUInteger)visibleLength);
+
+    [self measureBlock: ^{
+        for ( NSUInteger step = 1; step <= 100; step++ ) {
+            plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@(visibleLength * 0.5 * (double)step) length:@(visibleLength)];
+            [plot layoutIfNeeded];
+        }
+    }];
+
+    XCTAssertLessThan(plot.labelAnnotations.count, 2 * (NSUInteger)visibleLength);
+    XCTAssertNil(plot.labelAnnotations[@0]);
+    XCTAssertNotNil(plot.labelAnnotations[@5020]);
+}
+
+#pragma mark -
+#pragma mark Private Methods
+
+-(void)measureScatterPlotRenderingWithNumberOfPoints:(NSUInteger)pointCount decimated:(BOOL)decimate panning:(BOOL)pan
+{
+    CPTScatterPlot *plot = [self newPlotWithNumberOfPoints:pointCount];
+
+    plot.decimatesDataLine = decimate;
+
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)plot.plotSpace;
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context       = CGBitmapContextCreate(NULL, (size_t)plotWidth, (size_t)plotHeight, 8, 0, colorSpace, (CGBitmapInfo)kCGImageAlphaPremultipliedLast);
+
+    [self measureBlock: ^{
+        if ( pan ) {
+            // zoom in to a tenth of the data and scroll across it
+            double visibleLength = (double)pointCount / 10.0;
+
+            for ( NSUInteger step = 0; step < 10; step++ ) {
+                plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@(visibleLength * (double)step) length:@(visibleLength)];
+                [plot renderAsVectorInContext:context];
+            }
+        }
+        else {
+            [plot renderAsVectorInContext:context];
+        }
+    }];
+
+    CGContextRelease(context);
+    CGColorSpaceRelease(colorSpace);
+}
+
+-(nonnull CPTScatterPlot *)newPlotWithNumberOfPoints:(NSUInteger)pointCount
+{
+    self.xData = [[NSMutableData alloc] initWithLength:pointCount * sizeof(double)];
+    self.yData = [[NSMutableData alloc] initWithLength:pointCount * sizeof(double)];
+
+    double *xValues = (double *)self.xData.mutableBytes;
+    double *yValues = (double *)self.yData.mutableBytes;
+
+    srand48(42);
+    for ( NSUInteger i = 0; i < pointCount; i++ ) {
+        xValues[i] = (double)i;
+        yValues[i] = sin((double)i / 1000.0) + drand48() * 0.2;
+    }
+
+    CPTXYGraph *graph = [[CPTXYGraph alloc] initWithFrame:CGRectMake(0.0, 0.0, plotWidth, plotHeight)];
+
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)graph.defaultPlotSpace;
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@(pointCount)];
+    plotSpace.yRange = [CPTPlotRange plotRangeWithLocation:@(-1.5) length:@3.0];
+
+    CPTScatterPlot *plot = [[CPTScatterPlot alloc] init];
+
+    plot.cachePrecision = CPTPlotCachePrecisionDouble;
+    plot.dataSource     = self;
+    [graph addPlot:plot];
+
+    [graph layoutIfNeeded];
+    [plot reloadDataIfNeeded];
+
+    return plot;
+}
+
+-(nonnull CPTScatterPlot *)newPlotWithRandomXValues
+{
+    CPTMutableNumberArray *xValues = [NSMutableArray arrayWithCapacity:numberOfRecords];
+
+    srand48(42);
+    for ( NSUInteger i = 0; i < numberOfRecords; i++ ) {
+        [xValues addObject:@(drand48() * 1000.0 - 500.0)];
+    }
+
+    CPTScatterPlot *plot = [[CPTScatterPlot alloc] init];
+
+    plot.cachePrecision = CPTPlotCachePrecisionDouble;
+    [plot setXValues:xValues];
+
+    return plot;
+}
+
+#pragma mark -
+#pragma mark Plot Data Source Methods
+
+-(NSUInteger)numberOfRecordsForPlot:(nonnull CPTPlot *__unused)plot
+{
+    return self.xData.length / sizeof(double);
+}
+
+-(nullable double *)doublesForPlot:(nonnull CPTPlot *__unused)plot field:(NSUInteger)fieldEnum recordIndexRange:(NSRange)indexRange
+{
+    NSMutableData *fieldData = (fieldEnum == CPTScatterPlotFieldX ? self.xData : self.yData);
+
+    return (double *)fieldData.mutableBytes + indexRange.location;
+}
+
+@end
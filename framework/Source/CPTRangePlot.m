@@ -309,9 +309,10 @@ typedef struct CGPointError CGPointError;
         CPTPlotRange *yRange = xyPlotSpace.yRange;
 
         // Determine where each point lies in relation to range
-        if ( self.doublePrecisionCache ) {
-            const double *xBytes = (const double *)[self cachedNumbersForField:CPTRangePlotFieldX].data.bytes;
-            const double *yBytes = (const double *)[self cachedNumbersForField:CPTRangePlotFieldY].data.bytes;
+        if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+            NSRange allRecords   = NSMakeRange(0, dataCount);
+            const double *xBytes = (const double *)[self cachedDoublesForField:CPTRangePlotFieldX recordIndexRange:allRecords].bytes;
+            const double *yBytes = (const double *)[self cachedDoublesForField:CPTRangePlotFieldY recordIndexRange:allRecords].bytes;
 
             dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
                 const double x = xBytes[i];
@@ -323,8 +324,8 @@ typedef struct CGPointError CGPointError;
             });
         }
         else {
-            const NSDecimal *xBytes = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldX].data.bytes;
-            const NSDecimal *yBytes = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldY].data.bytes;
+            const NSDecimal *xBytes = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldX].bytes;
+            const NSDecimal *yBytes = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldY].bytes;
 
             dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
                 const NSDecimal x = xBytes[i];
@@ -352,65 +353,61 @@ typedef struct CGPointError CGPointError;
 
 -(void)calculateViewPoints:(nonnull CGPointError *)viewPoints withDrawPointFlags:(nonnull BOOL *)drawPointFlags numberOfPoints:(NSUInteger)dataCount
 {
-    CPTPlotSpace *thePlotSpace = self.plotSpace;
+    CPTXYPlotSpace *thePlotSpace = (CPTXYPlotSpace *)self.plotSpace;
 
     // Calculate points
-    if ( self.doublePrecisionCache ) {
-        const double *xBytes     = (const double *)[self cachedNumbersForField:CPTRangePlotFieldX].data.bytes;
-        const double *yBytes     = (const double *)[self cachedNumbersForField:CPTRangePlotFieldY].data.bytes;
-        const double *highBytes  = (const double *)[self cachedNumbersForField:CPTRangePlotFieldHigh].data.bytes;
-        const double *lowBytes   = (const double *)[self cachedNumbersForField:CPTRangePlotFieldLow].data.bytes;
-        const double *leftBytes  = (const double *)[self cachedNumbersForField:CPTRangePlotFieldLeft].data.bytes;
-        const double *rightBytes = (const double *)[self cachedNumbersForField:CPTRangePlotFieldRight].data.bytes;
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+        NSRange allRecords       = NSMakeRange(0, dataCount);
+        const double *xBytes     = (const double *)[self cachedDoublesForField:CPTRangePlotFieldX recordIndexRange:allRecords].bytes;
+        const double *yBytes     = (const double *)[self cachedDoublesForField:CPTRangePlotFieldY recordIndexRange:allRecords].bytes;
+        const double *highBytes  = (const double *)[self cachedDoublesForField:CPTRangePlotFieldHigh recordIndexRange:allRecords].bytes;
+        const double *lowBytes   = (const double *)[self cachedDoublesForField:CPTRangePlotFieldLow recordIndexRange:allRecords].bytes;
+        const double *leftBytes  = (const double *)[self cachedDoublesForField:CPTRangePlotFieldLeft recordIndexRange:allRecords].bytes;
+        const double *rightBytes = (const double *)[self cachedDoublesForField:CPTRangePlotFieldRight recordIndexRange:allRecords].bytes;
+
+        // Convert each coordinate of every point at once, storing the results directly in the view points
+        const NSUInteger stride = sizeof(CGPointError) / sizeof(CGFloat);
+        double *offsetValues    = malloc(dataCount * sizeof(double));
+
+        [thePlotSpace plotAreaViewCoordinates:&viewPoints[0].x stride:stride forDoublePrecisionPlotCoordinates:xBytes numberOfValues:dataCount coordinate:CPTCoordinateX];
+        [thePlotSpace plotAreaViewCoordinates:&viewPoints[0].y stride:stride forDoublePrecisionPlotCoordinates:yBytes numberOfValues:dataCount coordinate:CPTCoordinateY];
 
-        dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
-            const double x     = xBytes[i];
-            const double y     = yBytes[i];
-            const double high  = highBytes[i];
-            const double low   = lowBytes[i];
-            const double left  = leftBytes[i];
-            const double right = rightBytes[i];
-            if ( !drawPointFlags[i] || isnan(x) || isnan(y)) {
-                viewPoints[i].x = CPTNAN; // depending coordinates
-                viewPoints[i].y = CPTNAN;
-            }
-            else {
-                double plotPoint[2];
-                plotPoint[CPTCoordinateX] = x;
-                plotPoint[CPTCoordinateY] = y;
-                CGPoint pos               = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-                viewPoints[i].x           = pos.x;
-                viewPoints[i].y           = pos.y;
+        for ( NSUInteger i = 0; i < dataCount; i++ ) {
+            offsetValues[i] = yBytes[i] + highBytes[i];
+        }
+        [thePlotSpace plotAreaViewCoordinates:&viewPoints[0].high stride:stride forDoublePrecisionPlotCoordinates:offsetValues numberOfValues:dataCount coordinate:CPTCoordinateY];
 
-                plotPoint[CPTCoordinateX] = x;
-                plotPoint[CPTCoordinateY] = y + high;
-                pos                       = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-                viewPoints[i].high        = pos.y;
+        for ( NSUInteger i = 0; i < dataCount; i++ ) {
+            offsetValues[i] = yBytes[i] - lowBytes[i];
+        }
+        [thePlotSpace plotAreaViewCoordinates:&viewPoints[0].low stride:stride forDoublePrecisionPlotCoordinates:offsetValues numberOfValues:dataCount coordinate:CPTCoordinateY];
 
-                plotPoint[CPTCoordinateX] = x;
-                plotPoint[CPTCoordinateY] = y - low;
-                pos                       = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-                viewPoints[i].low         = pos.y;
+        for ( NSUInteger i = 0; i < dataCount; i++ ) {
+            offsetValues[i] = xBytes[i] - leftBytes[i];
+        }
+        [thePlotSpace plotAreaViewCoordinates:&viewPoints[0].left stride:stride forDoublePrecisionPlotCoordinates:offsetValues numberOfValues:dataCount coordinate:CPTCoordinateX];
 
-                plotPoint[CPTCoordinateX] = x - left;
-                plotPoint[CPTCoordinateY] = y;
-                pos                       = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-                viewPoints[i].left        = pos.x;
+        for ( NSUInteger i = 0; i < dataCount; i++ ) {
+            offsetValues[i] = xBytes[i] + rightBytes[i];
+        }
+        [thePlotSpace plotAreaViewCoordinates:&viewPoints[0].right stride:stride forDoublePrecisionPlotCoordinates:offsetValues numberOfValues:dataCount coordinate:CPTCoordinateX];
 
-                plotPoint[CPTCoordinateX] = x + right;
-                plotPoint[CPTCoordinateY] = y;
-                pos                       = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-                viewPoints[i].right       = pos.x;
+        free(offsetValues);
+
+        for ( NSUInteger i = 0; i < dataCount; i++ ) {
+            if ( !drawPointFlags[i] || isnan(xBytes[i]) || isnan(yBytes[i])) {
+                viewPoints[i].x = CPTNAN; // depending coordinates
+                viewPoints[i].y = CPTNAN;
             }
-        });
+        }
     }
     else {
-        const NSDecimal *xBytes     = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldX].data.bytes;
-        const NSDecimal *yBytes     = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldY].data.bytes;
-        const NSDecimal *highBytes  = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldHigh].data.bytes;
-        const NSDecimal *lowBytes   = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldLow].data.bytes;
-        const NSDecimal *leftBytes  = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldLeft].data.bytes;
-        const NSDecimal *rightBytes = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldRight].data.bytes;
+        const NSDecimal *xBytes     = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldX].bytes;
+        const NSDecimal *yBytes     = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldY].bytes;
+        const NSDecimal *highBytes  = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldHigh].bytes;
+        const NSDecimal *lowBytes   = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldLow].bytes;
+        const NSDecimal *leftBytes  = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldLeft].bytes;
+        const NSDecimal *rightBytes = (const NSDecimal *)[self cachedNumbersForField:CPTRangePlotFieldRight].bytes;
 
         dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
             const NSDecimal x     = xBytes[i];
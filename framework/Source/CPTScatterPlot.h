@@ -266,6 +266,8 @@ typedef NS_ENUM (NSInteger, CPTScatterPlotHistogramOption) {
 @property (nonatomic, readwrite, copy, nullable) CPTPlotSymbol *plotSymbol;
 @property (nonatomic, readwrite, copy, nullable) CPTFill *areaFill;
 @property (nonatomic, readwrite, copy, nullable) CPTFill *areaFill2;
+@property (nonatomic, readwrite, assign) BOOL decimatesDataLine;
+@property (nonatomic, readwrite, assign) BOOL assumesSortedXValues;
 /// @}
 
 /// @name Data Line
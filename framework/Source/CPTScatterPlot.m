@@ -13,6 +13,9 @@
 #import "CPTUtilities.h"
 #import "CPTXYPlotSpace.h"
 #import "NSCoderExtensions.h"
+#import "_CPTDataRangeIndex.h"
+#import "_CPTImplicitField.h"
+#import "_CPTPointIndex.h"
 #import <tgmath.h>
 
 /** @defgroup plotAnimationScatterPlot Scatter Plot
@@ -40,13 +43,20 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 @property (nonatomic, readwrite, assign) NSUInteger pointingDeviceDownIndex;
 @property (nonatomic, readwrite, assign) BOOL pointingDeviceDownOnLine;
 @property (nonatomic, readwrite, strong) CPTMutableLimitBandArray *mutableAreaFillBands;
+@property (nonatomic, readwrite, strong, nullable) NSMutableData *scratchBuffer;
+@property (nonatomic, readwrite, strong, nullable) NSMutableData *levelOfDetailIndices;
+@property (nonatomic, readwrite, strong, nullable) _CPTPointIndex *visiblePointIndex;
+@property (nonatomic, readwrite, assign) CGRect visiblePointIndexBounds;
 
--(void)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount;
--(void)calculateViewPoints:(nonnull CGPoint *)viewPoints withDrawPointFlags:(nonnull BOOL *)drawPointFlags numberOfPoints:(NSUInteger)dataCount;
--(void)alignViewPointsToUserSpace:(nonnull CGPoint *)viewPoints withContext:(nonnull CGContextRef)context drawPointFlags:(nonnull BOOL *)drawPointFlags numberOfPoints:(NSUInteger)dataCount;
+-(NSRange)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount;
+-(NSRange)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags viewPoints:(nullable CGPoint *)viewPoints regions:(nullable uint8_t *)regions forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount;
+-(void)calculateViewPoints:(nonnull CGPoint *)viewPoints withDrawPointFlags:(nonnull BOOL *)drawPointFlags indexRange:(NSRange)indexRange;
+-(void)alignViewPointsToUserSpace:(nonnull CGPoint *)viewPoints withContext:(nonnull CGContextRef)context drawPointFlags:(nonnull BOOL *)drawPointFlags indexRange:(NSRange)indexRange;
 
--(NSInteger)extremeDrawnPointIndexForFlags:(nonnull BOOL *)pointDrawFlags numberOfPoints:(NSUInteger)dataCount extremeNumIsLowerBound:(BOOL)isLowerBound;
+-(NSInteger)extremeDrawnPointIndexForFlags:(nonnull BOOL *)pointDrawFlags indexRange:(NSRange)indexRange extremeNumIsLowerBound:(BOOL)isLowerBound;
 
+-(BOOL)getLevelOfDetailViewPoints:(CGPoint *__nullable *__nonnull)viewPoints count:(nonnull NSUInteger *)pointCount firstRecordIndex:(nonnull NSUInteger *)firstIndex inContext:(nonnull CGContextRef)context;
+-(NSUInteger)decimateViewPoints:(nonnull const CGPoint *)viewPoints indexRange:(NSRange)indexRange toViewPoints:(nonnull CGPoint *)decimatedPoints;
 -(nonnull CGPathRef)newDataLinePathForViewPoints:(nonnull CGPoint *)viewPoints indexRange:(NSRange)indexRange baselineYValue:(CGFloat)baselineYValue;
 -(nonnull CGPathRef)newCurvedDataLinePathForViewPoints:(nonnull CGPoint *)viewPoints indexRange:(NSRange)indexRange baselineYValue:(CGFloat)baselineYValue;
 -(void)computeBezierControlPoints:(nonnull CGPoint *)cp1 points2:(nonnull CGPoint *)cp2 forViewPoints:(nonnull CGPoint *)viewPoints indexRange:(NSRange)indexRange;
@@ -54,8 +64,35 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 -(void)computeHermiteControlPoints:(nonnull CGPoint *)points points2:(nonnull CGPoint *)points2 forViewPoints:(nonnull CGPoint *)viewPoints indexRange:(NSRange)indexRange;
 -(BOOL)monotonicViewPoints:(nonnull CGPoint *)viewPoints indexRange:(NSRange)indexRange;
 
+-(nonnull uint8_t *)scratchBytesWithLength:(NSUInteger)length;
+-(void)getScratchViewPoints:(CGPoint *__nullable *__nonnull)viewPoints drawPointFlags:(BOOL *__nullable *__nonnull)drawPointFlags regions:(uint8_t *__nullable *__nonnull)regions count:(NSUInteger)count;
+-(nonnull _CPTPointIndex *)newVisiblePointIndex;
+
+@end
+
+@interface CPTPlot()
+
+// inherited private methods
+-(nullable _CPTDataRangeIndex *)rangeIndexForField:(NSUInteger)fieldEnum;
+-(nullable _CPTImplicitField *)implicitFieldForField:(NSUInteger)fieldEnum;
+-(BOOL)isSortedField:(NSUInteger)fieldEnum;
+-(NSRange)indexRangeForSortedField:(NSUInteger)fieldEnum plotRange:(nonnull CPTPlotRange *)plotRange;
+-(NSUInteger)firstIndexOfSortedField:(NSUInteger)fieldEnum notLessThanValue:(double)value inIndexRange:(NSRange)indexRange;
+
 @end
 
+static const NSUInteger kCPTScatterPlotChunkSize = 4096; // records classified by each concurrent batch
+
+static const NSUInteger kCPTScatterPlotLevelOfDetailMinimumDensity = 64; // records per pixel column below which every record is transformed
+
+// Region codes pack the x and y range comparison results of a record into one byte
+static const uint8_t kCPTScatterPlotRegionNaN     = 0x10;
+static const uint8_t kCPTScatterPlotRegionVisible = (uint8_t)(CPTPlotRangeComparisonResultNumberInRange | (CPTPlotRangeComparisonResultNumberInRange << 2));
+
+static uint8_t CPTScatterPlotRegion(CPTPlotRangeComparisonResult xFlag, CPTPlotRangeComparisonResult yFlag, BOOL isNaN);
+static void CPTScatterPlotFlagPointsToDraw(BOOL *__nonnull drawFlags, CGPoint *__nullable viewPoints, const uint8_t *__nonnull regions, NSUInteger count, BOOL visibleOnly, BOOL curved);
+static NSUInteger CPTScatterPlotClearHiddenViewPoints(CGPoint *__nullable viewPoints, const BOOL *__nonnull drawFlags, NSUInteger start, NSUInteger end);
+
 /// @endcond
 
 #pragma mark -
@@ -122,6 +159,33 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
  **/
 @synthesize areaFill2;
 
+/** @property BOOL decimatesDataLine
+ *  @brief If @YES, the data line and area fills are drawn from a reduced set of points when the
+ *  @ref interpolation is #CPTScatterPlotInterpolationLinear.
+ *
+ *  For each run of consecutive points that fall in the same device pixel column, only the first, last,
+ *  lowest, and highest points are kept. The rendered line looks the same while the size of the drawing
+ *  path grows with the width of the plot instead of the number of data points.
+ *  Plot symbols are still drawn for every point. Defaults to @NO.
+ *
+ *  If the plot has no plot symbols and the x values are sorted in ascending order, the points are taken
+ *  from a persistent level of detail summary of the y values instead, so only the first, last, lowest,
+ *  and highest visible record of each pixel column, and of each run between gaps in the data, are
+ *  transformed and drawn.
+ **/
+@synthesize decimatesDataLine;
+
+/** @property BOOL assumesSortedXValues
+ *  @brief If @YES, the plot assumes the x values are sorted in ascending order without checking them.
+ *
+ *  When the x values are sorted, the records inside the visible x range are found with a binary
+ *  search and only those records are classified and transformed when drawing and hit testing.
+ *  If @NO, the plot detects sorted x values from the min/max summary of the cached data.
+ *  Setting this property to @YES when the x values are not sorted may leave parts of the plot undrawn.
+ *  Defaults to @NO.
+ **/
+@synthesize assumesSortedXValues;
+
 /** @property nullable NSNumber *areaBaseValue
  *  @brief The Y coordinate of the straight boundary of the area fill.
  *  If not a number, the area is not filled.
@@ -191,6 +255,33 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 
 @synthesize mutableAreaFillBands;
 
+/** @internal
+ *  @property nullable NSMutableData *scratchBuffer
+ *  @brief Working storage for the view points, draw flags, and region codes used when drawing.
+ *  Kept between frames and only reallocated when the number of records grows or falls well below its capacity.
+ **/
+@synthesize scratchBuffer;
+
+/** @internal
+ *  @property nullable NSMutableData *levelOfDetailIndices
+ *  @brief Working storage for the record indices selected from the level of detail summary of the y values.
+ *  Kept between frames and only grown when more records are selected.
+ **/
+@synthesize levelOfDetailIndices;
+
+/** @internal
+ *  @property nullable _CPTPointIndex *visiblePointIndex
+ *  @brief The view points of the visible records used to find the point closest to an interaction.
+ *  Discarded whenever the plot needs to be redrawn.
+ **/
+@synthesize visiblePointIndex;
+
+/** @internal
+ *  @property CGRect visiblePointIndexBounds
+ *  @brief The bounds of the plot when @ref visiblePointIndex was built.
+ **/
+@synthesize visiblePointIndexBounds;
+
 #pragma mark -
 #pragma mark Init/Dealloc
 
@@ -223,6 +314,8 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
  *  - @ref areaFill2 = @nil
  *  - @ref areaBaseValue = @NAN
  *  - @ref areaBaseValue2 = @NAN
+ *  - @ref decimatesDataLine = @NO
+ *  - @ref assumesSortedXValues = @NO
  *  - @ref plotSymbolMarginForHitDetection = @num{0.0}
  *  - @ref plotLineMarginForHitDetection = @num{4.0}
  *  - @ref allowSimultaneousSymbolAndPlotSelection = NO
@@ -244,6 +337,8 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         areaFill2                       = nil;
         areaBaseValue                   = @(NAN);
         areaBaseValue2                  = @(NAN);
+        decimatesDataLine               = NO;
+        assumesSortedXValues            = NO;
         plotSymbolMarginForHitDetection = CPTFloat(0.0);
         plotLineMarginForHitDetection   = CPTFloat(4.0);
         interpolation                   = CPTScatterPlotInterpolationLinear;
@@ -253,6 +348,10 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         pointingDeviceDownIndex         = NSNotFound;
         pointingDeviceDownOnLine        = NO;
         mutableAreaFillBands            = nil;
+        scratchBuffer                   = nil;
+        levelOfDetailIndices            = nil;
+        visiblePointIndex               = nil;
+        visiblePointIndexBounds         = CGRectNull;
         self.labelField                 = CPTScatterPlotFieldY;
     }
     return self;
@@ -273,6 +372,8 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         areaFill2                               = theLayer->areaFill2;
         areaBaseValue                           = theLayer->areaBaseValue;
         areaBaseValue2                          = theLayer->areaBaseValue2;
+        decimatesDataLine                       = theLayer->decimatesDataLine;
+        assumesSortedXValues                    = theLayer->assumesSortedXValues;
         plotSymbolMarginForHitDetection         = theLayer->plotSymbolMarginForHitDetection;
         plotLineMarginForHitDetection           = theLayer->plotLineMarginForHitDetection;
         allowSimultaneousSymbolAndPlotSelection = theLayer->allowSimultaneousSymbolAndPlotSelection;
@@ -281,6 +382,10 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         curvedInterpolationOption               = theLayer->curvedInterpolationOption;
         curvedInterpolationCustomAlpha          = theLayer->curvedInterpolationCustomAlpha;
         mutableAreaFillBands                    = theLayer->mutableAreaFillBands;
+        scratchBuffer                           = nil;
+        levelOfDetailIndices                    = nil;
+        visiblePointIndex                       = nil;
+        visiblePointIndexBounds                 = CGRectNull;
         pointingDeviceDownIndex                 = NSNotFound;
         pointingDeviceDownOnLine                = NO;
     }
@@ -309,6 +414,8 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     [coder encodeObject:self.mutableAreaFillBands forKey:@"CPTScatterPlot.mutableAreaFillBands"];
     [coder encodeObject:self.areaBaseValue forKey:@"CPTScatterPlot.areaBaseValue"];
     [coder encodeObject:self.areaBaseValue2 forKey:@"CPTScatterPlot.areaBaseValue2"];
+    [coder encodeBool:self.decimatesDataLine forKey:@"CPTScatterPlot.decimatesDataLine"];
+    [coder encodeBool:self.assumesSortedXValues forKey:@"CPTScatterPlot.assumesSortedXValues"];
     [coder encodeCGFloat:self.plotSymbolMarginForHitDetection forKey:@"CPTScatterPlot.plotSymbolMarginForHitDetection"];
     [coder encodeCGFloat:self.plotLineMarginForHitDetection forKey:@"CPTScatterPlot.plotLineMarginForHitDetection"];
     [coder encodeBool:self.allowSimultaneousSymbolAndPlotSelection forKey:@"CPTScatterPlot.allowSimultaneousSymbolAndPlotSelection"];
@@ -316,6 +423,8 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     // No need to archive these properties:
     // pointingDeviceDownIndex
     // pointingDeviceDownOnLine
+    // visiblePointIndex
+    // visiblePointIndexBounds
 }
 
 -(nullable instancetype)initWithCoder:(nonnull NSCoder *)coder
@@ -339,9 +448,15 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
                                             forKey:@"CPTScatterPlot.areaBaseValue"];
         areaBaseValue2 = [coder decodeObjectOfClass:[NSNumber class]
                                              forKey:@"CPTScatterPlot.areaBaseValue2"];
+        decimatesDataLine                       = [coder decodeBoolForKey:@"CPTScatterPlot.decimatesDataLine"];
+        assumesSortedXValues                    = [coder decodeBoolForKey:@"CPTScatterPlot.assumesSortedXValues"];
         plotSymbolMarginForHitDetection         = [coder decodeCGFloatForKey:@"CPTScatterPlot.plotSymbolMarginForHitDetection"];
         plotLineMarginForHitDetection           = [coder decodeCGFloatForKey:@"CPTScatterPlot.plotLineMarginForHitDetection"];
         allowSimultaneousSymbolAndPlotSelection = [coder decodeBoolForKey:@"CPTScatterPlot.allowSimultaneousSymbolAndPlotSelection"];
+        scratchBuffer                           = nil;
+        levelOfDetailIndices                    = nil;
+        visiblePointIndex                       = nil;
+        visiblePointIndexBounds                 = CGRectNull;
         pointingDeviceDownIndex                 = NSNotFound;
         pointingDeviceDownOnLine                = NO;
     }
@@ -468,10 +583,51 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 
 /// @cond
 
--(void)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount
+/** @internal
+ *  @brief Determines which records need to be drawn.
+ *
+ *  When the x values are sorted, only the records found by a binary search of the visible x range are
+ *  classified. Flags outside of the returned range are not changed, so @par{pointDrawFlags} should be
+ *  cleared before calling this method.
+ *
+ *  @param pointDrawFlags Returns @YES for each record that should be drawn.
+ *  @param xyPlotSpace The plot space.
+ *  @param visibleOnly If @YES, only records inside the plot space ranges are flagged; otherwise,
+ *  the neighbors needed to draw lines crossing the plot area boundary are also flagged.
+ *  @param dataCount The number of records.
+ *  @return The range of records whose flags were calculated.
+ **/
+-(NSRange)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount
+{
+    return [self calculatePointsToDraw:pointDrawFlags
+                            viewPoints:NULL
+                               regions:NULL
+                          forPlotSpace:xyPlotSpace
+              includeVisiblePointsOnly:visibleOnly
+                        numberOfPoints:dataCount];
+}
+
+/** @internal
+ *  @brief Determines which records need to be drawn and, optionally, calculates their view points in the same pass.
+ *
+ *  With a @double cache, each block of records is converted to view coordinates and compared to the plot
+ *  ranges while it is still in the processor cache. The range comparisons are packed into one byte per record,
+ *  and a single sequential pass then sets the draw flags and marks the view points that are not drawn as @NAN.
+ *  Flags and view points outside of the returned range are not changed.
+ *
+ *  @param pointDrawFlags Returns @YES for each record that should be drawn.
+ *  @param viewPoints If not @NULL, returns the view point of each record in the returned range. Records that are not drawn are @NAN.
+ *  @param regions Working storage for one byte per record, or @NULL to allocate it temporarily.
+ *  @param xyPlotSpace The plot space.
+ *  @param visibleOnly If @YES, only records inside the plot space ranges are flagged; otherwise,
+ *  the neighbors needed to draw lines crossing the plot area boundary are also flagged.
+ *  @param dataCount The number of records.
+ *  @return The range of records whose flags were calculated.
+ **/
+-(NSRange)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags viewPoints:(nullable CGPoint *)viewPoints regions:(nullable uint8_t *)regions forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount
 {
     if ( dataCount == 0 ) {
-        return;
+        return NSMakeRange(0, 0);
     }
 
     CPTLineStyle *lineStyle = self.dataLineStyle;
@@ -481,166 +637,179 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         for ( NSUInteger i = 0; i < dataCount; i++ ) {
             pointDrawFlags[i] = YES;
         }
+
+        NSRange allRecords = NSMakeRange(0, dataCount);
+
+        if ( viewPoints ) {
+            [self calculateViewPoints:viewPoints withDrawPointFlags:pointDrawFlags indexRange:allRecords];
+        }
+
+        return allRecords;
     }
-    else {
-        CPTPlotRangeComparisonResult *xRangeFlags = calloc(dataCount, sizeof(CPTPlotRangeComparisonResult));
-        CPTPlotRangeComparisonResult *yRangeFlags = calloc(dataCount, sizeof(CPTPlotRangeComparisonResult));
-        BOOL *nanFlags                            = calloc(dataCount, sizeof(BOOL));
-
-        CPTPlotRange *xRange = xyPlotSpace.xRange;
-        CPTPlotRange *yRange = xyPlotSpace.yRange;
-
-        // Determine where each point lies in relation to range
-        if ( self.doublePrecisionCache ) {
-            const double *xBytes = (const double *)[self cachedNumbersForField:CPTScatterPlotFieldX].data.bytes;
-            const double *yBytes = (const double *)[self cachedNumbersForField:CPTScatterPlotFieldY].data.bytes;
-
-            dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
-                const double x = xBytes[i];
-                const double y = yBytes[i];
-
-                CPTPlotRangeComparisonResult xFlag = [xRange compareToDouble:x];
-                xRangeFlags[i]                     = xFlag;
-                if ( xFlag != CPTPlotRangeComparisonResultNumberInRange ) {
-                    yRangeFlags[i] = CPTPlotRangeComparisonResultNumberInRange; // if x is out of range, then y doesn't matter
-                }
-                else {
-                    yRangeFlags[i] = [yRange compareToDouble:y];
-                }
-                nanFlags[i] = isnan(x) || isnan(y);
-            });
+
+    CPTPlotRange *xRange = xyPlotSpace.xRange;
+    CPTPlotRange *yRange = xyPlotSpace.yRange;
+
+    // Records outside of this range lie on the same side of the x range as their neighbors and are never drawn
+    NSRange indexRange = NSMakeRange(0, dataCount);
+
+    if ( [self isSortedField:CPTScatterPlotFieldX] ) {
+        NSRange xIndexRange = [self indexRangeForSortedField:CPTScatterPlotFieldX plotRange:xRange];
+
+        if ( xIndexRange.location != NSNotFound ) {
+            // keep one record outside of the range on each side so line segments crossing the range boundaries are drawn
+            NSUInteger lowIndex  = (xIndexRange.location > 0) ? xIndexRange.location - 1 : 0;
+            NSUInteger highIndex = MIN(NSMaxRange(xIndexRange) + 1, dataCount);
+
+            indexRange = NSMakeRange(lowIndex, highIndex - lowIndex);
         }
-        else {
-            // Determine where each point lies in relation to range
-            const NSDecimal *xBytes = (const NSDecimal *)[self cachedNumbersForField:CPTScatterPlotFieldX].data.bytes;
-            const NSDecimal *yBytes = (const NSDecimal *)[self cachedNumbersForField:CPTScatterPlotFieldY].data.bytes;
-
-            dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
-                const NSDecimal x = xBytes[i];
-                const NSDecimal y = yBytes[i];
-
-                CPTPlotRangeComparisonResult xFlag = [xRange compareToDecimal:x];
-                xRangeFlags[i]                     = xFlag;
-                if ( xFlag != CPTPlotRangeComparisonResultNumberInRange ) {
-                    yRangeFlags[i] = CPTPlotRangeComparisonResultNumberInRange; // if x is out of range, then y doesn't matter
-                }
-                else {
-                    yRangeFlags[i] = [yRange compareToDecimal:y];
+    }
+
+    NSUInteger firstIndex = indexRange.location;
+    NSUInteger count      = indexRange.length;
+
+    if ( count == 0 ) {
+        return indexRange;
+    }
+
+    uint8_t *regionBuffer = NULL;
+
+    if ( !regions ) {
+        regionBuffer = malloc(dataCount * sizeof(uint8_t));
+        regions      = regionBuffer;
+    }
+
+    BOOL *drawFlags        = pointDrawFlags + firstIndex;
+    uint8_t *windowRegions = regions + firstIndex;
+    CGPoint *windowPoints  = viewPoints ? viewPoints + firstIndex : NULL;
+    BOOL projectedInKernel = NO;
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+
+    // Determine where each point lies in relation to range
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+        const double xMin = xRange.minLimitDouble;
+        const double xMax = xRange.maxLimitDouble;
+        const double yMin = yRange.minLimitDouble;
+        const double yMax = yRange.maxLimitDouble;
+
+        size_t chunkCount = (count + kCPTScatterPlotChunkSize - 1) / kCPTScatterPlotChunkSize;
+
+        dispatch_apply(chunkCount, queue, ^(size_t chunk) {
+            size_t start = chunk * kCPTScatterPlotChunkSize;
+            size_t end   = MIN(start + kCPTScatterPlotChunkSize, count);
+
+            @autoreleasepool {
+                // float caches are widened one chunk at a time
+                NSRange chunkRange   = NSMakeRange(firstIndex + start, end - start);
+                const double *xBytes = (const double *)[self cachedDoublesForField:CPTScatterPlotFieldX recordIndexRange:chunkRange].bytes;
+                const double *yBytes = (const double *)[self cachedDoublesForField:CPTScatterPlotFieldY recordIndexRange:chunkRange].bytes;
+
+                if ( windowPoints ) {
+                    [xyPlotSpace plotAreaViewPoints:windowPoints + start
+                          forDoublePrecisionXValues:xBytes
+                                            yValues:yBytes
+                                     numberOfPoints:end - start];
                 }
 
-                nanFlags[i] = NSDecimalIsNotANumber(&x) || NSDecimalIsNotANumber(&y);
-            });
-        }
+                for ( size_t i = start; i < end; i++ ) {
+                    const double x = xBytes[i - start];
+                    const double y = yBytes[i - start];
 
-        // Ensure that whenever the path crosses over a region boundary, both points
-        // are included. This ensures no lines are left out that shouldn't be.
-        CPTScatterPlotInterpolation theInterpolation = self.interpolation;
+                    CPTPlotRangeComparisonResult xFlag = CPTPlotRangeComparisonResultNumberInRange;
+                    CPTPlotRangeComparisonResult yFlag = CPTPlotRangeComparisonResultNumberInRange;
 
-        memset(pointDrawFlags, NO, dataCount * sizeof(BOOL));
-        if ( dataCount > 0 ) {
-            pointDrawFlags[0] = (xRangeFlags[0] == CPTPlotRangeComparisonResultNumberInRange &&
-                                 yRangeFlags[0] == CPTPlotRangeComparisonResultNumberInRange &&
-                                 !nanFlags[0]);
-        }
-        if ( visibleOnly ) {
-            for ( NSUInteger i = 1; i < dataCount; i++ ) {
-                if ((xRangeFlags[i] == CPTPlotRangeComparisonResultNumberInRange) &&
-                    (yRangeFlags[i] == CPTPlotRangeComparisonResultNumberInRange) &&
-                    !nanFlags[i] ) {
-                    pointDrawFlags[i] = YES;
+                    if ( isnan(x)) {
+                        xFlag = CPTPlotRangeComparisonResultNumberUndefined;
+                    }
+                    else if ( x < xMin ) {
+                        xFlag = CPTPlotRangeComparisonResultNumberBelowRange;
+                    }
+                    else if ( x > xMax ) {
+                        xFlag = CPTPlotRangeComparisonResultNumberAboveRange;
+                    }
+                    else if ( isnan(y)) { // if x is out of range, then y doesn't matter
+                        yFlag = CPTPlotRangeComparisonResultNumberUndefined;
+                    }
+                    else if ( y < yMin ) {
+                        yFlag = CPTPlotRangeComparisonResultNumberBelowRange;
+                    }
+                    else if ( y > yMax ) {
+                        yFlag = CPTPlotRangeComparisonResultNumberAboveRange;
+                    }
+
+                    windowRegions[i] = CPTScatterPlotRegion(xFlag, yFlag, isnan(x) || isnan(y));
                 }
             }
-        }
-        else {
-            switch ( theInterpolation ) {
-                case CPTScatterPlotInterpolationCurved:
-                    // Keep 2 points outside of the visible area on each side to maintain the correct curvature of the line
-                    if ( dataCount > 1 ) {
-                        if ( !nanFlags[0] && !nanFlags[1] && ((xRangeFlags[0] != xRangeFlags[1]) || (yRangeFlags[0] != yRangeFlags[1]))) {
-                            pointDrawFlags[0] = YES;
-                            pointDrawFlags[1] = YES;
-                        }
-                        else if ((xRangeFlags[1] == CPTPlotRangeComparisonResultNumberInRange) &&
-                                 (yRangeFlags[1] == CPTPlotRangeComparisonResultNumberInRange) &&
-                                 !nanFlags[1] ) {
-                            pointDrawFlags[1] = YES;
-                        }
-                    }
+        });
 
-                    for ( NSUInteger i = 2; i < dataCount; i++ ) {
-                        if ( !nanFlags[i - 2] && !nanFlags[i - 1] && !nanFlags[i] ) {
-                            pointDrawFlags[i - 2] = YES;
-                            pointDrawFlags[i - 1] = YES;
-                            pointDrawFlags[i]     = YES;
-                        }
-                        else if ( !nanFlags[i - 1] && !nanFlags[i] && ((xRangeFlags[i - 1] != xRangeFlags[i]) || (yRangeFlags[i - 1] != yRangeFlags[i]))) {
-                            pointDrawFlags[i - 2] = YES;
-                            pointDrawFlags[i - 1] = YES;
-                            pointDrawFlags[i]     = YES;
-                        }
-                        else if ((xRangeFlags[i] == CPTPlotRangeComparisonResultNumberInRange) &&
-                                 (yRangeFlags[i] == CPTPlotRangeComparisonResultNumberInRange) &&
-                                 !nanFlags[i] ) {
-                            pointDrawFlags[i] = YES;
-                        }
-                    }
-                    break;
+        projectedInKernel = YES;
+    }
+    else {
+        const NSDecimal *xBytes = (const NSDecimal *)[self cachedNumbersForField:CPTScatterPlotFieldX].bytes + firstIndex;
+        const NSDecimal *yBytes = (const NSDecimal *)[self cachedNumbersForField:CPTScatterPlotFieldY].bytes + firstIndex;
 
-                default:
-                    // Keep 1 point outside of the visible area on each side
-                    for ( NSUInteger i = 1; i < dataCount; i++ ) {
-                        if ( !nanFlags[i - 1] && !nanFlags[i] && ((xRangeFlags[i - 1] != xRangeFlags[i]) || (yRangeFlags[i - 1] != yRangeFlags[i]))) {
-                            pointDrawFlags[i - 1] = YES;
-                            pointDrawFlags[i]     = YES;
-                        }
-                        else if ((xRangeFlags[i] == CPTPlotRangeComparisonResultNumberInRange) &&
-                                 (yRangeFlags[i] == CPTPlotRangeComparisonResultNumberInRange) &&
-                                 !nanFlags[i] ) {
-                            pointDrawFlags[i] = YES;
-                        }
-                    }
-                    break;
+        dispatch_apply(count, queue, ^(size_t i) {
+            const NSDecimal x = xBytes[i];
+            const NSDecimal y = yBytes[i];
+
+            CPTPlotRangeComparisonResult xFlag = [xRange compareToDecimal:x];
+            CPTPlotRangeComparisonResult yFlag = CPTPlotRangeComparisonResultNumberInRange; // if x is out of range, then y doesn't matter
+            if ( xFlag == CPTPlotRangeComparisonResultNumberInRange ) {
+                yFlag = [yRange compareToDecimal:y];
             }
-        }
 
-        free(xRangeFlags);
-        free(yRangeFlags);
-        free(nanFlags);
+            windowRegions[i] = CPTScatterPlotRegion(xFlag, yFlag, NSDecimalIsNotANumber(&x) || NSDecimalIsNotANumber(&y));
+        });
     }
+
+    // Ensure that whenever the path crosses over a region boundary, both points
+    // are included. This ensures no lines are left out that shouldn't be.
+    CPTScatterPlotFlagPointsToDraw(drawFlags,
+                                   projectedInKernel ? windowPoints : NULL,
+                                   windowRegions,
+                                   count,
+                                   visibleOnly,
+                                   self.interpolation == CPTScatterPlotInterpolationCurved);
+
+    if ( viewPoints && !projectedInKernel ) {
+        [self calculateViewPoints:viewPoints withDrawPointFlags:pointDrawFlags indexRange:indexRange];
+    }
+
+    free(regionBuffer);
+
+    return indexRange;
 }
 
--(void)calculateViewPoints:(nonnull CGPoint *)viewPoints withDrawPointFlags:(nonnull BOOL *)drawPointFlags numberOfPoints:(NSUInteger)dataCount
+-(void)calculateViewPoints:(nonnull CGPoint *)viewPoints withDrawPointFlags:(nonnull BOOL *)drawPointFlags indexRange:(NSRange)indexRange
 {
-    CPTPlotSpace *thePlotSpace = self.plotSpace;
+    CPTXYPlotSpace *thePlotSpace = (CPTXYPlotSpace *)self.plotSpace;
+    NSUInteger firstIndex        = indexRange.location;
 
     // Calculate points
-    if ( self.doublePrecisionCache ) {
-        const double *xBytes = (const double *)[self cachedNumbersForField:CPTScatterPlotFieldX].data.bytes;
-        const double *yBytes = (const double *)[self cachedNumbersForField:CPTScatterPlotFieldY].data.bytes;
-
-        dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
-            const double x = xBytes[i];
-            const double y = yBytes[i];
-            if ( !drawPointFlags[i] || isnan(x) || isnan(y)) {
-                viewPoints[i] = CPTPointMake(NAN, NAN);
-            }
-            else {
-                double plotPoint[2];
-                plotPoint[CPTCoordinateX] = x;
-                plotPoint[CPTCoordinateY] = y;
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+        const double *xBytes = (const double *)[self cachedDoublesForField:CPTScatterPlotFieldX recordIndexRange:indexRange].bytes;
+        const double *yBytes = (const double *)[self cachedDoublesForField:CPTScatterPlotFieldY recordIndexRange:indexRange].bytes;
+
+        [thePlotSpace plotAreaViewPoints:viewPoints + firstIndex
+               forDoublePrecisionXValues:xBytes
+                                 yValues:yBytes
+                          numberOfPoints:indexRange.length];
 
-                viewPoints[i] = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
+        for ( NSUInteger i = firstIndex; i < NSMaxRange(indexRange); i++ ) {
+            if ( !drawPointFlags[i] || isnan(xBytes[i - firstIndex]) || isnan(yBytes[i - firstIndex])) {
+                viewPoints[i] = CPTPointMake(NAN, NAN);
             }
-        });
+        }
     }
     else {
         CPTMutableNumericData *xData = [self cachedNumbersForField:CPTScatterPlotFieldX];
         CPTMutableNumericData *yData = [self cachedNumbersForField:CPTScatterPlotFieldY];
 
-        const NSDecimal *xBytes = (const NSDecimal *)xData.data.bytes;
-        const NSDecimal *yBytes = (const NSDecimal *)yData.data.bytes;
+        const NSDecimal *xBytes = (const NSDecimal *)xData.bytes;
+        const NSDecimal *yBytes = (const NSDecimal *)yData.bytes;
 
-        dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
+        dispatch_apply(indexRange.length, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t j) {
+            const size_t i    = firstIndex + j;
             const NSDecimal x = xBytes[i];
             const NSDecimal y = yBytes[i];
             if ( !drawPointFlags[i] || NSDecimalIsNotANumber(&x) || NSDecimalIsNotANumber(&y)) {
@@ -657,19 +826,23 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     }
 }
 
--(void)alignViewPointsToUserSpace:(nonnull CGPoint *)viewPoints withContext:(nonnull CGContextRef)context drawPointFlags:(nonnull BOOL *)drawPointFlags numberOfPoints:(NSUInteger)dataCount
+-(void)alignViewPointsToUserSpace:(nonnull CGPoint *)viewPoints withContext:(nonnull CGContextRef)context drawPointFlags:(nonnull BOOL *)drawPointFlags indexRange:(NSRange)indexRange
 {
+    NSUInteger firstIndex = indexRange.location;
+
     // Align to device pixels if there is a data line.
     // Otherwise, align to view space, so fills are sharp at edges.
     if ( self.dataLineStyle.lineWidth > CPTFloat(0.0)) {
-        dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
+        dispatch_apply(indexRange.length, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t j) {
+            const size_t i = firstIndex + j;
             if ( drawPointFlags[i] ) {
                 viewPoints[i] = CPTAlignPointToUserSpace(context, viewPoints[i]);
             }
         });
     }
     else {
-        dispatch_apply(dataCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t i) {
+        dispatch_apply(indexRange.length, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t j) {
+            const size_t i = firstIndex + j;
             if ( drawPointFlags[i] ) {
                 viewPoints[i] = CPTAlignIntegralPointToUserSpace(context, viewPoints[i]);
             }
@@ -677,19 +850,22 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     }
 }
 
--(NSInteger)extremeDrawnPointIndexForFlags:(nonnull BOOL *)pointDrawFlags numberOfPoints:(NSUInteger)dataCount extremeNumIsLowerBound:(BOOL)isLowerBound
+-(NSInteger)extremeDrawnPointIndexForFlags:(nonnull BOOL *)pointDrawFlags indexRange:(NSRange)indexRange extremeNumIsLowerBound:(BOOL)isLowerBound
 {
     NSInteger result = NSNotFound;
-    NSInteger delta  = (isLowerBound ? 1 : -1);
 
-    if ( dataCount > 0 ) {
-        NSUInteger initialIndex = (isLowerBound ? 0 : dataCount - 1);
-        for ( NSInteger i = (NSInteger)initialIndex; i < (NSInteger)dataCount; i += delta ) {
+    if ( isLowerBound ) {
+        for ( NSUInteger i = indexRange.location; i < NSMaxRange(indexRange); i++ ) {
             if ( pointDrawFlags[i] ) {
-                result = i;
+                result = (NSInteger)i;
                 break;
             }
-            if ((delta < 0) && (i == 0)) {
+        }
+    }
+    else {
+        for ( NSUInteger i = NSMaxRange(indexRange); i > indexRange.location; i-- ) {
+            if ( pointDrawFlags[i - 1] ) {
+                result = (NSInteger)(i - 1);
                 break;
             }
         }
@@ -697,6 +873,20 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     return result;
 }
 
+/** @internal
+ *  @brief Determines whether the values of a field are known to be in ascending order.
+ *  @param fieldEnum The field enumerator identifying the field.
+ *  @return @YES for the x values if @ref assumesSortedXValues is @YES, otherwise the result of the superclass.
+ **/
+-(BOOL)isSortedField:(NSUInteger)fieldEnum
+{
+    if ((fieldEnum == CPTScatterPlotFieldX) && self.assumesSortedXValues ) {
+        return YES;
+    }
+
+    return [super isSortedField:fieldEnum];
+}
+
 /// @endcond
 
 #pragma mark -
@@ -712,36 +902,59 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 /// @endcond
 
 /** @brief Returns the index of the closest visible point to the point passed in.
+ *
+ *  The view points of the visible records are kept in a spatial index that is rebuilt the first time
+ *  this method is called after the data, the plot space, or the size of the plot changes, so repeated
+ *  queries, such as while tracking a drag, take logarithmic time.
+ *
  *  @param viewPoint The reference point.
  *  @return The index of the closest point, or @ref NSNotFound if there is no visible point.
  **/
 -(NSUInteger)indexOfVisiblePointClosestToPlotAreaPoint:(CGPoint)viewPoint
+{
+    _CPTPointIndex *pointIndex = self.visiblePointIndex;
+    CGRect plotBounds          = self.bounds;
+
+    if ( !pointIndex || !CGRectEqualToRect(plotBounds, self.visiblePointIndexBounds)) {
+        pointIndex                   = [self newVisiblePointIndex];
+        self.visiblePointIndex       = pointIndex;
+        self.visiblePointIndexBounds = plotBounds;
+    }
+
+    return [pointIndex indexOfPointClosestToPoint:viewPoint];
+}
+
+/** @internal
+ *  @brief Builds a spatial index of the view points of the visible records.
+ *  @return A new point index.
+ **/
+-(nonnull _CPTPointIndex *)newVisiblePointIndex
 {
     NSUInteger dataCount = self.cachedDataCount;
+
+    if ( dataCount == 0 ) {
+        return [[_CPTPointIndex alloc] init];
+    }
+
+    // Use private storage rather than the scratch buffer, which belongs to the drawing code
     CGPoint *viewPoints  = calloc(dataCount, sizeof(CGPoint));
     BOOL *drawPointFlags = calloc(dataCount, sizeof(BOOL));
 
-    [self calculatePointsToDraw:drawPointFlags forPlotSpace:(CPTXYPlotSpace *)self.plotSpace includeVisiblePointsOnly:YES numberOfPoints:dataCount];
-    [self calculateViewPoints:viewPoints withDrawPointFlags:drawPointFlags numberOfPoints:dataCount];
+    NSRange indexRange = [self calculatePointsToDraw:drawPointFlags
+                                          viewPoints:viewPoints
+                                             regions:NULL
+                                        forPlotSpace:(CPTXYPlotSpace *)self.plotSpace
+                            includeVisiblePointsOnly:YES
+                                      numberOfPoints:dataCount];
 
-    NSInteger result = [self extremeDrawnPointIndexForFlags:drawPointFlags numberOfPoints:dataCount extremeNumIsLowerBound:YES];
-    if ( result != NSNotFound ) {
-        CGFloat minimumDistanceSquared = CPTNAN;
-        for ( NSUInteger i = (NSUInteger)result; i < dataCount; ++i ) {
-            if ( drawPointFlags[i] ) {
-                CGFloat distanceSquared = squareOfDistanceBetweenPoints(viewPoint, viewPoints[i]);
-                if ( isnan(minimumDistanceSquared) || (distanceSquared < minimumDistanceSquared)) {
-                    minimumDistanceSquared = distanceSquared;
-                    result                 = (NSInteger)i;
-                }
-            }
-        }
-    }
+    _CPTPointIndex *pointIndex = [[_CPTPointIndex alloc] initWithPoints:viewPoints
+                                                         includedPoints:drawPointFlags
+                                                             indexRange:indexRange];
 
     free(viewPoints);
     free(drawPointFlags);
 
-    return (NSUInteger)result;
+    return pointIndex;
 }
 
 /** @brief Returns the plot area view point of a visible point.
@@ -755,7 +968,7 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     CPTXYPlotSpace *thePlotSpace = (CPTXYPlotSpace *)self.plotSpace;
     CGPoint viewPoint;
 
-    if ( self.doublePrecisionCache ) {
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
         double plotPoint[2];
         plotPoint[CPTScatterPlotFieldX] = [self cachedDoubleForField:CPTScatterPlotFieldX recordIndex:idx];
         plotPoint[CPTScatterPlotFieldY] = [self cachedDoubleForField:CPTScatterPlotFieldY recordIndex:idx];
@@ -784,10 +997,13 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         return;
     }
 
-    CPTMutableNumericData *xValueData = [self cachedNumbersForField:CPTScatterPlotFieldX];
+    // implicit x values are computed as needed instead of being materialized here
+    BOOL implicitX = [self hasImplicitValuesForField:CPTScatterPlotFieldX];
+
+    CPTMutableNumericData *xValueData = implicitX ? nil : [self cachedNumbersForField:CPTScatterPlotFieldX];
     CPTMutableNumericData *yValueData = [self cachedNumbersForField:CPTScatterPlotFieldY];
 
-    if ((xValueData == nil) || (yValueData == nil)) {
+    if ((!implicitX && (xValueData == nil)) || (yValueData == nil)) {
         return;
     }
     NSUInteger dataCount = self.cachedDataCount;
@@ -797,32 +1013,68 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     if ( !(self.dataLineStyle || self.areaFill || self.areaFill2 || self.plotSymbol || self.plotSymbols.count)) {
         return;
     }
-    if ( xValueData.numberOfSamples != yValueData.numberOfSamples ) {
+    if ( !implicitX && (xValueData.numberOfSamples != yValueData.numberOfSamples)) {
         [NSException raise:CPTException format:@"Number of x and y values do not match"];
     }
 
     [super renderAsVectorInContext:context];
 
-    // Calculate view points, and align to user space
-    CGPoint *viewPoints  = calloc(dataCount, sizeof(CGPoint));
-    BOOL *drawPointFlags = calloc(dataCount, sizeof(BOOL));
-
     CPTXYPlotSpace *thePlotSpace = (CPTXYPlotSpace *)self.plotSpace;
-    [self calculatePointsToDraw:drawPointFlags forPlotSpace:thePlotSpace includeVisiblePointsOnly:NO numberOfPoints:dataCount];
-    [self calculateViewPoints:viewPoints withDrawPointFlags:drawPointFlags numberOfPoints:dataCount];
-
-    BOOL pixelAlign = self.alignsPointsToPixels;
-    if ( pixelAlign ) {
-        [self alignViewPointsToUserSpace:viewPoints withContext:context drawPointFlags:drawPointFlags numberOfPoints:dataCount];
+    BOOL pixelAlign              = self.alignsPointsToPixels;
+
+    CGPoint *viewPoints            = NULL;
+    BOOL *drawPointFlags           = NULL;
+    NSInteger firstDrawnPointIndex = NSNotFound;
+    NSInteger lastDrawnPointIndex  = NSNotFound;
+
+    // Reduce the number of points used to build the line and fill paths
+    CGPoint *linePoints      = NULL;
+    CGPoint *decimatedPoints = NULL;
+    NSRange lineIndexRange   = NSMakeRange(0, 0);
+    NSUInteger lodFirstIndex = NSNotFound;
+    NSUInteger lodPointCount = 0;
+
+    if ( [self getLevelOfDetailViewPoints:&linePoints count:&lodPointCount firstRecordIndex:&lodFirstIndex inContext:context] ) {
+        lineIndexRange = NSMakeRange(0, lodPointCount);
+        if ( lodFirstIndex != NSNotFound ) {
+            firstDrawnPointIndex = (NSInteger)lodFirstIndex;
+        }
     }
+    else {
+        // Calculate view points, and align to user space
+        uint8_t *regions = NULL;
+        [self getScratchViewPoints:&viewPoints drawPointFlags:&drawPointFlags regions:&regions count:dataCount];
+
+        NSRange indexRange = [self calculatePointsToDraw:drawPointFlags
+                                              viewPoints:viewPoints
+                                                 regions:regions
+                                            forPlotSpace:thePlotSpace
+                                includeVisiblePointsOnly:NO
+                                          numberOfPoints:dataCount];
+
+        if ( pixelAlign ) {
+            [self alignViewPointsToUserSpace:viewPoints withContext:context drawPointFlags:drawPointFlags indexRange:indexRange];
+        }
 
-    // Get extreme points
-    NSInteger lastDrawnPointIndex  = [self extremeDrawnPointIndexForFlags:drawPointFlags numberOfPoints:dataCount extremeNumIsLowerBound:NO];
-    NSInteger firstDrawnPointIndex = [self extremeDrawnPointIndexForFlags:drawPointFlags numberOfPoints:dataCount extremeNumIsLowerBound:YES];
+        // Get extreme points
+        lastDrawnPointIndex  = [self extremeDrawnPointIndexForFlags:drawPointFlags indexRange:indexRange extremeNumIsLowerBound:NO];
+        firstDrawnPointIndex = [self extremeDrawnPointIndexForFlags:drawPointFlags indexRange:indexRange extremeNumIsLowerBound:YES];
 
-    if ( firstDrawnPointIndex != NSNotFound ) {
-        NSRange viewIndexRange = NSMakeRange((NSUInteger)firstDrawnPointIndex, (NSUInteger)(lastDrawnPointIndex - firstDrawnPointIndex + 1));
+        if ( firstDrawnPointIndex != NSNotFound ) {
+            NSRange viewIndexRange = NSMakeRange((NSUInteger)firstDrawnPointIndex, (NSUInteger)(lastDrawnPointIndex - firstDrawnPointIndex + 1));
+
+            linePoints     = viewPoints;
+            lineIndexRange = viewIndexRange;
 
+            if ( self.decimatesDataLine && (self.interpolation == CPTScatterPlotInterpolationLinear)) {
+                decimatedPoints = calloc(viewIndexRange.length, sizeof(CGPoint));
+                lineIndexRange  = NSMakeRange(0, [self decimateViewPoints:viewPoints indexRange:viewIndexRange toViewPoints:decimatedPoints]);
+                linePoints      = decimatedPoints;
+            }
+        }
+    }
+
+    if ( linePoints && (firstDrawnPointIndex != NSNotFound)) {
         CPTPlotArea *thePlotArea            = self.plotArea;
         CPTLineStyle *theLineStyle          = self.dataLineStyle;
         CPTMutableLimitBandArray *fillBands = self.mutableAreaFillBands;
@@ -855,16 +1107,15 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
                         CGContextSetShadowWithColor(context, CGSizeZero, CPTFloat(0.0), NULL);
                     }
 
-                    NSNumber *xValue = [xValueData sampleValue:(NSUInteger)firstDrawnPointIndex];
                     NSDecimal plotPoint[2];
-                    plotPoint[CPTCoordinateX] = xValue.decimalValue;
+                    plotPoint[CPTCoordinateX] = [self cachedDecimalForField:CPTScatterPlotFieldX recordIndex:(NSUInteger)firstDrawnPointIndex];
                     plotPoint[CPTCoordinateY] = theAreaBaseValue;
                     CGPoint baseLinePoint = [self convertPoint:[thePlotSpace plotAreaViewPointForPlotPoint:plotPoint numberOfCoordinates:2] fromLayer:thePlotArea];
                     if ( pixelAlign ) {
                         baseLinePoint = CPTAlignIntegralPointToUserSpace(context, baseLinePoint);
                     }
 
-                    CGPathRef dataLinePath = [self newDataLinePathForViewPoints:viewPoints indexRange:viewIndexRange baselineYValue:baseLinePoint.y];
+                    CGPathRef dataLinePath = [self newDataLinePathForViewPoints:linePoints indexRange:lineIndexRange baselineYValue:baseLinePoint.y];
 
                     if ( theFill ) {
                         CGContextBeginPath(context);
@@ -913,7 +1164,7 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 
         // Draw line
         if ( theLineStyle ) {
-            CGPathRef dataLinePath = [self newDataLinePathForViewPoints:viewPoints indexRange:viewIndexRange baselineYValue:CPTNAN];
+            CGPathRef dataLinePath = [self newDataLinePathForViewPoints:linePoints indexRange:lineIndexRange baselineYValue:CPTNAN];
 
             // Give the delegate a chance to prepare for the drawing.
             id<CPTScatterPlotDelegate> theDelegate = (id<CPTScatterPlotDelegate>)self.delegate;
@@ -929,7 +1180,7 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         }
 
         // Draw plot symbols
-        if ( self.plotSymbol || self.plotSymbols.count ) {
+        if ( viewPoints && drawPointFlags && (self.plotSymbol || self.plotSymbols.count)) {
             Class symbolClass = [CPTPlotSymbol class];
 
             // clear the plot shadow if any--symbols draw their own shadows
@@ -959,8 +1210,294 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         }
     }
 
-    free(viewPoints);
-    free(drawPointFlags);
+    free(decimatedPoints);
+}
+
+/** @internal
+ *  @brief Gets working storage for drawing from the scratch buffer.
+ *
+ *  The buffer is reused from frame to frame. It is reallocated, with room to grow, only when it is too small,
+ *  or when it is more than twice the size needed so that memory is returned after the data shrinks.
+ *  The contents are not cleared between uses.
+ *
+ *  @param length The number of bytes needed.
+ *  @return The storage.
+ **/
+-(nonnull uint8_t *)scratchBytesWithLength:(NSUInteger)length
+{
+    NSMutableData *buffer = self.scratchBuffer;
+
+    if ( !buffer || (buffer.length < length) || (buffer.length > 2 * length)) {
+        buffer             = [[NSMutableData alloc] initWithLength:length + length / 2];
+        self.scratchBuffer = buffer;
+    }
+
+    return (uint8_t *)buffer.mutableBytes;
+}
+
+/** @internal
+ *  @brief Gets working storage for the view points, draw flags, and region codes of every record from the scratch buffer.
+ *  @param viewPoints Returns storage for @par{count} view points.
+ *  @param drawPointFlags Returns storage for @par{count} draw flags.
+ *  @param regions Returns storage for @par{count} region codes.
+ *  @param count The number of records.
+ **/
+-(void)getScratchViewPoints:(CGPoint *__nullable *__nonnull)viewPoints drawPointFlags:(BOOL *__nullable *__nonnull)drawPointFlags regions:(uint8_t *__nullable *__nonnull)regions count:(NSUInteger)count
+{
+    NSUInteger pointLength = count * sizeof(CGPoint);
+    NSUInteger flagLength  = count * sizeof(BOOL);
+
+    uint8_t *bytes = [self scratchBytesWithLength:pointLength + flagLength + count * sizeof(uint8_t)];
+
+    *viewPoints     = (CGPoint *)(void *)bytes;
+    *drawPointFlags = (BOOL *)(bytes + pointLength);
+    *regions        = bytes + pointLength + flagLength;
+}
+
+/** @internal
+ *  @brief Calculates the view points of the data line from the level of detail summary of the y values.
+ *
+ *  When the x values are sorted, the visible records are divided among the device pixel columns of the
+ *  plot with a binary search for the x value at each column boundary. The y values of each column are
+ *  reduced to the first, smallest, largest, and last record of each run of values between @NAN gaps.
+ *  Only those records are transformed to view coordinates, so the cost of drawing the line depends
+ *  on the width of the plot rather than the number of records.
+ *
+ *  @param viewPoints Returns the view points, stored in the scratch buffer.
+ *  @param pointCount Returns the number of view points.
+ *  @param firstIndex Returns the index of the first record drawn, or @ref NSNotFound if no record is drawn.
+ *  @param context The graphics context used to align the points.
+ *  @return @YES if the level of detail summary was used, or @NO if every record should be drawn instead.
+ **/
+-(BOOL)getLevelOfDetailViewPoints:(CGPoint *__nullable *__nonnull)viewPoints count:(nonnull NSUInteger *)pointCount firstRecordIndex:(nonnull NSUInteger *)firstIndex inContext:(nonnull CGContextRef)context
+{
+    if ( !self.decimatesDataLine || (self.interpolation != CPTScatterPlotInterpolationLinear) || self.plotSymbol || self.plotSymbols.count ) {
+        return NO;
+    }
+
+    _CPTDataRangeIndex *yIndex = [self rangeIndexForField:CPTScatterPlotFieldY];
+
+    if ( !yIndex || ![self isSortedField:CPTScatterPlotFieldX] ) {
+        return NO;
+    }
+
+    CGFloat scale          = self.contentsScale;
+    NSUInteger columnCount = (NSUInteger)ceil(self.bounds.size.width * scale);
+
+    if ( columnCount == 0 ) {
+        return NO;
+    }
+
+    CPTXYPlotSpace *thePlotSpace = (CPTXYPlotSpace *)self.plotSpace;
+    NSUInteger dataCount         = self.cachedDataCount;
+    NSRange xIndexRange          = [self indexRangeForSortedField:CPTScatterPlotFieldX plotRange:thePlotSpace.xRange];
+
+    if ( xIndexRange.location == NSNotFound ) {
+        return NO;
+    }
+
+    // keep one record outside of the range on each side so line segments crossing the range boundaries are drawn
+    NSUInteger lowIndex  = (xIndexRange.location > 0) ? xIndexRange.location - 1 : 0;
+    NSUInteger highIndex = MIN(NSMaxRange(xIndexRange) + 1, dataCount);
+    NSRange indexRange   = NSMakeRange(lowIndex, highIndex - lowIndex);
+
+    if ( indexRange.length < kCPTScatterPlotLevelOfDetailMinimumDensity * columnCount ) {
+        return NO;
+    }
+
+    _CPTImplicitField *implicitX = [self implicitFieldForField:CPTScatterPlotFieldX];
+    CPTMutableNumericData *xData = implicitX ? nil : [self cachedNumbersForField:CPTScatterPlotFieldX];
+    CPTMutableNumericData *yData = [self cachedNumbersForField:CPTScatterPlotFieldY];
+
+    NSMutableData *indexBuffer = self.levelOfDetailIndices;
+
+    if ( !indexBuffer ) {
+        indexBuffer               = [[NSMutableData alloc] initWithLength:4 * (columnCount + 1) * sizeof(NSUInteger)];
+        self.levelOfDetailIndices = indexBuffer;
+    }
+
+    // visit the pixel columns in order of increasing x
+    double plotPoint[2];
+
+    [thePlotSpace doublePrecisionPlotPoint:plotPoint numberOfCoordinates:2 forPlotAreaViewPoint:CGPointZero];
+    double leftX = plotPoint[CPTCoordinateX];
+
+    [thePlotSpace doublePrecisionPlotPoint:plotPoint numberOfCoordinates:2 forPlotAreaViewPoint:CPTPointMake((CGFloat)columnCount / scale, 0.0)];
+    BOOL reversed = (plotPoint[CPTCoordinateX] < leftX);
+
+    NSUInteger count       = 0;
+    NSUInteger columnStart = indexRange.location;
+    NSUInteger endIndex    = NSMaxRange(indexRange);
+
+    for ( NSUInteger column = 1; column <= columnCount; column++ ) {
+        NSUInteger columnEnd = endIndex;
+
+        if ( column < columnCount ) {
+            CGFloat boundary = (CGFloat)(reversed ? columnCount - column : column) / scale;
+
+            [thePlotSpace doublePrecisionPlotPoint:plotPoint numberOfCoordinates:2 forPlotAreaViewPoint:CPTPointMake(boundary, 0.0)];
+            columnEnd = [self firstIndexOfSortedField:CPTScatterPlotFieldX
+                                     notLessThanValue:plotPoint[CPTCoordinateX]
+                                         inIndexRange:NSMakeRange(columnStart, endIndex - columnStart)];
+        }
+
+        count       = [yIndex appendLevelOfDetailIndicesToBuffer:indexBuffer count:count forData:yData inIndexRange:NSMakeRange(columnStart, columnEnd - columnStart)];
+        columnStart = columnEnd;
+    }
+
+    // transform the selected records together
+    const NSUInteger *indices = (const NSUInteger *)indexBuffer.bytes;
+    uint8_t *scratch          = [self scratchBytesWithLength:MAX(count, (NSUInteger)1) * (sizeof(CGPoint) + 2 * sizeof(double))];
+    CGPoint *points           = (CGPoint *)(void *)scratch;
+    NSUInteger first          = NSNotFound;
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        if ( indices[i] != NSNotFound ) {
+            first = indices[i];
+            break;
+        }
+    }
+
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+        const void *xBytes = xData.bytes;
+        const void *yBytes = yData.bytes;
+        BOOL floatCache    = self.floatPrecisionCache;
+        double *xValues    = (double *)(void *)(scratch + count * sizeof(CGPoint));
+        double *yValues    = xValues + count;
+
+        for ( NSUInteger i = 0; i < count; i++ ) {
+            NSUInteger idx = indices[i];
+            if ( idx == NSNotFound ) {
+                xValues[i] = (double)NAN;
+                yValues[i] = (double)NAN;
+            }
+            else if ( implicitX ) {
+                xValues[i] = [implicitX doubleValueAtIndex:idx];
+                yValues[i] = floatCache ? (double)((const float *)yBytes)[idx] : ((const double *)yBytes)[idx];
+            }
+            else if ( floatCache ) {
+                xValues[i] = (double)((const float *)xBytes)[idx];
+                yValues[i] = (double)((const float *)yBytes)[idx];
+            }
+            else {
+                xValues[i] = ((const double *)xBytes)[idx];
+                yValues[i] = ((const double *)yBytes)[idx];
+            }
+        }
+
+        [thePlotSpace plotAreaViewPoints:points forDoublePrecisionXValues:xValues yValues:yValues numberOfPoints:count];
+    }
+    else {
+        // decimal values keep the precision of the decimal transform
+        const NSDecimal *xBytes = (const NSDecimal *)xData.bytes;
+        const NSDecimal *yBytes = (const NSDecimal *)yData.bytes;
+
+        for ( NSUInteger i = 0; i < count; i++ ) {
+            NSUInteger idx = indices[i];
+            if ( idx == NSNotFound ) {
+                points[i] = CPTPointMake(NAN, NAN);
+            }
+            else {
+                NSDecimal decimalPoint[2];
+                decimalPoint[CPTCoordinateX] = implicitX ? [implicitX decimalValueAtIndex:idx] : xBytes[idx];
+                decimalPoint[CPTCoordinateY] = yBytes[idx];
+
+                points[i] = [thePlotSpace plotAreaViewPointForPlotPoint:decimalPoint numberOfCoordinates:2];
+            }
+        }
+    }
+
+    if ( self.alignsPointsToPixels ) {
+        BOOL alignToDevice = (self.dataLineStyle.lineWidth > CPTFloat(0.0));
+
+        for ( NSUInteger i = 0; i < count; i++ ) {
+            if ( !isnan(points[i].x)) {
+                points[i] = alignToDevice ? CPTAlignPointToUserSpace(context, points[i]) : CPTAlignIntegralPointToUserSpace(context, points[i]);
+            }
+        }
+    }
+
+    *viewPoints = points;
+    *pointCount = count;
+    *firstIndex = first;
+
+    return YES;
+}
+
+/** @internal
+ *  @brief Reduces a range of view points to the first, last, lowest, and highest point of each run of
+ *  consecutive points that fall in the same device pixel column.
+ *
+ *  Runs of @NAN points are collapsed to a single @NAN point so gaps in the data line are preserved.
+ *  The result never holds more points than the original range.
+ *
+ *  @param viewPoints The view points.
+ *  @param indexRange The range of view points to reduce.
+ *  @param decimatedPoints Returns the reduced view points. Must have room for at least @par{indexRange.length} points.
+ *  @return The number of points stored in @par{decimatedPoints}.
+ **/
+-(NSUInteger)decimateViewPoints:(nonnull const CGPoint *)viewPoints indexRange:(NSRange)indexRange toViewPoints:(nonnull CGPoint *)decimatedPoints
+{
+    CGFloat scale       = self.contentsScale;
+    NSUInteger count    = 0;
+    NSUInteger i        = indexRange.location;
+    NSUInteger maxIndex = NSMaxRange(indexRange);
+
+    while ( i < maxIndex ) {
+        CGPoint viewPoint = viewPoints[i];
+
+        if ( isnan(viewPoint.x) || isnan(viewPoint.y)) {
+            if ((count == 0) || !isnan(decimatedPoints[count - 1].x)) {
+                decimatedPoints[count++] = CPTPointMake(NAN, NAN);
+            }
+            i++;
+            continue;
+        }
+
+        CGFloat column      = floor(viewPoint.x * scale);
+        NSUInteger firstIdx = i;
+        NSUInteger lastIdx  = i;
+        NSUInteger lowIdx   = i;
+        NSUInteger highIdx  = i;
+        CGFloat lowValue    = viewPoint.y;
+        CGFloat highValue   = viewPoint.y;
+
+        for ( i++; i < maxIndex; i++ ) {
+            CGPoint nextPoint = viewPoints[i];
+
+            if ( isnan(nextPoint.x) || isnan(nextPoint.y) || (floor(nextPoint.x * scale) != column)) {
+                break;
+            }
+
+            if ( nextPoint.y < lowValue ) {
+                lowValue = nextPoint.y;
+                lowIdx   = i;
+            }
+            if ( nextPoint.y > highValue ) {
+                highValue = nextPoint.y;
+                highIdx   = i;
+            }
+            lastIdx = i;
+        }
+
+        // keep the points in their original order
+        NSUInteger runIndices[4];
+        runIndices[0] = firstIdx;
+        runIndices[1] = MIN(lowIdx, highIdx);
+        runIndices[2] = MAX(lowIdx, highIdx);
+        runIndices[3] = lastIdx;
+
+        NSUInteger previousIdx = NSNotFound;
+        for ( NSUInteger j = 0; j < 4; j++ ) {
+            NSUInteger idx = runIndices[j];
+            if ( idx != previousIdx ) {
+                decimatedPoints[count++] = viewPoints[idx];
+                previousIdx              = idx;
+            }
+        }
+    }
+
+    return count;
 }
 
 -(nonnull CGPathRef)newDataLinePathForViewPoints:(nonnull CGPoint *)viewPoints indexRange:(NSRange)indexRange baselineYValue:(CGFloat)baselineYValue
@@ -1643,7 +2180,7 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         drawPointFlags[i] = YES;
     }
 
-    [self calculateViewPoints:viewPoints withDrawPointFlags:drawPointFlags numberOfPoints:dataCount];
+    [self calculateViewPoints:viewPoints withDrawPointFlags:drawPointFlags indexRange:NSMakeRange(0, dataCount)];
 
     // Create the path
     CGPathRef dataLinePath = [self newDataLinePathForViewPoints:viewPoints
@@ -2141,12 +2678,16 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
         BOOL *drawPointFlags = calloc(dataCount, sizeof(BOOL));
 
         CPTXYPlotSpace *thePlotSpace = (CPTXYPlotSpace *)self.plotSpace;
-        [self calculatePointsToDraw:drawPointFlags forPlotSpace:thePlotSpace includeVisiblePointsOnly:NO numberOfPoints:dataCount];
-        [self calculateViewPoints:viewPoints withDrawPointFlags:drawPointFlags numberOfPoints:dataCount];
-        NSInteger firstDrawnPointIndex = [self extremeDrawnPointIndexForFlags:drawPointFlags numberOfPoints:dataCount extremeNumIsLowerBound:YES];
+        NSRange indexRange = [self calculatePointsToDraw:drawPointFlags
+                                              viewPoints:viewPoints
+                                                 regions:NULL
+                                            forPlotSpace:thePlotSpace
+                                includeVisiblePointsOnly:NO
+                                          numberOfPoints:dataCount];
+        NSInteger firstDrawnPointIndex = [self extremeDrawnPointIndexForFlags:drawPointFlags indexRange:indexRange extremeNumIsLowerBound:YES];
 
         if ( firstDrawnPointIndex != NSNotFound ) {
-            NSInteger lastDrawnPointIndex = [self extremeDrawnPointIndexForFlags:drawPointFlags numberOfPoints:dataCount extremeNumIsLowerBound:NO];
+            NSInteger lastDrawnPointIndex = [self extremeDrawnPointIndexForFlags:drawPointFlags indexRange:indexRange extremeNumIsLowerBound:NO];
 
             NSRange viewIndexRange = NSMakeRange((NSUInteger)firstDrawnPointIndex, (NSUInteger)(lastDrawnPointIndex - firstDrawnPointIndex + 1));
             CGPathRef dataLinePath = [self newDataLinePathForViewPoints:viewPoints indexRange:viewIndexRange baselineYValue:CPTNAN];
@@ -2178,6 +2719,14 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 
 /// @cond
 
+-(void)setNeedsDisplay
+{
+    [super setNeedsDisplay];
+
+    // the view points may have moved
+    self.visiblePointIndex = nil;
+}
+
 -(void)setInterpolation:(CPTScatterPlotInterpolation)newInterpolation
 {
     if ( newInterpolation != interpolation ) {
@@ -2235,6 +2784,22 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
     }
 }
 
+-(void)setDecimatesDataLine:(BOOL)newDecimatesDataLine
+{
+    if ( newDecimatesDataLine != decimatesDataLine ) {
+        decimatesDataLine = newDecimatesDataLine;
+        [self setNeedsDisplay];
+    }
+}
+
+-(void)setAssumesSortedXValues:(BOOL)newAssumesSortedXValues
+{
+    if ( newAssumesSortedXValues != assumesSortedXValues ) {
+        assumesSortedXValues = newAssumesSortedXValues;
+        [self setNeedsDisplay];
+    }
+}
+
 -(void)setAreaFill:(nullable CPTFill *)newFill
 {
     if ( newFill != areaFill ) {
@@ -2324,3 +2889,128 @@ CPTScatterPlotBinding const CPTScatterPlotBindingPlotSymbols = @"plotSymbols"; /
 /// @endcond
 
 @end
+
+#pragma mark -
+
+/// @cond
+
+/** @internal
+ *  @brief Packs the range comparison results of a record into a region code.
+ *  @param xFlag The comparison of the x value to the x range.
+ *  @param yFlag The comparison of the y value to the y range.
+ *  @param isNaN @YES if either value is missing.
+ *  @return The region code.
+ **/
+static uint8_t CPTScatterPlotRegion(CPTPlotRangeComparisonResult xFlag, CPTPlotRangeComparisonResult yFlag, BOOL isNaN)
+{
+    return (uint8_t)((uint8_t)xFlag | (uint8_t)(yFlag << 2) | (isNaN ? kCPTScatterPlotRegionNaN : 0));
+}
+
+/** @internal
+ *  @brief Sets the draw flags from the region codes of a range of records.
+ *
+ *  A record is drawn if it is visible. Unless @par{visibleOnly} is @YES, both ends of every line segment
+ *  that crosses a region boundary are also drawn, plus one more record on each side for curved lines.
+ *  View points are marked @NAN as soon as their flags can no longer change, while they are still in the cache.
+ *
+ *  @param drawFlags Returns @YES for each record that should be drawn.
+ *  @param viewPoints If not @NULL, the view points of the records. Records that are not drawn are set to @NAN.
+ *  @param regions The region codes.
+ *  @param count The number of records.
+ *  @param visibleOnly If @YES, only visible records are flagged.
+ *  @param curved If @YES, keep two records outside of the visible area on each side to maintain the curvature of the line.
+ **/
+static void CPTScatterPlotFlagPointsToDraw(BOOL *__nonnull drawFlags, CGPoint *__nullable viewPoints, const uint8_t *__nonnull regions, NSUInteger count, BOOL visibleOnly, BOOL curved)
+{
+    // number of records the loops can look back when setting flags
+    NSUInteger lag       = visibleOnly ? 0 : (curved ? 2 : 1);
+    NSUInteger finalized = 0;
+
+    memset(drawFlags, NO, count * sizeof(BOOL));
+    drawFlags[0] = (regions[0] == kCPTScatterPlotRegionVisible);
+
+    if ( visibleOnly ) {
+        for ( NSUInteger i = 1; i < count; i++ ) {
+            if ( regions[i] == kCPTScatterPlotRegionVisible ) {
+                drawFlags[i] = YES;
+            }
+            finalized = CPTScatterPlotClearHiddenViewPoints(viewPoints, drawFlags, finalized, i + 1 - lag);
+        }
+    }
+    else if ( curved ) {
+        // Keep 2 points outside of the visible area on each side to maintain the correct curvature of the line
+        if ( count > 1 ) {
+            BOOL isNumber0 = (regions[0] & kCPTScatterPlotRegionNaN) == 0;
+            BOOL isNumber1 = (regions[1] & kCPTScatterPlotRegionNaN) == 0;
+
+            if ( isNumber0 && isNumber1 && (regions[0] != regions[1])) {
+                drawFlags[0] = YES;
+                drawFlags[1] = YES;
+            }
+            else if ( regions[1] == kCPTScatterPlotRegionVisible ) {
+                drawFlags[1] = YES;
+            }
+        }
+
+        for ( NSUInteger i = 2; i < count; i++ ) {
+            BOOL isNumber2 = (regions[i - 2] & kCPTScatterPlotRegionNaN) == 0;
+            BOOL isNumber1 = (regions[i - 1] & kCPTScatterPlotRegionNaN) == 0;
+            BOOL isNumber  = (regions[i] & kCPTScatterPlotRegionNaN) == 0;
+
+            if ( isNumber2 && isNumber1 && isNumber ) {
+                drawFlags[i - 2] = YES;
+                drawFlags[i - 1] = YES;
+                drawFlags[i]     = YES;
+            }
+            else if ( isNumber1 && isNumber && (regions[i - 1] != regions[i])) {
+                drawFlags[i - 2] = YES;
+                drawFlags[i - 1] = YES;
+                drawFlags[i]     = YES;
+            }
+            else if ( regions[i] == kCPTScatterPlotRegionVisible ) {
+                drawFlags[i] = YES;
+            }
+            finalized = CPTScatterPlotClearHiddenViewPoints(viewPoints, drawFlags, finalized, i + 1 - lag);
+        }
+    }
+    else {
+        // Keep 1 point outside of the visible area on each side
+        for ( NSUInteger i = 1; i < count; i++ ) {
+            BOOL isNumber1 = (regions[i - 1] & kCPTScatterPlotRegionNaN) == 0;
+            BOOL isNumber  = (regions[i] & kCPTScatterPlotRegionNaN) == 0;
+
+            if ( isNumber1 && isNumber && (regions[i - 1] != regions[i])) {
+                drawFlags[i - 1] = YES;
+                drawFlags[i]     = YES;
+            }
+            else if ( regions[i] == kCPTScatterPlotRegionVisible ) {
+                drawFlags[i] = YES;
+            }
+            finalized = CPTScatterPlotClearHiddenViewPoints(viewPoints, drawFlags, finalized, i + 1 - lag);
+        }
+    }
+
+    CPTScatterPlotClearHiddenViewPoints(viewPoints, drawFlags, finalized, count);
+}
+
+/** @internal
+ *  @brief Marks the view points of records that are not drawn as @NAN.
+ *  @param viewPoints The view points. Nothing is changed if @NULL.
+ *  @param drawFlags The draw flags.
+ *  @param start The index of the first record to check.
+ *  @param end The index after the last record to check.
+ *  @return The index after the last record checked.
+ **/
+static NSUInteger CPTScatterPlotClearHiddenViewPoints(CGPoint *__nullable viewPoints, const BOOL *__nonnull drawFlags, NSUInteger start, NSUInteger end)
+{
+    if ( viewPoints ) {
+        for ( NSUInteger i = start; i < end; i++ ) {
+            if ( !drawFlags[i] ) {
+                viewPoints[i] = CPTPointMake(NAN, NAN);
+            }
+        }
+    }
+    return end;
+}
+
+/// @endcond
@@ -1,12 +1,23 @@
 #import "CPTScatterPlotTests.h"
 
+#import "CPTMutableNumericData.h"
+#import "CPTNumericData.h"
 #import "CPTPlotRange.h"
 #import "CPTScatterPlot.h"
+#import "CPTUtilities.h"
 #import "CPTXYPlotSpace.h"
+#import "_CPTDataRangeIndex.h"
+#import "_CPTPointIndex.h"
 
 @interface CPTScatterPlot(Testing)
 
--(void)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount;
+-(NSRange)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount;
+-(NSRange)calculatePointsToDraw:(nonnull BOOL *)pointDrawFlags viewPoints:(nullable CGPoint *)viewPoints regions:(nullable uint8_t *)regions forPlotSpace:(nonnull CPTXYPlotSpace *)xyPlotSpace includeVisiblePointsOnly:(BOOL)visibleOnly numberOfPoints:(NSUInteger)dataCount;
+-(NSUInteger)decimateViewPoints:(nonnull const CGPoint *)viewPoints indexRange:(NSRange)indexRange toViewPoints:(nonnull CGPoint *)decimatedPoints;
+-(BOOL)isSortedField:(NSUInteger)fieldEnum;
+-(NSRange)indexRangeForSortedField:(NSUInteger)fieldEnum plotRange:(nonnull CPTPlotRange *)plotRange;
+-(NSUInteger)firstIndexOfSortedField:(NSUInteger)fieldEnum notLessThanValue:(double)value inIndexRange:(NSRange)indexRange;
+-(nullable _CPTDataRangeIndex *)rangeIndexForField:(NSUInteger)fieldEnum;
 -(void)setXValues:(nullable CPTNumberArray *)newValues;
 -(void)setYValues:(nullable CPTNumberArray *)newValues;
 
@@ -245,4 +256,711 @@
     free(drawFlags);
 }
 
+-(void)testCalculatePointsToDrawSortedXValues
+{
+    const NSUInteger count         = 100;
+    CPTMutableNumberArray *xValues = [NSMutableArray arrayWithCapacity:count];
+    CPTMutableNumberArray *yValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        [xValues addObject:@((double)i * 0.02)];
+        [yValues addObject:@0.5];
+    }
+
+    [self.plot setXValues:xValues];
+    [self.plot setYValues:yValues];
+
+    BOOL *drawFlags = calloc(count, sizeof(BOOL));
+
+    NSRange indexRange = [self.plot calculatePointsToDraw:drawFlags forPlotSpace:self.plotSpace includeVisiblePointsOnly:NO numberOfPoints:count];
+
+    XCTAssertEqual(indexRange.location, (NSUInteger)0, @"First classified record");
+    XCTAssertEqual(indexRange.length, (NSUInteger)52, @"Number of classified records");
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        XCTAssertEqual(drawFlags[i], (BOOL)(i <= 51), @"Test that in range points and the first point past the range are drawn (%@).", xValues[i]);
+    }
+
+    memset(drawFlags, NO, count * sizeof(BOOL));
+    [self.plot calculatePointsToDraw:drawFlags forPlotSpace:self.plotSpace includeVisiblePointsOnly:YES numberOfPoints:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        XCTAssertEqual(drawFlags[i], (BOOL)(i <= 50), @"Test that only in range points are drawn (%@).", xValues[i]);
+    }
+
+    free(drawFlags);
+}
+
+-(void)testCalculatePointsToDrawWithViewPoints
+{
+    CPTNumberArray *xValues = @[@(-0.1), @1.1, @0.9, @0.5, @(NAN), @0.4, @0.3, @(-0.2), @(-0.3)];
+    CPTNumberArray *yValues = @[@0.5, @0.5, @0.5, @2.0, @0.5, @(NAN), @0.5, @0.5, @0.5];
+    NSUInteger count        = xValues.count;
+
+    [self.plot setXValues:xValues];
+    [self.plot setYValues:yValues];
+
+    BOOL *expected      = calloc(count, sizeof(BOOL));
+    BOOL *drawFlags     = calloc(count, sizeof(BOOL));
+    uint8_t *regions    = calloc(count, sizeof(uint8_t));
+    CGPoint *viewPoints = calloc(count, sizeof(CGPoint));
+
+    for ( NSUInteger v = 0; v < 2; v++ ) {
+        BOOL visibleOnly = (v == 1);
+
+        memset(expected, NO, count * sizeof(BOOL));
+        [self.plot calculatePointsToDraw:expected forPlotSpace:self.plotSpace includeVisiblePointsOnly:visibleOnly numberOfPoints:count];
+
+        memset(drawFlags, NO, count * sizeof(BOOL));
+        NSRange indexRange = [self.plot calculatePointsToDraw:drawFlags
+                                                   viewPoints:viewPoints
+                                                      regions:regions
+                                                 forPlotSpace:self.plotSpace
+                                     includeVisiblePointsOnly:visibleOnly
+                                               numberOfPoints:count];
+
+        XCTAssertEqual(indexRange.length, count, @"Number of classified records");
+
+        for ( NSUInteger i = 0; i < count; i++ ) {
+            XCTAssertEqual(drawFlags[i], expected[i], @"Draw flag %lu (visible only = %d)", (unsigned long)i, visibleOnly);
+
+            BOOL hasValues = !isnan(xValues[i].doubleValue) && !isnan(yValues[i].doubleValue);
+            XCTAssertEqual((BOOL) !isnan(viewPoints[i].x), (BOOL)(drawFlags[i] && hasValues), @"View point %lu (visible only = %d)", (unsigned long)i, visibleOnly);
+        }
+    }
+
+    free(expected);
+    free(drawFlags);
+    free(regions);
+    free(viewPoints);
+}
+
+-(void)testPlotRangeForFieldMatchesLinearScan
+{
+    const NSUInteger count         = 1000;
+    CPTMutableNumberArray *xValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        if ( i % 97 == 0 ) {
+            [xValues addObject:@(NAN)];
+        }
+        else {
+            [xValues addObject:@(sin((double)i) * (double)i)];
+        }
+    }
+
+    [self.plot setXValues:xValues];
+
+    NSRange ranges[] = {
+        { 0, count }, { 0, 1 }, { 5, 10 }, { 63, 2 }, { 64, 64 }, { 100, 700 }, { 999, 1 }, { 97, 1 }
+    };
+
+    for ( NSUInteger r = 0; r < sizeof(ranges) / sizeof(NSRange); r++ ) {
+        [self checkPlotRangeForRecordIndexRange:ranges[r] values:xValues];
+    }
+
+    // remove from the front, middle, and end of the cache
+    [self.plot deleteDataInIndexRange:NSMakeRange(0, 70)];
+    [xValues removeObjectsInRange:NSMakeRange(0, 70)];
+    [self checkPlotRangeForRecordIndexRange:NSMakeRange(0, xValues.count) values:xValues];
+    [self checkPlotRangeForRecordIndexRange:NSMakeRange(10, 300) values:xValues];
+
+    [self.plot deleteDataInIndexRange:NSMakeRange(200, 300)];
+    [xValues removeObjectsInRange:NSMakeRange(200, 300)];
+    [self checkPlotRangeForRecordIndexRange:NSMakeRange(0, xValues.count) values:xValues];
+    [self checkPlotRangeForRecordIndexRange:NSMakeRange(150, 100) values:xValues];
+
+    [self.plot deleteDataInIndexRange:NSMakeRange(xValues.count - 5, 5)];
+    [xValues removeObjectsInRange:NSMakeRange(xValues.count - 5, 5)];
+    [self checkPlotRangeForRecordIndexRange:NSMakeRange(0, xValues.count) values:xValues];
+}
+
+-(void)testPlotRangeForFieldAllNaN
+{
+    [self.plot setXValues:@[@(NAN), @(NAN), @(NAN)]];
+
+    XCTAssertNil([self.plot plotRangeForField:CPTScatterPlotFieldX], @"Range of NaN values");
+}
+
+-(void)testFloatCachePrecision
+{
+    CPTNumberArray *xValues = @[@(-0.1), @0.1, @0.35, @0.5, @(NAN), @0.7, @1.2];
+    CPTNumberArray *yValues = @[@0.5, @0.25, @0.5, @2.0, @0.5, @0.75, @0.5];
+    NSUInteger count        = xValues.count;
+
+    [self.plot setXValues:xValues];
+    [self.plot setYValues:yValues];
+
+    BOOL *expectedFlags         = calloc(count, sizeof(BOOL));
+    CGPoint *expectedViewPoints = calloc(count, sizeof(CGPoint));
+
+    [self.plot calculatePointsToDraw:expectedFlags
+                          viewPoints:expectedViewPoints
+                             regions:NULL
+                        forPlotSpace:self.plotSpace
+            includeVisiblePointsOnly:NO
+                      numberOfPoints:count];
+
+    self.plot.cachePrecision = CPTPlotCachePrecisionFloat;
+
+    XCTAssertTrue(self.plot.floatPrecisionCache, @"floatPrecisionCache");
+    XCTAssertFalse(self.plot.doublePrecisionCache, @"doublePrecisionCache");
+
+    CPTNumericData *xData = [self.plot cachedNumbersForField:CPTScatterPlotFieldX];
+    XCTAssertTrue(CPTDataTypeEqualToDataType(xData.dataType, self.plot.floatDataType), @"Cached x data type");
+    XCTAssertEqual(xData.length, count * sizeof(float), @"Cached x data length");
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        double value = xValues[i].doubleValue;
+        if ( isnan(value)) {
+            XCTAssertTrue(isnan([self.plot cachedDoubleForField:CPTScatterPlotFieldX recordIndex:i]), @"x value %lu", (unsigned long)i);
+        }
+        else {
+            XCTAssertEqual([self.plot cachedDoubleForField:CPTScatterPlotFieldX recordIndex:i], (double)(float)value, @"x value %lu", (unsigned long)i);
+        }
+    }
+
+    CPTPlotRange *xRange = [self.plot plotRangeForField:CPTScatterPlotFieldX];
+    XCTAssertEqualWithAccuracy(xRange.locationDouble, (double)(-0.1f), 1.0e-9, @"x range location");
+    XCTAssertEqualWithAccuracy(xRange.endDouble, (double)1.2f, 1.0e-9, @"x range end");
+
+    BOOL *drawFlags     = calloc(count, sizeof(BOOL));
+    CGPoint *viewPoints = calloc(count, sizeof(CGPoint));
+
+    [self.plot calculatePointsToDraw:drawFlags
+                          viewPoints:viewPoints
+                             regions:NULL
+                        forPlotSpace:self.plotSpace
+            includeVisiblePointsOnly:NO
+                      numberOfPoints:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        XCTAssertEqual(drawFlags[i], expectedFlags[i], @"Draw flag %lu", (unsigned long)i);
+        if ( isnan(expectedViewPoints[i].x)) {
+            XCTAssertTrue(isnan(viewPoints[i].x), @"View point %lu", (unsigned long)i);
+        }
+        else {
+            XCTAssertEqualWithAccuracy(viewPoints[i].x, expectedViewPoints[i].x, CPTFloat(1.0e-4), @"View point %lu x", (unsigned long)i);
+            XCTAssertEqualWithAccuracy(viewPoints[i].y, expectedViewPoints[i].y, CPTFloat(1.0e-4), @"View point %lu y", (unsigned long)i);
+        }
+    }
+
+    free(expectedFlags);
+    free(expectedViewPoints);
+    free(drawFlags);
+    free(viewPoints);
+}
+
+-(void)testDecimateViewPointsKeepsColumnExtremes
+{
+    const NSUInteger count = 9;
+    CGPoint viewPoints[9]  = {
+        CPTPointMake(0.1, 5.0), CPTPointMake(0.2, 1.0), CPTPointMake(0.3, 9.0), CPTPointMake(0.4, 4.0), CPTPointMake(0.5, 3.0), // column 0
+        CPTPointMake(1.2, 2.0),                                                                                               // column 1
+        CPTPointMake(NAN, NAN), CPTPointMake(NAN, NAN),                                                                       // gap
+        CPTPointMake(2.5, 7.0)                                                                                                // column 2
+    };
+    CGPoint decimated[9];
+
+    self.plot.contentsScale = CPTFloat(1.0);
+
+    NSUInteger decimatedCount = [self.plot decimateViewPoints:viewPoints indexRange:NSMakeRange(0, count) toViewPoints:decimated];
+
+    XCTAssertEqual(decimatedCount, (NSUInteger)7, @"Number of decimated points");
+
+    // first, low, high, last of column 0
+    XCTAssertEqual(decimated[0].y, CPTFloat(5.0), @"First point of column");
+    XCTAssertEqual(decimated[1].y, CPTFloat(1.0), @"Lowest point of column");
+    XCTAssertEqual(decimated[2].y, CPTFloat(9.0), @"Highest point of column");
+    XCTAssertEqual(decimated[3].y, CPTFloat(3.0), @"Last point of column");
+
+    XCTAssertEqual(decimated[4].x, CPTFloat(1.2), @"Single point column");
+    XCTAssertTrue(isnan(decimated[5].x), @"Gap is preserved");
+    XCTAssertEqual(decimated[6].x, CPTFloat(2.5), @"Point after gap");
+}
+
+-(void)testLevelOfDetailIndicesKeepBucketExtremes
+{
+    const NSUInteger count         = 4096;
+    CPTMutableNumberArray *yValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        [yValues addObject:@(sin((double)i) * (double)i)];
+    }
+
+    [self.plot setYValues:yValues];
+
+    _CPTDataRangeIndex *rangeIndex = [self.plot rangeIndexForField:CPTScatterPlotFieldY];
+    CPTMutableNumericData *yData   = [self.plot cachedNumbersForField:CPTScatterPlotFieldY];
+
+    // 16 buckets of 256 samples each
+    const NSUInteger bucketCount = 16;
+    const NSUInteger bucketSize  = count / bucketCount;
+    NSMutableData *indexBuffer   = [NSMutableData data];
+    NSUInteger indexCount        = 0;
+
+    for ( NSUInteger bucket = 0; bucket < bucketCount; bucket++ ) {
+        indexCount = [rangeIndex appendLevelOfDetailIndicesToBuffer:indexBuffer count:indexCount forData:yData inIndexRange:NSMakeRange(bucket * bucketSize, bucketSize)];
+    }
+
+    const NSUInteger *indices = (const NSUInteger *)indexBuffer.bytes;
+
+    XCTAssertTrue(indexCount <= 4 * bucketCount, @"Number of level of detail indices");
+
+    for ( NSUInteger i = 1; i < indexCount; i++ ) {
+        XCTAssertTrue(indices[i] > indices[i - 1], @"Indices are in ascending order");
+    }
+
+    NSMutableIndexSet *indexSet = [NSMutableIndexSet indexSet];
+    for ( NSUInteger i = 0; i < indexCount; i++ ) {
+        [indexSet addIndex:indices[i]];
+    }
+
+    for ( NSUInteger bucket = 0; bucket < bucketCount; bucket++ ) {
+        NSUInteger minIndex = bucket * bucketSize;
+        NSUInteger maxIndex = bucket * bucketSize;
+
+        for ( NSUInteger i = bucket * bucketSize; i < (bucket + 1) * bucketSize; i++ ) {
+            if ( yValues[i].doubleValue < yValues[minIndex].doubleValue ) {
+                minIndex = i;
+            }
+            if ( yValues[i].doubleValue > yValues[maxIndex].doubleValue ) {
+                maxIndex = i;
+            }
+        }
+
+        XCTAssertTrue([indexSet containsIndex:bucket * bucketSize], @"First sample of bucket %lu", (unsigned long)bucket);
+        XCTAssertTrue([indexSet containsIndex:minIndex], @"Smallest sample of bucket %lu", (unsigned long)bucket);
+        XCTAssertTrue([indexSet containsIndex:maxIndex], @"Largest sample of bucket %lu", (unsigned long)bucket);
+        XCTAssertTrue([indexSet containsIndex:(bucket + 1) * bucketSize - 1], @"Last sample of bucket %lu", (unsigned long)bucket);
+    }
+}
+
+-(void)testLevelOfDetailIndicesKeepGaps
+{
+    const NSUInteger count         = 1000;
+    CPTMutableNumberArray *yValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        BOOL gap = ((i >= 300) && (i < 310)) || (i >= 700);
+        [yValues addObject:gap ? @(NAN) : @(i)];
+    }
+
+    [self.plot setYValues:yValues];
+
+    _CPTDataRangeIndex *rangeIndex = [self.plot rangeIndexForField:CPTScatterPlotFieldY];
+    CPTMutableNumericData *yData   = [self.plot cachedNumbersForField:CPTScatterPlotFieldY];
+
+    XCTAssertEqual([rangeIndex numberOfNaNValuesForData:yData inIndexRange:NSMakeRange(0, count)], (NSUInteger)310, @"NaN values");
+    XCTAssertEqual([rangeIndex numberOfNaNValuesForData:yData inIndexRange:NSMakeRange(5, 300)], (NSUInteger)5, @"NaN values at the end of a range");
+    XCTAssertEqual([rangeIndex numberOfNaNValuesForData:yData inIndexRange:NSMakeRange(310, 390)], (NSUInteger)0, @"No NaN values");
+
+    // a bucket with a gap in the middle, followed by a bucket that ends in a gap and one that is all gap
+    NSMutableData *indexBuffer = [NSMutableData data];
+    NSUInteger indexCount      = 0;
+
+    indexCount = [rangeIndex appendLevelOfDetailIndicesToBuffer:indexBuffer count:indexCount forData:yData inIndexRange:NSMakeRange(0, 400)];
+    indexCount = [rangeIndex appendLevelOfDetailIndicesToBuffer:indexBuffer count:indexCount forData:yData inIndexRange:NSMakeRange(400, 400)];
+    indexCount = [rangeIndex appendLevelOfDetailIndicesToBuffer:indexBuffer count:indexCount forData:yData inIndexRange:NSMakeRange(800, 200)];
+
+    const NSUInteger expected[] = { 0, 299, NSNotFound, 310, 399, 400, 699, NSNotFound };
+    const NSUInteger *indices   = (const NSUInteger *)indexBuffer.bytes;
+
+    XCTAssertEqual(indexCount, sizeof(expected) / sizeof(expected[0]), @"Number of level of detail indices");
+    for ( NSUInteger i = 0; i < MIN(indexCount, sizeof(expected) / sizeof(expected[0])); i++ ) {
+        XCTAssertEqual(indices[i], expected[i], @"Index %lu", (unsigned long)i);
+    }
+}
+
+-(void)testFirstIndexOfSortedField
+{
+    CPTNumberArray *xValues = @[@0.0, @0.0, @1.0, @2.0, @2.0, @2.0, @5.0];
+
+    [self.plot setXValues:xValues];
+
+    NSRange allRecords = NSMakeRange(0, xValues.count);
+
+    XCTAssertEqual([self.plot firstIndexOfSortedField:CPTScatterPlotFieldX notLessThanValue:-1.0 inIndexRange:allRecords], (NSUInteger)0, @"Below every value");
+    XCTAssertEqual([self.plot firstIndexOfSortedField:CPTScatterPlotFieldX notLessThanValue:0.0 inIndexRange:allRecords], (NSUInteger)0, @"Repeated first value");
+    XCTAssertEqual([self.plot firstIndexOfSortedField:CPTScatterPlotFieldX notLessThanValue:0.5 inIndexRange:allRecords], (NSUInteger)2, @"Between values");
+    XCTAssertEqual([self.plot firstIndexOfSortedField:CPTScatterPlotFieldX notLessThanValue:2.0 inIndexRange:allRecords], (NSUInteger)3, @"Repeated value");
+    XCTAssertEqual([self.plot firstIndexOfSortedField:CPTScatterPlotFieldX notLessThanValue:4.0 inIndexRange:allRecords], (NSUInteger)6, @"Wide spacing");
+    XCTAssertEqual([self.plot firstIndexOfSortedField:CPTScatterPlotFieldX notLessThanValue:6.0 inIndexRange:allRecords], (NSUInteger)7, @"Above every value");
+    XCTAssertEqual([self.plot firstIndexOfSortedField:CPTScatterPlotFieldX notLessThanValue:0.0 inIndexRange:NSMakeRange(4, 3)], (NSUInteger)4, @"Search starts at the range");
+}
+
+-(void)testRangeIndexDetectsSortedData
+{
+    const NSUInteger count         = 200;
+    CPTMutableNumberArray *xValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        [xValues addObject:@(i)];
+    }
+
+    [self.plot setXValues:xValues];
+    XCTAssertTrue([self.plot rangeIndexForField:CPTScatterPlotFieldX].sorted, @"Ascending values");
+
+    xValues[150] = @(-1.0);
+    [self.plot setXValues:xValues];
+    XCTAssertFalse([self.plot rangeIndexForField:CPTScatterPlotFieldX].sorted, @"One descending value");
+
+    [self.plot deleteDataInIndexRange:NSMakeRange(150, 1)];
+    XCTAssertTrue([self.plot rangeIndexForField:CPTScatterPlotFieldX].sorted, @"Descending value removed");
+
+    xValues[150] = @(NAN);
+    [self.plot setXValues:xValues];
+    XCTAssertFalse([self.plot rangeIndexForField:CPTScatterPlotFieldX].sorted, @"NaN value");
+}
+
+-(void)testRangeIndexReadsStridedSlice
+{
+    const NSUInteger rows = 500;
+    const NSUInteger cols = 3;
+
+    NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sizeof(double)];
+    double *samples     = (double *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < rows * cols; i++ ) {
+        samples[i] = sin((double)i) * (double)i;
+    }
+
+    CPTNumericData *matrix = [[CPTNumericData alloc] initWithData:data
+                                                         dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                            shape:@[@(rows), @(cols)]
+                                                        dataOrder:CPTDataOrderRowsFirst];
+
+    CPTNumericData *column = [matrix sliceForColumn:2];
+
+    _CPTDataRangeIndex *rangeIndex = [[_CPTDataRangeIndex alloc] init];
+    [rangeIndex rebuildWithData:column];
+
+    NSUInteger minIndex = NSNotFound;
+    NSUInteger maxIndex = NSNotFound;
+
+    XCTAssertTrue([rangeIndex getMinimumIndex:&minIndex maximumIndex:&maxIndex forData:column inIndexRange:NSMakeRange(10, 400)], @"Range found");
+    XCTAssertEqual(column.sampleStride, cols, @"The slice is read in place");
+
+    double minValue = (double)INFINITY;
+    double maxValue = -(double)INFINITY;
+
+    for ( NSUInteger i = 10; i < 410; i++ ) {
+        double value = samples[i * cols + 2];
+        minValue = MIN(minValue, value);
+        maxValue = MAX(maxValue, value);
+    }
+
+    XCTAssertEqual(samples[minIndex * cols + 2], minValue, @"Minimum");
+    XCTAssertEqual(samples[maxIndex * cols + 2], maxValue, @"Maximum");
+}
+
+-(void)testCachedStridedSliceIsContiguous
+{
+    const NSUInteger rows = 6;
+    const NSUInteger cols = 2;
+
+    NSMutableData *data = [NSMutableData dataWithLength:rows * cols * sizeof(double)];
+    double *samples     = (double *)data.mutableBytes;
+
+    for ( NSUInteger i = 0; i < rows * cols; i++ ) {
+        samples[i] = (double)i;
+    }
+
+    CPTNumericData *matrix = [[CPTNumericData alloc] initWithData:data
+                                                         dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                            shape:@[@(rows), @(cols)]
+                                                        dataOrder:CPTDataOrderRowsFirst];
+
+    [self.plot cacheNumbers:[matrix sliceForColumn:1] forField:CPTScatterPlotFieldX];
+
+    CPTNumericData *cachedNumbers = [self.plot cachedNumbersForField:CPTScatterPlotFieldX];
+
+    XCTAssertEqual(cachedNumbers.sampleStride, (NSUInteger)1, @"Cached samples are contiguous");
+    XCTAssertEqual(cachedNumbers.length, rows * sizeof(double), @"Cached length");
+
+    const double *cachedSamples = (const double *)cachedNumbers.bytes;
+
+    for ( NSUInteger i = 0; i < rows; i++ ) {
+        XCTAssertEqual(cachedSamples[i], (double)(i * cols + 1), @"Cached sample %lu", (unsigned long)i);
+    }
+}
+
+-(void)testRangeIndexFindsValuesInRange
+{
+    const NSUInteger count = 5000;
+
+    CPTMutableNumericData *data = [[CPTMutableNumericData alloc] initWithData:[NSMutableData dataWithLength:count * sizeof(double)]
+                                                                     dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), NSHostByteOrder())
+                                                                        shape:nil];
+    double *samples = (double *)data.mutableBytes;
+
+    srand48(23);
+
+    // a random walk, so whole blocks lie outside most windows
+    double value = 0.0;
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        value     += drand48() - 0.5;
+        samples[i] = (i % 97 == 0) ? (double)NAN : value;
+    }
+
+    _CPTDataRangeIndex *rangeIndex = [[_CPTDataRangeIndex alloc] init];
+    [rangeIndex rebuildWithData:data];
+
+    NSRange indexRange = NSMakeRange(37, count - 100);
+
+    for ( NSUInteger q = 0; q < 50; q++ ) {
+        double minimum = drand48() * 40.0 - 20.0;
+        double maximum = minimum + drand48() * 5.0;
+
+        NSMutableIndexSet *expected = [NSMutableIndexSet indexSet];
+        for ( NSUInteger i = indexRange.location; i < NSMaxRange(indexRange); i++ ) {
+            if ((samples[i] >= minimum) && (samples[i] <= maximum)) {
+                [expected addIndex:i];
+            }
+        }
+
+        NSMutableIndexSet *found = [NSMutableIndexSet indexSet];
+        [rangeIndex addIndicesOfValuesFromMinimum:minimum toMaximum:maximum toIndexSet:found forData:data inIndexRange:indexRange];
+
+        XCTAssertEqualObjects(found, expected, @"Values from %g to %g", minimum, maximum);
+    }
+}
+
+-(void)testIndexRangeForSortedField
+{
+    const NSUInteger count         = 100;
+    CPTMutableNumberArray *xValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        [xValues addObject:@(i)];
+    }
+
+    [self.plot setXValues:xValues];
+
+    NSRange indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@10.0 length:@10.0]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)10, @"First index");
+    XCTAssertEqual(indexRange.length, (NSUInteger)11, @"Number of indices");
+
+    indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@10.5 length:@0.25]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)11, @"First index between values");
+    XCTAssertEqual(indexRange.length, (NSUInteger)0, @"Number of indices between values");
+
+    indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@(-5.0) length:@200.0]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)0, @"First index");
+    XCTAssertEqual(indexRange.length, count, @"Number of indices");
+
+    indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@200.0 length:@10.0]];
+    XCTAssertEqual(indexRange.location, count, @"First index");
+    XCTAssertEqual(indexRange.length, (NSUInteger)0, @"Number of indices");
+
+    // decimal values are compared exactly
+    self.plot.cachePrecision = CPTPlotCachePrecisionDecimal;
+    [self.plot setXValues:xValues];
+
+    indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@10.0 length:@10.0]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)10, @"First decimal index");
+    XCTAssertEqual(indexRange.length, (NSUInteger)11, @"Number of decimal indices");
+
+    // unsorted values are not searched unless the plot assumes they are sorted
+    [xValues exchangeObjectAtIndex:0 withObjectAtIndex:1];
+    self.plot.cachePrecision = CPTPlotCachePrecisionDouble;
+    [self.plot setXValues:xValues];
+
+    XCTAssertFalse([self.plot isSortedField:CPTScatterPlotFieldX], @"Unsorted x values");
+    indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@10.0 length:@10.0]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)NSNotFound, @"Unsorted values are not searched");
+
+    self.plot.assumesSortedXValues = YES;
+
+    XCTAssertTrue([self.plot isSortedField:CPTScatterPlotFieldX], @"Assumed sorted x values");
+    indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@10.0 length:@10.0]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)10, @"First index of assumed sorted values");
+    XCTAssertEqual(indexRange.length, (NSUInteger)11, @"Number of indices of assumed sorted values");
+}
+
+-(void)testImplicitXValues
+{
+    const NSUInteger count         = 100;
+    CPTMutableNumberArray *xValues = [NSMutableArray arrayWithCapacity:count];
+    CPTMutableNumberArray *yValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        [xValues addObject:@(10.0 + 0.5 * i)];
+        [yValues addObject:@((i % 7) / 7.0)];
+    }
+
+    [self.plot setImplicitValuesForField:CPTScatterPlotFieldX origin:@10.0 step:@0.5];
+    [self.plot setYValues:yValues];
+
+    XCTAssertTrue([self.plot hasImplicitValuesForField:CPTScatterPlotFieldX], @"Implicit x values");
+    XCTAssertFalse([self.plot hasImplicitValuesForField:CPTScatterPlotFieldY], @"Cached y values");
+    XCTAssertEqual(self.plot.cachedDataCount, count, @"Number of records");
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        XCTAssertEqual([self.plot cachedDoubleForField:CPTScatterPlotFieldX recordIndex:i], xValues[i].doubleValue, @"x value %lu", (unsigned long)i);
+    }
+
+    CPTNumericData *xData = [self.plot cachedNumbersForField:CPTScatterPlotFieldX];
+    XCTAssertEqual(xData.numberOfSamples, count, @"Materialized x values");
+    XCTAssertEqual(((const double *)xData.bytes)[count - 1], 59.5, @"Last materialized x value");
+
+    CPTPlotRange *xRange = [self.plot plotRangeForField:CPTScatterPlotFieldX];
+    XCTAssertEqual(xRange.locationDouble, 10.0, @"x range location");
+    XCTAssertEqual(xRange.endDouble, 59.5, @"x range end");
+
+    NSRange indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@20.0 length:@10.0]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)20, @"First index");
+    XCTAssertEqual(indexRange.length, (NSUInteger)21, @"Number of indices");
+
+    indexRange = [self.plot indexRangeForSortedField:CPTScatterPlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@0.0 length:@5.0]];
+    XCTAssertEqual(indexRange.location, (NSUInteger)0, @"First index");
+    XCTAssertEqual(indexRange.length, (NSUInteger)0, @"Number of indices");
+
+    // compare with the same values cached explicitly
+    CPTScatterPlot *explicitPlot = [CPTScatterPlot new];
+    explicitPlot.cachePrecision = CPTPlotCachePrecisionDouble;
+    [explicitPlot setXValues:xValues];
+    [explicitPlot setYValues:yValues];
+
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@20.0 length:@10.0];
+
+    BOOL *expectedFlags         = calloc(count, sizeof(BOOL));
+    CGPoint *expectedViewPoints = calloc(count, sizeof(CGPoint));
+    BOOL *drawFlags             = calloc(count, sizeof(BOOL));
+    CGPoint *viewPoints         = calloc(count, sizeof(CGPoint));
+
+    NSRange expectedRange = [explicitPlot calculatePointsToDraw:expectedFlags
+                                                     viewPoints:expectedViewPoints
+                                                        regions:NULL
+                                                   forPlotSpace:self.plotSpace
+                                       includeVisiblePointsOnly:NO
+                                                 numberOfPoints:count];
+
+    NSRange drawnRange = [self.plot calculatePointsToDraw:drawFlags
+                                               viewPoints:viewPoints
+                                                  regions:NULL
+                                             forPlotSpace:self.plotSpace
+                                 includeVisiblePointsOnly:NO
+                                           numberOfPoints:count];
+
+    XCTAssertTrue(NSEqualRanges(drawnRange, expectedRange), @"Drawn index range");
+
+    for ( NSUInteger i = drawnRange.location; i < NSMaxRange(drawnRange); i++ ) {
+        XCTAssertEqual(drawFlags[i], expectedFlags[i], @"Draw flag %lu", (unsigned long)i);
+        XCTAssertEqual(viewPoints[i].x, expectedViewPoints[i].x, @"View point %lu x", (unsigned long)i);
+        XCTAssertEqual(viewPoints[i].y, expectedViewPoints[i].y, @"View point %lu y", (unsigned long)i);
+    }
+
+    free(expectedFlags);
+    free(expectedViewPoints);
+    free(drawFlags);
+    free(viewPoints);
+}
+
+-(void)testImplicitXValuesKeepValuesWhenDeletingFromFront
+{
+    const NSUInteger count         = 20;
+    CPTMutableNumberArray *yValues = [NSMutableArray arrayWithCapacity:count];
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        [yValues addObject:@(i)];
+    }
+
+    [self.plot setImplicitValuesForField:CPTScatterPlotFieldX origin:@0.0 step:@2.0];
+    [self.plot setYValues:yValues];
+
+    [self.plot deleteDataInIndexRange:NSMakeRange(0, 5)];
+
+    XCTAssertEqual(self.plot.cachedDataCount, count - 5, @"Number of records");
+    XCTAssertEqual([self.plot cachedDoubleForField:CPTScatterPlotFieldX recordIndex:0], 10.0, @"First x value");
+    XCTAssertEqual([self.plot cachedDoubleForField:CPTScatterPlotFieldY recordIndex:0], 5.0, @"First y value");
+
+    CPTPlotRange *xRange = [self.plot plotRangeForField:CPTScatterPlotFieldX];
+    XCTAssertEqual(xRange.locationDouble, 10.0, @"x range location");
+    XCTAssertEqual(xRange.endDouble, 38.0, @"x range end");
+
+    [self.plot deleteDataInIndexRange:NSMakeRange(10, 5)];
+
+    XCTAssertEqual([self.plot cachedDoubleForField:CPTScatterPlotFieldX recordIndex:0], 10.0, @"First x value after deleting from the end");
+    XCTAssertTrue(isnan([self.plot cachedDoubleForField:CPTScatterPlotFieldX recordIndex:10]), @"x value past the end");
+}
+
+-(void)testPointIndexMatchesLinearScan
+{
+    const NSUInteger count = 500;
+
+    CGPoint *points = calloc(count, sizeof(CGPoint));
+    BOOL *included  = calloc(count, sizeof(BOOL));
+
+    srand48(17);
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        // coarse coordinates give many duplicate points and ties
+        points[i]   = CPTPointMake(floor(drand48() * 20.0), floor(drand48() * 20.0));
+        included[i] = (i % 7 != 0);
+    }
+    points[3] = CPTPointMake(NAN, 1.0);
+
+    NSRange indexRange         = NSMakeRange(10, count - 20);
+    _CPTPointIndex *pointIndex = [[_CPTPointIndex alloc] initWithPoints:points includedPoints:included indexRange:indexRange];
+
+    for ( NSUInteger q = 0; q < 200; q++ ) {
+        CGPoint queryPoint = CPTPointMake(drand48() * 24.0 - 2.0, drand48() * 24.0 - 2.0);
+
+        if ( q % 4 == 0 ) {
+            queryPoint = CPTPointMake(round(queryPoint.x), round(queryPoint.y));
+        }
+
+        NSUInteger expected     = NSNotFound;
+        CGFloat minimumDistance = CPTFloat(INFINITY);
+
+        for ( NSUInteger i = indexRange.location; i < NSMaxRange(indexRange); i++ ) {
+            if ( included[i] && !isnan(points[i].x)) {
+                CGFloat dx       = points[i].x - queryPoint.x;
+                CGFloat dy       = points[i].y - queryPoint.y;
+                CGFloat distance = dx * dx + dy * dy;
+                if ( distance < minimumDistance ) {
+                    minimumDistance = distance;
+                    expected        = i;
+                }
+            }
+        }
+
+        XCTAssertEqual([pointIndex indexOfPointClosestToPoint:queryPoint], expected, @"Closest point to %@", CPTStringFromPoint(queryPoint));
+    }
+
+    _CPTPointIndex *emptyIndex = [[_CPTPointIndex alloc] init];
+    XCTAssertEqual([emptyIndex indexOfPointClosestToPoint:CGPointZero], (NSUInteger)NSNotFound, @"Empty index");
+
+    free(points);
+    free(included);
+}
+
+#pragma mark -
+#pragma mark Private Methods
+
+-(void)checkPlotRangeForRecordIndexRange:(NSRange)indexRange values:(nonnull CPTNumberArray *)values
+{
+    double min = (double)INFINITY;
+    double max = -(double)INFINITY;
+
+    for ( NSUInteger i = indexRange.location; i < NSMaxRange(indexRange); i++ ) {
+        double value = values[i].doubleValue;
+        if ( !isnan(value)) {
+            min = MIN(min, value);
+            max = MAX(max, value);
+        }
+    }
+
+    CPTPlotRange *range = [self.plot plotRangeForField:CPTScatterPlotFieldX recordIndexRange:indexRange];
+
+    if ( max >= min ) {
+        XCTAssertEqual(range.locationDouble, min, @"Range location for records %@", NSStringFromRange(indexRange));
+        XCTAssertEqualWithAccuracy(range.endDouble, max, 1.0e-9 * MAX(fabs(max), 1.0), @"Range end for records %@", NSStringFromRange(indexRange));
+    }
+    else {
+        XCTAssertNil(range, @"Range for records %@", NSStringFromRange(indexRange));
+    }
+}
+
 @end
@@ -1,5 +1,6 @@
 #import "CPTTextLayer.h"
 
+#import "_CPTTextCache.h"
 #import "CPTPlatformSpecificCategories.h"
 #import "CPTShadow.h"
 #import "CPTTextStylePlatformSpecific.h"
@@ -315,12 +316,14 @@ const CGFloat kCPTTextLayerMarginWidth = CPTFloat(2.0);
     NSString *myText = self.text;
 
     if ( myText.length > 0 ) {
+        _CPTTextCache *textCache = [_CPTTextCache sharedCache];
+
         NSAttributedString *styledText = self.attributedText;
         if ( styledText.length > 0 ) {
-            textSize = [styledText sizeAsDrawn];
+            textSize = [textCache sizeOfAttributedText:styledText];
         }
         else {
-            textSize = [myText sizeWithTextStyle:self.textStyle];
+            textSize = [textCache sizeOfText:myText style:self.textStyle];
         }
 
         // Add small margin
@@ -378,6 +381,27 @@ const CGFloat kCPTTextLayerMarginWidth = CPTFloat(2.0);
     if ( myText.length > 0 ) {
         [super renderAsVectorInContext:context];
 
+        // When drawing into the layer, reuse a bitmap of the same text drawn earlier.
+        // Vector output, such as PDF, always draws the glyphs.
+        if ( self.useFastRendering ) {
+            CGRect textRect = CGRectInset(self.bounds, kCPTTextLayerMarginWidth, kCPTTextLayerMarginWidth);
+            textRect.origin.x    += self.paddingLeft;
+            textRect.origin.y    += self.paddingBottom;
+            textRect.size.width  -= self.paddingLeft + self.paddingRight;
+            textRect.size.height -= self.paddingTop + self.paddingBottom;
+
+            CGImageRef textImage = [[_CPTTextCache sharedCache] newImageOfText:myText
+                                                                attributedText:self.attributedText
+                                                                         style:self.textStyle
+                                                                          size:textRect.size
+                                                                         scale:self.contentsScale];
+            if ( textImage ) {
+                CGContextDrawImage(context, textRect, textImage);
+                CGImageRelease(textImage);
+                return;
+            }
+        }
+
 #if TARGET_OS_SIMULATOR || TARGET_OS_IPHONE
         CGContextSaveGState(context);
         CGContextTranslateCTM(context, CPTFloat(0.0), self.bounds.size.height);
@@ -0,0 +1,48 @@
+#import "CPTTradingRangePlot.h"
+
+@class CPTNumericData;
+
+@interface CPTTradingRangeDataSource : NSObject<CPTTradingRangePlotDataSource>
+
+@property (nonatomic, readonly, nonnull) CPTTradingRangePlot *dataPlot;
+
+/// @name Ticks
+/// @{
+@property (nonatomic, readonly, nonnull) CPTNumericData *tickTimes;
+@property (nonatomic, readonly, nonnull) CPTNumericData *tickPrices;
+@property (nonatomic, readonly, nonnull) CPTNumericData *tickVolumes;
+@property (nonatomic, readonly) NSUInteger numberOfTicks;
+/// @}
+
+/// @name Buckets
+/// @{
+@property (nonatomic, readwrite) CGFloat resolution;
+@property (nonatomic, readwrite, copy, nullable) CPTNumberArray *bucketWidths;
+@property (nonatomic, readwrite) double bucketOrigin;
+@property (nonatomic, readonly) double bucketWidth;
+@property (nonatomic, readonly) NSUInteger numberOfBuckets;
+/// @}
+
+/// @name Factory Methods
+/// @{
++(nonnull instancetype)dataSourceForPlot:(nonnull CPTTradingRangePlot *)plot NS_SWIFT_NAME(init(for:));
+/// @}
+
+/// @name Initialization
+/// @{
+-(nonnull instancetype)initForPlot:(nonnull CPTTradingRangePlot *)plot NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(forPlot:));
+/// @}
+
+/// @name Adding and Removing Ticks
+/// @{
+-(void)appendTickWithTime:(double)time price:(double)price volume:(double)volume;
+-(void)appendTicksWithTimes:(nonnull const double *)times prices:(nonnull const double *)prices volumes:(nullable const double *)volumes count:(NSUInteger)count;
+-(void)removeAllTicks;
+/// @}
+
+/// @name Bucket Values
+/// @{
+-(double)volumeForBucketAtIndex:(NSUInteger)idx;
+/// @}
+
+@end
@@ -0,0 +1,911 @@
+#import "CPTTradingRangeDataSource.h"
+
+#import "CPTExceptions.h"
+#import "CPTMutableNumericData.h"
+#import "CPTPlotRange.h"
+#import "CPTUtilities.h"
+#import "CPTXYPlotSpace.h"
+#import "tgmath.h"
+
+/// @cond
+
+static void *CPTTradingRangeDataSourceKVOContext = (void *)&CPTTradingRangeDataSourceKVOContext;
+
+static const NSUInteger kCPTTradingRangeDataSourceMaximumLevelBuckets = 65536; // larger levels are aggregated for the visible window only
+static const NSUInteger kCPTTradingRangeDataSourceMaximumLevels       = 8;     // bucket widths kept in the level cache
+
+/**
+ *  @internal
+ *  @brief The aggregated values of one time bucket.
+ **/
+typedef struct _CPTTradingRangeBucket {
+    int64_t number; ///< The bucket number. The bucket starts at @ref CPTTradingRangeDataSource::bucketOrigin + number * width.
+    double  open;   ///< The price of the first tick in the bucket.
+    double  high;   ///< The highest price in the bucket.
+    double  low;    ///< The lowest price in the bucket.
+    double  close;  ///< The price of the last tick in the bucket.
+    double  volume; ///< The total volume of the ticks in the bucket.
+}
+CPTTradingRangeBucket;
+
+static CPTTradingRangeBucket *__nonnull CPTTradingRangeNewBucket(NSMutableData *__nonnull buckets, NSUInteger idx);
+static NSUInteger CPTTradingRangeAggregateTicks(NSMutableData *__nonnull buckets, const double *__nonnull times, const double *__nonnull prices, const double *__nullable volumes, NSUInteger count, double origin, double width);
+static NSUInteger CPTTradingRangeAggregateBuckets(NSMutableData *__nonnull buckets, const CPTTradingRangeBucket *__nonnull sourceBuckets, NSUInteger count, int64_t factor);
+
+@interface CPTTradingRangeDataSource()
+
+@property (nonatomic, readwrite, nonnull) CPTTradingRangePlot *dataPlot;
+@property (nonatomic, readwrite, strong, nonnull) CPTMutableNumericData *times;
+@property (nonatomic, readwrite, strong, nonnull) CPTMutableNumericData *prices;
+@property (nonatomic, readwrite, strong, nonnull) CPTMutableNumericData *volumes;
+@property (nonatomic, readwrite) double bucketWidth;
+@property (nonatomic, readwrite, strong, nonnull) NSMutableDictionary<NSNumber *, NSMutableData *> *levels;
+@property (nonatomic, readwrite, strong, nonnull) NSMutableArray<NSNumber *> *levelWidths;
+@property (nonatomic, readwrite, strong, nullable) NSMutableData *buckets;
+@property (nonatomic, readwrite, strong, nullable) CPTPlotRange *windowRange;
+
+-(void)plotBoundsChanged;
+-(void)plotSpaceChanged;
+-(void)updateBuckets;
+-(double)bucketWidthForRangeLength:(double)rangeLength pixelWidth:(CGFloat)pixelWidth;
+-(nonnull NSMutableData *)levelForWidth:(double)width;
+-(nonnull NSMutableData *)bucketsForWidth:(double)width inRange:(nonnull CPTPlotRange *)range;
+-(NSUInteger)lowerBoundForTime:(double)time;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/**
+ *  @brief A datasource class that aggregates raw trades into open, high, low, and close values for a trading range plot.
+ *
+ *  Each trade, or tick, has a time, a price, and a volume. The ticks are stored in time order and grouped into
+ *  buckets of equal width. The bucket width is chosen from the length of the
+ *  @link CPTXYPlotSpace::xRange xRange @endlink of the plot space and the width of the plot so that
+ *  neighboring candlesticks are at least @ref resolution pixels apart.
+ *
+ *  Buckets for the most recently used widths are cached. A coarser bucket width is aggregated from a finer
+ *  cached one that divides it evenly instead of from the ticks, so zooming out only reads the ticks once.
+ *  When a bucket width would produce a very large number of buckets, only the buckets near the
+ *  visible range are aggregated. Newly appended ticks update the last bucket or add new ones
+ *  without reloading the rest of the plot.
+ *
+ *  The x value of each bucket is the center of the bucket. Buckets without any ticks are skipped.
+ **/
+@implementation CPTTradingRangeDataSource
+
+/** @property nonnull CPTTradingRangePlot *dataPlot
+ *  @brief The plot that will display the aggregated values.
+ **/
+@synthesize dataPlot;
+
+/** @property nonnull CPTNumericData *tickTimes
+ *  @brief The times of the ticks in ascending order. The values are stored as @double.
+ **/
+@dynamic tickTimes;
+
+/** @property nonnull CPTNumericData *tickPrices
+ *  @brief The prices of the ticks. The values are stored as @double.
+ **/
+@dynamic tickPrices;
+
+/** @property nonnull CPTNumericData *tickVolumes
+ *  @brief The volumes of the ticks. The values are stored as @double.
+ **/
+@dynamic tickVolumes;
+
+/** @property NSUInteger numberOfTicks
+ *  @brief The number of ticks.
+ **/
+@dynamic numberOfTicks;
+
+/** @property CGFloat resolution
+ *  @brief The minimum number of pixels between neighboring buckets. Default is @num{5.0}.
+ **/
+@synthesize resolution;
+
+/** @property nullable CPTNumberArray *bucketWidths
+ *  @brief The bucket widths that can be chosen, for example one minute, five minutes, one hour, and one day.
+ *
+ *  The smallest width that keeps the buckets at least @ref resolution pixels apart is used, or the largest
+ *  width if none of them do. If @nil (the default), the bucket width is a
+ *  power of ten multiplied by one, two, or five.
+ **/
+@synthesize bucketWidths;
+
+/** @property double bucketOrigin
+ *  @brief The time where the bucket boundaries are anchored. Default is @num{0.0}.
+ *
+ *  Buckets start at this time plus whole multiples of the bucket width.
+ **/
+@synthesize bucketOrigin;
+
+/** @property double bucketWidth
+ *  @brief The current bucket width. It is @num{0.0} until the plot has a plot space and a non-zero width.
+ **/
+@synthesize bucketWidth;
+
+/** @property NSUInteger numberOfBuckets
+ *  @brief The number of buckets supplied to the plot.
+ **/
+@dynamic numberOfBuckets;
+
+@synthesize times;
+@synthesize prices;
+@synthesize volumes;
+@synthesize levels;
+@synthesize levelWidths;
+@synthesize buckets;
+@synthesize windowRange;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Creates and returns a new CPTTradingRangeDataSource instance initialized with the provided plot.
+ *  @param plot The plot that will display the aggregated values.
+ *  @return A new CPTTradingRangeDataSource instance initialized with the provided plot.
+ **/
++(nonnull instancetype)dataSourceForPlot:(nonnull CPTTradingRangePlot *)plot
+{
+    return [[self alloc] initForPlot:plot];
+}
+
+/** @brief Initializes a newly allocated CPTTradingRangeDataSource object with the provided plot.
+ *
+ *  The new datasource becomes the datasource of the plot.
+ *
+ *  @param plot The plot that will display the aggregated values.
+ *  @return The initialized CPTTradingRangeDataSource object.
+ **/
+-(nonnull instancetype)initForPlot:(nonnull CPTTradingRangePlot *)plot
+{
+    NSParameterAssert([plot isKindOfClass:[CPTTradingRangePlot class]]);
+
+    if ((self = [super init])) {
+        CPTNumericDataType doubleType = CPTDataType(CPTFloatingPointDataType, sizeof(double), CFByteOrderGetCurrent());
+
+        dataPlot     = plot;
+        times        = [[CPTMutableNumericData alloc] initWithData:[NSData data] dataType:doubleType shape:@[@0]];
+        prices       = [[CPTMutableNumericData alloc] initWithData:[NSData data] dataType:doubleType shape:@[@0]];
+        volumes      = [[CPTMutableNumericData alloc] initWithData:[NSData data] dataType:doubleType shape:@[@0]];
+        resolution   = CPTFloat(5.0);
+        bucketWidths = nil;
+        bucketOrigin = 0.0;
+        bucketWidth  = 0.0;
+        levels       = [[NSMutableDictionary alloc] init];
+        levelWidths  = [[NSMutableArray alloc] init];
+        buckets      = nil;
+        windowRange  = nil;
+
+        plot.cachePrecision = CPTPlotCachePrecisionDouble;
+
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(plotBoundsChanged)
+                                                     name:CPTLayerBoundsDidChangeNotification
+                                                   object:plot];
+        [plot addObserver:self
+               forKeyPath:@"plotSpace"
+                  options:NSKeyValueObservingOptionNew | NSKeyValueObservingOptionOld | NSKeyValueObservingOptionInitial
+                  context:CPTTradingRangeDataSourceKVOContext];
+
+        plot.dataSource = self;
+    }
+    return self;
+}
+
+/// @cond
+
+// plot is required; this will fail the assertion in -initForPlot:
+-(nonnull instancetype)init
+{
+    [NSException raise:CPTException format:@"%@ must be initialized with a plot.", NSStringFromClass([self class])];
+    return [self initForPlot:[CPTTradingRangePlot layer]];
+}
+
+-(void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+
+    [dataPlot removeObserver:self forKeyPath:@"plotSpace" context:CPTTradingRangeDataSourceKVOContext];
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Ticks
+
+/** @brief Adds a tick after the existing ticks.
+ *  @param time The time of the tick. Must not be earlier than the last tick.
+ *  @param price The price of the tick.
+ *  @param volume The volume of the tick.
+ **/
+-(void)appendTickWithTime:(double)time price:(double)price volume:(double)volume
+{
+    [self appendTicksWithTimes:&time prices:&price volumes:&volume count:1];
+}
+
+/** @brief Adds ticks after the existing ticks.
+ *
+ *  The buckets that contain the new ticks are updated, and only those records are reloaded in the plot.
+ *
+ *  @param newTimes The times of the ticks. They must be in ascending order and must not be earlier than the last tick.
+ *  @param newPrices The prices of the ticks.
+ *  @param newVolumes The volumes of the ticks. If @NULL, each tick has a volume of zero.
+ *  @param count The number of ticks.
+ **/
+-(void)appendTicksWithTimes:(nonnull const double *)newTimes prices:(nonnull const double *)newPrices volumes:(nullable const double *)newVolumes count:(NSUInteger)count
+{
+    NSParameterAssert(newTimes);
+    NSParameterAssert(newPrices);
+
+    if ( count == 0 ) {
+        return;
+    }
+
+    CPTMutableNumericData *timeData   = self.times;
+    CPTMutableNumericData *priceData  = self.prices;
+    CPTMutableNumericData *volumeData = self.volumes;
+
+    NSUInteger oldTickCount = timeData.numberOfSamples;
+
+    double lastTime = (oldTickCount > 0) ? ((const double *)timeData.bytes)[oldTickCount - 1] : -(double)INFINITY;
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        if ( !(newTimes[i] >= lastTime)) {
+            [NSException raise:CPTException format:@"Ticks must be appended in ascending time order."];
+        }
+        lastTime = newTimes[i];
+    }
+
+    [timeData insertSamplesAtIndex:oldTickCount numberOfSamples:count];
+    [priceData insertSamplesAtIndex:oldTickCount numberOfSamples:count];
+    [volumeData insertSamplesAtIndex:oldTickCount numberOfSamples:count];
+
+    memcpy((double *)timeData.mutableBytes + oldTickCount, newTimes, count * sizeof(double));
+    memcpy((double *)priceData.mutableBytes + oldTickCount, newPrices, count * sizeof(double));
+    if ( newVolumes ) {
+        memcpy((double *)volumeData.mutableBytes + oldTickCount, newVolumes, count * sizeof(double));
+    }
+
+    const double *appendedVolumes = (const double *)volumeData.bytes + oldTickCount;
+
+    double origin = self.bucketOrigin;
+
+    NSMutableData *servedBuckets = self.buckets;
+    NSUInteger oldBucketCount    = servedBuckets.length / sizeof(CPTTradingRangeBucket);
+    NSUInteger firstChanged      = NSNotFound;
+
+    // Keep every cached level current
+    NSMutableDictionary<NSNumber *, NSMutableData *> *theLevels = self.levels;
+
+    for ( NSNumber *levelWidth in theLevels ) {
+        NSMutableData *level = theLevels[levelWidth];
+        NSUInteger changed   = CPTTradingRangeAggregateTicks(level, newTimes, newPrices, appendedVolumes, count, origin, levelWidth.doubleValue);
+
+        if ( level == servedBuckets ) {
+            firstChanged = changed;
+        }
+    }
+
+    if ( servedBuckets && self.windowRange ) {
+        // Only add the ticks inside the window
+        CPTPlotRange *window = self.windowRange;
+        double windowMin     = window.minLimitDouble;
+        double windowMax     = window.maxLimitDouble;
+
+        NSUInteger first = 0;
+        while ((first < count) && (newTimes[first] < windowMin)) {
+            first++;
+        }
+        NSUInteger last = first;
+        while ((last < count) && (newTimes[last] < windowMax)) {
+            last++;
+        }
+
+        if ( last > first ) {
+            firstChanged = CPTTradingRangeAggregateTicks(servedBuckets, newTimes + first, newPrices + first, appendedVolumes + first, last - first, origin, self.bucketWidth);
+        }
+    }
+
+    if ( !servedBuckets ) {
+        [self updateBuckets];
+        return;
+    }
+
+    NSUInteger newBucketCount = servedBuckets.length / sizeof(CPTTradingRangeBucket);
+    CPTTradingRangePlot *plot = self.dataPlot;
+
+    if ( firstChanged < oldBucketCount ) {
+        [plot reloadDataInIndexRange:NSMakeRange(firstChanged, oldBucketCount - firstChanged)];
+    }
+    if ( newBucketCount > oldBucketCount ) {
+        [plot insertDataAtIndex:oldBucketCount numberOfRecords:newBucketCount - oldBucketCount];
+    }
+}
+
+/** @brief Removes all ticks and buckets.
+ **/
+-(void)removeAllTicks
+{
+    NSUInteger tickCount = self.numberOfTicks;
+
+    [self.times removeSamplesInRange:NSMakeRange(0, tickCount)];
+    [self.prices removeSamplesInRange:NSMakeRange(0, tickCount)];
+    [self.volumes removeSamplesInRange:NSMakeRange(0, tickCount)];
+
+    [self.levels removeAllObjects];
+    [self.levelWidths removeAllObjects];
+    self.buckets     = nil;
+    self.windowRange = nil;
+    self.bucketWidth = 0.0;
+
+    [self updateBuckets];
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Finds the first tick that is not earlier than a given time.
+ *  @param time The time.
+ *  @return The index of the tick, or the number of ticks if every tick is earlier.
+ **/
+-(NSUInteger)lowerBoundForTime:(double)time
+{
+    const double *timeBytes = (const double *)self.times.bytes;
+
+    NSUInteger low  = 0;
+    NSUInteger high = self.numberOfTicks;
+
+    while ( low < high ) {
+        NSUInteger mid = low + (high - low) / 2;
+        if ( timeBytes[mid] < time ) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Buckets
+
+/** @brief The total volume of the ticks in a bucket.
+ *  @param idx The index of the bucket.
+ *  @return The volume.
+ **/
+-(double)volumeForBucketAtIndex:(NSUInteger)idx
+{
+    NSParameterAssert(idx < self.numberOfBuckets);
+
+    const CPTTradingRangeBucket *bucketBytes = (const CPTTradingRangeBucket *)self.buckets.bytes;
+
+    return bucketBytes[idx].volume;
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Chooses the bucket width for the current plot space and plot size and reloads the plot if it changed.
+ *
+ *  Nothing is reloaded if the bucket width is the same and the visible range is still covered by the current buckets.
+ **/
+-(void)updateBuckets
+{
+    CPTTradingRangePlot *plot = self.dataPlot;
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)plot.plotSpace;
+
+    if ( !plotSpace ) {
+        return;
+    }
+
+    CPTPlotRange *xRange = plotSpace.xRange;
+    double width         = [self bucketWidthForRangeLength:xRange.lengthDouble pixelWidth:plot.bounds.size.width];
+
+    if ( !(width > 0.0)) {
+        return;
+    }
+
+    if ((width == self.bucketWidth) && self.buckets ) {
+        CPTPlotRange *window = self.windowRange;
+        if ( !window || [window containsRange:xRange] ) {
+            return;
+        }
+    }
+
+    NSUInteger tickCount = self.numberOfTicks;
+    double span          = 0.0;
+
+    if ( tickCount > 0 ) {
+        const double *timeBytes = (const double *)self.times.bytes;
+        span = timeBytes[tickCount - 1] - timeBytes[0];
+    }
+
+    if ( span / width < (double)kCPTTradingRangeDataSourceMaximumLevelBuckets ) {
+        self.buckets     = [self levelForWidth:width];
+        self.windowRange = nil;
+    }
+    else {
+        // Aggregate the visible range plus one screen on either side so small scrolls do not reload
+        double minLimit = xRange.minLimitDouble;
+        double length   = xRange.maxLimitDouble - minLimit;
+        double origin   = self.bucketOrigin;
+
+        double windowMin = origin + floor((minLimit - length - origin) / width) * width;
+        double windowMax = origin + ceil((minLimit + 2.0 * length - origin) / width) * width;
+
+        CPTPlotRange *window = [CPTPlotRange plotRangeWithLocation:@(windowMin) length:@(windowMax - windowMin)];
+
+        self.buckets     = [self bucketsForWidth:width inRange:window];
+        self.windowRange = window;
+    }
+
+    self.bucketWidth = width;
+
+    [plot reloadData];
+}
+
+/** @internal
+ *  @brief Chooses a bucket width that keeps neighboring buckets at least @ref resolution pixels apart.
+ *  @param rangeLength The length of the visible range.
+ *  @param pixelWidth The width of the plot in pixels.
+ *  @return The bucket width, or @num{0.0} if it cannot be determined.
+ **/
+-(double)bucketWidthForRangeLength:(double)rangeLength pixelWidth:(CGFloat)pixelWidth
+{
+    if ( !(pixelWidth > CPTFloat(0.0))) {
+        return 0.0;
+    }
+
+    double minimumWidth = fabs(rangeLength) * (double)self.resolution / (double)pixelWidth;
+
+    if ( !(minimumWidth > 0.0) || isinf(minimumWidth)) {
+        return 0.0;
+    }
+
+    CPTNumberArray *widths = self.bucketWidths;
+
+    if ( widths.count > 0 ) {
+        double width = 0.0;
+
+        for ( NSNumber *allowedWidth in widths ) {
+            width = allowedWidth.doubleValue;
+            if ( width >= minimumWidth ) {
+                break;
+            }
+        }
+        return width;
+    }
+
+    double magnitude = pow(10.0, floor(log10(minimumWidth)));
+    double fraction  = minimumWidth / magnitude;
+    double niceValue = 10.0;
+
+    if ( fraction <= 1.0 ) {
+        niceValue = 1.0;
+    }
+    else if ( fraction <= 2.0 ) {
+        niceValue = 2.0;
+    }
+    else if ( fraction <= 5.0 ) {
+        niceValue = 5.0;
+    }
+
+    return niceValue * magnitude;
+}
+
+/** @internal
+ *  @brief Gets the buckets covering all ticks for a bucket width, aggregating and caching them if needed.
+ *
+ *  A new level is built from the coarsest cached level whose width divides the new width evenly,
+ *  or from the ticks if there is none. Only a few levels are cached; the least recently used level
+ *  is discarded to make room for a new one.
+ *
+ *  @param width The bucket width.
+ *  @return The buckets.
+ **/
+-(nonnull NSMutableData *)levelForWidth:(double)width
+{
+    NSMutableDictionary<NSNumber *, NSMutableData *> *theLevels = self.levels;
+    NSMutableArray<NSNumber *> *theLevelWidths                  = self.levelWidths;
+
+    NSNumber *key        = @(width);
+    NSMutableData *level = theLevels[key];
+
+    if ( level ) {
+        // most recently used last
+        [theLevelWidths removeObject:key];
+        [theLevelWidths addObject:key];
+        return level;
+    }
+
+    NSMutableData *sourceLevel = nil;
+    double sourceWidth         = 0.0;
+    int64_t factor             = 0;
+
+    for ( NSNumber *levelWidth in theLevels ) {
+        double finerWidth = levelWidth.doubleValue;
+        if ((finerWidth < width) && (finerWidth > sourceWidth)) {
+            double ratio = width / finerWidth;
+            double whole = round(ratio);
+            if ( fabs(ratio - whole) <= 1.0e-9 * whole ) {
+                sourceLevel = theLevels[levelWidth];
+                sourceWidth = finerWidth;
+                factor      = (int64_t)whole;
+            }
+        }
+    }
+
+    level = [[NSMutableData alloc] init];
+
+    if ( sourceLevel ) {
+        CPTTradingRangeAggregateBuckets(level, (const CPTTradingRangeBucket *)sourceLevel.bytes, sourceLevel.length / sizeof(CPTTradingRangeBucket), factor);
+    }
+    else {
+        CPTTradingRangeAggregateTicks(level, (const double *)self.times.bytes, (const double *)self.prices.bytes, (const double *)self.volumes.bytes, self.numberOfTicks, self.bucketOrigin, width);
+    }
+
+    theLevels[key] = level;
+    [theLevelWidths addObject:key];
+
+    while ( theLevelWidths.count > kCPTTradingRangeDataSourceMaximumLevels ) {
+        [theLevels removeObjectForKey:theLevelWidths[0]];
+        [theLevelWidths removeObjectAtIndex:0];
+    }
+
+    return level;
+}
+
+/** @internal
+ *  @brief Aggregates the ticks in a range of times.
+ *  @param width The bucket width.
+ *  @param range The range of times. It should start and end on bucket boundaries.
+ *  @return The buckets.
+ **/
+-(nonnull NSMutableData *)bucketsForWidth:(double)width inRange:(nonnull CPTPlotRange *)range
+{
+    NSUInteger first = [self lowerBoundForTime:range.minLimitDouble];
+    NSUInteger last  = [self lowerBoundForTime:range.maxLimitDouble];
+
+    NSMutableData *window = [[NSMutableData alloc] init];
+
+    if ( last > first ) {
+        CPTTradingRangeAggregateTicks(window,
+                                      (const double *)self.times.bytes + first,
+                                      (const double *)self.prices.bytes + first,
+                                      (const double *)self.volumes.bytes + first,
+                                      last - first,
+                                      self.bucketOrigin,
+                                      width);
+    }
+
+    return window;
+}
+
+/**
+ *  @internal
+ *  @brief Adds a new bucket to the end of a bucket array.
+ *
+ *  The length of the array is always the number of buckets. NSMutableData keeps spare storage and grows it
+ *  geometrically, so appending one bucket at a time takes constant amortized time without clearing unused buckets.
+ *
+ *  @param buckets The bucket array.
+ *  @param idx The index of the new bucket. Must equal the number of buckets in the array.
+ *  @return A pointer to the new bucket. The pointers to other buckets may be invalid after this call.
+ **/
+static CPTTradingRangeBucket *__nonnull CPTTradingRangeNewBucket(NSMutableData *__nonnull buckets, NSUInteger idx)
+{
+    NSCParameterAssert(idx == buckets.length / sizeof(CPTTradingRangeBucket));
+
+    [buckets increaseLengthBy:sizeof(CPTTradingRangeBucket)];
+
+    return (CPTTradingRangeBucket *)buckets.mutableBytes + idx;
+}
+
+/**
+ *  @internal
+ *  @brief Adds ticks to the end of a bucket array.
+ *
+ *  Ticks in the same bucket as the last existing bucket are merged into it. The ticks must be in time order.
+ *
+ *  @param buckets The bucket array.
+ *  @param times The tick times.
+ *  @param prices The tick prices.
+ *  @param volumes The tick volumes, or @NULL for zero volume.
+ *  @param count The number of ticks.
+ *  @param origin The time where the bucket boundaries are anchored.
+ *  @param width The bucket width.
+ *  @return The index of the first bucket that was changed or added, or @ref NSNotFound if none were.
+ **/
+static NSUInteger CPTTradingRangeAggregateTicks(NSMutableData *__nonnull buckets, const double *__nonnull times, const double *__nonnull prices, const double *__nullable volumes, NSUInteger count, double origin, double width)
+{
+    NSUInteger bucketCount  = buckets.length / sizeof(CPTTradingRangeBucket);
+    NSUInteger firstChanged = NSNotFound;
+
+    if ( count == 0 ) {
+        return firstChanged;
+    }
+
+    CPTTradingRangeBucket *current = (bucketCount > 0) ? (CPTTradingRangeBucket *)buckets.mutableBytes + (bucketCount - 1) : NULL;
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        double price  = prices[i];
+        double volume = volumes ? volumes[i] : 0.0;
+
+        int64_t number = (int64_t)floor((times[i] - origin) / width);
+
+        if ( current && (current->number == number)) {
+            current->high    = MAX(current->high, price);
+            current->low     = MIN(current->low, price);
+            current->close   = price;
+            current->volume += volume;
+
+            firstChanged = MIN(firstChanged, bucketCount - 1);
+        }
+        else {
+            current         = CPTTradingRangeNewBucket(buckets, bucketCount++);
+            current->number = number;
+            current->open   = price;
+            current->high   = price;
+            current->low    = price;
+            current->close  = price;
+            current->volume = volume;
+
+            firstChanged = MIN(firstChanged, bucketCount - 1);
+        }
+    }
+
+    return firstChanged;
+}
+
+/**
+ *  @internal
+ *  @brief Adds buckets to the end of a bucket array, combining them into wider buckets.
+ *  @param buckets The bucket array that receives the wider buckets.
+ *  @param sourceBuckets The narrower buckets.
+ *  @param count The number of narrower buckets.
+ *  @param factor The number of narrower buckets in one wider bucket.
+ *  @return The index of the first bucket that was changed or added, or @ref NSNotFound if none were.
+ **/
+static NSUInteger CPTTradingRangeAggregateBuckets(NSMutableData *__nonnull buckets, const CPTTradingRangeBucket *__nonnull sourceBuckets, NSUInteger count, int64_t factor)
+{
+    NSUInteger bucketCount  = buckets.length / sizeof(CPTTradingRangeBucket);
+    NSUInteger firstChanged = NSNotFound;
+
+    if ( count == 0 ) {
+        return firstChanged;
+    }
+
+    CPTTradingRangeBucket *current = (bucketCount > 0) ? (CPTTradingRangeBucket *)buckets.mutableBytes + (bucketCount - 1) : NULL;
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        const CPTTradingRangeBucket *source = &sourceBuckets[i];
+
+        // round toward negative infinity so buckets before the origin line up
+        int64_t number = source->number / factor;
+        if ((source->number % factor != 0) && (source->number < 0)) {
+            number--;
+        }
+
+        if ( current && (current->number == number)) {
+            current->high    = MAX(current->high, source->high);
+            current->low     = MIN(current->low, source->low);
+            current->close   = source->close;
+            current->volume += source->volume;
+
+            firstChanged = MIN(firstChanged, bucketCount - 1);
+        }
+        else {
+            current         = CPTTradingRangeNewBucket(buckets, bucketCount++);
+            *current        = *source;
+            current->number = number;
+
+            firstChanged = MIN(firstChanged, bucketCount - 1);
+        }
+    }
+
+    return firstChanged;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Notifications
+
+/// @cond
+
+/** @internal
+ *  @brief Chooses a new bucket width when the plot is resized.
+ **/
+-(void)plotBoundsChanged
+{
+    [self updateBuckets];
+}
+
+/** @internal
+ *  @brief Chooses a new bucket width or window when the plot space is zoomed or scrolled.
+ **/
+-(void)plotSpaceChanged
+{
+    [self updateBuckets];
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark KVO Methods
+
+/// @cond
+
+-(void)observeValueForKeyPath:(nullable NSString *)keyPath ofObject:(nullable id)object change:(NSDictionary<NSString *, CPTPlotSpace *> *)change context:(nullable void *)context
+{
+    if ((context == CPTTradingRangeDataSourceKVOContext) && [keyPath isEqualToString:@"plotSpace"] && [object isEqual:self.dataPlot] ) {
+        CPTPlotSpace *oldSpace = change[NSKeyValueChangeOldKey];
+        CPTPlotSpace *newSpace = change[NSKeyValueChangeNewKey];
+
+        if ( oldSpace ) {
+            [[NSNotificationCenter defaultCenter] removeObserver:self
+                                                            name:CPTPlotSpaceCoordinateMappingDidChangeNotification
+                                                          object:oldSpace];
+        }
+
+        if ( newSpace ) {
+            [[NSNotificationCenter defaultCenter] addObserver:self
+                                                     selector:@selector(plotSpaceChanged)
+                                                         name:CPTPlotSpaceCoordinateMappingDidChangeNotification
+                                                       object:newSpace];
+        }
+
+        self.bucketWidth = 0.0;
+        [self plotSpaceChanged];
+    }
+    else {
+        [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+    }
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark CPTTradingRangePlotDataSource Methods
+
+/// @cond
+
+-(NSUInteger)numberOfRecordsForPlot:(nonnull CPTPlot *)plot
+{
+    NSUInteger count = 0;
+
+    if ( [plot isEqual:self.dataPlot] ) {
+        count = self.numberOfBuckets;
+    }
+
+    return count;
+}
+
+-(nullable CPTNumericData *)dataForPlot:(nonnull CPTPlot *)plot recordIndexRange:(NSRange)indexRange
+{
+    CPTNumericData *numericData = nil;
+
+    if ( [plot isEqual:self.dataPlot] ) {
+        NSParameterAssert(NSMaxRange(indexRange) <= self.numberOfBuckets);
+
+        NSUInteger length   = indexRange.length;
+        NSMutableData *data = [[NSMutableData alloc] initWithLength:length * 5 * sizeof(double)];
+
+        double *xBytes     = data.mutableBytes;
+        double *openBytes  = xBytes + length;
+        double *highBytes  = openBytes + length;
+        double *lowBytes   = highBytes + length;
+        double *closeBytes = lowBytes + length;
+
+        const CPTTradingRangeBucket *bucketBytes = (const CPTTradingRangeBucket *)self.buckets.bytes + indexRange.location;
+
+        double origin = self.bucketOrigin;
+        double width  = self.bucketWidth;
+
+        for ( NSUInteger i = 0; i < length; i++ ) {
+            const CPTTradingRangeBucket *bucket = &bucketBytes[i];
+
+            *xBytes++     = origin + ((double)bucket->number + 0.5) * width;
+            *openBytes++  = bucket->open;
+            *highBytes++  = bucket->high;
+            *lowBytes++   = bucket->low;
+            *closeBytes++ = bucket->close;
+        }
+
+        numericData = [CPTNumericData numericDataWithData:data
+                                                 dataType:CPTDataType(CPTFloatingPointDataType, sizeof(double), CFByteOrderGetCurrent())
+                                                    shape:@[@(length), @5]
+                                                dataOrder:CPTDataOrderColumnsFirst];
+    }
+
+    return numericData;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Accessors
+
+/// @cond
+
+-(nonnull CPTNumericData *)tickTimes
+{
+    return self.times;
+}
+
+-(nonnull CPTNumericData *)tickPrices
+{
+    return self.prices;
+}
+
+-(nonnull CPTNumericData *)tickVolumes
+{
+    return self.volumes;
+}
+
+-(NSUInteger)numberOfTicks
+{
+    return self.times.numberOfSamples;
+}
+
+-(NSUInteger)numberOfBuckets
+{
+    return self.buckets.length / sizeof(CPTTradingRangeBucket);
+}
+
+-(void)setResolution:(CGFloat)newResolution
+{
+    NSParameterAssert(newResolution > CPTFloat(0.0));
+
+    if ( newResolution != resolution ) {
+        resolution = newResolution;
+
+        [self updateBuckets];
+    }
+}
+
+-(void)setBucketWidths:(nullable CPTNumberArray *)newWidths
+{
+    if ( newWidths != bucketWidths ) {
+        NSMutableArray<NSNumber *> *sortedWidths = nil;
+
+        if ( newWidths ) {
+            sortedWidths = [[NSMutableArray alloc] initWithCapacity:newWidths.count];
+            for ( NSNumber *width in newWidths ) {
+                NSParameterAssert(width.doubleValue > 0.0);
+                [sortedWidths addObject:width];
+            }
+            [sortedWidths sortUsingSelector:@selector(compare:)];
+        }
+
+        bucketWidths = [sortedWidths copy];
+
+        [self updateBuckets];
+    }
+}
+
+-(void)setBucketOrigin:(double)newOrigin
+{
+    if ( newOrigin != bucketOrigin ) {
+        bucketOrigin = newOrigin;
+
+        // every cached level is anchored to the old origin
+        [self.levels removeAllObjects];
+        [self.levelWidths removeAllObjects];
+        self.buckets     = nil;
+        self.windowRange = nil;
+        self.bucketWidth = 0.0;
+
+        [self updateBuckets];
+    }
+}
+
+/// @endcond
+
+@end
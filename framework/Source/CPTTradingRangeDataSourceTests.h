@@ -0,0 +1,11 @@
+#import "CPTTestCase.h"
+
+@class CPTTradingRangePlot;
+@class CPTXYPlotSpace;
+
+@interface CPTTradingRangeDataSourceTests : CPTTestCase
+
+@property (nonatomic, readwrite, strong, nullable) CPTTradingRangePlot *plot;
+@property (nonatomic, readwrite, strong, nullable) CPTXYPlotSpace *plotSpace;
+
+@end
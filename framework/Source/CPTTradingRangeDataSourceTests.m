@@ -0,0 +1,333 @@
+#import "CPTTradingRangeDataSourceTests.h"
+
+#import "CPTExceptions.h"
+#import "CPTNumericData.h"
+#import "CPTPlotRange.h"
+#import "CPTTradingRangeDataSource.h"
+#import "CPTUtilities.h"
+#import "CPTXYPlotSpace.h"
+
+@interface CPTTradingRangeDataSource(Testing)
+
+-(nullable NSMutableData *)buckets;
+-(nullable CPTPlotRange *)windowRange;
+-(nonnull NSMutableDictionary<NSNumber *, NSMutableData *> *)levels;
+-(nonnull NSMutableData *)bucketsForWidth:(double)width inRange:(nonnull CPTPlotRange *)range;
+
+@end
+
+@implementation CPTTradingRangeDataSourceTests
+
+@synthesize plot;
+@synthesize plotSpace;
+
+-(void)setUp
+{
+    self.plot = [[CPTTradingRangePlot alloc] initWithFrame:CPTRectMake(0.0, 0.0, 100.0, 100.0)];
+
+    self.plotSpace        = [[CPTXYPlotSpace alloc] init];
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@100.0];
+    self.plotSpace.yRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@100.0];
+
+    self.plot.plotSpace = self.plotSpace;
+}
+
+-(void)tearDown
+{
+    self.plot      = nil;
+    self.plotSpace = nil;
+}
+
+#pragma mark -
+#pragma mark Helpers
+
+-(void)appendTicksToDataSource:(nonnull CPTTradingRangeDataSource *)dataSource count:(NSUInteger)count
+{
+    double *times   = calloc(count, sizeof(double));
+    double *prices  = calloc(count, sizeof(double));
+    double *volumes = calloc(count, sizeof(double));
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        times[i]   = (double)i * 0.5;
+        prices[i]  = 50.0 + 10.0 * sin((double)i * 0.37);
+        volumes[i] = (double)(i % 7);
+    }
+
+    [dataSource appendTicksWithTimes:times prices:prices volumes:volumes count:count];
+
+    free(times);
+    free(prices);
+    free(volumes);
+}
+
+-(nonnull CPTTradingRangeDataSource *)dataSourceWithTicksOfDataSource:(nonnull CPTTradingRangeDataSource *)dataSource inRange:(nonnull CPTPlotRange *)range
+{
+    CPTTradingRangePlot *expectedPlot = [[CPTTradingRangePlot alloc] initWithFrame:CPTRectMake(0.0, 0.0, 100.0, 100.0)];
+    CPTXYPlotSpace *expectedSpace     = [[CPTXYPlotSpace alloc] init];
+
+    expectedSpace.xRange   = self.plotSpace.xRange;
+    expectedPlot.plotSpace = expectedSpace;
+
+    CPTTradingRangeDataSource *expectedDataSource = [CPTTradingRangeDataSource dataSourceForPlot:expectedPlot];
+
+    const double *times   = (const double *)dataSource.tickTimes.bytes;
+    const double *prices  = (const double *)dataSource.tickPrices.bytes;
+    const double *volumes = (const double *)dataSource.tickVolumes.bytes;
+    NSUInteger count      = dataSource.numberOfTicks;
+
+    NSUInteger first = 0;
+
+    while ((first < count) && (times[first] < range.minLimitDouble)) {
+        first++;
+    }
+    NSUInteger last = first;
+
+    while ((last < count) && (times[last] < range.maxLimitDouble)) {
+        last++;
+    }
+
+    [expectedDataSource appendTicksWithTimes:times + first prices:prices + first volumes:volumes + first count:last - first];
+
+    return expectedDataSource;
+}
+
+-(void)assertBucketsOfDataSource:(nonnull CPTTradingRangeDataSource *)dataSource equalBucketsOfDataSource:(nonnull CPTTradingRangeDataSource *)expectedDataSource
+{
+    NSUInteger count = dataSource.numberOfBuckets;
+
+    XCTAssertEqual(count, expectedDataSource.numberOfBuckets, @"bucket count");
+
+    CPTNumericData *data         = [dataSource dataForPlot:dataSource.dataPlot recordIndexRange:NSMakeRange(0, count)];
+    CPTNumericData *expectedData = [expectedDataSource dataForPlot:expectedDataSource.dataPlot recordIndexRange:NSMakeRange(0, count)];
+
+    const double *values         = (const double *)data.bytes;
+    const double *expectedValues = (const double *)expectedData.bytes;
+
+    for ( NSUInteger i = 0; i < count * 5; i++ ) {
+        XCTAssertEqual(values[i], expectedValues[i], @"value %lu", (unsigned long)i);
+    }
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        XCTAssertEqualWithAccuracy([dataSource volumeForBucketAtIndex:i], [expectedDataSource volumeForBucketAtIndex:i], 1.0e-9, @"volume %lu", (unsigned long)i);
+    }
+}
+
+#pragma mark -
+#pragma mark Aggregation
+
+-(void)testTicksAreAggregatedIntoBuckets
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    // 100 units over 100 pixels at 5 pixels per bucket
+    XCTAssertEqual(dataSource.bucketWidth, 5.0, @"bucket width");
+
+    double times[]   = { 0.0, 1.0, 4.5, 5.0, 7.0, 21.0 };
+    double prices[]  = { 10.0, 12.0, 9.0, 11.0, 8.0, 20.0 };
+    double volumes[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+
+    [dataSource appendTicksWithTimes:times prices:prices volumes:volumes count:6];
+
+    XCTAssertEqual(dataSource.numberOfTicks, (NSUInteger)6, @"tick count");
+    XCTAssertEqual(dataSource.numberOfBuckets, (NSUInteger)3, @"empty buckets are skipped");
+
+    CPTNumericData *data  = [dataSource dataForPlot:self.plot recordIndexRange:NSMakeRange(0, 3)];
+    const double *values  = (const double *)data.bytes;
+    double expected[3][5] = {
+        { 2.5, 10.0, 12.0, 9.0, 9.0 },
+        { 7.5, 11.0, 11.0, 8.0, 8.0 },
+        { 22.5, 20.0, 20.0, 20.0, 20.0 }
+    };
+
+    for ( NSUInteger field = 0; field < 5; field++ ) {
+        for ( NSUInteger i = 0; i < 3; i++ ) {
+            XCTAssertEqual(values[field * 3 + i], expected[i][field], @"bucket %lu, field %lu", (unsigned long)i, (unsigned long)field);
+        }
+    }
+
+    XCTAssertEqual([dataSource volumeForBucketAtIndex:0], 6.0, @"volume 0");
+    XCTAssertEqual([dataSource volumeForBucketAtIndex:1], 9.0, @"volume 1");
+    XCTAssertEqual([dataSource volumeForBucketAtIndex:2], 6.0, @"volume 2");
+}
+
+-(void)testAppendedTicksUpdateLastBucket
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    [dataSource appendTickWithTime:1.0 price:10.0 volume:1.0];
+    [dataSource appendTickWithTime:2.0 price:14.0 volume:1.0];
+
+    XCTAssertEqual(dataSource.numberOfBuckets, (NSUInteger)1, @"bucket count");
+
+    [dataSource appendTickWithTime:3.0 price:6.0 volume:1.0];
+    [dataSource appendTickWithTime:6.0 price:7.0 volume:1.0];
+
+    XCTAssertEqual(dataSource.numberOfBuckets, (NSUInteger)2, @"bucket count");
+
+    CPTNumericData *data = [dataSource dataForPlot:self.plot recordIndexRange:NSMakeRange(0, 2)];
+    const double *values = (const double *)data.bytes;
+
+    XCTAssertEqual(values[2], 10.0, @"open");
+    XCTAssertEqual(values[4], 14.0, @"high");
+    XCTAssertEqual(values[6], 6.0, @"low");
+    XCTAssertEqual(values[8], 6.0, @"close");
+    XCTAssertEqual([dataSource volumeForBucketAtIndex:0], 3.0, @"volume");
+}
+
+-(void)testCoarserLevelMatchesAggregationFromTicks
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    [self appendTicksToDataSource:dataSource count:2000];
+
+    // zoom out so the wider buckets are built from the cached five unit buckets
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@1000.0];
+
+    XCTAssertEqual(dataSource.bucketWidth, 50.0, @"bucket width");
+
+    CPTTradingRangePlot *expectedPlot = [[CPTTradingRangePlot alloc] initWithFrame:CPTRectMake(0.0, 0.0, 100.0, 100.0)];
+    CPTXYPlotSpace *expectedSpace     = [[CPTXYPlotSpace alloc] init];
+    expectedSpace.xRange   = [CPTPlotRange plotRangeWithLocation:@0.0 length:@1000.0];
+    expectedPlot.plotSpace = expectedSpace;
+
+    CPTTradingRangeDataSource *expectedDataSource = [CPTTradingRangeDataSource dataSourceForPlot:expectedPlot];
+    [self appendTicksToDataSource:expectedDataSource count:2000];
+
+    XCTAssertEqual(expectedDataSource.bucketWidth, 50.0, @"bucket width");
+
+    [self assertBucketsOfDataSource:dataSource equalBucketsOfDataSource:expectedDataSource];
+
+    // ticks appended after zooming update every cached level
+    double time   = 1000.0;
+    double price  = 75.0;
+    double volume = 2.0;
+    [dataSource appendTicksWithTimes:&time prices:&price volumes:&volume count:1];
+    [expectedDataSource appendTicksWithTimes:&time prices:&price volumes:&volume count:1];
+
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@100.0];
+    expectedSpace.xRange  = [CPTPlotRange plotRangeWithLocation:@0.0 length:@100.0];
+
+    [self assertBucketsOfDataSource:dataSource equalBucketsOfDataSource:expectedDataSource];
+}
+
+-(void)testLevelCacheIsBounded
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    [self appendTicksToDataSource:dataSource count:8000];
+
+    // each range length selects a different bucket width, from one to two thousand units
+    const double lengths[] = { 20.0, 40.0, 100.0, 200.0, 400.0, 1000.0, 2000.0, 4000.0, 10000.0, 20000.0, 40000.0 };
+
+    for ( NSUInteger i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++ ) {
+        self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@(lengths[i])];
+
+        XCTAssertEqualWithAccuracy(dataSource.bucketWidth, lengths[i] / 20.0, 1.0e-9, @"bucket width %lu", (unsigned long)i);
+        XCTAssertLessThanOrEqual(dataSource.levels.count, (NSUInteger)8, @"cached levels %lu", (unsigned long)i);
+    }
+
+    XCTAssertNil(dataSource.levels[@1.0], @"least recently used level");
+
+    // a discarded level is rebuilt from the ticks
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@20.0];
+
+    CPTTradingRangeDataSource *expectedDataSource = [self dataSourceWithTicksOfDataSource:dataSource inRange:[CPTPlotRange plotRangeWithLocation:@0.0 length:@4000.0]];
+
+    XCTAssertEqual(expectedDataSource.bucketWidth, 1.0, @"bucket width");
+
+    [self assertBucketsOfDataSource:dataSource equalBucketsOfDataSource:expectedDataSource];
+}
+
+#pragma mark -
+#pragma mark Windows
+
+-(void)testWindowedBucketsMatchFullAggregation
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    [self appendTicksToDataSource:dataSource count:8000];
+
+    XCTAssertNil(dataSource.windowRange, @"all buckets");
+
+    // 0.05 unit buckets over 4000 units are too many to aggregate at once
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@1000.0 length:@1.0];
+
+    XCTAssertEqualWithAccuracy(dataSource.bucketWidth, 0.05, 1.0e-12, @"bucket width");
+
+    CPTPlotRange *window = dataSource.windowRange;
+
+    XCTAssertNotNil(window, @"windowed buckets");
+    XCTAssertTrue([window containsRange:self.plotSpace.xRange], @"window covers the visible range");
+    XCTAssertEqualObjects(dataSource.buckets, [dataSource bucketsForWidth:dataSource.bucketWidth inRange:window], @"buckets in the window");
+    XCTAssertEqual(self.plot.cachedDataCount, dataSource.numberOfBuckets, @"plot records");
+
+    CPTTradingRangeDataSource *expectedDataSource = [self dataSourceWithTicksOfDataSource:dataSource inRange:window];
+
+    XCTAssertNil(expectedDataSource.windowRange, @"all buckets");
+    XCTAssertEqualWithAccuracy(expectedDataSource.bucketWidth, 0.05, 1.0e-12, @"bucket width");
+
+    [self assertBucketsOfDataSource:dataSource equalBucketsOfDataSource:expectedDataSource];
+
+    // scrolling past the window aggregates a new window
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@2000.0 length:@1.0];
+
+    XCTAssertFalse([dataSource.windowRange isEqualToRange:window], @"new window");
+    XCTAssertTrue([dataSource.windowRange containsRange:self.plotSpace.xRange], @"new window covers the visible range");
+
+    expectedDataSource = [self dataSourceWithTicksOfDataSource:dataSource inRange:dataSource.windowRange];
+
+    [self assertBucketsOfDataSource:dataSource equalBucketsOfDataSource:expectedDataSource];
+}
+
+-(void)testAppendedTicksUpdateWindow
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    [self appendTicksToDataSource:dataSource count:8000];
+
+    // the last tick is at 3999.5
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@3999.0 length:@1.0];
+
+    CPTPlotRange *window      = dataSource.windowRange;
+    NSUInteger oldBucketCount = dataSource.numberOfBuckets;
+
+    XCTAssertNotNil(window, @"windowed buckets");
+    XCTAssertLessThan(window.maxLimitDouble, 4003.0, @"the last new tick is past the window");
+
+    double times[]   = { 3999.52, 3999.81, 3999.83, 4000.5, 4003.0 };
+    double prices[]  = { 61.0, 38.0, 72.0, 55.0, 90.0 };
+    double volumes[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+    [dataSource appendTicksWithTimes:times prices:prices volumes:volumes count:5];
+
+    XCTAssertEqualObjects(dataSource.windowRange, window, @"same window");
+    XCTAssertGreaterThan(dataSource.numberOfBuckets, oldBucketCount, @"new buckets");
+    XCTAssertEqualObjects(dataSource.buckets, [dataSource bucketsForWidth:dataSource.bucketWidth inRange:window], @"buckets in the window");
+    XCTAssertEqual(self.plot.cachedDataCount, dataSource.numberOfBuckets, @"plot records");
+
+    CPTTradingRangeDataSource *expectedDataSource = [self dataSourceWithTicksOfDataSource:dataSource inRange:window];
+
+    [self assertBucketsOfDataSource:dataSource equalBucketsOfDataSource:expectedDataSource];
+}
+
+-(void)testAllowedBucketWidths
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    dataSource.bucketWidths = @[@60.0, @1.0, @15.0];
+    XCTAssertEqual(dataSource.bucketWidth, 15.0, @"smallest allowed width of at least five");
+
+    self.plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@100000.0];
+    XCTAssertEqual(dataSource.bucketWidth, 60.0, @"largest allowed width");
+}
+
+-(void)testTicksOutOfOrder
+{
+    CPTTradingRangeDataSource *dataSource = [CPTTradingRangeDataSource dataSourceForPlot:self.plot];
+
+    [dataSource appendTickWithTime:10.0 price:1.0 volume:1.0];
+
+    XCTAssertThrowsSpecificNamed([dataSource appendTickWithTime:5.0 price:1.0 volume:1.0], NSException, CPTException, @"Should raise CPTException for ticks out of order");
+    XCTAssertEqual(dataSource.numberOfTicks, (NSUInteger)1, @"tick count");
+}
+
+@end
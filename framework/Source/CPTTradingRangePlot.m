@@ -13,6 +13,7 @@
 #import "CPTXYPlotSpace.h"
 #import "NSCoderExtensions.h"
 #import "NSNumberExtensions.h"
+#import "_CPTStyleBatches.h"
 #import "tgmath.h"
 
 /** @defgroup plotAnimationTradingRangePlot Trading Range Plot
@@ -60,6 +61,16 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
 
 -(void)drawCandleStickInContext:(nonnull CGContextRef)context atIndex:(NSUInteger)idx x:(CGFloat)x open:(CGFloat)openValue close:(CGFloat)closeValue high:(CGFloat)highValue low:(CGFloat)lowValue width:(CGFloat)width alignPoints:(BOOL)alignPoints;
 -(void)drawOHLCInContext:(nonnull CGContextRef)context atIndex:(NSUInteger)idx x:(CGFloat)x open:(CGFloat)openValue close:(CGFloat)closeValue high:(CGFloat)highValue low:(CGFloat)lowValue alignPoints:(BOOL)alignPoints;
+-(void)addCandleStickToBodyPath:(nonnull CGMutablePathRef)bodyPath linePath:(nonnull CGMutablePathRef)linePath inContext:(nonnull CGContextRef)context x:(CGFloat)x open:(CGFloat)openValue close:(CGFloat)closeValue high:(CGFloat)highValue low:(CGFloat)lowValue width:(CGFloat)width lineStyle:(nullable CPTLineStyle *)lineStyle alignPoints:(BOOL)alignPoints;
+-(void)addOHLCToPath:(nonnull CGMutablePathRef)path inContext:(nonnull CGContextRef)context x:(CGFloat)x open:(CGFloat)openValue close:(CGFloat)closeValue high:(CGFloat)highValue low:(CGFloat)lowValue lineStyle:(nonnull CPTLineStyle *)lineStyle alignPoints:(BOOL)alignPoints;
+-(nonnull CPTAlignPointFunction)alignmentFunctionForLineStyle:(nullable CPTLineStyle *)lineStyle;
+-(nullable CPTLineStyle *)candleStickLineStyleForIndex:(NSUInteger)idx open:(CGFloat)openValue close:(CGFloat)closeValue;
+-(nullable CPTLineStyle *)OHLCLineStyleForIndex:(NSUInteger)idx open:(CGFloat)openValue close:(CGFloat)closeValue;
+
+-(NSRange)visibleRecordIndexRangeForNumberOfRecords:(NSUInteger)sampleCount;
+-(CGFloat)symbolHalfWidthForBarWidth:(CGFloat)width;
+-(NSUInteger)batchIndexInBatches:(nonnull _CPTStyleBatches *)batches forFill:(nullable CPTFill *)fill lineStyle:(nullable CPTLineStyle *)lineStyle x:(CGFloat)x halfWidth:(CGFloat)halfWidth inContext:(nonnull CGContextRef)context;
+-(void)calculateViewCoordinatesX:(nonnull CGFloat *)xCoords open:(nonnull CGFloat *)openCoords high:(nonnull CGFloat *)highCoords low:(nonnull CGFloat *)lowCoords close:(nonnull CGFloat *)closeCoords indexRange:(NSRange)indexRange;
 
 -(nullable CPTFill *)increaseFillForIndex:(NSUInteger)idx;
 -(nullable CPTFill *)decreaseFillForIndex:(NSUInteger)idx;
@@ -72,6 +83,15 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
 
 @end
 
+@interface CPTPlot()
+
+// inherited private methods
+-(NSRange)indexRangeForSortedField:(NSUInteger)fieldEnum plotRange:(nonnull CPTPlotRange *)plotRange;
+
+@end
+
+static const NSUInteger kCPTTradingRangePlotMaximumStyleBatches = 16; // distinct fill and line style pairs drawn as compound paths
+
 /// @endcond
 
 #pragma mark -
@@ -633,128 +653,347 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
 
     [super renderAsVectorInContext:context];
 
-    CGPoint openPoint, highPoint, lowPoint, closePoint;
+    // Skip the records outside of the plot area
+    NSRange recordRange = [self visibleRecordIndexRangeForNumberOfRecords:sampleCount];
+    NSUInteger count    = recordRange.length;
+    if ( count == 0 ) {
+        return;
+    }
+
+    CGFloat *xCoords     = malloc(count * sizeof(CGFloat));
+    CGFloat *openCoords  = malloc(count * sizeof(CGFloat));
+    CGFloat *highCoords  = malloc(count * sizeof(CGFloat));
+    CGFloat *lowCoords   = malloc(count * sizeof(CGFloat));
+    CGFloat *closeCoords = malloc(count * sizeof(CGFloat));
+
+    [self calculateViewCoordinatesX:xCoords open:openCoords high:highCoords low:lowCoords close:closeCoords indexRange:recordRange];
 
-    CPTPlotSpace *thePlotSpace            = self.plotSpace;
     CPTTradingRangePlotStyle thePlotStyle = self.plotStyle;
     BOOL alignPoints                      = self.alignsPointsToPixels;
+    BOOL showBorder                       = self.showBarBorder;
+
+    CGRect plotBounds        = self.plotArea.bounds;
+    CGFloat defaultWidth     = self.barWidth;
+    CGFloat defaultHalfWidth = [self symbolHalfWidthForBarWidth:defaultWidth];
+    BOOL hasBarWidths        = ([self cachedArrayForKey:CPTTradingRangePlotBindingBarWidths] != nil);
+    CPTLineStyle *equalStyle = nil;
+    CPTFill *equalStyleFill  = nil;
+
+    // Candles and bars with the same solid fill and line style are collected into one path and drawn together.
+    // The batches are flushed before a symbol that would overlap them so the symbols stack in record order.
+    _CPTStyleBatches *batches = [[_CPTStyleBatches alloc] initWithMaximumBatchCount:kCPTTradingRangePlotMaximumStyleBatches];
 
     CGContextBeginTransparencyLayer(context, NULL);
 
-    if ( self.doublePrecisionCache ) {
-        const double *locationBytes = (const double *)locations.data.bytes;
-        const double *openBytes     = (const double *)opens.data.bytes;
-        const double *highBytes     = (const double *)highs.data.bytes;
-        const double *lowBytes      = (const double *)lows.data.bytes;
-        const double *closeBytes    = (const double *)closes.data.bytes;
+    for ( NSUInteger j = 0; j < count; j++ ) {
+        NSUInteger i   = recordRange.location + j;
+        CGFloat xCoord = xCoords[j];
 
-        for ( NSUInteger i = 0; i < sampleCount; i++ ) {
-            double plotPoint[2];
-            plotPoint[independentCoord] = *locationBytes++;
-            if ( isnan(plotPoint[independentCoord])) {
-                openBytes++;
-                highBytes++;
-                lowBytes++;
-                closeBytes++;
-                continue;
-            }
+        if ( isnan(xCoord)) {
+            continue;
+        }
 
-            // open point
-            plotPoint[dependentCoord] = *openBytes++;
-            if ( isnan(plotPoint[dependentCoord])) {
-                openPoint = CPTPointMake(NAN, NAN);
-            }
-            else {
-                openPoint = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-            }
+        CGFloat width     = defaultWidth;
+        CGFloat halfWidth = defaultHalfWidth;
+        if ( hasBarWidths ) {
+            width     = [self barWidthForIndex:i].cgFloatValue;
+            halfWidth = [self symbolHalfWidthForBarWidth:width];
+        }
 
-            // high point
-            plotPoint[dependentCoord] = *highBytes++;
-            if ( isnan(plotPoint[dependentCoord])) {
-                highPoint = CPTPointMake(NAN, NAN);
-            }
-            else {
-                highPoint = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-            }
+        // Skip symbols that are off screen
+        if ((xCoord + halfWidth < CGRectGetMinX(plotBounds)) || (xCoord - halfWidth > CGRectGetMaxX(plotBounds))) {
+            continue;
+        }
 
-            // low point
-            plotPoint[dependentCoord] = *lowBytes++;
-            if ( isnan(plotPoint[dependentCoord])) {
-                lowPoint = CPTPointMake(NAN, NAN);
-            }
-            else {
-                lowPoint = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-            }
+        CGFloat openValue  = openCoords[j];
+        CGFloat closeValue = closeCoords[j];
+        CGFloat highValue  = highCoords[j];
+        CGFloat lowValue   = lowCoords[j];
 
-            // close point
-            plotPoint[dependentCoord] = *closeBytes++;
-            if ( isnan(plotPoint[dependentCoord])) {
-                closePoint = CPTPointMake(NAN, NAN);
-            }
-            else {
-                closePoint = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
-            }
+        switch ( thePlotStyle ) {
+            case CPTTradingRangePlotStyleOHLC:
+            {
+                CPTLineStyle *theLineStyle = [self OHLCLineStyleForIndex:i open:openValue close:closeValue];
+                if ( !theLineStyle ) {
+                    break;
+                }
 
-            CGFloat xCoord = openPoint.x;
-            if ( isnan(xCoord)) {
-                xCoord = highPoint.x;
-            }
-            else if ( isnan(xCoord)) {
-                xCoord = lowPoint.x;
-            }
-            else if ( isnan(xCoord)) {
-                xCoord = closePoint.x;
+                NSUInteger batch = [self batchIndexInBatches:batches
+                                                     forFill:nil
+                                                   lineStyle:theLineStyle
+                                                           x:xCoord
+                                                   halfWidth:ABS(self.stickLength)
+                                                   inContext:context];
+
+                if ( batch != NSNotFound ) {
+                    [self addOHLCToPath:[batches strokePathForBatchAtIndex:batch]
+                              inContext:context
+                                      x:xCoord
+                                   open:openValue
+                                  close:closeValue
+                                   high:highValue
+                                    low:lowValue
+                              lineStyle:theLineStyle
+                            alignPoints:alignPoints];
+                }
+                else {
+                    [self drawOHLCInContext:context
+                                    atIndex:i
+                                          x:xCoord
+                                       open:openValue
+                                      close:closeValue
+                                       high:highValue
+                                        low:lowValue
+                                alignPoints:alignPoints];
+                }
             }
+            break;
+
+            case CPTTradingRangePlotStyleCandleStick:
+            {
+                CPTLineStyle *theLineStyle = [self candleStickLineStyleForIndex:i open:openValue close:closeValue];
+                CPTFill *theFill           = nil;
 
-            if ( !isnan(xCoord)) {
-                // Draw
-                switch ( thePlotStyle ) {
-                    case CPTTradingRangePlotStyleOHLC:
-                        [self drawOHLCInContext:context
-                                        atIndex:i
-                                              x:xCoord
-                                           open:openPoint.y
-                                          close:closePoint.y
-                                           high:highPoint.y
-                                            low:lowPoint.y
-                                    alignPoints:alignPoints];
-                        break;
-
-                    case CPTTradingRangePlotStyleCandleStick:
-                        [self drawCandleStickInContext:context
-                                               atIndex:i
-                                                     x:xCoord
-                                                  open:openPoint.y
-                                                 close:closePoint.y
-                                                  high:highPoint.y
-                                                   low:lowPoint.y
-                                                 width:[self barWidthForIndex:i].cgFloatValue
-                                           alignPoints:alignPoints];
-                        break;
+                if ( !isnan(openValue) && !isnan(closeValue)) {
+                    if ( openValue < closeValue ) {
+                        theFill = [self increaseFillForIndex:i];
+                    }
+                    else if ( openValue > closeValue ) {
+                        theFill = [self decreaseFillForIndex:i];
+                    }
+                    else if ( theLineStyle.lineColor ) {
+                        // reuse the fill so candles with the same line style share a batch
+                        if ( theLineStyle != equalStyle ) {
+                            equalStyle     = theLineStyle;
+                            equalStyleFill = [CPTFill fillWithColor:theLineStyle.lineColor];
+                        }
+                        theFill = equalStyleFill;
+                    }
+                }
+                if ( ![theFill isKindOfClass:[CPTFill class]] ) {
+                    theFill = nil;
+                }
+
+                if ( !theFill && !theLineStyle ) {
+                    break;
+                }
+
+                NSUInteger batch = [self batchIndexInBatches:batches
+                                                     forFill:theFill
+                                                   lineStyle:theLineStyle
+                                                           x:xCoord
+                                                   halfWidth:CPTFloat(0.5) * ABS(width)
+                                                   inContext:context];
+
+                if ( batch != NSNotFound ) {
+                    CGMutablePathRef bodyPath = (theLineStyle && showBorder) ? [batches sharedPathForBatchAtIndex:batch] : [batches fillPathForBatchAtIndex:batch];
+
+                    [self addCandleStickToBodyPath:bodyPath
+                                          linePath:[batches strokePathForBatchAtIndex:batch]
+                                         inContext:context
+                                                 x:xCoord
+                                              open:openValue
+                                             close:closeValue
+                                              high:highValue
+                                               low:lowValue
+                                             width:width
+                                         lineStyle:theLineStyle
+                                       alignPoints:alignPoints];
+                }
+                else {
+                    // Fills and line styles that depend on the bounds of the candle are drawn one candle at a time
+                    [self drawCandleStickInContext:context
+                                           atIndex:i
+                                                 x:xCoord
+                                              open:openValue
+                                             close:closeValue
+                                              high:highValue
+                                               low:lowValue
+                                             width:width
+                                       alignPoints:alignPoints];
                 }
             }
+            break;
+        }
+    }
+
+    [batches flushInContext:context];
+
+    CGContextEndTransparencyLayer(context);
+
+    free(xCoords);
+    free(openCoords);
+    free(highCoords);
+    free(lowCoords);
+    free(closeCoords);
+}
+
+/** @internal
+ *  @brief The distance from the x coordinate of a record to the farthest edge of its symbol.
+ *
+ *  Includes half of the widest default line style and a pixel to allow for rounding.
+ *
+ *  @param width The candlestick width. Ignored for OHLC symbols, which extend by the stick length instead.
+ *  @return The half width in view coordinates.
+ **/
+-(CGFloat)symbolHalfWidthForBarWidth:(CGFloat)width
+{
+    CGFloat lineWidth = MAX(self.lineStyle.lineWidth, MAX(self.increaseLineStyle.lineWidth, self.decreaseLineStyle.lineWidth));
+    CGFloat halfWidth = CPTFloat(0.5) * lineWidth + CPTFloat(1.0);
+
+    switch ( self.plotStyle ) {
+        case CPTTradingRangePlotStyleOHLC:
+            halfWidth += ABS(self.stickLength);
+            break;
+
+        case CPTTradingRangePlotStyleCandleStick:
+            halfWidth += CPTFloat(0.5) * ABS(width);
+            break;
+    }
+
+    return halfWidth;
+}
+
+/** @internal
+ *  @brief Finds the batch for the symbol of a record, flushing the batches first when needed.
+ *
+ *  The batches are drawn and emptied before a symbol that overlaps the symbols already collected,
+ *  before a symbol whose fill or line style cannot be batched, and when there is no room for another style.
+ *  Batched symbols therefore never overlap and look the same as symbols drawn one at a time in record order.
+ *
+ *  @param batches The style batches.
+ *  @param fill The fill of the symbol, or @nil for no fill.
+ *  @param lineStyle The line style of the symbol, or @nil for no line.
+ *  @param x The x coordinate of the symbol.
+ *  @param halfWidth The distance from the x coordinate to the farthest edge of the symbol, not including the line.
+ *  @param context The graphics context to draw into.
+ *  @return The index of the batch, or @ref NSNotFound if the symbol must be drawn directly.
+ **/
+-(NSUInteger)batchIndexInBatches:(nonnull _CPTStyleBatches *)batches forFill:(nullable CPTFill *)fill lineStyle:(nullable CPTLineStyle *)lineStyle x:(CGFloat)x halfWidth:(CGFloat)halfWidth inContext:(nonnull CGContextRef)context
+{
+    CGFloat symbolHalfWidth = halfWidth + (lineStyle ? CPTFloat(0.5) * lineStyle.lineWidth : CPTFloat(0.0));
+    CGFloat minExtent       = x - symbolHalfWidth;
+    CGFloat maxExtent       = x + symbolHalfWidth;
+
+    if ( [batches shapeOverlapsBatchesFrom:minExtent to:maxExtent] ) {
+        [batches flushInContext:context];
+    }
+
+    NSUInteger batch = [batches batchIndexForFill:fill lineStyle:lineStyle];
+
+    if ((batch == NSNotFound) && (batches.batchCount > 0)) {
+        [batches flushInContext:context];
+        batch = [batches batchIndexForFill:fill lineStyle:lineStyle];
+    }
+
+    if ( batch != NSNotFound ) {
+        [batches addShapeExtentFrom:minExtent to:maxExtent];
+    }
+
+    return batch;
+}
+
+/** @internal
+ *  @brief Finds the records that can be inside the plot area.
+ *
+ *  When the x values are sorted and all candlesticks have the same width, the edges of the plot area, widened by
+ *  half of the symbol width, are converted to x values and the records between them are found with a binary search.
+ *  Otherwise, every record is returned and each is tested when drawn.
+ *
+ *  @param sampleCount The number of records.
+ *  @return The range of record indices.
+ **/
+-(NSRange)visibleRecordIndexRangeForNumberOfRecords:(NSUInteger)sampleCount
+{
+    NSRange allRecords = NSMakeRange(0, sampleCount);
+
+    CPTPlotArea *thePlotArea   = self.plotArea;
+    CPTPlotSpace *thePlotSpace = self.plotSpace;
+
+    if ((sampleCount == 0) || !thePlotArea || !thePlotSpace || [self cachedArrayForKey:CPTTradingRangePlotBindingBarWidths] ) {
+        return allRecords;
+    }
+
+    CGRect plotBounds = thePlotArea.bounds;
+    CGFloat halfWidth = [self symbolHalfWidthForBarWidth:self.barWidth];
+
+    double lowerPlotPoint[2], upperPlotPoint[2];
+
+    [thePlotSpace doublePrecisionPlotPoint:lowerPlotPoint
+                       numberOfCoordinates:2
+                      forPlotAreaViewPoint:CPTPointMake(CGRectGetMinX(plotBounds) - halfWidth, CGRectGetMidY(plotBounds))];
+    [thePlotSpace doublePrecisionPlotPoint:upperPlotPoint
+                       numberOfCoordinates:2
+                      forPlotAreaViewPoint:CPTPointMake(CGRectGetMaxX(plotBounds) + halfWidth, CGRectGetMidY(plotBounds))];
+
+    // the axis may be reversed
+    double minValue = MIN(lowerPlotPoint[independentCoord], upperPlotPoint[independentCoord]);
+    double maxValue = MAX(lowerPlotPoint[independentCoord], upperPlotPoint[independentCoord]);
+
+    if ( isnan(minValue) || isnan(maxValue)) {
+        return allRecords;
+    }
+
+    CPTPlotRange *xRange = [CPTPlotRange plotRangeWithLocation:@(minValue) length:@(maxValue - minValue)];
+    NSRange recordRange  = [self indexRangeForSortedField:CPTTradingRangePlotFieldX plotRange:xRange];
+
+    return (recordRange.location == NSNotFound) ? allRecords : recordRange;
+}
+
+/** @internal
+ *  @brief Calculates the view coordinates of a range of records.
+ *
+ *  The x coordinate is @NAN if the x value is missing or both the open and high values are missing.
+ *  When the cache holds @double or @float values, each field is converted to view coordinates in one pass.
+ *
+ *  @param xCoords Returns the x coordinate of each record.
+ *  @param openCoords Returns the y coordinate of each open value.
+ *  @param highCoords Returns the y coordinate of each high value.
+ *  @param lowCoords Returns the y coordinate of each low value.
+ *  @param closeCoords Returns the y coordinate of each close value.
+ *  @param indexRange The range of records. The first record in the range is stored at the start of each array.
+ **/
+-(void)calculateViewCoordinatesX:(nonnull CGFloat *)xCoords open:(nonnull CGFloat *)openCoords high:(nonnull CGFloat *)highCoords low:(nonnull CGFloat *)lowCoords close:(nonnull CGFloat *)closeCoords indexRange:(NSRange)indexRange
+{
+    NSUInteger count           = indexRange.length;
+    CPTPlotSpace *thePlotSpace = self.plotSpace;
+
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+        CPTXYPlotSpace *xyPlotSpace = (CPTXYPlotSpace *)thePlotSpace;
+
+        // Convert each field to view coordinates in one pass
+        [xyPlotSpace plotAreaViewCoordinates:xCoords stride:1 forDoublePrecisionPlotCoordinates:(const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldX recordIndexRange:indexRange].bytes numberOfValues:count coordinate:independentCoord];
+        [xyPlotSpace plotAreaViewCoordinates:openCoords stride:1 forDoublePrecisionPlotCoordinates:(const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldOpen recordIndexRange:indexRange].bytes numberOfValues:count coordinate:dependentCoord];
+        [xyPlotSpace plotAreaViewCoordinates:highCoords stride:1 forDoublePrecisionPlotCoordinates:(const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldHigh recordIndexRange:indexRange].bytes numberOfValues:count coordinate:dependentCoord];
+        [xyPlotSpace plotAreaViewCoordinates:lowCoords stride:1 forDoublePrecisionPlotCoordinates:(const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldLow recordIndexRange:indexRange].bytes numberOfValues:count coordinate:dependentCoord];
+        [xyPlotSpace plotAreaViewCoordinates:closeCoords stride:1 forDoublePrecisionPlotCoordinates:(const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldClose recordIndexRange:indexRange].bytes numberOfValues:count coordinate:dependentCoord];
+
+        for ( NSUInteger j = 0; j < count; j++ ) {
+            // The x coordinate is taken from the open point, or the high point if the open value is missing
+            if ( isnan(openCoords[j]) && isnan(highCoords[j])) {
+                xCoords[j] = CPTFloat(NAN);
+            }
         }
     }
     else {
-        const NSDecimal *locationBytes = (const NSDecimal *)locations.data.bytes;
-        const NSDecimal *openBytes     = (const NSDecimal *)opens.data.bytes;
-        const NSDecimal *highBytes     = (const NSDecimal *)highs.data.bytes;
-        const NSDecimal *lowBytes      = (const NSDecimal *)lows.data.bytes;
-        const NSDecimal *closeBytes    = (const NSDecimal *)closes.data.bytes;
+        const NSDecimal *locationBytes = (const NSDecimal *)[self cachedNumbersForField:CPTTradingRangePlotFieldX].bytes + indexRange.location;
+        const NSDecimal *openBytes     = (const NSDecimal *)[self cachedNumbersForField:CPTTradingRangePlotFieldOpen].bytes + indexRange.location;
+        const NSDecimal *highBytes     = (const NSDecimal *)[self cachedNumbersForField:CPTTradingRangePlotFieldHigh].bytes + indexRange.location;
+        const NSDecimal *lowBytes      = (const NSDecimal *)[self cachedNumbersForField:CPTTradingRangePlotFieldLow].bytes + indexRange.location;
+        const NSDecimal *closeBytes    = (const NSDecimal *)[self cachedNumbersForField:CPTTradingRangePlotFieldClose].bytes + indexRange.location;
 
-        for ( NSUInteger i = 0; i < sampleCount; i++ ) {
+        for ( NSUInteger j = 0; j < count; j++ ) {
             NSDecimal plotPoint[2];
-            plotPoint[independentCoord] = *locationBytes++;
+            plotPoint[independentCoord] = locationBytes[j];
             if ( NSDecimalIsNotANumber(&plotPoint[independentCoord])) {
-                openBytes++;
-                highBytes++;
-                lowBytes++;
-                closeBytes++;
+                xCoords[j] = CPTFloat(NAN);
                 continue;
             }
 
+            CGPoint openPoint, highPoint, lowPoint, closePoint;
+
             // open point
-            plotPoint[dependentCoord] = *openBytes++;
+            plotPoint[dependentCoord] = openBytes[j];
             if ( NSDecimalIsNotANumber(&plotPoint[dependentCoord])) {
                 openPoint = CPTPointMake(NAN, NAN);
             }
@@ -763,7 +1002,7 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
             }
 
             // high point
-            plotPoint[dependentCoord] = *highBytes++;
+            plotPoint[dependentCoord] = highBytes[j];
             if ( NSDecimalIsNotANumber(&plotPoint[dependentCoord])) {
                 highPoint = CPTPointMake(NAN, NAN);
             }
@@ -772,7 +1011,7 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
             }
 
             // low point
-            plotPoint[dependentCoord] = *lowBytes++;
+            plotPoint[dependentCoord] = lowBytes[j];
             if ( NSDecimalIsNotANumber(&plotPoint[dependentCoord])) {
                 lowPoint = CPTPointMake(NAN, NAN);
             }
@@ -781,7 +1020,7 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
             }
 
             // close point
-            plotPoint[dependentCoord] = *closeBytes++;
+            plotPoint[dependentCoord] = closeBytes[j];
             if ( NSDecimalIsNotANumber(&plotPoint[dependentCoord])) {
                 closePoint = CPTPointMake(NAN, NAN);
             }
@@ -793,44 +1032,88 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
             if ( isnan(xCoord)) {
                 xCoord = highPoint.x;
             }
-            else if ( isnan(xCoord)) {
-                xCoord = lowPoint.x;
+
+            xCoords[j]     = xCoord;
+            openCoords[j]  = openPoint.y;
+            highCoords[j]  = highPoint.y;
+            lowCoords[j]   = lowPoint.y;
+            closeCoords[j] = closePoint.y;
+        }
+    }
+}
+
+/** @internal
+ *  @brief The line style used to outline a candlestick and draw its wicks.
+ *  @param idx The record index.
+ *  @param openValue The view coordinate of the open value.
+ *  @param closeValue The view coordinate of the close value.
+ *  @return The line style, or @nil if the candlestick has no outline.
+ **/
+-(nullable CPTLineStyle *)candleStickLineStyleForIndex:(NSUInteger)idx open:(CGFloat)openValue close:(CGFloat)closeValue
+{
+    CPTLineStyle *theLineStyle = nil;
+
+    if ( !isnan(openValue) && !isnan(closeValue)) {
+        if ( openValue < closeValue ) {
+            theLineStyle = [self increaseLineStyleForIndex:idx];
+        }
+        else if ( openValue > closeValue ) {
+            theLineStyle = [self decreaseLineStyleForIndex:idx];
+        }
+        else {
+            theLineStyle = [self lineStyleForIndex:idx];
+        }
+    }
+
+    return [theLineStyle isKindOfClass:[CPTLineStyle class]] ? theLineStyle : nil;
+}
+
+/** @internal
+ *  @brief The line style used to draw an OHLC symbol.
+ *  @param idx The record index.
+ *  @param openValue The view coordinate of the open value.
+ *  @param closeValue The view coordinate of the close value.
+ *  @return The line style, or @nil if the symbol is not drawn.
+ **/
+-(nullable CPTLineStyle *)OHLCLineStyleForIndex:(NSUInteger)idx open:(CGFloat)openValue close:(CGFloat)closeValue
+{
+    CPTLineStyle *theLineStyle = [self lineStyleForIndex:idx];
+
+    if ( !isnan(openValue) && !isnan(closeValue)) {
+        if ( openValue < closeValue ) {
+            CPTLineStyle *lineStyleForIncrease = [self increaseLineStyleForIndex:idx];
+            if ( [lineStyleForIncrease isKindOfClass:[CPTLineStyle class]] ) {
+                theLineStyle = lineStyleForIncrease;
             }
-            else if ( isnan(xCoord)) {
-                xCoord = closePoint.x;
+        }
+        else if ( openValue > closeValue ) {
+            CPTLineStyle *lineStyleForDecrease = [self decreaseLineStyleForIndex:idx];
+            if ( [lineStyleForDecrease isKindOfClass:[CPTLineStyle class]] ) {
+                theLineStyle = lineStyleForDecrease;
             }
+        }
+    }
 
-            if ( !isnan(xCoord)) {
-                // Draw
-                switch ( thePlotStyle ) {
-                    case CPTTradingRangePlotStyleOHLC:
-                        [self drawOHLCInContext:context
-                                        atIndex:i
-                                              x:xCoord
-                                           open:openPoint.y
-                                          close:closePoint.y
-                                           high:highPoint.y
-                                            low:lowPoint.y
-                                    alignPoints:alignPoints];
-                        break;
-
-                    case CPTTradingRangePlotStyleCandleStick:
-                        [self drawCandleStickInContext:context
-                                               atIndex:i
-                                                     x:xCoord
-                                                  open:openPoint.y
-                                                 close:closePoint.y
-                                                  high:highPoint.y
-                                                   low:lowPoint.y
-                                                 width:[self barWidthForIndex:i].cgFloatValue
-                                           alignPoints:alignPoints];
-                        break;
-                }
-            }
+    return [theLineStyle isKindOfClass:[CPTLineStyle class]] ? theLineStyle : nil;
+}
+
+/** @internal
+ *  @brief Chooses how the points of a symbol drawn with a line style are aligned to device pixels.
+ *  @param lineStyle The line style, or @nil.
+ *  @return The alignment function.
+ **/
+-(nonnull CPTAlignPointFunction)alignmentFunctionForLineStyle:(nullable CPTLineStyle *)lineStyle
+{
+    CPTAlignPointFunction alignmentFunction = CPTAlignPointToUserSpace;
+
+    if ( lineStyle ) {
+        CGFloat lineWidth = lineStyle.lineWidth;
+        if ((self.contentsScale > CPTFloat(1.0)) && (round(lineWidth) == lineWidth)) {
+            alignmentFunction = CPTAlignIntegralPointToUserSpace;
         }
     }
 
-    CGContextEndTransparencyLayer(context);
+    return alignmentFunction;
 }
 
 -(void)drawCandleStickInContext:(nonnull CGContextRef)context
@@ -843,22 +1126,17 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
                           width:(CGFloat)width
                     alignPoints:(BOOL)alignPoints
 {
-    const CGFloat halfBarWidth = CPTFloat(0.5) * width;
-
     CPTFill *currentBarFill          = nil;
-    CPTLineStyle *theBorderLineStyle = nil;
+    CPTLineStyle *theBorderLineStyle = [self candleStickLineStyleForIndex:idx open:openValue close:closeValue];
 
     if ( !isnan(openValue) && !isnan(closeValue)) {
         if ( openValue < closeValue ) {
-            theBorderLineStyle = [self increaseLineStyleForIndex:idx];
-            currentBarFill     = [self increaseFillForIndex:idx];
+            currentBarFill = [self increaseFillForIndex:idx];
         }
         else if ( openValue > closeValue ) {
-            theBorderLineStyle = [self decreaseLineStyleForIndex:idx];
-            currentBarFill     = [self decreaseFillForIndex:idx];
+            currentBarFill = [self decreaseFillForIndex:idx];
         }
         else {
-            theBorderLineStyle = [self lineStyleForIndex:idx];
             CPTColor *lineColor = theBorderLineStyle.lineColor;
             if ( lineColor ) {
                 currentBarFill = [CPTFill fillWithColor:lineColor];
@@ -866,18 +1144,80 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
         }
     }
 
-    CPTAlignPointFunction alignmentFunction = CPTAlignPointToUserSpace;
+    BOOL hasFill      = [currentBarFill isKindOfClass:[CPTFill class]];
+    BOOL hasLineStyle = (theBorderLineStyle != nil);
 
-    BOOL hasLineStyle = [theBorderLineStyle isKindOfClass:[CPTLineStyle class]];
-    if ( hasLineStyle ) {
-        [theBorderLineStyle setLineStyleInContext:context];
+    if ( !hasFill && !hasLineStyle ) {
+        return;
+    }
 
-        CGFloat lineWidth = theBorderLineStyle.lineWidth;
-        if ((self.contentsScale > CPTFloat(1.0)) && (round(lineWidth) == lineWidth)) {
-            alignmentFunction = CPTAlignIntegralPointToUserSpace;
+    CGMutablePathRef bodyPath = CGPathCreateMutable();
+    CGMutablePathRef linePath = CGPathCreateMutable();
+
+    [self addCandleStickToBodyPath:bodyPath
+                          linePath:linePath
+                         inContext:context
+                                 x:x
+                              open:openValue
+                             close:closeValue
+                              high:highValue
+                               low:lowValue
+                             width:width
+                         lineStyle:theBorderLineStyle
+                       alignPoints:alignPoints];
+
+    if ( hasFill && !CGPathIsEmpty(bodyPath)) {
+        CGContextBeginPath(context);
+        CGContextAddPath(context, bodyPath);
+        [currentBarFill fillPathInContext:context];
+    }
+
+    if ( hasLineStyle ) {
+        CGContextBeginPath(context);
+        if ( self.showBarBorder ) {
+            CGContextAddPath(context, bodyPath);
         }
+        CGContextAddPath(context, linePath);
+        [theBorderLineStyle setLineStyleInContext:context];
+        [theBorderLineStyle strokePathInContext:context];
     }
 
+    CGPathRelease(bodyPath);
+    CGPathRelease(linePath);
+}
+
+/** @internal
+ *  @brief Adds the outline of a candlestick body and its wicks to paths.
+ *  @param bodyPath The path that receives the outline of the open-close body.
+ *  @param linePath The path that receives the wicks, or the high-low line if the open or close value is missing.
+ *  Lines are only added when there is a line style.
+ *  @param context The graphics context used to align the points to device pixels.
+ *  @param x The x coordinate of the candlestick.
+ *  @param openValue The y coordinate of the open value.
+ *  @param closeValue The y coordinate of the close value.
+ *  @param highValue The y coordinate of the high value.
+ *  @param lowValue The y coordinate of the low value.
+ *  @param width The width of the body.
+ *  @param lineStyle The line style used to outline the candlestick, or @nil.
+ *  @param alignPoints If @YES, align the points to device pixels.
+ **/
+-(void)addCandleStickToBodyPath:(nonnull CGMutablePathRef)bodyPath
+                       linePath:(nonnull CGMutablePathRef)linePath
+                      inContext:(nonnull CGContextRef)context
+                              x:(CGFloat)x
+                           open:(CGFloat)openValue
+                          close:(CGFloat)closeValue
+                           high:(CGFloat)highValue
+                            low:(CGFloat)lowValue
+                          width:(CGFloat)width
+                      lineStyle:(nullable CPTLineStyle *)lineStyle
+                    alignPoints:(BOOL)alignPoints
+{
+    const CGFloat halfBarWidth = CPTFloat(0.5) * width;
+
+    BOOL hasLineStyle                       = (lineStyle != nil);
+    CPTAlignPointFunction alignmentFunction = [self alignmentFunctionForLineStyle:lineStyle];
+
     // high - low only
     if ( hasLineStyle && !isnan(highValue) && !isnan(lowValue) && (isnan(openValue) || isnan(closeValue))) {
         CGPoint alignedHighPoint = CPTPointMake(x, highValue);
@@ -887,107 +1227,81 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
             alignedLowPoint  = alignmentFunction(context, alignedLowPoint);
         }
 
-        CGMutablePathRef path = CGPathCreateMutable();
-        CGPathMoveToPoint(path, NULL, alignedHighPoint.x, alignedHighPoint.y);
-        CGPathAddLineToPoint(path, NULL, alignedLowPoint.x, alignedLowPoint.y);
-
-        CGContextBeginPath(context);
-        CGContextAddPath(context, path);
-        [theBorderLineStyle strokePathInContext:context];
-
-        CGPathRelease(path);
+        CGPathMoveToPoint(linePath, NULL, alignedHighPoint.x, alignedHighPoint.y);
+        CGPathAddLineToPoint(linePath, NULL, alignedLowPoint.x, alignedLowPoint.y);
     }
 
     // open-close
     if ( !isnan(openValue) && !isnan(closeValue)) {
-        if ( currentBarFill || hasLineStyle ) {
-            CGFloat radius = MIN(self.barCornerRadius, halfBarWidth);
-            radius = MIN(radius, ABS(closeValue - openValue));
-
-            CGPoint alignedPoint1 = CPTPointMake(x + halfBarWidth, openValue);
-            CGPoint alignedPoint2 = CPTPointMake(x + halfBarWidth, closeValue);
-            CGPoint alignedPoint3 = CPTPointMake(x, closeValue);
-            CGPoint alignedPoint4 = CPTPointMake(x - halfBarWidth, closeValue);
-            CGPoint alignedPoint5 = CPTPointMake(x - halfBarWidth, openValue);
-            if ( alignPoints ) {
-                if ( hasLineStyle && self.showBarBorder ) {
-                    alignedPoint1 = alignmentFunction(context, alignedPoint1);
-                    alignedPoint2 = alignmentFunction(context, alignedPoint2);
-                    alignedPoint3 = alignmentFunction(context, alignedPoint3);
-                    alignedPoint4 = alignmentFunction(context, alignedPoint4);
-                    alignedPoint5 = alignmentFunction(context, alignedPoint5);
-                }
-                else {
-                    alignedPoint1 = CPTAlignIntegralPointToUserSpace(context, alignedPoint1);
-                    alignedPoint2 = CPTAlignIntegralPointToUserSpace(context, alignedPoint2);
-                    alignedPoint3 = CPTAlignIntegralPointToUserSpace(context, alignedPoint3);
-                    alignedPoint4 = CPTAlignIntegralPointToUserSpace(context, alignedPoint4);
-                    alignedPoint5 = CPTAlignIntegralPointToUserSpace(context, alignedPoint5);
-                }
-            }
-
-            if ( hasLineStyle && (openValue == closeValue)) {
-                // #285 Draw a cross with open/close values marked
-                const CGFloat halfLineWidth = CPTFloat(0.5) * theBorderLineStyle.lineWidth;
-
-                alignedPoint1.y -= halfLineWidth;
-                alignedPoint2.y += halfLineWidth;
-                alignedPoint3.y += halfLineWidth;
-                alignedPoint4.y += halfLineWidth;
-                alignedPoint5.y -= halfLineWidth;
+        CGFloat radius = MIN(self.barCornerRadius, halfBarWidth);
+        radius = MIN(radius, ABS(closeValue - openValue));
+
+        CGPoint alignedPoint1 = CPTPointMake(x + halfBarWidth, openValue);
+        CGPoint alignedPoint2 = CPTPointMake(x + halfBarWidth, closeValue);
+        CGPoint alignedPoint3 = CPTPointMake(x, closeValue);
+        CGPoint alignedPoint4 = CPTPointMake(x - halfBarWidth, closeValue);
+        CGPoint alignedPoint5 = CPTPointMake(x - halfBarWidth, openValue);
+        if ( alignPoints ) {
+            if ( hasLineStyle && self.showBarBorder ) {
+                alignedPoint1 = alignmentFunction(context, alignedPoint1);
+                alignedPoint2 = alignmentFunction(context, alignedPoint2);
+                alignedPoint3 = alignmentFunction(context, alignedPoint3);
+                alignedPoint4 = alignmentFunction(context, alignedPoint4);
+                alignedPoint5 = alignmentFunction(context, alignedPoint5);
             }
-
-            CGMutablePathRef path = CGPathCreateMutable();
-            CGPathMoveToPoint(path, NULL, alignedPoint1.x, alignedPoint1.y);
-            CGPathAddArcToPoint(path, NULL, alignedPoint2.x, alignedPoint2.y, alignedPoint3.x, alignedPoint3.y, radius);
-            CGPathAddArcToPoint(path, NULL, alignedPoint4.x, alignedPoint4.y, alignedPoint5.x, alignedPoint5.y, radius);
-            CGPathAddLineToPoint(path, NULL, alignedPoint5.x, alignedPoint5.y);
-            CGPathCloseSubpath(path);
-
-            if ( [currentBarFill isKindOfClass:[CPTFill class]] ) {
-                CGContextBeginPath(context);
-                CGContextAddPath(context, path);
-                [currentBarFill fillPathInContext:context];
+            else {
+                alignedPoint1 = CPTAlignIntegralPointToUserSpace(context, alignedPoint1);
+                alignedPoint2 = CPTAlignIntegralPointToUserSpace(context, alignedPoint2);
+                alignedPoint3 = CPTAlignIntegralPointToUserSpace(context, alignedPoint3);
+                alignedPoint4 = CPTAlignIntegralPointToUserSpace(context, alignedPoint4);
+                alignedPoint5 = CPTAlignIntegralPointToUserSpace(context, alignedPoint5);
             }
+        }
 
-            if ( hasLineStyle ) {
-                if ( !self.showBarBorder ) {
-                    CGPathRelease(path);
-                    path = CGPathCreateMutable();
-                }
+        if ( hasLineStyle && (openValue == closeValue)) {
+            // #285 Draw a cross with open/close values marked
+            const CGFloat halfLineWidth = CPTFloat(0.5) * lineStyle.lineWidth;
 
-                if ( !isnan(lowValue)) {
-                    if ( lowValue < MIN(openValue, closeValue)) {
-                        CGPoint alignedStartPoint = CPTPointMake(x, MIN(openValue, closeValue));
-                        CGPoint alignedLowPoint   = CPTPointMake(x, lowValue);
-                        if ( alignPoints ) {
-                            alignedStartPoint = alignmentFunction(context, alignedStartPoint);
-                            alignedLowPoint   = alignmentFunction(context, alignedLowPoint);
-                        }
+            alignedPoint1.y -= halfLineWidth;
+            alignedPoint2.y += halfLineWidth;
+            alignedPoint3.y += halfLineWidth;
+            alignedPoint4.y += halfLineWidth;
+            alignedPoint5.y -= halfLineWidth;
+        }
 
-                        CGPathMoveToPoint(path, NULL, alignedStartPoint.x, alignedStartPoint.y);
-                        CGPathAddLineToPoint(path, NULL, alignedLowPoint.x, alignedLowPoint.y);
+        CGPathMoveToPoint(bodyPath, NULL, alignedPoint1.x, alignedPoint1.y);
+        CGPathAddArcToPoint(bodyPath, NULL, alignedPoint2.x, alignedPoint2.y, alignedPoint3.x, alignedPoint3.y, radius);
+        CGPathAddArcToPoint(bodyPath, NULL, alignedPoint4.x, alignedPoint4.y, alignedPoint5.x, alignedPoint5.y, radius);
+        CGPathAddLineToPoint(bodyPath, NULL, alignedPoint5.x, alignedPoint5.y);
+        CGPathCloseSubpath(bodyPath);
+
+        if ( hasLineStyle ) {
+            if ( !isnan(lowValue)) {
+                if ( lowValue < MIN(openValue, closeValue)) {
+                    CGPoint alignedStartPoint = CPTPointMake(x, MIN(openValue, closeValue));
+                    CGPoint alignedLowPoint   = CPTPointMake(x, lowValue);
+                    if ( alignPoints ) {
+                        alignedStartPoint = alignmentFunction(context, alignedStartPoint);
+                        alignedLowPoint   = alignmentFunction(context, alignedLowPoint);
                     }
-                }
-                if ( !isnan(highValue)) {
-                    if ( highValue > MAX(openValue, closeValue)) {
-                        CGPoint alignedStartPoint = CPTPointMake(x, MAX(openValue, closeValue));
-                        CGPoint alignedHighPoint  = CPTPointMake(x, highValue);
-                        if ( alignPoints ) {
-                            alignedStartPoint = alignmentFunction(context, alignedStartPoint);
-                            alignedHighPoint  = alignmentFunction(context, alignedHighPoint);
-                        }
 
-                        CGPathMoveToPoint(path, NULL, alignedStartPoint.x, alignedStartPoint.y);
-                        CGPathAddLineToPoint(path, NULL, alignedHighPoint.x, alignedHighPoint.y);
-                    }
+                    CGPathMoveToPoint(linePath, NULL, alignedStartPoint.x, alignedStartPoint.y);
+                    CGPathAddLineToPoint(linePath, NULL, alignedLowPoint.x, alignedLowPoint.y);
                 }
-                CGContextBeginPath(context);
-                CGContextAddPath(context, path);
-                [theBorderLineStyle strokePathInContext:context];
             }
+            if ( !isnan(highValue)) {
+                if ( highValue > MAX(openValue, closeValue)) {
+                    CGPoint alignedStartPoint = CPTPointMake(x, MAX(openValue, closeValue));
+                    CGPoint alignedHighPoint  = CPTPointMake(x, highValue);
+                    if ( alignPoints ) {
+                        alignedStartPoint = alignmentFunction(context, alignedStartPoint);
+                        alignedHighPoint  = alignmentFunction(context, alignedHighPoint);
+                    }
 
-            CGPathRelease(path);
+                    CGPathMoveToPoint(linePath, NULL, alignedStartPoint.x, alignedStartPoint.y);
+                    CGPathAddLineToPoint(linePath, NULL, alignedHighPoint.x, alignedHighPoint.y);
+                }
+            }
         }
     }
 }
@@ -1001,75 +1315,89 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
                      low:(CGFloat)lowValue
              alignPoints:(BOOL)alignPoints
 {
-    CPTLineStyle *theLineStyle = [self lineStyleForIndex:idx];
+    CPTLineStyle *theLineStyle = [self OHLCLineStyleForIndex:idx open:openValue close:closeValue];
 
-    if ( !isnan(openValue) && !isnan(closeValue)) {
-        if ( openValue < closeValue ) {
-            CPTLineStyle *lineStyleForIncrease = [self increaseLineStyleForIndex:idx];
-            if ( [lineStyleForIncrease isKindOfClass:[CPTLineStyle class]] ) {
-                theLineStyle = lineStyleForIncrease;
-            }
-        }
-        else if ( openValue > closeValue ) {
-            CPTLineStyle *lineStyleForDecrease = [self decreaseLineStyleForIndex:idx];
-            if ( [lineStyleForDecrease isKindOfClass:[CPTLineStyle class]] ) {
-                theLineStyle = lineStyleForDecrease;
-            }
-        }
-    }
+    if ( theLineStyle ) {
+        CGMutablePathRef path = CGPathCreateMutable();
 
-    if ( [theLineStyle isKindOfClass:[CPTLineStyle class]] ) {
-        CGFloat theStickLength = self.stickLength;
-        CGMutablePathRef path  = CGPathCreateMutable();
+        [self addOHLCToPath:path
+                  inContext:context
+                          x:x
+                       open:openValue
+                      close:closeValue
+                       high:highValue
+                        low:lowValue
+                  lineStyle:theLineStyle
+                alignPoints:alignPoints];
 
-        CPTAlignPointFunction alignmentFunction = CPTAlignPointToUserSpace;
+        CGContextBeginPath(context);
+        CGContextAddPath(context, path);
+        [theLineStyle setLineStyleInContext:context];
+        [theLineStyle strokePathInContext:context];
+        CGPathRelease(path);
+    }
+}
 
-        CGFloat lineWidth = theLineStyle.lineWidth;
-        if ((self.contentsScale > CPTFloat(1.0)) && (round(lineWidth) == lineWidth)) {
-            alignmentFunction = CPTAlignIntegralPointToUserSpace;
-        }
+/** @internal
+ *  @brief Adds the lines of an OHLC symbol to a path.
+ *  @param path The path.
+ *  @param context The graphics context used to align the points to device pixels.
+ *  @param x The x coordinate of the symbol.
+ *  @param openValue The y coordinate of the open value.
+ *  @param closeValue The y coordinate of the close value.
+ *  @param highValue The y coordinate of the high value.
+ *  @param lowValue The y coordinate of the low value.
+ *  @param lineStyle The line style used to draw the symbol.
+ *  @param alignPoints If @YES, align the points to device pixels.
+ **/
+-(void)addOHLCToPath:(nonnull CGMutablePathRef)path
+           inContext:(nonnull CGContextRef)context
+                   x:(CGFloat)x
+                open:(CGFloat)openValue
+               close:(CGFloat)closeValue
+                high:(CGFloat)highValue
+                 low:(CGFloat)lowValue
+           lineStyle:(nonnull CPTLineStyle *)lineStyle
+         alignPoints:(BOOL)alignPoints
+{
+    CGFloat theStickLength = self.stickLength;
 
-        // high-low
-        if ( !isnan(highValue) && !isnan(lowValue)) {
-            CGPoint alignedHighPoint = CPTPointMake(x, highValue);
-            CGPoint alignedLowPoint  = CPTPointMake(x, lowValue);
-            if ( alignPoints ) {
-                alignedHighPoint = alignmentFunction(context, alignedHighPoint);
-                alignedLowPoint  = alignmentFunction(context, alignedLowPoint);
-            }
-            CGPathMoveToPoint(path, NULL, alignedHighPoint.x, alignedHighPoint.y);
-            CGPathAddLineToPoint(path, NULL, alignedLowPoint.x, alignedLowPoint.y);
-        }
+    CPTAlignPointFunction alignmentFunction = [self alignmentFunctionForLineStyle:lineStyle];
 
-        // open
-        if ( !isnan(openValue)) {
-            CGPoint alignedOpenStartPoint = CPTPointMake(x, openValue);
-            CGPoint alignedOpenEndPoint   = CPTPointMake(x - theStickLength, openValue); // left side
-            if ( alignPoints ) {
-                alignedOpenStartPoint = alignmentFunction(context, alignedOpenStartPoint);
-                alignedOpenEndPoint   = alignmentFunction(context, alignedOpenEndPoint);
-            }
-            CGPathMoveToPoint(path, NULL, alignedOpenStartPoint.x, alignedOpenStartPoint.y);
-            CGPathAddLineToPoint(path, NULL, alignedOpenEndPoint.x, alignedOpenEndPoint.y);
+    // high-low
+    if ( !isnan(highValue) && !isnan(lowValue)) {
+        CGPoint alignedHighPoint = CPTPointMake(x, highValue);
+        CGPoint alignedLowPoint  = CPTPointMake(x, lowValue);
+        if ( alignPoints ) {
+            alignedHighPoint = alignmentFunction(context, alignedHighPoint);
+            alignedLowPoint  = alignmentFunction(context, alignedLowPoint);
         }
+        CGPathMoveToPoint(path, NULL, alignedHighPoint.x, alignedHighPoint.y);
+        CGPathAddLineToPoint(path, NULL, alignedLowPoint.x, alignedLowPoint.y);
+    }
 
-        // close
-        if ( !isnan(closeValue)) {
-            CGPoint alignedCloseStartPoint = CPTPointMake(x, closeValue);
-            CGPoint alignedCloseEndPoint   = CPTPointMake(x + theStickLength, closeValue); // right side
-            if ( alignPoints ) {
-                alignedCloseStartPoint = alignmentFunction(context, alignedCloseStartPoint);
-                alignedCloseEndPoint   = alignmentFunction(context, alignedCloseEndPoint);
-            }
-            CGPathMoveToPoint(path, NULL, alignedCloseStartPoint.x, alignedCloseStartPoint.y);
-            CGPathAddLineToPoint(path, NULL, alignedCloseEndPoint.x, alignedCloseEndPoint.y);
+    // open
+    if ( !isnan(openValue)) {
+        CGPoint alignedOpenStartPoint = CPTPointMake(x, openValue);
+        CGPoint alignedOpenEndPoint   = CPTPointMake(x - theStickLength, openValue); // left side
+        if ( alignPoints ) {
+            alignedOpenStartPoint = alignmentFunction(context, alignedOpenStartPoint);
+            alignedOpenEndPoint   = alignmentFunction(context, alignedOpenEndPoint);
         }
+        CGPathMoveToPoint(path, NULL, alignedOpenStartPoint.x, alignedOpenStartPoint.y);
+        CGPathAddLineToPoint(path, NULL, alignedOpenEndPoint.x, alignedOpenEndPoint.y);
+    }
 
-        CGContextBeginPath(context);
-        CGContextAddPath(context, path);
-        [theLineStyle setLineStyleInContext:context];
-        [theLineStyle strokePathInContext:context];
-        CGPathRelease(path);
+    // close
+    if ( !isnan(closeValue)) {
+        CGPoint alignedCloseStartPoint = CPTPointMake(x, closeValue);
+        CGPoint alignedCloseEndPoint   = CPTPointMake(x + theStickLength, closeValue); // right side
+        if ( alignPoints ) {
+            alignedCloseStartPoint = alignmentFunction(context, alignedCloseStartPoint);
+            alignedCloseEndPoint   = alignmentFunction(context, alignedCloseEndPoint);
+        }
+        CGPathMoveToPoint(path, NULL, alignedCloseStartPoint.x, alignedCloseStartPoint.y);
+        CGPathAddLineToPoint(path, NULL, alignedCloseEndPoint.x, alignedCloseEndPoint.y);
     }
 }
 
@@ -1352,12 +1680,13 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
     NSUInteger result              = NSNotFound;
     CGFloat minimumDistanceSquared = CPTNAN;
 
-    if ( self.doublePrecisionCache ) {
-        const double *locationBytes = (const double *)locations.data.bytes;
-        const double *openBytes     = (const double *)opens.data.bytes;
-        const double *highBytes     = (const double *)highs.data.bytes;
-        const double *lowBytes      = (const double *)lows.data.bytes;
-        const double *closeBytes    = (const double *)closes.data.bytes;
+    if ( self.doublePrecisionCache || self.floatPrecisionCache ) {
+        NSRange allRecords          = NSMakeRange(0, dataCount);
+        const double *locationBytes = (const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldX recordIndexRange:allRecords].bytes;
+        const double *openBytes     = (const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldOpen recordIndexRange:allRecords].bytes;
+        const double *highBytes     = (const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldHigh recordIndexRange:allRecords].bytes;
+        const double *lowBytes      = (const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldLow recordIndexRange:allRecords].bytes;
+        const double *closeBytes    = (const double *)[self cachedDoublesForField:CPTTradingRangePlotFieldClose recordIndexRange:allRecords].bytes;
 
         for ( NSUInteger i = 0; i < dataCount; i++ ) {
             double plotPoint[2];
@@ -1445,11 +1774,11 @@ static const CPTCoordinate dependentCoord   = CPTCoordinateY;
         }
     }
     else {
-        const NSDecimal *locationBytes = (const NSDecimal *)locations.data.bytes;
-        const NSDecimal *openBytes     = (const NSDecimal *)opens.data.bytes;
-        const NSDecimal *highBytes     = (const NSDecimal *)highs.data.bytes;
-        const NSDecimal *lowBytes      = (const NSDecimal *)lows.data.bytes;
-        const NSDecimal *closeBytes    = (const NSDecimal *)closes.data.bytes;
+        const NSDecimal *locationBytes = (const NSDecimal *)locations.bytes;
+        const NSDecimal *openBytes     = (const NSDecimal *)opens.bytes;
+        const NSDecimal *highBytes     = (const NSDecimal *)highs.bytes;
+        const NSDecimal *lowBytes      = (const NSDecimal *)lows.bytes;
+        const NSDecimal *closeBytes    = (const NSDecimal *)closes.bytes;
 
         for ( NSUInteger i = 0; i < dataCount; i++ ) {
             NSDecimal plotPoint[2];
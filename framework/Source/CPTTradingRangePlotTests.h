@@ -0,0 +1,12 @@
+#import "CPTTestCase.h"
+#import "CPTTradingRangePlot.h"
+
+@class CPTXYGraph;
+
+@interface CPTTradingRangePlotTests : CPTTestCase<CPTTradingRangePlotDataSource>
+
+@property (nonatomic, readwrite, strong, nullable) CPTXYGraph *graph;
+@property (nonatomic, readwrite, strong, nullable) CPTTradingRangePlot *plot;
+@property (nonatomic, readwrite, strong, nullable) NSArray<CPTNumberArray *> *records;
+
+@end
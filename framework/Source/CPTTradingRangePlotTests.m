@@ -0,0 +1,215 @@
+#import "CPTTradingRangePlotTests.h"
+
+#import "CPTColor.h"
+#import "CPTFill.h"
+#import "CPTLineStyle.h"
+#import "CPTPlotRange.h"
+#import "CPTUtilities.h"
+#import "CPTXYGraph.h"
+#import "CPTXYPlotSpace.h"
+
+@interface CPTTradingRangePlot(Testing)
+
+-(NSRange)visibleRecordIndexRangeForNumberOfRecords:(NSUInteger)sampleCount;
+-(NSRange)indexRangeForSortedField:(NSUInteger)fieldEnum plotRange:(nonnull CPTPlotRange *)plotRange;
+
+@end
+
+@implementation CPTTradingRangePlotTests
+
+@synthesize graph;
+@synthesize plot;
+@synthesize records;
+
+-(void)setUp
+{
+    self.graph = [[CPTXYGraph alloc] initWithFrame:CPTRectMake(0.0, 0.0, 100.0, 100.0)];
+
+    self.graph.paddingLeft   = 0.0;
+    self.graph.paddingRight  = 0.0;
+    self.graph.paddingTop    = 0.0;
+    self.graph.paddingBottom = 0.0;
+
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)self.graph.defaultPlotSpace;
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@10.0];
+    plotSpace.yRange = [CPTPlotRange plotRangeWithLocation:@0.0 length:@10.0];
+
+    // x, open, high, low, close
+    NSMutableArray<CPTNumberArray *> *sortedRecords = [NSMutableArray arrayWithCapacity:20];
+
+    for ( NSUInteger i = 0; i < 20; i++ ) {
+        [sortedRecords addObject:@[@(i), @2.0, @8.0, @1.0, @6.0]];
+    }
+    self.records = sortedRecords;
+
+    self.plot = [[CPTTradingRangePlot alloc] init];
+
+    self.plot.cachePrecision    = CPTPlotCachePrecisionFloat;
+    self.plot.lineStyle         = [CPTLineStyle lineStyle];
+    self.plot.increaseLineStyle = nil;
+    self.plot.decreaseLineStyle = nil;
+    self.plot.barWidth          = 5.0;
+    self.plot.stickLength       = 3.0;
+    self.plot.dataSource        = self;
+    [self.graph addPlot:self.plot];
+
+    [self.graph layoutIfNeeded];
+    [self.plot reloadDataIfNeeded];
+}
+
+-(void)tearDown
+{
+    self.plot    = nil;
+    self.graph   = nil;
+    self.records = nil;
+}
+
+#pragma mark -
+#pragma mark Sorted Fields
+
+-(void)testIndexRangeForSortedField
+{
+    CPTTradingRangePlot *tradingRangePlot = self.plot;
+
+    NSRange indexRange = [tradingRangePlot indexRangeForSortedField:CPTTradingRangePlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@2.5 length:@5.0]];
+
+    XCTAssertEqual(indexRange.location, (NSUInteger)3, @"First index");
+    XCTAssertEqual(indexRange.length, (NSUInteger)5, @"Number of indices");
+
+    indexRange = [tradingRangePlot indexRangeForSortedField:CPTTradingRangePlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@3.0 length:@4.0]];
+
+    XCTAssertEqual(indexRange.location, (NSUInteger)3, @"First index on a value");
+    XCTAssertEqual(indexRange.length, (NSUInteger)5, @"Number of indices ending on a value");
+
+    indexRange = [tradingRangePlot indexRangeForSortedField:CPTTradingRangePlotFieldX plotRange:[CPTPlotRange plotRangeWithLocation:@(-10.0) length:@5.0]];
+
+    XCTAssertEqual(indexRange.location, (NSUInteger)0, @"First index below the data");
+    XCTAssertEqual(indexRange.length, (NSUInteger)0, @"Number of indices below the data");
+
+    // the open values are constant, which counts as sorted
+    indexRange = [tradingRangePlot indexRangeForSortedField:CPTTradingRangePlotFieldOpen plotRange:[CPTPlotRange plotRangeWithLocation:@0.0 length:@1.0]];
+
+    XCTAssertEqual(indexRange.location, (NSUInteger)0, @"First index of constant values");
+    XCTAssertEqual(indexRange.length, (NSUInteger)0, @"Number of indices of constant values");
+
+    // the high values are not sorted
+    NSMutableArray<CPTNumberArray *> *unsortedRecords = [self.records mutableCopy];
+
+    unsortedRecords[5] = @[@5.0, @2.0, @9.0, @1.0, @6.0];
+    unsortedRecords[6] = @[@6.0, @2.0, @3.0, @1.0, @2.5];
+    self.records       = unsortedRecords;
+    [tradingRangePlot reloadData];
+
+    indexRange = [tradingRangePlot indexRangeForSortedField:CPTTradingRangePlotFieldHigh plotRange:[CPTPlotRange plotRangeWithLocation:@0.0 length:@10.0]];
+
+    XCTAssertEqual(indexRange.location, (NSUInteger)NSNotFound, @"Unsorted values");
+}
+
+#pragma mark -
+#pragma mark Culling
+
+-(void)testVisibleRecordIndexRange
+{
+    CPTTradingRangePlot *tradingRangePlot = self.plot;
+    CPTXYPlotSpace *plotSpace             = (CPTXYPlotSpace *)self.graph.defaultPlotSpace;
+
+    // ten view units per x unit; candles extend four view units on each side including the line width and a pixel for rounding
+    NSRange recordRange = [tradingRangePlot visibleRecordIndexRangeForNumberOfRecords:20];
+
+    XCTAssertEqual(recordRange.location, (NSUInteger)0, @"Location of visible candles");
+    XCTAssertEqual(recordRange.length, (NSUInteger)11, @"Number of visible candles");
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@5.44 length:@10.0];
+    recordRange      = [tradingRangePlot visibleRecordIndexRangeForNumberOfRecords:20];
+
+    XCTAssertEqual(recordRange.location, (NSUInteger)6, @"Location of scrolled visible candles");
+    XCTAssertEqual(recordRange.length, (NSUInteger)10, @"Number of scrolled visible candles");
+
+    // OHLC symbols extend by the stick length instead of half of the bar width
+    tradingRangePlot.plotStyle = CPTTradingRangePlotStyleOHLC;
+    recordRange                = [tradingRangePlot visibleRecordIndexRangeForNumberOfRecords:20];
+
+    XCTAssertEqual(recordRange.location, (NSUInteger)5, @"Location of scrolled visible OHLC symbols");
+    XCTAssertEqual(recordRange.length, (NSUInteger)11, @"Number of scrolled visible OHLC symbols");
+
+    // reversed axis
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@15.44 length:@(-10.0)];
+    recordRange      = [tradingRangePlot visibleRecordIndexRangeForNumberOfRecords:20];
+
+    XCTAssertEqual(recordRange.location, (NSUInteger)5, @"Location of visible symbols on a reversed axis");
+    XCTAssertEqual(recordRange.length, (NSUInteger)11, @"Number of visible symbols on a reversed axis");
+
+    // unsorted x values are tested one record at a time
+    NSMutableArray<CPTNumberArray *> *unsortedRecords = [self.records mutableCopy];
+
+    [unsortedRecords exchangeObjectAtIndex:2 withObjectAtIndex:12];
+    self.records = unsortedRecords;
+    [tradingRangePlot reloadData];
+
+    recordRange = [tradingRangePlot visibleRecordIndexRangeForNumberOfRecords:20];
+
+    XCTAssertEqual(recordRange.location, (NSUInteger)0, @"Location of unsorted records");
+    XCTAssertEqual(recordRange.length, (NSUInteger)20, @"Number of unsorted records");
+}
+
+#pragma mark -
+#pragma mark Drawing
+
+-(void)testCandlesAreDrawnInRecordOrder
+{
+    // three overlapping candles; the first and last share the increase fill
+    self.records = @[@[@2.0, @2.0, @8.0, @1.0, @6.0],
+                     @[@2.3, @6.0, @8.0, @1.0, @2.0],
+                     @[@2.6, @2.0, @8.0, @1.0, @6.0]];
+
+    CPTTradingRangePlot *tradingRangePlot = self.plot;
+
+    tradingRangePlot.barWidth     = 10.0;
+    tradingRangePlot.lineStyle    = nil;
+    tradingRangePlot.increaseFill = [CPTFill fillWithColor:[CPTColor redColor]];
+    tradingRangePlot.decreaseFill = [CPTFill fillWithColor:[CPTColor blueColor]];
+    [tradingRangePlot reloadData];
+
+    const size_t width  = 100;
+    const size_t height = 100;
+
+    size_t bytesPerRow = 4 * width;
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context       = CGBitmapContextCreate(NULL, width, height, 8, bytesPerRow, colorSpace, (CGBitmapInfo)kCGImageAlphaPremultipliedLast);
+
+    [tradingRangePlot renderAsVectorInContext:context];
+
+    const uint8_t *pixels = (const uint8_t *)CGBitmapContextGetData(context);
+
+    // all three bodies cover this point; the last candle is on top
+    const uint8_t *pixel = pixels + (height - 1 - 40) * bytesPerRow + 4 * 23;
+
+    XCTAssertGreaterThan(pixel[0], 200, @"Last candle on top");
+    XCTAssertLessThan(pixel[2], 50, @"Last candle on top");
+
+    // only the first two bodies cover this point
+    pixel = pixels + (height - 1 - 40) * bytesPerRow + 4 * 19;
+
+    XCTAssertLessThan(pixel[0], 50, @"Second candle on top of the first");
+    XCTAssertGreaterThan(pixel[2], 200, @"Second candle on top of the first");
+
+    CGContextRelease(context);
+    CGColorSpaceRelease(colorSpace);
+}
+
+#pragma mark -
+#pragma mark Plot Data Source Methods
+
+-(NSUInteger)numberOfRecordsForPlot:(nonnull CPTPlot *__unused)thePlot
+{
+    return self.records.count;
+}
+
+-(nullable id)numberForPlot:(nonnull CPTPlot *__unused)thePlot field:(NSUInteger)fieldEnum recordIndex:(NSUInteger)idx
+{
+    return self.records[idx][fieldEnum];
+}
+
+@end
@@ -11,17 +11,26 @@
 #import "CPTUtilities.h"
 #import "CPTXYPlotSpace.h"
 #import "NSCoderExtensions.h"
+#import "_CPTSortedTickLocations.h"
 #import <tgmath.h>
 
 /// @cond
+@interface CPTAxis(CPTSortedTickLocations)
+
+@property (nonatomic, readonly, strong, nullable) _CPTSortedTickLocations *sortedMajorTickLocations;
+@property (nonatomic, readonly, strong, nullable) _CPTSortedTickLocations *sortedMinorTickLocations;
+
+@end
+
 @interface CPTXYAxis()
 
--(void)drawTicksInContext:(nonnull CGContextRef)context atLocations:(nullable CPTNumberSet *)locations withLength:(CGFloat)length inRange:(nullable CPTPlotRange *)labeledRange isMajor:(BOOL)major;
+-(void)drawTicksInContext:(nonnull CGContextRef)context lineStyle:(nullable CPTLineStyle *)lineStyle majorLocations:(nullable _CPTSortedTickLocations *)majorLocations minorLocations:(nullable _CPTSortedTickLocations *)minorLocations inRange:(nullable CPTPlotRange *)labeledRange;
+-(void)addTicksInContext:(nonnull CGContextRef)context atLocations:(nullable _CPTSortedTickLocations *)locations withLength:(CGFloat)length inRange:(nullable CPTPlotRange *)labeledRange alignmentFunction:(nonnull CPTAlignPointFunction)alignmentFunction;
 
 -(void)orthogonalCoordinateViewLowerBound:(nonnull CGFloat *)lower upperBound:(nonnull CGFloat *)upper;
 -(CGPoint)viewPointForOrthogonalCoordinate:(nullable NSNumber *)orthogonalCoord axisCoordinate:(nullable NSNumber *)coordinateValue;
 
--(NSUInteger)initialBandIndexForSortedLocations:(nonnull CPTNumberArray *)sortedLocations inRange:(nullable CPTMutablePlotRange *)range;
+-(NSUInteger)initialBandIndexForSortedLocations:(nonnull _CPTSortedTickLocations *)sortedLocations ascending:(BOOL)ascending inRange:(nullable CPTMutablePlotRange *)range;
 
 @end
 
@@ -226,10 +235,8 @@
 
 /// @cond
 
--(void)drawTicksInContext:(nonnull CGContextRef)context atLocations:(nullable CPTNumberSet *)locations withLength:(CGFloat)length inRange:(nullable CPTPlotRange *)labeledRange isMajor:(BOOL)major
+-(void)drawTicksInContext:(nonnull CGContextRef)context lineStyle:(nullable CPTLineStyle *)lineStyle majorLocations:(nullable _CPTSortedTickLocations *)majorLocations minorLocations:(nullable _CPTSortedTickLocations *)minorLocations inRange:(nullable CPTPlotRange *)labeledRange
 {
-    CPTLineStyle *lineStyle = (major ? self.majorTickLineStyle : self.minorTickLineStyle);
-
     if ( !lineStyle ) {
         return;
     }
@@ -247,57 +254,115 @@
     [lineStyle setLineStyleInContext:context];
     CGContextBeginPath(context);
 
-    for ( NSDecimalNumber *tickLocation in locations ) {
-        if ( labeledRange && ![labeledRange containsNumber:tickLocation] ) {
-            continue;
-        }
+    [self addTicksInContext:context atLocations:minorLocations withLength:self.minorTickLength inRange:labeledRange alignmentFunction:alignmentFunction];
+    [self addTicksInContext:context atLocations:majorLocations withLength:self.majorTickLength inRange:labeledRange alignmentFunction:alignmentFunction];
 
-        // Tick end points
-        CGPoint baseViewPoint  = [self viewPointForCoordinateValue:tickLocation];
-        CGPoint startViewPoint = baseViewPoint;
-        CGPoint endViewPoint   = baseViewPoint;
+    // Stroke tick line
+    [lineStyle strokePathInContext:context];
+}
 
-        CGFloat startFactor = CPTFloat(0.0);
-        CGFloat endFactor   = CPTFloat(0.0);
-        switch ( self.tickDirection ) {
-            case CPTSignPositive:
-                endFactor = CPTFloat(1.0);
-                break;
+-(void)addTicksInContext:(nonnull CGContextRef)context atLocations:(nullable _CPTSortedTickLocations *)locations withLength:(CGFloat)length inRange:(nullable CPTPlotRange *)labeledRange alignmentFunction:(nonnull CPTAlignPointFunction)alignmentFunction
+{
+    NSUInteger locationCount = locations.count;
 
-            case CPTSignNegative:
-                endFactor = CPTFloat(-1.0);
-                break;
+    if ( locationCount == 0 ) {
+        return;
+    }
 
-            case CPTSignNone:
-                startFactor = CPTFloat(-0.5);
-                endFactor   = CPTFloat(0.5);
-                break;
+    CPTCoordinate selfCoordinate       = self.coordinate;
+    CPTCoordinate orthogonalCoordinate = CPTOrthogonalCoordinate(selfCoordinate);
+
+    // Tick end points relative to the axis
+    CGFloat startFactor = CPTFloat(0.0);
+    CGFloat endFactor   = CPTFloat(0.0);
+    switch ( self.tickDirection ) {
+        case CPTSignPositive:
+            endFactor = CPTFloat(1.0);
+            break;
+
+        case CPTSignNegative:
+            endFactor = CPTFloat(-1.0);
+            break;
+
+        case CPTSignNone:
+            startFactor = CPTFloat(-0.5);
+            endFactor   = CPTFloat(0.5);
+            break;
+    }
+
+    CGPoint startOffset = CGPointZero;
+    CGPoint endOffset   = CGPointZero;
+
+    switch ( selfCoordinate ) {
+        case CPTCoordinateX:
+            startOffset.y = length * startFactor;
+            endOffset.y   = length * endFactor;
+            break;
+
+        case CPTCoordinateY:
+            startOffset.x = length * startFactor;
+            endOffset.x   = length * endFactor;
+            break;
+
+        default:
+            NSLog(@"Invalid coordinate in [CPTXYAxis drawTicksInContext:]");
+    }
+
+    // Axis position--the same for every tick
+    CPTPlotSpace *thePlotSpace = self.plotSpace;
+    CGPoint originTransformed  = [self convertPoint:self.bounds.origin fromLayer:self.plotArea];
+
+    double plotPoint[2];
+    plotPoint[orthogonalCoordinate] = self.orthogonalPosition.doubleValue;
+
+    CPTConstraints *theAxisConstraints = self.axisConstraints;
+    CGFloat constrainedPosition        = CPTFloat(0.0);
+
+    if ( theAxisConstraints ) {
+        CGFloat lb, ub;
+        [self orthogonalCoordinateViewLowerBound:&lb upperBound:&ub];
+        constrainedPosition = [theAxisConstraints positionForLowerBound:lb upperBound:ub];
+    }
+
+    const double *locationValues = locations.doubleValues;
+
+    for ( NSUInteger i = 0; i < locationCount; i++ ) {
+        if ( labeledRange && ![locations locationAtIndex:i isInRange:labeledRange] ) {
+            continue;
         }
 
-        switch ( self.coordinate ) {
-            case CPTCoordinateX:
-                startViewPoint.y += length * startFactor;
-                endViewPoint.y   += length * endFactor;
-                break;
+        plotPoint[selfCoordinate] = locationValues[i];
 
-            case CPTCoordinateY:
-                startViewPoint.x += length * startFactor;
-                endViewPoint.x   += length * endFactor;
-                break;
+        CGPoint baseViewPoint = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
+        baseViewPoint.x += originTransformed.x;
+        baseViewPoint.y += originTransformed.y;
 
-            default:
-                NSLog(@"Invalid coordinate in [CPTXYAxis drawTicksInContext:]");
+        if ( theAxisConstraints ) {
+            switch ( selfCoordinate ) {
+                case CPTCoordinateX:
+                    baseViewPoint.y = constrainedPosition;
+                    break;
+
+                case CPTCoordinateY:
+                    baseViewPoint.x = constrainedPosition;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        if ( isnan(baseViewPoint.x) || isnan(baseViewPoint.y)) {
+            continue;
         }
 
-        startViewPoint = alignmentFunction(context, startViewPoint);
-        endViewPoint   = alignmentFunction(context, endViewPoint);
+        CGPoint startViewPoint = alignmentFunction(context, CPTPointMake(baseViewPoint.x + startOffset.x, baseViewPoint.y + startOffset.y));
+        CGPoint endViewPoint   = alignmentFunction(context, CPTPointMake(baseViewPoint.x + endOffset.x, baseViewPoint.y + endOffset.y));
 
         // Add tick line
         CGContextMoveToPoint(context, startViewPoint.x, startViewPoint.y);
         CGContextAddLineToPoint(context, endViewPoint.x, endViewPoint.y);
     }
-    // Stroke tick line
-    [lineStyle strokePathInContext:context];
 }
 
 -(void)renderAsVectorInContext:(nonnull CGContextRef)context
@@ -330,8 +395,17 @@
     }
 
     // Ticks
-    [self drawTicksInContext:context atLocations:self.minorTickLocations withLength:self.minorTickLength inRange:labeledRange isMajor:NO];
-    [self drawTicksInContext:context atLocations:self.majorTickLocations withLength:self.majorTickLength inRange:labeledRange isMajor:YES];
+    CPTLineStyle *theMajorTickLineStyle = self.majorTickLineStyle;
+    CPTLineStyle *theMinorTickLineStyle = self.minorTickLineStyle;
+
+    if ( theMinorTickLineStyle == theMajorTickLineStyle ) {
+        // Stroke major and minor ticks as one path when they share a line style
+        [self drawTicksInContext:context lineStyle:theMajorTickLineStyle majorLocations:self.sortedMajorTickLocations minorLocations:self.sortedMinorTickLocations inRange:labeledRange];
+    }
+    else {
+        [self drawTicksInContext:context lineStyle:theMinorTickLineStyle majorLocations:nil minorLocations:self.sortedMinorTickLocations inRange:labeledRange];
+        [self drawTicksInContext:context lineStyle:theMajorTickLineStyle majorLocations:self.sortedMajorTickLocations minorLocations:nil inRange:labeledRange];
+    }
 
     // Axis Line
     CPTLineStyle *theLineStyle = self.axisLineStyle;
@@ -406,7 +480,7 @@
         [self relabel];
 
         CPTPlotSpace *thePlotSpace           = self.plotSpace;
-        CPTNumberSet *locations              = (major ? self.majorTickLocations : self.minorTickLocations);
+        _CPTSortedTickLocations *locations   = (major ? self.sortedMajorTickLocations : self.sortedMinorTickLocations);
         CPTCoordinate selfCoordinate         = self.coordinate;
         CPTCoordinate orthogonalCoordinate   = CPTOrthogonalCoordinate(selfCoordinate);
         CPTMutablePlotRange *orthogonalRange = [[thePlotSpace plotRangeForCoordinate:orthogonalCoordinate] mutableCopy];
@@ -434,10 +508,10 @@
         }
 
         CPTPlotArea *thePlotArea = self.plotArea;
-        NSDecimal startPlotPoint[2];
-        NSDecimal endPlotPoint[2];
-        startPlotPoint[orthogonalCoordinate] = orthogonalRange.locationDecimal;
-        endPlotPoint[orthogonalCoordinate]   = orthogonalRange.endDecimal;
+        double startPlotPoint[2];
+        double endPlotPoint[2];
+        startPlotPoint[orthogonalCoordinate] = orthogonalRange.locationDouble;
+        endPlotPoint[orthogonalCoordinate]   = orthogonalRange.endDouble;
         CGPoint originTransformed = [self convertPoint:self.bounds.origin fromLayer:thePlotArea];
 
         CGFloat lineWidth = lineStyle.lineWidth;
@@ -452,23 +526,24 @@
 
         CGContextBeginPath(context);
 
-        for ( NSDecimalNumber *location in locations ) {
-            NSDecimal locationDecimal = location.decimalValue;
+        NSUInteger locationCount     = locations.count;
+        const double *locationValues = locations.doubleValues;
 
-            if ( labeledRange && ![labeledRange contains:locationDecimal] ) {
+        for ( NSUInteger i = 0; i < locationCount; i++ ) {
+            if ( labeledRange && ![locations locationAtIndex:i isInRange:labeledRange] ) {
                 continue;
             }
 
-            startPlotPoint[selfCoordinate] = locationDecimal;
-            endPlotPoint[selfCoordinate]   = locationDecimal;
+            startPlotPoint[selfCoordinate] = locationValues[i];
+            endPlotPoint[selfCoordinate]   = locationValues[i];
 
             // Start point
-            CGPoint startViewPoint = [thePlotSpace plotAreaViewPointForPlotPoint:startPlotPoint numberOfCoordinates:2];
+            CGPoint startViewPoint = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:startPlotPoint numberOfCoordinates:2];
             startViewPoint.x += originTransformed.x;
             startViewPoint.y += originTransformed.y;
 
             // End point
-            CGPoint endViewPoint = [thePlotSpace plotAreaViewPointForPlotPoint:endPlotPoint numberOfCoordinates:2];
+            CGPoint endViewPoint = [thePlotSpace plotAreaViewPointForDoublePrecisionPlotPoint:endPlotPoint numberOfCoordinates:2];
             endViewPoint.x += originTransformed.x;
             endViewPoint.y += originTransformed.y;
 
@@ -494,7 +569,7 @@
 
 /// @cond
 
--(NSUInteger)initialBandIndexForSortedLocations:(CPTNumberArray *)sortedLocations inRange:(CPTMutablePlotRange *)range
+-(NSUInteger)initialBandIndexForSortedLocations:(nonnull _CPTSortedTickLocations *)sortedLocations ascending:(BOOL)ascending inRange:(nullable CPTMutablePlotRange *)range
 {
     NSUInteger bandIndex = 0;
 
@@ -523,6 +598,9 @@
 
         const NSDecimal zero = CPTDecimalFromInteger(0);
 
+        NSUInteger locationCount  = sortedLocations.count;
+        const NSDecimal *decimals = sortedLocations.decimalValues;
+
         // Set starting coord--should be the smallest value >= rangeMin that is a whole multiple of majorInterval away from the alternatingBandAnchor
         NSDecimal coord         = zero;
         NSDecimal majorInterval = zero;
@@ -530,12 +608,12 @@
         switch ( self.labelingPolicy ) {
             case CPTAxisLabelingPolicyAutomatic:
             case CPTAxisLabelingPolicyEqualDivisions:
-                if ( sortedLocations.count > 1 ) {
-                    if ( range.lengthDouble >= 0.0 ) {
-                        majorInterval = CPTDecimalSubtract(sortedLocations[1].decimalValue, sortedLocations[0].decimalValue);
+                if ( locationCount > 1 ) {
+                    if ( ascending ) {
+                        majorInterval = CPTDecimalSubtract(decimals[1], decimals[0]);
                     }
                     else {
-                        majorInterval = CPTDecimalSubtract(sortedLocations[0].decimalValue, sortedLocations[1].decimalValue);
+                        majorInterval = CPTDecimalSubtract(decimals[locationCount - 1], decimals[locationCount - 2]);
                     }
                 }
                 break;
@@ -550,9 +628,9 @@
             case CPTAxisLabelingPolicyNone:
             {
                 // user provided tick locations; they're not guaranteed to be evenly spaced, but band drawing always starts with the first location
-                if ( range.lengthDouble >= 0.0 ) {
-                    for ( NSNumber *location in sortedLocations ) {
-                        if ( CPTDecimalLessThan(anchor, location.decimalValue)) {
+                if ( ascending ) {
+                    for ( NSUInteger i = 0; i < locationCount; i++ ) {
+                        if ( CPTDecimalLessThan(anchor, decimals[i])) {
                             break;
                         }
 
@@ -560,8 +638,8 @@
                     }
                 }
                 else {
-                    for ( NSNumber *location in sortedLocations ) {
-                        if ( CPTDecimalGreaterThanOrEqualTo(anchor, location.decimalValue)) {
+                    for ( NSUInteger i = locationCount; i > 0; i-- ) {
+                        if ( CPTDecimalGreaterThanOrEqualTo(anchor, decimals[i - 1])) {
                             break;
                         }
 
@@ -597,9 +675,10 @@
     NSUInteger bandCount    = bandArray.count;
 
     if ( bandCount > 0 ) {
-        CPTNumberArray *locations = self.majorTickLocations.allObjects;
+        _CPTSortedTickLocations *locations = self.sortedMajorTickLocations;
+        NSUInteger locationCount           = locations.count;
 
-        if ( locations.count > 0 ) {
+        if ( locationCount > 0 ) {
             CPTPlotSpace *thePlotSpace = self.plotSpace;
 
             CPTCoordinate selfCoordinate = self.coordinate;
@@ -619,22 +698,15 @@
                 [orthogonalRange intersectionPlotRange:theGridLineRange];
             }
 
-            const NSDecimal zero             = CPTDecimalFromInteger(0);
-            NSSortDescriptor *sortDescriptor = nil;
+            const NSDecimal zero = CPTDecimalFromInteger(0);
+
+            // Bands run from the start of the range toward its end
+            BOOL ascending = YES;
             if ( range ) {
-                if ( CPTDecimalGreaterThanOrEqualTo(range.lengthDecimal, zero)) {
-                    sortDescriptor = [[NSSortDescriptor alloc] initWithKey:nil ascending:YES];
-                }
-                else {
-                    sortDescriptor = [[NSSortDescriptor alloc] initWithKey:nil ascending:NO];
-                }
+                ascending = CPTDecimalGreaterThanOrEqualTo(range.lengthDecimal, zero);
             }
-            else {
-                sortDescriptor = [[NSSortDescriptor alloc] initWithKey:nil ascending:YES];
-            }
-            locations = [locations sortedArrayUsingDescriptors:@[sortDescriptor]];
 
-            NSUInteger bandIndex = [self initialBandIndexForSortedLocations:locations inRange:range];
+            NSUInteger bandIndex = [self initialBandIndexForSortedLocations:locations ascending:ascending inRange:range];
 
             const id null = [NSNull null];
 
@@ -657,8 +729,10 @@
                 endPlotPoint[orthogonalCoordinate]   = CPTDecimalNaN();
             }
 
-            for ( NSDecimalNumber *location in locations ) {
-                NSDecimal currentLocation = location.decimalValue;
+            const NSDecimal *decimals = locations.decimalValues;
+
+            for ( NSUInteger i = 0; i < locationCount; i++ ) {
+                NSDecimal currentLocation = decimals[ascending ? i : locationCount - 1 - i];
                 if ( !CPTDecimalEquals(CPTDecimalSubtract(currentLocation, lastLocation), zero)) {
                     CPTFill *bandFill = bandArray[bandIndex++];
                     bandIndex %= bandCount;
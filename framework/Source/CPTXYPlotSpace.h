@@ -24,4 +24,10 @@
 
 -(void)cancelAnimations;
 
+/// @name Batch Coordinate Space Conversions
+/// @{
+-(void)plotAreaViewPoints:(nonnull CGPoint *)viewPoints forDoublePrecisionXValues:(nonnull const double *)xValues yValues:(nonnull const double *)yValues numberOfPoints:(NSUInteger)count;
+-(void)plotAreaViewCoordinates:(nonnull CGFloat *)viewCoordinates stride:(NSUInteger)stride forDoublePrecisionPlotCoordinates:(nonnull const double *)plotCoordinates numberOfValues:(NSUInteger)count coordinate:(CPTCoordinate)coordinate;
+/// @}
+
 @end
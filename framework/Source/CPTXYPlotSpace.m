@@ -19,6 +19,12 @@
 /// @cond
 typedef NSMutableArray<CPTAnimationOperation *> CPTMutableAnimationArray;
 
+static const size_t kCPTTransformChunkSize = 4096; // values converted by each concurrent batch
+
+static void CPTTransformLinear(CGFloat *__nonnull viewCoordinates, size_t stride, const double *__nonnull plotCoordinates, size_t count, double location, double scale);
+static void CPTTransformLog(CGFloat *__nonnull viewCoordinates, size_t stride, const double *__nonnull plotCoordinates, size_t count, double location, double scale);
+static void CPTTransformLogModulus(CGFloat *__nonnull viewCoordinates, size_t stride, const double *__nonnull plotCoordinates, size_t count, double location, double scale);
+
 @interface CPTXYPlotSpace()
 
 -(CGFloat)viewCoordinateForViewLength:(NSDecimal)viewLength linearPlotRange:(nonnull CPTPlotRange *)range plotCoordinateValue:(NSDecimal)plotCoord;
@@ -1408,6 +1414,126 @@ CGFloat CPTFirstPositiveRoot(CGFloat a, CGFloat b, CGFloat c)
 
 /// @endcond
 
+#pragma mark -
+#pragma mark Batch Point Conversion
+
+/** @brief Converts many data points to plot area drawing coordinates at once.
+ *
+ *  The result is equivalent, up to rounding, to calling
+ *  @link CPTPlotSpace::plotAreaViewPointForDoublePrecisionPlotPoint:numberOfCoordinates: -plotAreaViewPointForDoublePrecisionPlotPoint:numberOfCoordinates: @endlink
+ *  for each point, but the scale factors are computed once and the points are converted in tight loops
+ *  that the compiler can vectorize. Each value is multiplied by a precomputed scale factor instead of being
+ *  divided by the plot range length, so the results can differ from the single-point conversion in the last bit.
+ *
+ *  @param viewPoints Returns the drawing coordinates of the data points. Must have room for @par{count} points.
+ *  @param xValues The x-coordinates of the data points.
+ *  @param yValues The y-coordinates of the data points.
+ *  @param count The number of data points.
+ **/
+-(void)plotAreaViewPoints:(nonnull CGPoint *)viewPoints forDoublePrecisionXValues:(nonnull const double *)xValues yValues:(nonnull const double *)yValues numberOfPoints:(NSUInteger)count
+{
+    const NSUInteger stride = sizeof(CGPoint) / sizeof(CGFloat);
+
+    [self plotAreaViewCoordinates:&viewPoints[0].x stride:stride forDoublePrecisionPlotCoordinates:xValues numberOfValues:count coordinate:CPTCoordinateX];
+    [self plotAreaViewCoordinates:&viewPoints[0].y stride:stride forDoublePrecisionPlotCoordinates:yValues numberOfValues:count coordinate:CPTCoordinateY];
+}
+
+/** @brief Converts many values along one coordinate to plot area drawing coordinates at once.
+ *
+ *  Use this method to convert values that share the other coordinate, for example the high and low values of a
+ *  range plot, or to store the results directly in the fields of an array of structures.
+ *  Like @link CPTXYPlotSpace::plotAreaViewPoints:forDoublePrecisionXValues:yValues:numberOfPoints: -plotAreaViewPoints:forDoublePrecisionXValues:yValues:numberOfPoints: @endlink,
+ *  the results match the single-point conversion only up to rounding.
+ *
+ *  @param viewCoordinates Returns the drawing coordinates. The first result is stored at @par{viewCoordinates[0]},
+ *  the next at @par{viewCoordinates[stride]}, and so on.
+ *  @param stride The number of @ref CGFloat values between consecutive results. Must be at least one.
+ *  @param plotCoordinates The data coordinates to convert.
+ *  @param count The number of values to convert.
+ *  @param coordinate The coordinate of the values.
+ **/
+-(void)plotAreaViewCoordinates:(nonnull CGFloat *)viewCoordinates stride:(NSUInteger)stride forDoublePrecisionPlotCoordinates:(nonnull const double *)plotCoordinates numberOfValues:(NSUInteger)count coordinate:(CPTCoordinate)coordinate
+{
+    NSParameterAssert(stride > 0);
+
+    if ( count == 0 ) {
+        return;
+    }
+
+    CPTPlotArea *plotArea = self.graph.plotAreaFrame.plotArea;
+
+    CPTPlotRange *range;
+    CPTScaleType scaleType;
+    CGFloat viewLength;
+
+    switch ( coordinate ) {
+        case CPTCoordinateX:
+            range      = self.xRange;
+            scaleType  = self.xScaleType;
+            viewLength = plotArea.bounds.size.width;
+            break;
+
+        case CPTCoordinateY:
+            range      = self.yRange;
+            scaleType  = self.yScaleType;
+            viewLength = plotArea.bounds.size.height;
+            break;
+
+        default:
+            [NSException raise:CPTException format:@"Coordinate not supported in CPTXYPlotSpace"];
+            return;
+    }
+
+    // Find the scale factors once for all of the values; a zero scale maps every value except NaN to the origin
+    double location = 0.0;
+    double scale    = 0.0;
+    void (*transform)(CGFloat *__nonnull, size_t, const double *__nonnull, size_t, double, double) = CPTTransformLinear;
+
+    switch ( scaleType ) {
+        case CPTScaleTypeLinear:
+        case CPTScaleTypeCategory:
+            if ( plotArea && (range.lengthDouble != 0.0)) {
+                location = range.locationDouble;
+                scale    = (double)viewLength / range.lengthDouble;
+            }
+            break;
+
+        case CPTScaleTypeLog:
+            transform = CPTTransformLog;
+            if ( plotArea && (range.minLimitDouble > 0.0) && (range.maxLimitDouble > 0.0)) {
+                location = log10(range.locationDouble);
+                scale    = (double)viewLength / (log10(range.endDouble) - location);
+            }
+            break;
+
+        case CPTScaleTypeLogModulus:
+            transform = CPTTransformLogModulus;
+            if ( plotArea ) {
+                location = CPTLogModulus(range.locationDouble);
+                scale    = (double)viewLength / (CPTLogModulus(range.endDouble) - location);
+            }
+            break;
+
+        default:
+            [NSException raise:CPTException format:@"Scale type not supported in CPTXYPlotSpace"];
+            return;
+    }
+
+    if ( count <= kCPTTransformChunkSize ) {
+        transform(viewCoordinates, stride, plotCoordinates, count, location, scale);
+    }
+    else {
+        size_t chunkCount = (count + kCPTTransformChunkSize - 1) / kCPTTransformChunkSize;
+
+        dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+            size_t start  = chunk * kCPTTransformChunkSize;
+            size_t length = MIN(kCPTTransformChunkSize, count - start);
+
+            transform(viewCoordinates + start * stride, stride, plotCoordinates + start, length, location, scale);
+        });
+    }
+}
+
 #pragma mark -
 #pragma mark Scaling
 
@@ -1975,3 +2101,81 @@ CGFloat CPTFirstPositiveRoot(CGFloat a, CGFloat b, CGFloat c)
 /// @endcond
 
 @end
+
+#pragma mark -
+
+/// @cond
+
+/** @internal
+ *  @brief Converts linear data coordinates to view coordinates.
+ *  @param viewCoordinates Returns the view coordinates, @par{stride} values apart.
+ *  @param stride The number of @ref CGFloat values between consecutive results.
+ *  @param plotCoordinates The data coordinates.
+ *  @param count The number of values to convert.
+ *  @param location The data coordinate at the start of the view.
+ *  @param scale The view length per data unit. Zero maps every value except @NAN to the start of the view.
+ **/
+static void CPTTransformLinear(CGFloat *__nonnull viewCoordinates, size_t stride, const double *__nonnull plotCoordinates, size_t count, double location, double scale)
+{
+    if ( scale == 0.0 ) {
+        for ( size_t i = 0; i < count; i++ ) {
+            viewCoordinates[i * stride] = isnan(plotCoordinates[i]) ? CPTNAN : CPTFloat(0.0);
+        }
+        return;
+    }
+
+    for ( size_t i = 0; i < count; i++ ) {
+        viewCoordinates[i * stride] = (CGFloat)((plotCoordinates[i] - location) * scale);
+    }
+}
+
+/** @internal
+ *  @brief Converts logarithmic data coordinates to view coordinates. Values less than or equal to zero map to the start of the view.
+ *  @param viewCoordinates Returns the view coordinates, @par{stride} values apart.
+ *  @param stride The number of @ref CGFloat values between consecutive results.
+ *  @param plotCoordinates The data coordinates.
+ *  @param count The number of values to convert.
+ *  @param location The logarithm of the data coordinate at the start of the view.
+ *  @param scale The view length per decade. Zero maps every value except @NAN to the start of the view.
+ **/
+static void CPTTransformLog(CGFloat *__nonnull viewCoordinates, size_t stride, const double *__nonnull plotCoordinates, size_t count, double location, double scale)
+{
+    for ( size_t i = 0; i < count; i++ ) {
+        double value = plotCoordinates[i];
+
+        if ( isnan(value)) {
+            viewCoordinates[i * stride] = CPTNAN;
+        }
+        else if ((scale == 0.0) || (value <= 0.0)) {
+            viewCoordinates[i * stride] = CPTFloat(0.0);
+        }
+        else {
+            viewCoordinates[i * stride] = (CGFloat)((log10(value) - location) * scale);
+        }
+    }
+}
+
+/** @internal
+ *  @brief Converts log-modulus data coordinates to view coordinates.
+ *  @param viewCoordinates Returns the view coordinates, @par{stride} values apart.
+ *  @param stride The number of @ref CGFloat values between consecutive results.
+ *  @param plotCoordinates The data coordinates.
+ *  @param count The number of values to convert.
+ *  @param location The log-modulus of the data coordinate at the start of the view.
+ *  @param scale The view length per unit of log-modulus. Zero maps every value except @NAN to the start of the view.
+ **/
+static void CPTTransformLogModulus(CGFloat *__nonnull viewCoordinates, size_t stride, const double *__nonnull plotCoordinates, size_t count, double location, double scale)
+{
+    if ( scale == 0.0 ) {
+        for ( size_t i = 0; i < count; i++ ) {
+            viewCoordinates[i * stride] = isnan(plotCoordinates[i]) ? CPTNAN : CPTFloat(0.0);
+        }
+        return;
+    }
+
+    for ( size_t i = 0; i < count; i++ ) {
+        viewCoordinates[i * stride] = (CGFloat)((CPTLogModulus(plotCoordinates[i]) - location) * scale);
+    }
+}
+
+/// @endcond
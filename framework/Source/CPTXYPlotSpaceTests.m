@@ -295,6 +295,114 @@
     XCTAssertEqualWithAccuracy(viewPoint.y, CPTFloat(25.0), CPTFloat(0.01), @"");
 }
 
+#pragma mark -
+#pragma mark Batch view points for plot points
+
+-(void)testBatchViewPointsMatchSinglePointConversion
+{
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)self.graph.defaultPlotSpace;
+
+    const NSUInteger pointCount = 10000;
+
+    double *xValues      = malloc(pointCount * sizeof(double));
+    double *yValues      = malloc(pointCount * sizeof(double));
+    CGPoint *batchPoints = malloc(pointCount * sizeof(CGPoint));
+
+    for ( NSUInteger i = 0; i < pointCount; i++ ) {
+        xValues[i] = (double)i * 0.01 + 0.5;
+        yValues[i] = sin((double)i) * 50.0 + 60.0;
+    }
+    yValues[7] = (double)NAN;
+
+    CPTScaleType scaleTypes[] = { CPTScaleTypeLinear, CPTScaleTypeLog, CPTScaleTypeLogModulus };
+
+    for ( NSUInteger s = 0; s < sizeof(scaleTypes) / sizeof(CPTScaleType); s++ ) {
+        plotSpace.xScaleType = scaleTypes[s];
+        plotSpace.yScaleType = scaleTypes[s];
+
+        plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@1.0
+                                                        length:@99.0];
+        plotSpace.yRange = [CPTPlotRange plotRangeWithLocation:@5.0
+                                                        length:@100.0];
+
+        [plotSpace plotAreaViewPoints:batchPoints forDoublePrecisionXValues:xValues yValues:yValues numberOfPoints:pointCount];
+
+        for ( NSUInteger i = 0; i < pointCount; i++ ) {
+            double plotPoint[2];
+            plotPoint[CPTCoordinateX] = xValues[i];
+            plotPoint[CPTCoordinateY] = yValues[i];
+
+            CGPoint viewPoint = [plotSpace plotAreaViewPointForDoublePrecisionPlotPoint:plotPoint numberOfCoordinates:2];
+
+            XCTAssertEqualWithAccuracy(batchPoints[i].x, viewPoint.x, CPTFloat(0.001), @"scale type %lu, point %lu", (unsigned long)scaleTypes[s], (unsigned long)i);
+            if ( isnan(viewPoint.y)) {
+                XCTAssertTrue(isnan(batchPoints[i].y), @"scale type %lu, point %lu", (unsigned long)scaleTypes[s], (unsigned long)i);
+            }
+            else {
+                XCTAssertEqualWithAccuracy(batchPoints[i].y, viewPoint.y, CPTFloat(0.001), @"scale type %lu, point %lu", (unsigned long)scaleTypes[s], (unsigned long)i);
+            }
+        }
+    }
+
+    free(xValues);
+    free(yValues);
+    free(batchPoints);
+}
+
+-(void)testBatchViewCoordinatesWithStride
+{
+    CPTXYPlotSpace *plotSpace = (CPTXYPlotSpace *)self.graph.defaultPlotSpace;
+
+    plotSpace.xScaleType = CPTScaleTypeLinear;
+    plotSpace.yScaleType = CPTScaleTypeLinear;
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@0.0
+                                                    length:@10.0];
+    plotSpace.yRange = [CPTPlotRange plotRangeWithLocation:@0.0
+                                                    length:@10.0];
+
+    const double yValues[] = { 0.0, 5.0, 10.0 };
+    CGPoint viewPoints[3];
+
+    for ( NSUInteger i = 0; i < 3; i++ ) {
+        viewPoints[i] = CPTPointMake(-1.0, -1.0);
+    }
+
+    [plotSpace plotAreaViewCoordinates:&viewPoints[0].y stride:2 forDoublePrecisionPlotCoordinates:yValues numberOfValues:3 coordinate:CPTCoordinateY];
+
+    XCTAssertEqualWithAccuracy(viewPoints[0].y, CPTFloat(0.0), CPTFloat(0.01), @"");
+    XCTAssertEqualWithAccuracy(viewPoints[1].y, CPTFloat(25.0), CPTFloat(0.01), @"");
+    XCTAssertEqualWithAccuracy(viewPoints[2].y, CPTFloat(50.0), CPTFloat(0.01), @"");
+
+    for ( NSUInteger i = 0; i < 3; i++ ) {
+        XCTAssertEqual(viewPoints[i].x, CPTFloat(-1.0), @"x coordinate %lu should not change", (unsigned long)i);
+    }
+}
+
+-(void)testBatchViewCoordinatesKeepNaNWithZeroScale
+{
+    // a plot space without a plot area has no scale
+    CPTXYPlotSpace *plotSpace = [[CPTXYPlotSpace alloc] init];
+
+    plotSpace.xRange = [CPTPlotRange plotRangeWithLocation:@1.0
+                                                    length:@10.0];
+
+    const double values[] = { 1.0, (double)NAN, 5.0 };
+    CGFloat viewCoordinates[3];
+
+    CPTScaleType scaleTypes[] = { CPTScaleTypeLinear, CPTScaleTypeLog, CPTScaleTypeLogModulus };
+
+    for ( NSUInteger s = 0; s < sizeof(scaleTypes) / sizeof(CPTScaleType); s++ ) {
+        plotSpace.xScaleType = scaleTypes[s];
+
+        [plotSpace plotAreaViewCoordinates:viewCoordinates stride:1 forDoublePrecisionPlotCoordinates:values numberOfValues:3 coordinate:CPTCoordinateX];
+
+        XCTAssertEqual(viewCoordinates[0], CPTFloat(0.0), @"scale type %lu, value 0", (unsigned long)scaleTypes[s]);
+        XCTAssertTrue(isnan(viewCoordinates[1]), @"scale type %lu, NaN value", (unsigned long)scaleTypes[s]);
+        XCTAssertEqual(viewCoordinates[2], CPTFloat(0.0), @"scale type %lu, value 2", (unsigned long)scaleTypes[s]);
+    }
+}
+
 #pragma mark -
 #pragma mark Plot point for view point (linear)
 
@@ -0,0 +1,28 @@
+@class CPTNumericData;
+
+@interface _CPTDataRangeIndex : NSObject
+
+@property (nonatomic, readonly) NSUInteger sampleCount;
+@property (nonatomic, readonly, getter = isSorted) BOOL sorted;
+
+/// @name Updating the Index
+/// @{
+-(void)rebuildWithData:(nonnull CPTNumericData *)data;
+-(void)updateData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+-(void)insertData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+-(void)removeData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+/// @}
+
+/// @name Queries
+/// @{
+-(BOOL)getMinimumIndex:(nonnull NSUInteger *)minIndex maximumIndex:(nonnull NSUInteger *)maxIndex forData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+-(NSUInteger)numberOfNaNValuesForData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+-(void)addIndicesOfValuesFromMinimum:(double)minimum toMaximum:(double)maximum toIndexSet:(nonnull NSMutableIndexSet *)indexSet forData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+/// @}
+
+/// @name Levels of Detail
+/// @{
+-(NSUInteger)appendLevelOfDetailIndicesToBuffer:(nonnull NSMutableData *)indices count:(NSUInteger)count forData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+/// @}
+
+@end
@@ -0,0 +1,1052 @@
+#import "_CPTDataRangeIndex.h"
+
+#import "CPTNumericData.h"
+#import "CPTUtilities.h"
+
+static const NSUInteger kCPTDataRangeIndexBlockSize = 64; // samples summarized by each leaf of the tree
+
+/// @cond
+
+/**
+ *  @brief Enumeration of the sample types that can be indexed.
+ **/
+typedef NS_ENUM (NSInteger, CPTDataRangeIndexFormat) {
+    CPTDataRangeIndexFormatDouble, ///< @double samples.
+    CPTDataRangeIndexFormatFloat,  ///< @float samples.
+    CPTDataRangeIndexFormatDecimal ///< @ref NSDecimal samples.
+};
+
+static BOOL CPTDataRangeIndexValueIsLess(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger idx1, NSUInteger idx2);
+static BOOL CPTDataRangeIndexValueIsNaN(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger idx);
+static double CPTDataRangeIndexDoubleValue(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger idx);
+static void CPTDataRangeIndexScan(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger start, NSUInteger end, NSUInteger *__nonnull minIndex, NSUInteger *__nonnull maxIndex);
+static NSUInteger CPTDataRangeIndexCountDescents(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger start, NSUInteger end, NSUInteger count);
+static NSUInteger CPTDataRangeIndexCountNaNs(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger start, NSUInteger end);
+static NSUInteger CPTDataRangeIndexAppend(NSMutableData *__nonnull indices, NSUInteger count, NSUInteger idx);
+
+@interface _CPTDataRangeIndex()
+
+@property (nonatomic, readwrite, assign) CPTDataRangeIndexFormat sampleFormat;
+@property (nonatomic, readwrite, assign) NSUInteger origin;
+@property (nonatomic, readwrite, assign) NSUInteger sampleCount;
+@property (nonatomic, readwrite, assign) NSUInteger slotCount;
+@property (nonatomic, readwrite, assign, nullable) NSUInteger *minNodes;
+@property (nonatomic, readwrite, assign, nullable) NSUInteger *maxNodes;
+@property (nonatomic, readwrite, assign, nullable) NSUInteger *descentNodes;
+@property (nonatomic, readwrite, assign, nullable) NSUInteger *nanNodes;
+
+-(void)refreshBlocksFrom:(NSUInteger)firstBlock through:(NSUInteger)lastBlock data:(nonnull CPTNumericData *)data;
+-(NSUInteger)minimumOfIndex:(NSUInteger)idx1 andIndex:(NSUInteger)idx2 bytes:(nonnull const void *)bytes stride:(NSUInteger)stride;
+-(NSUInteger)maximumOfIndex:(NSUInteger)idx1 andIndex:(NSUInteger)idx2 bytes:(nonnull const void *)bytes stride:(NSUInteger)stride;
+-(NSUInteger)appendRunIndicesToBuffer:(nonnull NSMutableData *)indices count:(NSUInteger)count data:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange;
+-(void)addIndicesOfValuesFromMinimum:(double)minimum toMaximum:(double)maximum toIndexSet:(nonnull NSMutableIndexSet *)indexSet inNode:(NSUInteger)node firstBlock:(NSUInteger)firstBlock blockCount:(NSUInteger)blockCount bytes:(nonnull const void *)bytes stride:(NSUInteger)stride start:(NSUInteger)absStart end:(NSUInteger)absEnd;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief A min/max summary of the values in a plot data cache.
+ *
+ *  Samples are grouped into fixed-size blocks. The indices of the smallest and largest value in
+ *  each block are stored in the leaves of a segment tree and each interior node holds the extremes
+ *  of its children, so the extent of any index range can be found in logarithmic time.
+ *
+ *  Node values are absolute sample indices measured from an origin that advances as samples are
+ *  removed from the front of the data. Removing from the front and appending to the end of the data
+ *  therefore only refresh the blocks at the ends; inserting or removing samples elsewhere refreshes
+ *  the blocks from the change to the end of the data.
+ *
+ *  Renderers can use the tree as a level of detail summary of the data: instead of every sample, they
+ *  draw the first, smallest, largest, and last sample of the records that fall in each pixel column.
+ *  The tree also counts the @NAN samples, so that gaps in the data are kept, and the descending pairs
+ *  of neighboring samples, so it can report whether the data are sorted in ascending order.
+ *
+ *  The same tree finds the samples whose values fall within a range without visiting every sample:
+ *  subtrees whose extremes lie outside the range are skipped.
+ *
+ *  The data must hold host byte order @double, @float, or @ref NSDecimal values. @NAN values are ignored.
+ *  Strided slices, such as one field of rows-first plot data, are read in place.
+ **/
+@implementation _CPTDataRangeIndex
+
+/** @internal
+ *  @property CPTDataRangeIndexFormat sampleFormat
+ *  @brief The type of the indexed sample values.
+ **/
+@synthesize sampleFormat;
+
+/** @internal
+ *  @property NSUInteger origin
+ *  @brief The absolute index of the first sample in the data.
+ **/
+@synthesize origin;
+
+/** @internal
+ *  @property NSUInteger sampleCount
+ *  @brief The number of samples in the data.
+ **/
+@synthesize sampleCount;
+
+/** @internal
+ *  @property NSUInteger slotCount
+ *  @brief The number of leaves in the tree. Always a power of two.
+ **/
+@synthesize slotCount;
+
+/** @internal
+ *  @property NSUInteger *minNodes
+ *  @brief The tree nodes holding the absolute index of the smallest value, or @ref NSNotFound if empty.
+ **/
+@synthesize minNodes;
+
+/** @internal
+ *  @property NSUInteger *maxNodes
+ *  @brief The tree nodes holding the absolute index of the largest value, or @ref NSNotFound if empty.
+ **/
+@synthesize maxNodes;
+
+/** @internal
+ *  @property NSUInteger *descentNodes
+ *  @brief The tree nodes holding the number of samples that are not less than or equal to the sample after them.
+ **/
+@synthesize descentNodes;
+
+/** @internal
+ *  @property NSUInteger *nanNodes
+ *  @brief The tree nodes holding the number of @NAN samples.
+ **/
+@synthesize nanNodes;
+
+/** @property BOOL sorted
+ *  @brief If @YES, every sample is less than or equal to the sample after it.
+ *  Data containing @NAN values are never considered sorted.
+ **/
+@dynamic sorted;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/// @cond
+
+-(nonnull instancetype)init
+{
+    if ((self = [super init])) {
+        sampleFormat = CPTDataRangeIndexFormatDouble;
+        origin       = 0;
+        sampleCount  = 0;
+        slotCount    = 0;
+        minNodes     = NULL;
+        maxNodes     = NULL;
+        descentNodes = NULL;
+        nanNodes     = NULL;
+    }
+    return self;
+}
+
+-(void)dealloc
+{
+    free(minNodes);
+    free(maxNodes);
+    free(descentNodes);
+    free(nanNodes);
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Updating the Index
+
+/** @brief Discards the current index and summarizes all of the samples in the data.
+ *  @param data The indexed data.
+ **/
+-(void)rebuildWithData:(nonnull CPTNumericData *)data
+{
+    NSParameterAssert(data.dataTypeFormat == CPTFloatingPointDataType || data.dataTypeFormat == CPTDecimalDataType);
+
+    NSUInteger count      = data.numberOfSamples;
+    NSUInteger blockCount = (count + kCPTDataRangeIndexBlockSize - 1) / kCPTDataRangeIndexBlockSize;
+
+    // leave room to append as many blocks as there are now before the tree needs to grow
+    NSUInteger slots = 1;
+
+    while ( slots < 2 * blockCount ) {
+        slots <<= 1;
+    }
+
+    free(self.minNodes);
+    free(self.maxNodes);
+    free(self.descentNodes);
+    free(self.nanNodes);
+
+    NSUInteger *newMinNodes = malloc(2 * slots * sizeof(NSUInteger));
+    NSUInteger *newMaxNodes = malloc(2 * slots * sizeof(NSUInteger));
+
+    for ( NSUInteger i = 0; i < 2 * slots; i++ ) {
+        newMinNodes[i] = NSNotFound;
+        newMaxNodes[i] = NSNotFound;
+    }
+
+    self.minNodes     = newMinNodes;
+    self.maxNodes     = newMaxNodes;
+    self.descentNodes = calloc(2 * slots, sizeof(NSUInteger));
+    self.nanNodes     = calloc(2 * slots, sizeof(NSUInteger));
+    self.slotCount    = slots;
+    self.origin       = 0;
+    self.sampleCount  = count;
+
+    if ( data.dataTypeFormat == CPTDecimalDataType ) {
+        self.sampleFormat = CPTDataRangeIndexFormatDecimal;
+    }
+    else if ( data.sampleBytes == sizeof(float)) {
+        self.sampleFormat = CPTDataRangeIndexFormatFloat;
+    }
+    else {
+        self.sampleFormat = CPTDataRangeIndexFormatDouble;
+    }
+
+    if ( blockCount > 0 ) {
+        [self refreshBlocksFrom:0 through:blockCount - 1 data:data];
+    }
+}
+
+/** @brief Updates the index after sample values were replaced.
+ *  @param data The indexed data.
+ *  @param indexRange The range of samples that changed.
+ **/
+-(void)updateData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    NSParameterAssert(NSMaxRange(indexRange) <= self.sampleCount);
+
+    if ( indexRange.length > 0 ) {
+        NSUInteger start = self.origin + indexRange.location;
+
+        // the block before the change holds the pair that ends at the first changed sample
+        [self refreshBlocksFrom:(start - (indexRange.location > 0 ? 1 : 0)) / kCPTDataRangeIndexBlockSize
+                        through:(start + indexRange.length - 1) / kCPTDataRangeIndexBlockSize
+                           data:data];
+    }
+}
+
+/** @brief Updates the index after samples were inserted into the data.
+ *  @param data The indexed data, including the new samples.
+ *  @param indexRange The range of the new samples.
+ **/
+-(void)insertData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    NSParameterAssert(indexRange.location <= self.sampleCount);
+
+    if ( indexRange.length == 0 ) {
+        return;
+    }
+
+    NSUInteger oldOrigin = self.origin;
+
+    self.sampleCount += indexRange.length;
+
+    if ((indexRange.location == 0) && (oldOrigin >= indexRange.length)) {
+        // reuse the space left by samples removed from the front
+        NSUInteger newOrigin = oldOrigin - indexRange.length;
+        self.origin = newOrigin;
+
+        [self refreshBlocksFrom:newOrigin / kCPTDataRangeIndexBlockSize
+                        through:oldOrigin / kCPTDataRangeIndexBlockSize
+                           data:data];
+    }
+    else {
+        NSUInteger lastBlock = (oldOrigin + self.sampleCount - 1) / kCPTDataRangeIndexBlockSize;
+
+        if ( lastBlock >= self.slotCount ) {
+            [self rebuildWithData:data];
+        }
+        else {
+            [self refreshBlocksFrom:(oldOrigin + indexRange.location - (indexRange.location > 0 ? 1 : 0)) / kCPTDataRangeIndexBlockSize
+                            through:lastBlock
+                               data:data];
+        }
+    }
+}
+
+/** @brief Updates the index after samples were removed from the data.
+ *  @param data The indexed data, with the samples already removed.
+ *  @param indexRange The range of the removed samples.
+ **/
+-(void)removeData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    NSUInteger oldCount = self.sampleCount;
+
+    NSParameterAssert(NSMaxRange(indexRange) <= oldCount);
+
+    if ( indexRange.length == 0 ) {
+        return;
+    }
+
+    if ( indexRange.length == oldCount ) {
+        [self rebuildWithData:data];
+        return;
+    }
+
+    NSUInteger oldOrigin = self.origin;
+    NSUInteger oldLast   = (oldOrigin + oldCount - 1) / kCPTDataRangeIndexBlockSize;
+
+    self.sampleCount = oldCount - indexRange.length;
+
+    if ( indexRange.location == 0 ) {
+        NSUInteger newOrigin = oldOrigin + indexRange.length;
+        self.origin = newOrigin;
+
+        [self refreshBlocksFrom:oldOrigin / kCPTDataRangeIndexBlockSize
+                        through:newOrigin / kCPTDataRangeIndexBlockSize
+                           data:data];
+    }
+    else {
+        [self refreshBlocksFrom:(oldOrigin + indexRange.location - 1) / kCPTDataRangeIndexBlockSize
+                        through:oldLast
+                           data:data];
+    }
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Recomputes the leaves for a run of blocks and the interior nodes above them.
+ *  @param firstBlock The absolute number of the first block to refresh.
+ *  @param lastBlock The absolute number of the last block to refresh.
+ *  @param data The indexed data.
+ **/
+-(void)refreshBlocksFrom:(NSUInteger)firstBlock through:(NSUInteger)lastBlock data:(nonnull CPTNumericData *)data
+{
+    NSUInteger slots = self.slotCount;
+
+    NSParameterAssert(firstBlock <= lastBlock);
+    NSParameterAssert(lastBlock < slots);
+
+    NSUInteger *minTree            = self.minNodes;
+    NSUInteger *maxTree            = self.maxNodes;
+    NSUInteger *descents           = self.descentNodes;
+    NSUInteger *nans               = self.nanNodes;
+    const void *bytes              = data.bytes;
+    NSUInteger stride              = data.sampleStride;
+    CPTDataRangeIndexFormat format = self.sampleFormat;
+    NSUInteger liveStart           = self.origin;
+    NSUInteger liveEnd             = liveStart + self.sampleCount;
+
+    for ( NSUInteger block = firstBlock; block <= lastBlock; block++ ) {
+        NSUInteger start = MAX(block * kCPTDataRangeIndexBlockSize, liveStart);
+        NSUInteger end   = MIN((block + 1) * kCPTDataRangeIndexBlockSize, liveEnd);
+        NSUInteger node  = slots + block;
+
+        NSUInteger minIndex     = NSNotFound;
+        NSUInteger maxIndex     = NSNotFound;
+        NSUInteger descentCount = 0;
+        NSUInteger nanCount     = 0;
+
+        if ( start < end ) {
+            CPTDataRangeIndexScan(bytes, format, stride, start - liveStart, end - liveStart, &minIndex, &maxIndex);
+            if ( minIndex != NSNotFound ) {
+                minIndex += liveStart;
+                maxIndex += liveStart;
+            }
+            descentCount = CPTDataRangeIndexCountDescents(bytes, format, stride, start - liveStart, end - liveStart, liveEnd - liveStart);
+            nanCount     = CPTDataRangeIndexCountNaNs(bytes, format, stride, start - liveStart, end - liveStart);
+        }
+
+        minTree[node]  = minIndex;
+        maxTree[node]  = maxIndex;
+        descents[node] = descentCount;
+        nans[node]     = nanCount;
+    }
+
+    NSUInteger lowNode  = slots + firstBlock;
+    NSUInteger highNode = slots + lastBlock;
+
+    while ( lowNode > 1 ) {
+        lowNode  >>= 1;
+        highNode >>= 1;
+
+        for ( NSUInteger node = lowNode; node <= highNode; node++ ) {
+            minTree[node]  = [self minimumOfIndex:minTree[2 * node] andIndex:minTree[2 * node + 1] bytes:bytes stride:stride];
+            maxTree[node]  = [self maximumOfIndex:maxTree[2 * node] andIndex:maxTree[2 * node + 1] bytes:bytes stride:stride];
+            descents[node] = descents[2 * node] + descents[2 * node + 1];
+            nans[node]     = nans[2 * node] + nans[2 * node + 1];
+        }
+    }
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Queries
+
+/// @cond
+
+-(BOOL)isSorted
+{
+    const NSUInteger *descents = self.descentNodes;
+
+    return (descents == NULL) || (descents[1] == 0);
+}
+
+/// @endcond
+
+/** @brief Finds the smallest and largest values in a range of samples.
+ *  @param minIndex Returns the index of the smallest value.
+ *  @param maxIndex Returns the index of the largest value.
+ *  @param data The indexed data.
+ *  @param indexRange The range of samples to search.
+ *  @return @YES if the range contains at least one value that is not @NAN.
+ **/
+-(BOOL)getMinimumIndex:(nonnull NSUInteger *)minIndex maximumIndex:(nonnull NSUInteger *)maxIndex forData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    NSParameterAssert(NSMaxRange(indexRange) <= self.sampleCount);
+
+    if ( indexRange.length == 0 ) {
+        return NO;
+    }
+
+    const void *bytes              = data.bytes;
+    NSUInteger stride              = data.sampleStride;
+    CPTDataRangeIndexFormat format = self.sampleFormat;
+    NSUInteger base                = self.origin;
+    NSUInteger absStart            = base + indexRange.location;
+    NSUInteger absEnd              = absStart + indexRange.length;
+
+    NSUInteger firstFullBlock = (absStart + kCPTDataRangeIndexBlockSize - 1) / kCPTDataRangeIndexBlockSize;
+    NSUInteger endFullBlock   = absEnd / kCPTDataRangeIndexBlockSize;
+
+    NSUInteger bestMin = NSNotFound;
+    NSUInteger bestMax = NSNotFound;
+
+    if ( firstFullBlock >= endFullBlock ) {
+        // the range fits within one or two blocks
+        CPTDataRangeIndexScan(bytes, format, stride, absStart - base, absEnd - base, &bestMin, &bestMax);
+    }
+    else {
+        NSUInteger partialMin = NSNotFound;
+        NSUInteger partialMax = NSNotFound;
+
+        CPTDataRangeIndexScan(bytes, format, stride, absStart - base, firstFullBlock * kCPTDataRangeIndexBlockSize - base, &partialMin, &partialMax);
+        if ( partialMin != NSNotFound ) {
+            bestMin = partialMin + base;
+            bestMax = partialMax + base;
+        }
+
+        CPTDataRangeIndexScan(bytes, format, stride, endFullBlock * kCPTDataRangeIndexBlockSize - base, absEnd - base, &partialMin, &partialMax);
+        if ( partialMin != NSNotFound ) {
+            bestMin = [self minimumOfIndex:bestMin andIndex:partialMin + base bytes:bytes stride:stride];
+            bestMax = [self maximumOfIndex:bestMax andIndex:partialMax + base bytes:bytes stride:stride];
+        }
+
+        const NSUInteger *minTree = self.minNodes;
+        const NSUInteger *maxTree = self.maxNodes;
+        NSUInteger slots          = self.slotCount;
+
+        NSUInteger lowNode  = slots + firstFullBlock;
+        NSUInteger highNode = slots + endFullBlock;
+
+        while ( lowNode < highNode ) {
+            if ( lowNode & 1 ) {
+                bestMin = [self minimumOfIndex:bestMin andIndex:minTree[lowNode] bytes:bytes stride:stride];
+                bestMax = [self maximumOfIndex:bestMax andIndex:maxTree[lowNode] bytes:bytes stride:stride];
+                lowNode++;
+            }
+            if ( highNode & 1 ) {
+                highNode--;
+                bestMin = [self minimumOfIndex:bestMin andIndex:minTree[highNode] bytes:bytes stride:stride];
+                bestMax = [self maximumOfIndex:bestMax andIndex:maxTree[highNode] bytes:bytes stride:stride];
+            }
+            lowNode  >>= 1;
+            highNode >>= 1;
+        }
+
+        if ( bestMin != NSNotFound ) {
+            bestMin -= base;
+            bestMax -= base;
+        }
+    }
+
+    if ( bestMin == NSNotFound ) {
+        return NO;
+    }
+
+    *minIndex = bestMin;
+    *maxIndex = bestMax;
+
+    return YES;
+}
+
+/** @brief Counts the @NAN values in a range of samples.
+ *  @param data The indexed data.
+ *  @param indexRange The range of samples to search.
+ *  @return The number of @NAN values in the range.
+ **/
+-(NSUInteger)numberOfNaNValuesForData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    NSParameterAssert(NSMaxRange(indexRange) <= self.sampleCount);
+
+    if ( indexRange.length == 0 ) {
+        return 0;
+    }
+
+    const void *bytes              = data.bytes;
+    NSUInteger stride              = data.sampleStride;
+    CPTDataRangeIndexFormat format = self.sampleFormat;
+    NSUInteger base                = self.origin;
+    NSUInteger absStart            = base + indexRange.location;
+    NSUInteger absEnd              = absStart + indexRange.length;
+
+    NSUInteger firstFullBlock = (absStart + kCPTDataRangeIndexBlockSize - 1) / kCPTDataRangeIndexBlockSize;
+    NSUInteger endFullBlock   = absEnd / kCPTDataRangeIndexBlockSize;
+
+    if ( firstFullBlock >= endFullBlock ) {
+        // the range fits within one or two blocks
+        return CPTDataRangeIndexCountNaNs(bytes, format, stride, absStart - base, absEnd - base);
+    }
+
+    NSUInteger nanCount = CPTDataRangeIndexCountNaNs(bytes, format, stride, absStart - base, firstFullBlock * kCPTDataRangeIndexBlockSize - base);
+
+    nanCount += CPTDataRangeIndexCountNaNs(bytes, format, stride, endFullBlock * kCPTDataRangeIndexBlockSize - base, absEnd - base);
+
+    const NSUInteger *nans = self.nanNodes;
+    NSUInteger slots       = self.slotCount;
+
+    NSUInteger lowNode  = slots + firstFullBlock;
+    NSUInteger highNode = slots + endFullBlock;
+
+    while ( lowNode < highNode ) {
+        if ( lowNode & 1 ) {
+            nanCount += nans[lowNode];
+            lowNode++;
+        }
+        if ( highNode & 1 ) {
+            highNode--;
+            nanCount += nans[highNode];
+        }
+        lowNode  >>= 1;
+        highNode >>= 1;
+    }
+
+    return nanCount;
+}
+
+/** @brief Finds the samples whose values fall within a range of values.
+ *
+ *  Blocks whose smallest value is greater than @par{maximum} or whose largest value is less than
+ *  @par{minimum} are skipped without reading their samples. @NAN values are never added.
+ *  @param minimum The smallest value to find.
+ *  @param maximum The largest value to find.
+ *  @param indexSet The indices of the samples that were found are added to this index set.
+ *  @param data The indexed data.
+ *  @param indexRange The range of samples to search.
+ **/
+-(void)addIndicesOfValuesFromMinimum:(double)minimum toMaximum:(double)maximum toIndexSet:(nonnull NSMutableIndexSet *)indexSet forData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    NSParameterAssert(NSMaxRange(indexRange) <= self.sampleCount);
+
+    if ((indexRange.length == 0) || !(minimum <= maximum)) {
+        return;
+    }
+
+    NSUInteger absStart = self.origin + indexRange.location;
+
+    [self addIndicesOfValuesFromMinimum:minimum
+                              toMaximum:maximum
+                             toIndexSet:indexSet
+                                 inNode:1
+                             firstBlock:0
+                             blockCount:self.slotCount
+                                  bytes:data.bytes
+                                 stride:data.sampleStride
+                                  start:absStart
+                                    end:absStart + indexRange.length];
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Adds the indices of the samples of one subtree whose values fall within a range of values.
+ *  @param minimum The smallest value to find.
+ *  @param maximum The largest value to find.
+ *  @param indexSet The index set that receives the indices, measured from the first sample in the data.
+ *  @param node The root node of the subtree.
+ *  @param firstBlock The absolute number of the first block covered by the subtree.
+ *  @param blockCount The number of blocks covered by the subtree.
+ *  @param bytes The sample values.
+ *  @param stride The distance between consecutive samples, measured in samples.
+ *  @param absStart The absolute index of the first sample to search.
+ *  @param absEnd The absolute index following the last sample to search.
+ **/
+-(void)addIndicesOfValuesFromMinimum:(double)minimum toMaximum:(double)maximum toIndexSet:(nonnull NSMutableIndexSet *)indexSet inNode:(NSUInteger)node firstBlock:(NSUInteger)firstBlock blockCount:(NSUInteger)blockCount bytes:(nonnull const void *)bytes stride:(NSUInteger)stride start:(NSUInteger)absStart end:(NSUInteger)absEnd
+{
+    NSUInteger blockStart = firstBlock * kCPTDataRangeIndexBlockSize;
+    NSUInteger blockEnd   = (firstBlock + blockCount) * kCPTDataRangeIndexBlockSize;
+
+    if ((blockEnd <= absStart) || (blockStart >= absEnd)) {
+        return;
+    }
+
+    NSUInteger minIndex = self.minNodes[node];
+
+    if ( minIndex == NSNotFound ) {
+        return;
+    }
+
+    CPTDataRangeIndexFormat format = self.sampleFormat;
+    NSUInteger base                = self.origin;
+    double nodeMin                 = CPTDataRangeIndexDoubleValue(bytes, format, stride, minIndex - base);
+    double nodeMax                 = CPTDataRangeIndexDoubleValue(bytes, format, stride, self.maxNodes[node] - base);
+
+    if ((nodeMin > maximum) || (nodeMax < minimum)) {
+        return;
+    }
+
+    NSUInteger start = MAX(blockStart, absStart);
+    NSUInteger end   = MIN(blockEnd, absEnd);
+
+    if ((nodeMin >= minimum) && (nodeMax <= maximum) && (self.nanNodes[node] == 0) &&
+        (blockStart >= absStart) && (blockEnd <= absEnd)) {
+        // every sample of the subtree is in range
+        [indexSet addIndexesInRange:NSMakeRange(start - base, end - start)];
+    }
+    else if ( blockCount == 1 ) {
+        for ( NSUInteger i = start - base; i < end - base; i++ ) {
+            double value = CPTDataRangeIndexDoubleValue(bytes, format, stride, i);
+
+            if ((value >= minimum) && (value <= maximum)) {
+                [indexSet addIndex:i];
+            }
+        }
+    }
+    else {
+        NSUInteger halfCount = blockCount / 2;
+
+        [self addIndicesOfValuesFromMinimum:minimum toMaximum:maximum toIndexSet:indexSet inNode:2 * node firstBlock:firstBlock blockCount:halfCount bytes:bytes stride:stride start:absStart end:absEnd];
+        [self addIndicesOfValuesFromMinimum:minimum toMaximum:maximum toIndexSet:indexSet inNode:2 * node + 1 firstBlock:firstBlock + halfCount blockCount:halfCount bytes:bytes stride:stride start:absStart end:absEnd];
+    }
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Levels of Detail
+
+/** @brief Appends the level of detail summary of one bucket of samples to a buffer of indices.
+ *
+ *  For each run of consecutive samples in the bucket that are not @NAN, the indices of the first,
+ *  smallest, largest, and last sample of the run are appended in ascending order without duplicates.
+ *  Runs are separated by a single @ref NSNotFound index, so gaps in the data are kept. Buckets without
+ *  @NAN values are summarized in logarithmic time; buckets with gaps are scanned.
+ *
+ *  Renderers call this once for the records that fall in each pixel column, in ascending order,
+ *  and draw a line through the selected samples instead of every sample. The buffer grows as needed
+ *  and is never shrunk, so it can be reused from frame to frame.
+ *
+ *  @param indices The buffer of indices. Its length is the capacity; only the first @par{count} indices are in use.
+ *  @param count The number of indices already in the buffer.
+ *  @param data The indexed data.
+ *  @param indexRange The range of samples in the bucket.
+ *  @return The number of indices in the buffer after the bucket was appended.
+ **/
+-(NSUInteger)appendLevelOfDetailIndicesToBuffer:(nonnull NSMutableData *)indices count:(NSUInteger)count forData:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    NSParameterAssert(NSMaxRange(indexRange) <= self.sampleCount);
+
+    if ( indexRange.length == 0 ) {
+        return count;
+    }
+
+    if ( [self numberOfNaNValuesForData:data inIndexRange:indexRange] > 0 ) {
+        return [self appendRunIndicesToBuffer:indices count:count data:data inIndexRange:indexRange];
+    }
+
+    NSUInteger minIndex = NSNotFound;
+    NSUInteger maxIndex = NSNotFound;
+
+    [self getMinimumIndex:&minIndex maximumIndex:&maxIndex forData:data inIndexRange:indexRange];
+
+    count = CPTDataRangeIndexAppend(indices, count, indexRange.location);
+    count = CPTDataRangeIndexAppend(indices, count, MIN(minIndex, maxIndex));
+    count = CPTDataRangeIndexAppend(indices, count, MAX(minIndex, maxIndex));
+    count = CPTDataRangeIndexAppend(indices, count, NSMaxRange(indexRange) - 1);
+
+    return count;
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Appends the first, smallest, largest, and last sample of each run of values in a range that contains @NAN values.
+ *  @param indices The buffer of indices.
+ *  @param count The number of indices already in the buffer.
+ *  @param data The indexed data.
+ *  @param indexRange The range of samples to scan.
+ *  @return The number of indices in the buffer after the runs were appended.
+ **/
+-(NSUInteger)appendRunIndicesToBuffer:(nonnull NSMutableData *)indices count:(NSUInteger)count data:(nonnull CPTNumericData *)data inIndexRange:(NSRange)indexRange
+{
+    const void *bytes              = data.bytes;
+    NSUInteger stride              = data.sampleStride;
+    CPTDataRangeIndexFormat format = self.sampleFormat;
+    NSUInteger end                 = NSMaxRange(indexRange);
+    NSUInteger i                   = indexRange.location;
+
+    while ( i < end ) {
+        if ( CPTDataRangeIndexValueIsNaN(bytes, format, stride, i)) {
+            count = CPTDataRangeIndexAppend(indices, count, NSNotFound);
+            i++;
+            continue;
+        }
+
+        NSUInteger runEnd = i + 1;
+        while ((runEnd < end) && !CPTDataRangeIndexValueIsNaN(bytes, format, stride, runEnd)) {
+            runEnd++;
+        }
+
+        NSUInteger minIndex = NSNotFound;
+        NSUInteger maxIndex = NSNotFound;
+
+        CPTDataRangeIndexScan(bytes, format, stride, i, runEnd, &minIndex, &maxIndex);
+
+        count = CPTDataRangeIndexAppend(indices, count, i);
+        count = CPTDataRangeIndexAppend(indices, count, MIN(minIndex, maxIndex));
+        count = CPTDataRangeIndexAppend(indices, count, MAX(minIndex, maxIndex));
+        count = CPTDataRangeIndexAppend(indices, count, runEnd - 1);
+
+        i = runEnd;
+    }
+
+    return count;
+}
+
+-(NSUInteger)minimumOfIndex:(NSUInteger)idx1 andIndex:(NSUInteger)idx2 bytes:(nonnull const void *)bytes stride:(NSUInteger)stride
+{
+    if ( idx1 == NSNotFound ) {
+        return idx2;
+    }
+    if ( idx2 == NSNotFound ) {
+        return idx1;
+    }
+
+    NSUInteger base = self.origin;
+
+    return CPTDataRangeIndexValueIsLess(bytes, self.sampleFormat, stride, idx2 - base, idx1 - base) ? idx2 : idx1;
+}
+
+-(NSUInteger)maximumOfIndex:(NSUInteger)idx1 andIndex:(NSUInteger)idx2 bytes:(nonnull const void *)bytes stride:(NSUInteger)stride
+{
+    if ( idx1 == NSNotFound ) {
+        return idx2;
+    }
+    if ( idx2 == NSNotFound ) {
+        return idx1;
+    }
+
+    NSUInteger base = self.origin;
+
+    return CPTDataRangeIndexValueIsLess(bytes, self.sampleFormat, stride, idx1 - base, idx2 - base) ? idx2 : idx1;
+}
+
+/// @endcond
+
+@end
+
+#pragma mark -
+
+/// @cond
+
+static BOOL CPTDataRangeIndexValueIsLess(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger idx1, NSUInteger idx2)
+{
+    switch ( format ) {
+        case CPTDataRangeIndexFormatDecimal:
+        {
+            const NSDecimal *decimals = (const NSDecimal *)bytes;
+            return CPTDecimalLessThan(decimals[idx1 * stride], decimals[idx2 * stride]);
+        }
+
+        case CPTDataRangeIndexFormatFloat:
+        {
+            const float *floats = (const float *)bytes;
+            return floats[idx1 * stride] < floats[idx2 * stride];
+        }
+
+        default:
+        {
+            const double *doubles = (const double *)bytes;
+            return doubles[idx1 * stride] < doubles[idx2 * stride];
+        }
+    }
+}
+
+static BOOL CPTDataRangeIndexValueIsNaN(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger idx)
+{
+    switch ( format ) {
+        case CPTDataRangeIndexFormatDecimal:
+        {
+            NSDecimal value = ((const NSDecimal *)bytes)[idx * stride];
+            return NSDecimalIsNotANumber(&value);
+        }
+
+        case CPTDataRangeIndexFormatFloat:
+            return isnan(((const float *)bytes)[idx * stride]);
+
+        default:
+            return isnan(((const double *)bytes)[idx * stride]);
+    }
+}
+
+static double CPTDataRangeIndexDoubleValue(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger idx)
+{
+    switch ( format ) {
+        case CPTDataRangeIndexFormatDecimal:
+            return CPTDecimalDoubleValue(((const NSDecimal *)bytes)[idx * stride]);
+
+        case CPTDataRangeIndexFormatFloat:
+            return (double)((const float *)bytes)[idx * stride];
+
+        default:
+            return ((const double *)bytes)[idx * stride];
+    }
+}
+
+/** @internal
+ *  @brief Finds the smallest and largest values in a range of samples with a linear scan.
+ *  @param bytes The sample values.
+ *  @param format The type of the sample values.
+ *  @param stride The distance between consecutive samples, measured in samples.
+ *  @param start The index of the first sample to search.
+ *  @param end The index following the last sample to search.
+ *  @param minIndex Returns the index of the smallest value or @ref NSNotFound if every value is @NAN.
+ *  @param maxIndex Returns the index of the largest value or @ref NSNotFound if every value is @NAN.
+ **/
+static void CPTDataRangeIndexScan(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger start, NSUInteger end, NSUInteger *__nonnull minIndex, NSUInteger *__nonnull maxIndex)
+{
+    NSUInteger bestMin = NSNotFound;
+    NSUInteger bestMax = NSNotFound;
+
+    switch ( format ) {
+        case CPTDataRangeIndexFormatDecimal:
+        {
+            const NSDecimal *decimals = (const NSDecimal *)bytes;
+
+            for ( NSUInteger i = start; i < end; i++ ) {
+                NSDecimal value = decimals[i * stride];
+
+                if ( !NSDecimalIsNotANumber(&value)) {
+                    if ((bestMin == NSNotFound) || CPTDecimalLessThan(value, decimals[bestMin * stride])) {
+                        bestMin = i;
+                    }
+                    if ((bestMax == NSNotFound) || CPTDecimalGreaterThan(value, decimals[bestMax * stride])) {
+                        bestMax = i;
+                    }
+                }
+            }
+        }
+        break;
+
+        case CPTDataRangeIndexFormatFloat:
+        {
+            const float *floats = (const float *)bytes;
+
+            float minValue = INFINITY;
+            float maxValue = -INFINITY;
+
+            for ( NSUInteger i = start; i < end; i++ ) {
+                float value = floats[i * stride];
+
+                if ( !isnan(value)) {
+                    if ((bestMin == NSNotFound) || (value < minValue)) {
+                        minValue = value;
+                        bestMin  = i;
+                    }
+                    if ((bestMax == NSNotFound) || (value > maxValue)) {
+                        maxValue = value;
+                        bestMax  = i;
+                    }
+                }
+            }
+        }
+        break;
+
+        default:
+        {
+            const double *doubles = (const double *)bytes;
+
+            double minValue = (double)INFINITY;
+            double maxValue = -(double)INFINITY;
+
+            for ( NSUInteger i = start; i < end; i++ ) {
+                double value = doubles[i * stride];
+
+                if ( !isnan(value)) {
+                    if ((bestMin == NSNotFound) || (value < minValue)) {
+                        minValue = value;
+                        bestMin  = i;
+                    }
+                    if ((bestMax == NSNotFound) || (value > maxValue)) {
+                        maxValue = value;
+                        bestMax  = i;
+                    }
+                }
+            }
+        }
+        break;
+    }
+
+    *minIndex = bestMin;
+    *maxIndex = bestMax;
+}
+
+/** @internal
+ *  @brief Counts the samples in a range that are not less than or equal to the sample after them.
+ *  Comparisons with @NAN values count as descents.
+ *  @param bytes The sample values.
+ *  @param format The type of the sample values.
+ *  @param stride The distance between consecutive samples, measured in samples.
+ *  @param start The index of the first sample to check.
+ *  @param end The index following the last sample to check.
+ *  @param count The number of samples in the data. The last sample has no successor and is never counted.
+ *  @return The number of descending pairs.
+ **/
+static NSUInteger CPTDataRangeIndexCountDescents(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger start, NSUInteger end, NSUInteger count)
+{
+    NSUInteger descents = 0;
+    NSUInteger last     = MIN(end, count - 1);
+
+    switch ( format ) {
+        case CPTDataRangeIndexFormatDecimal:
+        {
+            const NSDecimal *decimals = (const NSDecimal *)bytes;
+
+            for ( NSUInteger i = start; i < last; i++ ) {
+                NSDecimal value     = decimals[i * stride];
+                NSDecimal nextValue = decimals[(i + 1) * stride];
+
+                if ( NSDecimalIsNotANumber(&value) || NSDecimalIsNotANumber(&nextValue) || CPTDecimalGreaterThan(value, nextValue)) {
+                    descents++;
+                }
+            }
+        }
+        break;
+
+        case CPTDataRangeIndexFormatFloat:
+        {
+            const float *floats = (const float *)bytes;
+
+            for ( NSUInteger i = start; i < last; i++ ) {
+                if ( !(floats[i * stride] <= floats[(i + 1) * stride])) {
+                    descents++;
+                }
+            }
+        }
+        break;
+
+        default:
+        {
+            const double *doubles = (const double *)bytes;
+
+            for ( NSUInteger i = start; i < last; i++ ) {
+                if ( !(doubles[i * stride] <= doubles[(i + 1) * stride])) {
+                    descents++;
+                }
+            }
+        }
+        break;
+    }
+
+    return descents;
+}
+
+/** @internal
+ *  @brief Counts the @NAN samples in a range.
+ *  @param bytes The sample values.
+ *  @param format The type of the sample values.
+ *  @param stride The distance between consecutive samples, measured in samples.
+ *  @param start The index of the first sample to check.
+ *  @param end The index following the last sample to check.
+ *  @return The number of @NAN samples.
+ **/
+static NSUInteger CPTDataRangeIndexCountNaNs(const void *__nonnull bytes, CPTDataRangeIndexFormat format, NSUInteger stride, NSUInteger start, NSUInteger end)
+{
+    NSUInteger nanCount = 0;
+
+    switch ( format ) {
+        case CPTDataRangeIndexFormatDecimal:
+        {
+            const NSDecimal *decimals = (const NSDecimal *)bytes;
+
+            for ( NSUInteger i = start; i < end; i++ ) {
+                NSDecimal value = decimals[i * stride];
+
+                if ( NSDecimalIsNotANumber(&value)) {
+                    nanCount++;
+                }
+            }
+        }
+        break;
+
+        case CPTDataRangeIndexFormatFloat:
+        {
+            const float *floats = (const float *)bytes;
+
+            for ( NSUInteger i = start; i < end; i++ ) {
+                if ( isnan(floats[i * stride])) {
+                    nanCount++;
+                }
+            }
+        }
+        break;
+
+        default:
+        {
+            const double *doubles = (const double *)bytes;
+
+            for ( NSUInteger i = start; i < end; i++ ) {
+                if ( isnan(doubles[i * stride])) {
+                    nanCount++;
+                }
+            }
+        }
+        break;
+    }
+
+    return nanCount;
+}
+
+/** @internal
+ *  @brief Appends an index to a buffer of level of detail indices, growing the buffer if needed.
+ *
+ *  An index equal to the last one in the buffer is skipped, so runs of @ref NSNotFound gap markers
+ *  collapse to one marker. A gap marker at the start of the buffer is skipped as well.
+ *
+ *  @param indices The buffer of indices.
+ *  @param count The number of indices already in the buffer.
+ *  @param idx The index to append.
+ *  @return The number of indices in the buffer after the index was appended.
+ **/
+static NSUInteger CPTDataRangeIndexAppend(NSMutableData *__nonnull indices, NSUInteger count, NSUInteger idx)
+{
+    NSUInteger *values = (NSUInteger *)indices.mutableBytes;
+
+    if ( count > 0 ) {
+        if ( values[count - 1] == idx ) {
+            return count;
+        }
+    }
+    else if ( idx == NSNotFound ) {
+        return count;
+    }
+
+    NSUInteger capacity = indices.length / sizeof(NSUInteger);
+
+    if ( count >= capacity ) {
+        indices.length = MAX(2 * capacity, (NSUInteger)64) * sizeof(NSUInteger);
+        values         = (NSUInteger *)indices.mutableBytes;
+    }
+
+    values[count] = idx;
+
+    return count + 1;
+}
+
+/// @endcond
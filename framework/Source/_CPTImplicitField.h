@@ -0,0 +1,37 @@
+#import "CPTNumericDataType.h"
+
+@class CPTMutableNumericData;
+@class CPTPlotRange;
+
+@interface _CPTImplicitField : NSObject<NSCoding, NSSecureCoding>
+
+@property (nonatomic, readonly) NSDecimal origin;
+@property (nonatomic, readonly) NSDecimal step;
+@property (nonatomic, readonly) double originDouble;
+@property (nonatomic, readonly) double stepDouble;
+
+/// @name Initialization
+/// @{
+-(nonnull instancetype)initWithOrigin:(NSDecimal)newOrigin step:(NSDecimal)newStep NS_DESIGNATED_INITIALIZER;
+-(nullable instancetype)initWithCoder:(nonnull NSCoder *)coder NS_DESIGNATED_INITIALIZER;
+/// @}
+
+/// @name Updating the Origin
+/// @{
+-(void)offsetOriginByNumberOfRecords:(NSInteger)numberOfRecords;
+/// @}
+
+/// @name Values
+/// @{
+-(double)doubleValueAtIndex:(NSUInteger)idx;
+-(NSDecimal)decimalValueAtIndex:(NSUInteger)idx;
+-(void)getDoubles:(nonnull double *)values inIndexRange:(NSRange)indexRange;
+-(nonnull CPTMutableNumericData *)numericDataWithNumberOfRecords:(NSUInteger)numberOfRecords dataType:(CPTNumericDataType)dataType;
+/// @}
+
+/// @name Queries
+/// @{
+-(NSRange)indexRangeForPlotRange:(nonnull CPTPlotRange *)plotRange numberOfRecords:(NSUInteger)numberOfRecords;
+/// @}
+
+@end
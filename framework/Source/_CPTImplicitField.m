@@ -0,0 +1,331 @@
+#import "_CPTImplicitField.h"
+
+#import "CPTExceptions.h"
+#import "CPTMutableNumericData.h"
+#import "CPTPlotRange.h"
+#import "CPTUtilities.h"
+#import "NSCoderExtensions.h"
+#import <tgmath.h>
+
+/// @cond
+
+static NSUInteger CPTImplicitFieldClampIndex(double idx, NSUInteger numberOfRecords);
+
+@interface _CPTImplicitField()
+
+@property (nonatomic, readwrite, assign) NSDecimal origin;
+@property (nonatomic, readwrite, assign) NSDecimal step;
+@property (nonatomic, readwrite, assign) double originDouble;
+@property (nonatomic, readwrite, assign) double stepDouble;
+@property (nonatomic, readwrite, strong, nullable) CPTMutableNumericData *materializedData;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief A plot data field whose values are evenly spaced and computed from the record index.
+ *
+ *  The value of record @par{i} is @par{origin + i × step}. Only the origin and step are stored, so
+ *  values, extremes, and the records that fall within a range of values are computed in constant time
+ *  without a cached array of values.
+ **/
+@implementation _CPTImplicitField
+
+/** @property NSDecimal origin
+ *  @brief The value of the first record.
+ **/
+@synthesize origin;
+
+/** @property NSDecimal step
+ *  @brief The difference between the values of neighboring records.
+ **/
+@synthesize step;
+
+/** @property double originDouble
+ *  @brief The value of the first record as a @double.
+ **/
+@synthesize originDouble;
+
+/** @property double stepDouble
+ *  @brief The difference between the values of neighboring records as a @double.
+ **/
+@synthesize stepDouble;
+
+/** @internal
+ *  @property nullable CPTMutableNumericData *materializedData
+ *  @brief The values returned by the last call to
+ *  @link _CPTImplicitField::numericDataWithNumberOfRecords:dataType: -numericDataWithNumberOfRecords:dataType: @endlink.
+ *  The same object is shared by every caller until it is discarded.
+ **/
+@synthesize materializedData;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Initializes a newly allocated _CPTImplicitField object with the provided origin and step.
+ *  @param newOrigin The value of the first record.
+ *  @param newStep The difference between the values of neighboring records.
+ *  @return The initialized _CPTImplicitField object.
+ **/
+-(nonnull instancetype)initWithOrigin:(NSDecimal)newOrigin step:(NSDecimal)newStep
+{
+    if ((self = [super init])) {
+        origin           = newOrigin;
+        step             = newStep;
+        originDouble     = CPTDecimalDoubleValue(newOrigin);
+        stepDouble       = CPTDecimalDoubleValue(newStep);
+        materializedData = nil;
+    }
+    return self;
+}
+
+/// @cond
+
+-(nonnull instancetype)init
+{
+    return [self initWithOrigin:CPTDecimalFromInteger(0) step:CPTDecimalFromInteger(1)];
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark NSCoding Methods
+
+/// @cond
+
+-(void)encodeWithCoder:(nonnull NSCoder *)coder
+{
+    [coder encodeDecimal:self.origin forKey:@"_CPTImplicitField.origin"];
+    [coder encodeDecimal:self.step forKey:@"_CPTImplicitField.step"];
+
+    // No need to archive these properties:
+    // originDouble
+    // stepDouble
+    // materializedData
+}
+
+/// @endcond
+
+/** @brief Returns an object initialized from data in a given unarchiver.
+ *  @param coder An unarchiver object.
+ *  @return An object initialized from data in a given unarchiver.
+ */
+-(nullable instancetype)initWithCoder:(nonnull NSCoder *)coder
+{
+    if ((self = [super init])) {
+        origin           = [coder decodeDecimalForKey:@"_CPTImplicitField.origin"];
+        step             = [coder decodeDecimalForKey:@"_CPTImplicitField.step"];
+        originDouble     = CPTDecimalDoubleValue(origin);
+        stepDouble       = CPTDecimalDoubleValue(step);
+        materializedData = nil;
+    }
+    return self;
+}
+
+#pragma mark -
+#pragma mark NSSecureCoding Methods
+
+/// @cond
+
++(BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Updating the Origin
+
+/** @brief Moves the origin by a whole number of steps.
+ *
+ *  Used to keep the values of existing records unchanged when records are inserted at or removed from
+ *  the front of the data.
+ *
+ *  @param numberOfRecords The number of steps to move the origin. Negative values move it backward.
+ **/
+-(void)offsetOriginByNumberOfRecords:(NSInteger)numberOfRecords
+{
+    if ( numberOfRecords != 0 ) {
+        NSDecimal newOrigin = CPTDecimalAdd(self.origin, CPTDecimalMultiply(self.step, CPTDecimalFromInteger(numberOfRecords)));
+
+        self.origin           = newOrigin;
+        self.originDouble     = CPTDecimalDoubleValue(newOrigin);
+        self.materializedData = nil;
+    }
+}
+
+#pragma mark -
+#pragma mark Values
+
+/** @brief Computes the value of a record as a @double.
+ *  @param idx The record index.
+ *  @return The value of the record.
+ **/
+-(double)doubleValueAtIndex:(NSUInteger)idx
+{
+    return self.originDouble + (double)idx * self.stepDouble;
+}
+
+/** @brief Computes the value of a record as an @ref NSDecimal.
+ *  @param idx The record index.
+ *  @return The value of the record.
+ **/
+-(NSDecimal)decimalValueAtIndex:(NSUInteger)idx
+{
+    return CPTDecimalAdd(self.origin, CPTDecimalMultiply(self.step, CPTDecimalFromUnsignedInteger(idx)));
+}
+
+/** @brief Computes the values of a range of records as @double values.
+ *  @param values A C array that receives the values. Must have room for at least @par{indexRange.length} values.
+ *  @param indexRange The range of record indices.
+ **/
+-(void)getDoubles:(nonnull double *)values inIndexRange:(NSRange)indexRange
+{
+    double start = self.originDouble;
+    double delta = self.stepDouble;
+
+    for ( NSUInteger i = 0; i < indexRange.length; i++ ) {
+        values[i] = start + (double)(indexRange.location + i) * delta;
+    }
+}
+
+/** @brief Materializes the values of the first records as numeric data.
+ *
+ *  The result is kept and the same object is returned again until the number of records, the data type,
+ *  or the origin changes. Callers should treat it as read-only: changes made to it are seen by every later
+ *  caller, including the plot data cache, until the values are materialized again from the origin and step.
+ *
+ *  @param numberOfRecords The number of records.
+ *  @param dataType The data type of the result. Must be host byte order @double, @float, or @ref NSDecimal.
+ *  @return The record values.
+ **/
+-(nonnull CPTMutableNumericData *)numericDataWithNumberOfRecords:(NSUInteger)numberOfRecords dataType:(CPTNumericDataType)dataType
+{
+    CPTMutableNumericData *numbers = self.materializedData;
+
+    if ( numbers && (numbers.numberOfSamples == numberOfRecords) && CPTDataTypeEqualToDataType(numbers.dataType, dataType)) {
+        return numbers;
+    }
+
+    numbers = [[CPTMutableNumericData alloc] initWithData:[NSData data]
+                                                 dataType:dataType
+                                                    shape:nil];
+    numbers.shape = @[@(numberOfRecords)];
+
+    void *samples = numbers.mutableBytes;
+
+    switch ( dataType.dataTypeFormat ) {
+        case CPTFloatingPointDataType:
+            if ( dataType.sampleBytes == sizeof(float)) {
+                float *floats = (float *)samples;
+                double start  = self.originDouble;
+                double delta  = self.stepDouble;
+                for ( NSUInteger i = 0; i < numberOfRecords; i++ ) {
+                    floats[i] = (float)(start + (double)i * delta);
+                }
+            }
+            else {
+                [self getDoubles:(double *)samples inIndexRange:NSMakeRange(0, numberOfRecords)];
+            }
+            break;
+
+        case CPTDecimalDataType:
+        {
+            NSDecimal *decimals = (NSDecimal *)samples;
+            NSDecimal value     = self.origin;
+            NSDecimal delta     = self.step;
+            for ( NSUInteger i = 0; i < numberOfRecords; i++ ) {
+                decimals[i] = value;
+                value       = CPTDecimalAdd(value, delta);
+            }
+        }
+        break;
+
+        default:
+            [NSException raise:CPTException format:@"Unsupported data type format"];
+            break;
+    }
+
+    self.materializedData = numbers;
+
+    return numbers;
+}
+
+#pragma mark -
+#pragma mark Queries
+
+/** @brief Finds the records whose values fall within a range.
+ *
+ *  The step must not be negative. The index estimate is corrected against the computed record values,
+ *  so the result matches a binary search of the materialized values.
+ *
+ *  @param plotRange The range of values.
+ *  @param numberOfRecords The number of records.
+ *  @return The range of record indices.
+ **/
+-(NSRange)indexRangeForPlotRange:(nonnull CPTPlotRange *)plotRange numberOfRecords:(NSUInteger)numberOfRecords
+{
+    double minValue = plotRange.minLimitDouble;
+    double maxValue = plotRange.maxLimitDouble;
+    double start    = self.originDouble;
+    double delta    = self.stepDouble;
+
+    NSUInteger lowIndex  = 0; // first index with value >= minimum
+    NSUInteger highIndex = 0; // first index with value > maximum
+
+    if ( delta > 0.0 ) {
+        lowIndex  = CPTImplicitFieldClampIndex(ceil((minValue - start) / delta), numberOfRecords);
+        highIndex = CPTImplicitFieldClampIndex(floor((maxValue - start) / delta) + 1.0, numberOfRecords);
+
+        // correct for rounding in the estimates
+        while ((lowIndex > 0) && ([self doubleValueAtIndex:lowIndex - 1] >= minValue)) {
+            lowIndex--;
+        }
+        while ((lowIndex < numberOfRecords) && ([self doubleValueAtIndex:lowIndex] < minValue)) {
+            lowIndex++;
+        }
+        while ((highIndex > 0) && ([self doubleValueAtIndex:highIndex - 1] > maxValue)) {
+            highIndex--;
+        }
+        while ((highIndex < numberOfRecords) && ([self doubleValueAtIndex:highIndex] <= maxValue)) {
+            highIndex++;
+        }
+    }
+    else {
+        // every record has the same value
+        lowIndex  = (start < minValue) ? numberOfRecords : 0;
+        highIndex = (start <= maxValue) ? numberOfRecords : 0;
+    }
+
+    highIndex = MAX(lowIndex, highIndex);
+
+    return NSMakeRange(lowIndex, highIndex - lowIndex);
+}
+
+@end
+
+#pragma mark -
+
+/// @cond
+
+/** @internal
+ *  @brief Converts an estimated record index to an index in the range @par{[0, numberOfRecords]}.
+ *  @param idx The estimated index.
+ *  @param numberOfRecords The number of records.
+ *  @return The clamped index. @NAN estimates return zero.
+ **/
+static NSUInteger CPTImplicitFieldClampIndex(double idx, NSUInteger numberOfRecords)
+{
+    if ( isnan(idx) || (idx <= 0.0)) {
+        return 0;
+    }
+    if ( idx >= (double)numberOfRecords ) {
+        return numberOfRecords;
+    }
+    return (NSUInteger)idx;
+}
+
+/// @endcond
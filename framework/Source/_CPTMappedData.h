@@ -0,0 +1,8 @@
+@interface _CPTMappedData : NSData
+
+/// @name Factory Methods
+/// @{
++(nullable NSData *)dataWithContentsOfURL:(nonnull NSURL *)url offset:(NSUInteger)offset length:(NSUInteger)length error:(NSError *__nullable *__nullable)error;
+/// @}
+
+@end
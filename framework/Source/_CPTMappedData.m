@@ -0,0 +1,239 @@
+#import "_CPTMappedData.h"
+
+#import <sys/mman.h>
+#import <sys/stat.h>
+
+/// @cond
+
+@interface _CPTMappedData()
+
+@property (nonatomic, readwrite, strong, nullable) _CPTMappedData *mapping;
+@property (nonatomic, readwrite, assign, nullable) void *mappedBytes;
+@property (nonatomic, readwrite, assign) size_t mappedLength;
+@property (nonatomic, readwrite, assign, nonnull) const void *viewBytes;
+@property (nonatomic, readwrite, assign) NSUInteger viewLength;
+
+-(nonnull instancetype)initWithMapping:(nullable _CPTMappedData *)owner bytes:(nonnull const void *)bytes length:(NSUInteger)length;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief An immutable data buffer that reads its bytes from a memory-mapped file.
+ *
+ *  The file is mapped read-only and its pages are read by the operating system the first time they are used,
+ *  so opening a large file is fast and only the parts that are accessed become resident.
+ *  Pages that have not been changed can be discarded under memory pressure and read again later.
+ *
+ *  Copies and subranges share the mapping, which is released when the last object using it is deallocated.
+ **/
+@implementation _CPTMappedData
+
+/** @property nullable _CPTMappedData *mapping
+ *  @brief The object that owns the mapping or @nil if the receiver owns it.
+ **/
+@synthesize mapping;
+
+/** @property nullable void *mappedBytes
+ *  @brief The start of the mapped pages. Only set on the object that owns the mapping.
+ **/
+@synthesize mappedBytes;
+
+/** @property size_t mappedLength
+ *  @brief The number of mapped bytes, including any bytes before the requested offset in the first page.
+ **/
+@synthesize mappedLength;
+
+/** @property nonnull const void *viewBytes
+ *  @brief The first byte of the receiver.
+ **/
+@synthesize viewBytes;
+
+/** @property NSUInteger viewLength
+ *  @brief The number of bytes in the receiver.
+ **/
+@synthesize viewLength;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Maps part of a file into memory.
+ *  @param url A file URL.
+ *  @param offset The byte offset of the first byte to map.
+ *  @param length The number of bytes to map.
+ *  @param error Returns the reason the file could not be mapped.
+ *  @return A data object backed by the file or @nil if the file could not be mapped.
+ **/
++(nullable NSData *)dataWithContentsOfURL:(nonnull NSURL *)url offset:(NSUInteger)offset length:(NSUInteger)length error:(NSError *__nullable *__nullable)error
+{
+    NSParameterAssert(url.isFileURL);
+
+    const char *path = url.fileSystemRepresentation;
+
+    int fileDescriptor = open(path, O_RDONLY);
+
+    if ( fileDescriptor < 0 ) {
+        if ( error ) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{ NSURLErrorKey: url }];
+        }
+        return nil;
+    }
+
+    struct stat fileStatus;
+
+    if ( fstat(fileDescriptor, &fileStatus) != 0 ) {
+        if ( error ) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{ NSURLErrorKey: url }];
+        }
+        close(fileDescriptor);
+        return nil;
+    }
+
+    if ((offset > (NSUInteger)fileStatus.st_size) || (length > (NSUInteger)fileStatus.st_size - offset)) {
+        if ( error ) {
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError userInfo:@{ NSURLErrorKey: url }];
+        }
+        close(fileDescriptor);
+        return nil;
+    }
+
+    if ( length == 0 ) {
+        close(fileDescriptor);
+        return [NSData data];
+    }
+
+    // mmap() needs a page-aligned offset
+    size_t pageSize   = (size_t)getpagesize();
+    size_t pageOffset = offset % pageSize;
+    size_t mapLength  = length + pageOffset;
+
+    void *bytes = mmap(NULL, mapLength, PROT_READ, MAP_SHARED, fileDescriptor, (off_t)(offset - pageOffset));
+    int mapError = errno;
+
+    // the mapping stays valid after the file is closed
+    close(fileDescriptor);
+
+    if ( bytes == MAP_FAILED ) {
+        if ( error ) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:mapError userInfo:@{ NSURLErrorKey: url }];
+        }
+        return nil;
+    }
+
+    _CPTMappedData *mappedData = [[self alloc] initWithMapping:nil bytes:(const int8_t *)bytes + pageOffset length:length];
+
+    mappedData.mappedBytes  = bytes;
+    mappedData.mappedLength = mapLength;
+
+    return mappedData;
+}
+
+/// @cond
+
+/** @internal
+ *  @brief Initializes a newly allocated _CPTMappedData object that views part of a mapping.
+ *  @param owner The object that owns the mapping or @nil if the receiver will own it.
+ *  @param bytes The first byte of the view.
+ *  @param length The number of bytes in the view.
+ *  @return The initialized object.
+ **/
+-(nonnull instancetype)initWithMapping:(nullable _CPTMappedData *)owner bytes:(nonnull const void *)bytes length:(NSUInteger)length
+{
+    if ((self = [super init])) {
+        mapping      = owner;
+        mappedBytes  = NULL;
+        mappedLength = 0;
+        viewBytes    = bytes;
+        viewLength   = length;
+    }
+
+    return self;
+}
+
+-(void)dealloc
+{
+    if ( mappedBytes ) {
+        munmap(mappedBytes, mappedLength);
+    }
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark NSData Primitives
+
+/// @cond
+
+-(NSUInteger)length
+{
+    return self.viewLength;
+}
+
+-(nonnull const void *)bytes
+{
+    return self.viewBytes;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Subranges
+
+/// @cond
+
+/** @internal
+ *  @brief Returns a view of part of the receiver that shares the mapping instead of copying the bytes.
+ *  @param range The range of bytes to return.
+ *  @return A data object containing the bytes in @par{range}.
+ **/
+-(nonnull NSData *)subdataWithRange:(NSRange)range
+{
+    NSUInteger myLength = self.viewLength;
+
+    if ((range.location > myLength) || (range.length > myLength - range.location)) {
+        [NSException raise:NSRangeException
+                    format:@"Range %@ exceeds data length (%lu)", NSStringFromRange(range), (unsigned long)myLength];
+    }
+
+    if ( range.length == 0 ) {
+        return [NSData data];
+    }
+
+    _CPTMappedData *owner = self.mapping;
+
+    return [[[self class] alloc] initWithMapping:(owner ? owner : self)
+                                           bytes:(const int8_t *)self.viewBytes + range.location
+                                          length:range.length];
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark NSCopying Methods
+
+/// @cond
+
+-(nonnull id)copyWithZone:(nullable NSZone *__unused)zone
+{
+    // the bytes never change, so copies can share the mapping
+    return self;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark NSCoding Methods
+
+/// @cond
+
+-(nonnull Class)classForCoder
+{
+    // archive the bytes as a plain NSData object
+    return [NSData class];
+}
+
+/// @endcond
+
+@end
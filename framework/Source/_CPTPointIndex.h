@@ -0,0 +1,15 @@
+@interface _CPTPointIndex : NSObject
+
+@property (nonatomic, readonly) NSUInteger pointCount;
+
+/// @name Initialization
+/// @{
+-(nonnull instancetype)initWithPoints:(nullable const CGPoint *)points includedPoints:(nullable const BOOL *)includedPoints indexRange:(NSRange)indexRange NS_DESIGNATED_INITIALIZER;
+/// @}
+
+/// @name Queries
+/// @{
+-(NSUInteger)indexOfPointClosestToPoint:(CGPoint)point;
+/// @}
+
+@end
@@ -0,0 +1,254 @@
+#import "_CPTPointIndex.h"
+
+#import "CPTUtilities.h"
+#import <tgmath.h>
+
+/// @cond
+
+/**
+ *  @brief A point stored in the tree.
+ **/
+typedef struct _CPTPointIndexEntry {
+    CGPoint    point; ///< The point.
+    NSUInteger index; ///< The index of the point.
+}
+CPTPointIndexEntry;
+
+static void CPTPointIndexBuildTree(CPTPointIndexEntry *__nonnull entries, NSUInteger count, BOOL splitOnX);
+static void CPTPointIndexSelect(CPTPointIndexEntry *__nonnull entries, NSUInteger count, NSUInteger k, BOOL splitOnX);
+static void CPTPointIndexSearchTree(const CPTPointIndexEntry *__nonnull entries, NSUInteger count, BOOL splitOnX, CGPoint point, NSUInteger *__nonnull bestIndex, CGFloat *__nonnull bestDistanceSquared);
+
+@interface _CPTPointIndex()
+
+@property (nonatomic, readwrite, assign) NSUInteger pointCount;
+@property (nonatomic, readwrite, assign, nullable) CPTPointIndexEntry *entries;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief A two-dimensional tree of points used to find the point closest to a location.
+ *
+ *  The points are stored in a single array. The median point of each subarray along the splitting axis
+ *  sits in the middle, with the points below it before and the points above it after, and the splitting
+ *  axis alternates between x and y at each level. Building the tree takes @par{O(n log n)} time and
+ *  a query takes logarithmic time on average without allocating memory.
+ *
+ *  Points with @NAN coordinates are not indexed.
+ **/
+@implementation _CPTPointIndex
+
+/** @property NSUInteger pointCount
+ *  @brief The number of indexed points.
+ **/
+@synthesize pointCount;
+
+/** @internal
+ *  @property CPTPointIndexEntry *entries
+ *  @brief The indexed points, arranged as a tree.
+ **/
+@synthesize entries;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Initializes a newly allocated _CPTPointIndex object with the provided points.
+ *  @param points A C array of points. The points are copied.
+ *  @param includedPoints A C array of flags, one for each point. Only points with a @YES flag are indexed.
+ *  If @NULL, every point is indexed.
+ *  @param indexRange The range of points to index. The indices returned by queries are positions in the full array.
+ *  @return The initialized _CPTPointIndex object.
+ **/
+-(nonnull instancetype)initWithPoints:(nullable const CGPoint *)points includedPoints:(nullable const BOOL *)includedPoints indexRange:(NSRange)indexRange
+{
+    if ((self = [super init])) {
+        pointCount = 0;
+        entries    = NULL;
+
+        if ( points && (indexRange.length > 0)) {
+            entries = malloc(indexRange.length * sizeof(CPTPointIndexEntry));
+
+            for ( NSUInteger i = indexRange.location; i < NSMaxRange(indexRange); i++ ) {
+                CGPoint point = points[i];
+
+                if ((includedPoints && !includedPoints[i]) || isnan(point.x) || isnan(point.y)) {
+                    continue;
+                }
+
+                entries[pointCount].point = point;
+                entries[pointCount].index = i;
+                pointCount++;
+            }
+
+            CPTPointIndexBuildTree(entries, pointCount, YES);
+        }
+    }
+    return self;
+}
+
+/// @cond
+
+-(nonnull instancetype)init
+{
+    return [self initWithPoints:NULL includedPoints:NULL indexRange:NSMakeRange(0, 0)];
+}
+
+-(void)dealloc
+{
+    free(entries);
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Queries
+
+/** @brief Finds the indexed point closest to a location.
+ *
+ *  If several points are the same distance from the location, the one with the lowest index is returned.
+ *
+ *  @param point The location.
+ *  @return The index of the closest point, or @ref NSNotFound if there are no indexed points.
+ **/
+-(NSUInteger)indexOfPointClosestToPoint:(CGPoint)point
+{
+    NSUInteger bestIndex        = NSNotFound;
+    CGFloat bestDistanceSquared = CPTFloat(INFINITY);
+
+    if ( !isnan(point.x) && !isnan(point.y)) {
+        CPTPointIndexSearchTree(self.entries, self.pointCount, YES, point, &bestIndex, &bestDistanceSquared);
+    }
+
+    return bestIndex;
+}
+
+@end
+
+#pragma mark -
+
+/// @cond
+
+/** @internal
+ *  @brief Arranges points into a tree in place.
+ *  @param entries The points.
+ *  @param count The number of points.
+ *  @param splitOnX If @YES, split the points along the x-axis at this level, otherwise along the y-axis.
+ **/
+static void CPTPointIndexBuildTree(CPTPointIndexEntry *__nonnull entries, NSUInteger count, BOOL splitOnX)
+{
+    while ( count > 1 ) {
+        NSUInteger median = count / 2;
+
+        CPTPointIndexSelect(entries, count, median, splitOnX);
+        CPTPointIndexBuildTree(entries, median, !splitOnX);
+
+        // continue with the upper half instead of recursing
+        entries  += median + 1;
+        count    -= median + 1;
+        splitOnX = !splitOnX;
+    }
+}
+
+/** @internal
+ *  @brief Partially sorts points so the point at a position is the one that belongs there when sorted along an axis.
+ *
+ *  Points before the position are not above it and points after it are not below it. Uses a three-way partition
+ *  so many points with the same coordinate do not slow it down.
+ *
+ *  @param entries The points.
+ *  @param count The number of points.
+ *  @param k The position to select.
+ *  @param splitOnX If @YES, compare the x-coordinates, otherwise the y-coordinates.
+ **/
+static void CPTPointIndexSelect(CPTPointIndexEntry *__nonnull entries, NSUInteger count, NSUInteger k, BOOL splitOnX)
+{
+    NSUInteger low  = 0;
+    NSUInteger high = count;
+
+    while ( high - low > 1 ) {
+        CPTPointIndexEntry pivotEntry = entries[low + (high - low) / 2];
+        CGFloat pivot                 = splitOnX ? pivotEntry.point.x : pivotEntry.point.y;
+
+        NSUInteger lessEnd      = low;
+        NSUInteger current      = low;
+        NSUInteger greaterStart = high;
+
+        while ( current < greaterStart ) {
+            CGFloat value = splitOnX ? entries[current].point.x : entries[current].point.y;
+
+            if ( value < pivot ) {
+                CPTPointIndexEntry temp = entries[lessEnd];
+                entries[lessEnd++] = entries[current];
+                entries[current++] = temp;
+            }
+            else if ( value > pivot ) {
+                CPTPointIndexEntry temp = entries[--greaterStart];
+                entries[greaterStart] = entries[current];
+                entries[current]      = temp;
+            }
+            else {
+                current++;
+            }
+        }
+
+        if ( k < lessEnd ) {
+            high = lessEnd;
+        }
+        else if ( k >= greaterStart ) {
+            low = greaterStart;
+        }
+        else {
+            return;
+        }
+    }
+}
+
+/** @internal
+ *  @brief Searches a tree for the point closest to a location.
+ *  @param entries The points, arranged as a tree.
+ *  @param count The number of points.
+ *  @param splitOnX If @YES, the points are split along the x-axis at this level, otherwise along the y-axis.
+ *  @param point The location.
+ *  @param bestIndex The index of the closest point found so far. Updated if a closer point is found.
+ *  @param bestDistanceSquared The square of the distance to the closest point found so far. Updated if a closer point is found.
+ **/
+static void CPTPointIndexSearchTree(const CPTPointIndexEntry *__nonnull entries, NSUInteger count, BOOL splitOnX, CGPoint point, NSUInteger *__nonnull bestIndex, CGFloat *__nonnull bestDistanceSquared)
+{
+    if ( count == 0 ) {
+        return;
+    }
+
+    NSUInteger median               = count / 2;
+    const CPTPointIndexEntry *entry = &entries[median];
+
+    CGFloat distanceSquared = squareOfDistanceBetweenPoints(point, entry->point);
+
+    if ((distanceSquared < *bestDistanceSquared) || ((distanceSquared == *bestDistanceSquared) && (entry->index < *bestIndex))) {
+        *bestDistanceSquared = distanceSquared;
+        *bestIndex           = entry->index;
+    }
+
+    CGFloat delta = splitOnX ? point.x - entry->point.x : point.y - entry->point.y;
+
+    const CPTPointIndexEntry *lowerEntries = entries;
+    const CPTPointIndexEntry *upperEntries = entries + median + 1;
+    NSUInteger upperCount                  = count - median - 1;
+
+    // search the side of the split containing the point first
+    if ( delta < CPTFloat(0.0)) {
+        CPTPointIndexSearchTree(lowerEntries, median, !splitOnX, point, bestIndex, bestDistanceSquared);
+        if ( delta * delta <= *bestDistanceSquared ) {
+            CPTPointIndexSearchTree(upperEntries, upperCount, !splitOnX, point, bestIndex, bestDistanceSquared);
+        }
+    }
+    else {
+        CPTPointIndexSearchTree(upperEntries, upperCount, !splitOnX, point, bestIndex, bestDistanceSquared);
+        if ( delta * delta <= *bestDistanceSquared ) {
+            CPTPointIndexSearchTree(lowerEntries, median, !splitOnX, point, bestIndex, bestDistanceSquared);
+        }
+    }
+}
+
+/// @endcond
@@ -0,0 +1,22 @@
+/**
+ *  @brief A block that performs an exact hit test for the rectangle with the given index.
+ *  @param idx The index of the rectangle.
+ *  @return @YES if the rectangle's shape contains the point being tested.
+ **/
+typedef BOOL (^CPTRectIndexTestBlock)(NSUInteger idx);
+
+@interface _CPTRectIndex : NSObject
+
+@property (nonatomic, readonly) NSUInteger rectCount;
+
+/// @name Initialization
+/// @{
+-(nonnull instancetype)initWithRects:(nullable const CGRect *)rects count:(NSUInteger)count sortedByX:(BOOL)sortByX NS_DESIGNATED_INITIALIZER;
+/// @}
+
+/// @name Queries
+/// @{
+-(NSUInteger)firstIndexOfRectContainingPoint:(CGPoint)point passingTest:(nullable CPTRectIndexTestBlock)test;
+/// @}
+
+@end
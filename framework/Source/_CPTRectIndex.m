@@ -0,0 +1,262 @@
+#import "_CPTRectIndex.h"
+
+#import "CPTDefinitions.h"
+#import <tgmath.h>
+
+/// @cond
+
+/**
+ *  @brief The extent of one rectangle along the sorted axis.
+ **/
+typedef struct _CPTRectIndexEntry {
+    CGFloat    low;   ///< The smallest coordinate of the rectangle.
+    CGFloat    high;  ///< The largest coordinate of the rectangle.
+    NSUInteger index; ///< The index of the rectangle.
+}
+CPTRectIndexEntry;
+
+static int CPTRectIndexCompareEntries(const void *__nonnull entry1, const void *__nonnull entry2);
+
+@interface _CPTRectIndex()
+
+@property (nonatomic, readwrite, assign) NSUInteger rectCount;
+@property (nonatomic, readwrite, assign) NSUInteger entryCount;
+@property (nonatomic, readwrite, assign) BOOL sortedByX;
+@property (nonatomic, readwrite, assign, nullable) CGRect *rects;
+@property (nonatomic, readwrite, assign, nullable) CPTRectIndexEntry *entries;
+@property (nonatomic, readwrite, assign, nullable) CGFloat *maximumHighs;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief A sorted index of rectangles used to find the rectangles that contain a point.
+ *
+ *  The rectangles are sorted by their smallest coordinate along one axis. Each position in the sorted list
+ *  also stores the largest coordinate of all of the rectangles up to and including it, so a query finds the
+ *  last rectangle that starts before the point with a binary search and walks back only while earlier
+ *  rectangles can still reach the point. Queries take logarithmic time when the rectangles do not overlap
+ *  along the sorted axis, as is the case for the bars of a bar plot.
+ *
+ *  Rectangles that are null or contain @NAN coordinates are not indexed.
+ **/
+@implementation _CPTRectIndex
+
+/** @property NSUInteger rectCount
+ *  @brief The number of rectangles, including those that are not indexed.
+ **/
+@synthesize rectCount;
+
+/** @internal
+ *  @property NSUInteger entryCount
+ *  @brief The number of indexed rectangles.
+ **/
+@synthesize entryCount;
+
+/** @internal
+ *  @property BOOL sortedByX
+ *  @brief If @YES, the rectangles are sorted along the x-axis, otherwise along the y-axis.
+ **/
+@synthesize sortedByX;
+
+/** @internal
+ *  @property CGRect *rects
+ *  @brief The standardized rectangles in index order.
+ **/
+@synthesize rects;
+
+/** @internal
+ *  @property CPTRectIndexEntry *entries
+ *  @brief The extents of the indexed rectangles along the sorted axis, sorted by their smallest coordinate.
+ **/
+@synthesize entries;
+
+/** @internal
+ *  @property CGFloat *maximumHighs
+ *  @brief The largest coordinate of the entries up to and including each position in @ref entries.
+ **/
+@synthesize maximumHighs;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Initializes a newly allocated _CPTRectIndex object with the provided rectangles.
+ *  @param newRects A C array of rectangles. The rectangles are copied.
+ *  @param count The number of rectangles.
+ *  @param sortByX If @YES, sort the rectangles along the x-axis, otherwise along the y-axis.
+ *  Use the axis along which the rectangles overlap the least.
+ *  @return The initialized _CPTRectIndex object.
+ **/
+-(nonnull instancetype)initWithRects:(nullable const CGRect *)newRects count:(NSUInteger)count sortedByX:(BOOL)sortByX
+{
+    if ((self = [super init])) {
+        rectCount    = newRects ? count : 0;
+        entryCount   = 0;
+        sortedByX    = sortByX;
+        rects        = NULL;
+        entries      = NULL;
+        maximumHighs = NULL;
+
+        if ( rectCount > 0 ) {
+            rects   = malloc(rectCount * sizeof(CGRect));
+            entries = malloc(rectCount * sizeof(CPTRectIndexEntry));
+
+            BOOL needsSort = NO;
+
+            for ( NSUInteger i = 0; i < rectCount; i++ ) {
+                CGRect rect = newRects[i];
+
+                if ( CGRectIsNull(rect) || isnan(rect.origin.x) || isnan(rect.origin.y) || isnan(rect.size.width) || isnan(rect.size.height)) {
+                    rects[i] = CGRectNull;
+                    continue;
+                }
+
+                rect     = CGRectStandardize(rect);
+                rects[i] = rect;
+
+                CPTRectIndexEntry *entry = &entries[entryCount];
+                entry->low   = sortByX ? CGRectGetMinX(rect) : CGRectGetMinY(rect);
+                entry->high  = sortByX ? CGRectGetMaxX(rect) : CGRectGetMaxY(rect);
+                entry->index = i;
+
+                if ((entryCount > 0) && (entry->low < entries[entryCount - 1].low)) {
+                    needsSort = YES;
+                }
+                entryCount++;
+            }
+
+            // bar locations are usually in order already
+            if ( needsSort ) {
+                qsort(entries, entryCount, sizeof(CPTRectIndexEntry), CPTRectIndexCompareEntries);
+            }
+
+            maximumHighs = malloc(MAX(entryCount, (NSUInteger)1) * sizeof(CGFloat));
+
+            CGFloat maxHigh = -CPTFloat(INFINITY);
+            for ( NSUInteger i = 0; i < entryCount; i++ ) {
+                maxHigh         = MAX(maxHigh, entries[i].high);
+                maximumHighs[i] = maxHigh;
+            }
+        }
+    }
+    return self;
+}
+
+/// @cond
+
+-(nonnull instancetype)init
+{
+    return [self initWithRects:NULL count:0 sortedByX:YES];
+}
+
+-(void)dealloc
+{
+    free(rects);
+    free(entries);
+    free(maximumHighs);
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Queries
+
+/** @brief Finds the rectangle with the lowest index that contains a point.
+ *
+ *  Points on the edges of a rectangle are inside it.
+ *
+ *  @param point The point.
+ *  @param test An optional exact test for rectangles that contain the point, used when the shapes inside
+ *  the rectangles are not rectangular. If @nil, every rectangle that contains the point passes.
+ *  @return The index of the rectangle, or @ref NSNotFound if no rectangle contains the point and passes the test.
+ **/
+-(NSUInteger)firstIndexOfRectContainingPoint:(CGPoint)point passingTest:(nullable CPTRectIndexTestBlock)test
+{
+    NSUInteger count = self.entryCount;
+
+    if ((count == 0) || isnan(point.x) || isnan(point.y)) {
+        return NSNotFound;
+    }
+
+    const CPTRectIndexEntry *sortedEntries = self.entries;
+    const CGFloat *maxHighs                = self.maximumHighs;
+    const CGRect *allRects                 = self.rects;
+    BOOL byX                               = self.sortedByX;
+
+    CGFloat position = byX ? point.x : point.y;
+
+    // find the first entry that starts after the point
+    NSUInteger low  = 0;
+    NSUInteger high = count;
+
+    while ( low < high ) {
+        NSUInteger mid = low + (high - low) / 2;
+        if ( sortedEntries[mid].low <= position ) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    NSUInteger result = NSNotFound;
+
+    // walk back while an earlier entry can still reach the point
+    for ( NSUInteger i = low; (i > 0) && (maxHighs[i - 1] >= position); i-- ) {
+        const CPTRectIndexEntry *entry = &sortedEntries[i - 1];
+        NSUInteger idx                 = entry->index;
+
+        if ((entry->high < position) || (idx >= result)) {
+            continue;
+        }
+
+        CGRect rect = allRects[idx];
+
+        if ( byX ) {
+            if ((point.y < CGRectGetMinY(rect)) || (point.y > CGRectGetMaxY(rect))) {
+                continue;
+            }
+        }
+        else {
+            if ((point.x < CGRectGetMinX(rect)) || (point.x > CGRectGetMaxX(rect))) {
+                continue;
+            }
+        }
+
+        if ( !test || test(idx)) {
+            result = idx;
+        }
+    }
+
+    return result;
+}
+
+@end
+
+#pragma mark -
+
+/// @cond
+
+/** @internal
+ *  @brief Orders rectangle index entries by their smallest coordinate.
+ *  @param entry1 The first entry.
+ *  @param entry2 The second entry.
+ *  @return A negative, zero, or positive value if the first entry starts before, at, or after the second entry.
+ **/
+static int CPTRectIndexCompareEntries(const void *__nonnull entry1, const void *__nonnull entry2)
+{
+    CGFloat low1 = ((const CPTRectIndexEntry *)entry1)->low;
+    CGFloat low2 = ((const CPTRectIndexEntry *)entry2)->low;
+
+    if ( low1 < low2 ) {
+        return -1;
+    }
+    else if ( low1 > low2 ) {
+        return 1;
+    }
+    return 0;
+}
+
+/// @endcond
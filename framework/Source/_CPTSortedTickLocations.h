@@ -0,0 +1,21 @@
+#import "CPTDefinitions.h"
+
+@class CPTPlotRange;
+
+@interface _CPTSortedTickLocations : NSObject
+
+@property (nonatomic, readonly) NSUInteger count;
+@property (nonatomic, readonly, nullable) const double *doubleValues;
+@property (nonatomic, readonly, nullable) const NSDecimal *decimalValues;
+
+/// @name Initialization
+/// @{
+-(nonnull instancetype)initWithLocations:(nullable CPTNumberSet *)locations NS_DESIGNATED_INITIALIZER;
+/// @}
+
+/// @name Queries
+/// @{
+-(BOOL)locationAtIndex:(NSUInteger)idx isInRange:(nullable CPTPlotRange *)range;
+/// @}
+
+@end
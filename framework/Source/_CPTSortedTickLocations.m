@@ -0,0 +1,163 @@
+#import "_CPTSortedTickLocations.h"
+
+#import "CPTPlotRange.h"
+#import <tgmath.h>
+
+/// @cond
+
+@interface _CPTSortedTickLocations()
+
+@property (nonatomic, readwrite, assign) NSUInteger count;
+@property (nonatomic, readwrite, strong, nonnull) NSData *doubleData;
+@property (nonatomic, readwrite, strong, nonnull) NSData *decimalData;
+@property (nonatomic, readwrite, strong, nonnull) NSData *decimalFlagData;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief The tick locations of an axis in ascending order, stored as C arrays.
+ *
+ *  Axes draw ticks, grid lines, and background bands from these arrays so the draw path neither
+ *  sorts the tick location set nor unboxes its numbers. Each location is kept both as a @double,
+ *  used to position lines, and as an @ref NSDecimal, used where exact values matter. Locations
+ *  that are not numbers (@NAN) are left out.
+ **/
+@implementation _CPTSortedTickLocations
+
+/** @property NSUInteger count
+ *  @brief The number of tick locations.
+ **/
+@synthesize count;
+
+/** @property const double *doubleValues
+ *  @brief The tick locations as doubles, in ascending order.
+ **/
+@dynamic doubleValues;
+
+/** @property const NSDecimal *decimalValues
+ *  @brief The tick locations as decimals, in the same order as @ref doubleValues.
+ **/
+@dynamic decimalValues;
+
+/** @internal
+ *  @property nonnull NSData *doubleData
+ *  @brief The storage of @ref doubleValues.
+ **/
+@synthesize doubleData;
+
+/** @internal
+ *  @property nonnull NSData *decimalData
+ *  @brief The storage of @ref decimalValues.
+ **/
+@synthesize decimalData;
+
+/** @internal
+ *  @property nonnull NSData *decimalFlagData
+ *  @brief For each location, a @BOOL that is @YES if it was given as an NSDecimalNumber.
+ **/
+@synthesize decimalFlagData;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Initializes a newly allocated _CPTSortedTickLocations object with the provided tick locations.
+ *  @param locations A set of tick locations.
+ *  @return The initialized _CPTSortedTickLocations object.
+ **/
+-(nonnull instancetype)initWithLocations:(nullable CPTNumberSet *)locations
+{
+    if ((self = [super init])) {
+        CPTMutableNumberArray *sortedLocations = [NSMutableArray arrayWithCapacity:locations.count];
+
+        for ( NSNumber *location in locations ) {
+            if ( !isnan(location.doubleValue)) {
+                [sortedLocations addObject:location];
+            }
+        }
+        [sortedLocations sortUsingSelector:@selector(compare:)];
+
+        count = sortedLocations.count;
+
+        NSMutableData *doubles  = [NSMutableData dataWithLength:count * sizeof(double)];
+        NSMutableData *decimals = [NSMutableData dataWithLength:count * sizeof(NSDecimal)];
+        NSMutableData *flags    = [NSMutableData dataWithLength:count * sizeof(BOOL)];
+
+        double *doubleBytes     = (double *)doubles.mutableBytes;
+        NSDecimal *decimalBytes = (NSDecimal *)decimals.mutableBytes;
+        BOOL *flagBytes         = (BOOL *)flags.mutableBytes;
+
+        for ( NSUInteger i = 0; i < count; i++ ) {
+            NSNumber *location = sortedLocations[i];
+
+            doubleBytes[i]  = location.doubleValue;
+            decimalBytes[i] = location.decimalValue;
+            flagBytes[i]    = [location isKindOfClass:[NSDecimalNumber class]];
+        }
+
+        doubleData      = doubles;
+        decimalData     = decimals;
+        decimalFlagData = flags;
+    }
+    return self;
+}
+
+/// @cond
+
+-(nonnull instancetype)init
+{
+    return [self initWithLocations:nil];
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Accessors
+
+/// @cond
+
+-(nullable const double *)doubleValues
+{
+    return (const double *)self.doubleData.bytes;
+}
+
+-(nullable const NSDecimal *)decimalValues
+{
+    return (const NSDecimal *)self.decimalData.bytes;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Queries
+
+/** @brief Determines whether a tick location lies in a plot range.
+ *
+ *  Locations given as NSDecimalNumber instances are compared in decimal arithmetic and all others as doubles,
+ *  the same way as @link CPTPlotRange::containsNumber: -containsNumber: @endlink.
+ *
+ *  @param idx The index of the tick location.
+ *  @param range The plot range. If @nil, every location is in range.
+ *  @return @YES if the tick location lies in @par{range}.
+ **/
+-(BOOL)locationAtIndex:(NSUInteger)idx isInRange:(nullable CPTPlotRange *)range
+{
+    NSParameterAssert(idx < self.count);
+
+    if ( !range ) {
+        return YES;
+    }
+
+    const BOOL *decimalFlags = (const BOOL *)self.decimalFlagData.bytes;
+
+    if ( decimalFlags[idx] ) {
+        return [range contains:self.decimalValues[idx]];
+    }
+    else {
+        return [range containsDouble:self.doubleValues[idx]];
+    }
+}
+
+@end
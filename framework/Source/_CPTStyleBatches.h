@@ -0,0 +1,32 @@
+@class CPTFill;
+@class CPTLineStyle;
+
+@interface _CPTStyleBatches : NSObject
+
+@property (nonatomic, readonly) NSUInteger batchCount;
+@property (nonatomic, readonly) NSUInteger maximumBatchCount;
+@property (nonatomic, readonly) CGFloat minimumExtent;
+@property (nonatomic, readonly) CGFloat maximumExtent;
+
+/// @name Initialization
+/// @{
+-(nonnull instancetype)initWithMaximumBatchCount:(NSUInteger)maxCount NS_DESIGNATED_INITIALIZER;
+/// @}
+
+/// @name Batches
+/// @{
++(BOOL)canBatchFill:(nullable CPTFill *)fill lineStyle:(nullable CPTLineStyle *)lineStyle;
+-(NSUInteger)batchIndexForFill:(nullable CPTFill *)fill lineStyle:(nullable CPTLineStyle *)lineStyle;
+-(nonnull CGMutablePathRef)fillPathForBatchAtIndex:(NSUInteger)idx;
+-(nonnull CGMutablePathRef)strokePathForBatchAtIndex:(NSUInteger)idx;
+-(nonnull CGMutablePathRef)sharedPathForBatchAtIndex:(NSUInteger)idx;
+-(BOOL)shapeOverlapsBatchesFrom:(CGFloat)lowerBound to:(CGFloat)upperBound;
+-(void)addShapeExtentFrom:(CGFloat)lowerBound to:(CGFloat)upperBound;
+/// @}
+
+/// @name Drawing
+/// @{
+-(void)flushInContext:(nonnull CGContextRef)context;
+/// @}
+
+@end
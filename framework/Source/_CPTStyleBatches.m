@@ -0,0 +1,359 @@
+#import "_CPTStyleBatches.h"
+
+#import "CPTFill.h"
+#import "CPTLineStyle.h"
+
+/// @cond
+
+/**
+ *  @brief The paths collected for one fill and line style.
+ **/
+typedef struct _CPTStyleBatchPaths {
+    CGMutablePathRef __nullable fillPath;   ///< Outlines that are filled but not stroked.
+    CGMutablePathRef __nullable strokePath; ///< Lines that are stroked but not filled.
+    CGMutablePathRef __nullable sharedPath; ///< Outlines that are both filled and stroked.
+}
+CPTStyleBatchPaths;
+
+@interface _CPTStyleBatches()
+
+@property (nonatomic, readwrite, assign) NSUInteger batchCount;
+@property (nonatomic, readwrite, assign) NSUInteger maximumBatchCount;
+@property (nonatomic, readwrite, assign) CGFloat minimumExtent;
+@property (nonatomic, readwrite, assign) CGFloat maximumExtent;
+@property (nonatomic, readwrite, assign) NSUInteger lastBatchIndex;
+@property (nonatomic, readwrite, strong, nonnull) NSMutableArray *fills;
+@property (nonatomic, readwrite, strong, nonnull) NSMutableArray *lineStyles;
+@property (nonatomic, readwrite, assign, nullable) CPTStyleBatchPaths *paths;
+
+-(void)removeAllBatches;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief Collects the outlines of many plot symbols, bars, or candles into one compound path per fill and line style.
+ *
+ *  Plots that draw one shape per record normally set up the fill and line style and fill and stroke a
+ *  separate path for every record. Shapes added to a batch are drawn together instead, so each distinct
+ *  style is filled and stroked once. Batches are identified by the identity of the fill and line style
+ *  objects and are drawn in the order they were first used.
+ *
+ *  Only solid color fills and lines can be batched. Gradient and image fills are drawn relative to the
+ *  bounds of the path being filled and would look different when applied to the bounds of the whole batch.
+ *
+ *  Batching changes the drawing order: every shape of a batch is filled before any of them is stroked,
+ *  and the batches are drawn one after another. That only matches drawing the shapes one at a time in
+ *  record order when the batched shapes do not overlap, and overlapping outlines in one compound path
+ *  would also be filled once or leave holes where their winding cancels. Callers therefore record the
+ *  extent of each shape, including the width of its outline, along one axis and flush the batches
+ *  before adding a shape that overlaps the shapes already collected, or before drawing a shape directly.
+ *  Shapes that only touch are not considered overlapping.
+ **/
+@implementation _CPTStyleBatches
+
+/** @property NSUInteger batchCount
+ *  @brief The number of batches.
+ **/
+@synthesize batchCount;
+
+/** @property NSUInteger maximumBatchCount
+ *  @brief The largest number of batches. Flush the batches to make room for another style.
+ **/
+@synthesize maximumBatchCount;
+
+/** @property CGFloat minimumExtent
+ *  @brief The lowest coordinate covered by the collected shapes, or infinity if there are none.
+ **/
+@synthesize minimumExtent;
+
+/** @property CGFloat maximumExtent
+ *  @brief The highest coordinate covered by the collected shapes, or minus infinity if there are none.
+ **/
+@synthesize maximumExtent;
+
+/** @internal
+ *  @property NSUInteger lastBatchIndex
+ *  @brief The index of the batch returned by the last lookup. Neighboring records usually share a style.
+ **/
+@synthesize lastBatchIndex;
+
+/** @internal
+ *  @property nonnull NSMutableArray *fills
+ *  @brief The fill of each batch, or @NSNull for no fill.
+ **/
+@synthesize fills;
+
+/** @internal
+ *  @property nonnull NSMutableArray *lineStyles
+ *  @brief The line style of each batch, or @NSNull for no line.
+ **/
+@synthesize lineStyles;
+
+/** @internal
+ *  @property CPTStyleBatchPaths *paths
+ *  @brief The paths of each batch.
+ **/
+@synthesize paths;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Initializes a newly allocated _CPTStyleBatches object.
+ *  @param maxCount The largest number of batches.
+ *  @return The initialized _CPTStyleBatches object.
+ **/
+-(nonnull instancetype)initWithMaximumBatchCount:(NSUInteger)maxCount
+{
+    if ((self = [super init])) {
+        batchCount        = 0;
+        maximumBatchCount = maxCount;
+        minimumExtent     = (CGFloat)INFINITY;
+        maximumExtent     = -(CGFloat)INFINITY;
+        lastBatchIndex    = NSNotFound;
+        fills             = [[NSMutableArray alloc] initWithCapacity:maxCount];
+        lineStyles        = [[NSMutableArray alloc] initWithCapacity:maxCount];
+        paths             = calloc(MAX(maxCount, (NSUInteger)1), sizeof(CPTStyleBatchPaths));
+    }
+    return self;
+}
+
+/// @cond
+
+-(nonnull instancetype)init
+{
+    return [self initWithMaximumBatchCount:16];
+}
+
+-(void)dealloc
+{
+    for ( NSUInteger i = 0; i < batchCount; i++ ) {
+        CGPathRelease(paths[i].fillPath);
+        CGPathRelease(paths[i].strokePath);
+        CGPathRelease(paths[i].sharedPath);
+    }
+    free(paths);
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Batches
+
+/** @brief Determines whether shapes with a fill and line style can be drawn in a batch.
+ *  @param fill The fill, or @nil for no fill.
+ *  @param lineStyle The line style, or @nil for no line.
+ *  @return @YES if the fill and the line are solid colors or missing.
+ **/
++(BOOL)canBatchFill:(nullable CPTFill *)fill lineStyle:(nullable CPTLineStyle *)lineStyle
+{
+    if ( fill && !fill.cgColor ) {
+        return NO;
+    }
+
+    if ( lineStyle ) {
+        if ( lineStyle.lineGradient ) {
+            return NO;
+        }
+
+        CPTFill *lineFill = lineStyle.lineFill;
+        if ( lineFill && !lineFill.cgColor ) {
+            return NO;
+        }
+    }
+
+    return YES;
+}
+
+/** @brief Finds or adds the batch for a fill and line style.
+ *  @param fill The fill, or @nil for no fill.
+ *  @param lineStyle The line style, or @nil for no line.
+ *  @return The index of the batch, or @ref NSNotFound if the style cannot be batched or there are already
+ *  @ref maximumBatchCount batches. Flush the batches and try again or draw the shape directly in that case.
+ **/
+-(NSUInteger)batchIndexForFill:(nullable CPTFill *)fill lineStyle:(nullable CPTLineStyle *)lineStyle
+{
+    id fillKey      = fill ? (id)fill : (id)[NSNull null];
+    id lineStyleKey = lineStyle ? (id)lineStyle : (id)[NSNull null];
+
+    NSMutableArray *theFills      = self.fills;
+    NSMutableArray *theLineStyles = self.lineStyles;
+
+    NSUInteger lastIndex = self.lastBatchIndex;
+
+    if ((lastIndex != NSNotFound) && (theFills[lastIndex] == fillKey) && (theLineStyles[lastIndex] == lineStyleKey)) {
+        return lastIndex;
+    }
+
+    NSUInteger count = self.batchCount;
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        if ((theFills[i] == fillKey) && (theLineStyles[i] == lineStyleKey)) {
+            self.lastBatchIndex = i;
+            return i;
+        }
+    }
+
+    if ((count >= self.maximumBatchCount) || ![[self class] canBatchFill:fill lineStyle:lineStyle] ) {
+        return NSNotFound;
+    }
+
+    [theFills addObject:fillKey];
+    [theLineStyles addObject:lineStyleKey];
+
+    self.batchCount     = count + 1;
+    self.lastBatchIndex = count;
+
+    return count;
+}
+
+/** @brief The path of outlines that are filled with the batch fill but not stroked.
+ *  @param idx The index of the batch.
+ *  @return The path.
+ **/
+-(nonnull CGMutablePathRef)fillPathForBatchAtIndex:(NSUInteger)idx
+{
+    NSParameterAssert(idx < self.batchCount);
+
+    CPTStyleBatchPaths *batchPaths = &self.paths[idx];
+
+    if ( !batchPaths->fillPath ) {
+        batchPaths->fillPath = CGPathCreateMutable();
+    }
+    return batchPaths->fillPath;
+}
+
+/** @brief The path of lines that are stroked with the batch line style but not filled.
+ *  @param idx The index of the batch.
+ *  @return The path.
+ **/
+-(nonnull CGMutablePathRef)strokePathForBatchAtIndex:(NSUInteger)idx
+{
+    NSParameterAssert(idx < self.batchCount);
+
+    CPTStyleBatchPaths *batchPaths = &self.paths[idx];
+
+    if ( !batchPaths->strokePath ) {
+        batchPaths->strokePath = CGPathCreateMutable();
+    }
+    return batchPaths->strokePath;
+}
+
+/** @brief The path of outlines that are both filled and stroked.
+ *  @param idx The index of the batch.
+ *  @return The path.
+ **/
+-(nonnull CGMutablePathRef)sharedPathForBatchAtIndex:(NSUInteger)idx
+{
+    NSParameterAssert(idx < self.batchCount);
+
+    CPTStyleBatchPaths *batchPaths = &self.paths[idx];
+
+    if ( !batchPaths->sharedPath ) {
+        batchPaths->sharedPath = CGPathCreateMutable();
+    }
+    return batchPaths->sharedPath;
+}
+
+/** @brief Determines whether a shape overlaps any of the shapes already collected.
+ *  @param lowerBound The lowest coordinate covered by the shape, including its outline.
+ *  @param upperBound The highest coordinate covered by the shape, including its outline.
+ *  @return @YES if the shape overlaps the range covered by the collected shapes.
+ **/
+-(BOOL)shapeOverlapsBatchesFrom:(CGFloat)lowerBound to:(CGFloat)upperBound
+{
+    return (upperBound > self.minimumExtent) && (lowerBound < self.maximumExtent);
+}
+
+/** @brief Records the range covered by a shape added to one of the batches.
+ *  @param lowerBound The lowest coordinate covered by the shape, including its outline.
+ *  @param upperBound The highest coordinate covered by the shape, including its outline.
+ **/
+-(void)addShapeExtentFrom:(CGFloat)lowerBound to:(CGFloat)upperBound
+{
+    self.minimumExtent = MIN(self.minimumExtent, lowerBound);
+    self.maximumExtent = MAX(self.maximumExtent, upperBound);
+}
+
+/** @internal
+ *  @brief Removes all batches and their shapes.
+ **/
+-(void)removeAllBatches
+{
+    NSUInteger count        = self.batchCount;
+    CPTStyleBatchPaths *all  = self.paths;
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        CGPathRelease(all[i].fillPath);
+        CGPathRelease(all[i].strokePath);
+        CGPathRelease(all[i].sharedPath);
+    }
+    memset(all, 0, count * sizeof(CPTStyleBatchPaths));
+
+    [self.fills removeAllObjects];
+    [self.lineStyles removeAllObjects];
+
+    self.batchCount     = 0;
+    self.lastBatchIndex = NSNotFound;
+    self.minimumExtent  = (CGFloat)INFINITY;
+    self.maximumExtent  = -(CGFloat)INFINITY;
+}
+
+#pragma mark -
+#pragma mark Drawing
+
+/** @brief Draws the batches in the order they were added and removes them.
+ *
+ *  Each batch is filled and then stroked, so lines are drawn over the fills of the same batch.
+ *  The batches are empty afterwards and can collect the shapes that are drawn on top of these.
+ *
+ *  @param context The graphics context to draw into.
+ **/
+-(void)flushInContext:(nonnull CGContextRef)context
+{
+    NSUInteger count              = self.batchCount;
+    const CPTStyleBatchPaths *all = self.paths;
+    NSMutableArray *theFills      = self.fills;
+    NSMutableArray *theLineStyles = self.lineStyles;
+
+    for ( NSUInteger i = 0; i < count; i++ ) {
+        CGPathRef fillPath   = all[i].fillPath;
+        CGPathRef strokePath = all[i].strokePath;
+        CGPathRef sharedPath = all[i].sharedPath;
+
+        CGContextSaveGState(context);
+
+        CPTFill *theFill = theFills[i];
+        if ( [theFill isKindOfClass:[CPTFill class]] && (fillPath || sharedPath)) {
+            CGContextBeginPath(context);
+            if ( fillPath ) {
+                CGContextAddPath(context, fillPath);
+            }
+            if ( sharedPath ) {
+                CGContextAddPath(context, sharedPath);
+            }
+            [theFill fillPathInContext:context];
+        }
+
+        CPTLineStyle *theLineStyle = theLineStyles[i];
+        if ( [theLineStyle isKindOfClass:[CPTLineStyle class]] && (strokePath || sharedPath)) {
+            CGContextBeginPath(context);
+            if ( sharedPath ) {
+                CGContextAddPath(context, sharedPath);
+            }
+            if ( strokePath ) {
+                CGContextAddPath(context, strokePath);
+            }
+            [theLineStyle setLineStyleInContext:context];
+            [theLineStyle strokePathInContext:context];
+        }
+
+        CGContextRestoreGState(context);
+    }
+
+    [self removeAllBatches];
+}
+
+@end
@@ -0,0 +1,118 @@
+#import "_CPTStyleBatchesTests.h"
+
+#import "_CPTStyleBatches.h"
+#import "CPTColor.h"
+#import "CPTFill.h"
+#import "CPTGradient.h"
+#import "CPTMutableLineStyle.h"
+#import "CPTUtilities.h"
+
+@implementation _CPTStyleBatchesTests
+
+#pragma mark -
+#pragma mark Batches
+
+-(void)testBatchIndexIsSharedBySameStyles
+{
+    _CPTStyleBatches *batches = [[_CPTStyleBatches alloc] initWithMaximumBatchCount:4];
+
+    CPTFill *redFill        = [CPTFill fillWithColor:[CPTColor redColor]];
+    CPTFill *blueFill       = [CPTFill fillWithColor:[CPTColor blueColor]];
+    CPTLineStyle *lineStyle = [CPTLineStyle lineStyle];
+
+    XCTAssertEqual([batches batchIndexForFill:redFill lineStyle:nil], (NSUInteger)0, @"First style");
+    XCTAssertEqual([batches batchIndexForFill:blueFill lineStyle:nil], (NSUInteger)1, @"Second style");
+    XCTAssertEqual([batches batchIndexForFill:redFill lineStyle:nil], (NSUInteger)0, @"Repeated style");
+    XCTAssertEqual([batches batchIndexForFill:redFill lineStyle:lineStyle], (NSUInteger)2, @"Same fill with a line");
+    XCTAssertEqual([batches batchIndexForFill:nil lineStyle:lineStyle], (NSUInteger)3, @"Line only");
+    XCTAssertEqual(batches.batchCount, (NSUInteger)4, @"Number of batches");
+
+    // styles are compared by identity
+    CPTFill *otherRedFill = [CPTFill fillWithColor:[CPTColor redColor]];
+
+    XCTAssertEqual([batches batchIndexForFill:otherRedFill lineStyle:nil], (NSUInteger)NSNotFound, @"Too many batches");
+    XCTAssertEqual(batches.batchCount, (NSUInteger)4, @"Number of batches after overflow");
+}
+
+-(void)testBatchIndexRejectsGradients
+{
+    _CPTStyleBatches *batches = [[_CPTStyleBatches alloc] initWithMaximumBatchCount:4];
+
+    CPTGradient *gradient = [CPTGradient gradientWithBeginningColor:[CPTColor redColor] endingColor:[CPTColor blueColor]];
+
+    CPTMutableLineStyle *gradientLineStyle = [CPTMutableLineStyle lineStyle];
+
+    gradientLineStyle.lineGradient = gradient;
+
+    XCTAssertFalse([_CPTStyleBatches canBatchFill:[CPTFill fillWithGradient:gradient] lineStyle:nil], @"Gradient fill");
+    XCTAssertFalse([_CPTStyleBatches canBatchFill:nil lineStyle:gradientLineStyle], @"Gradient line");
+    XCTAssertTrue([_CPTStyleBatches canBatchFill:nil lineStyle:nil], @"No fill or line");
+
+    XCTAssertEqual([batches batchIndexForFill:[CPTFill fillWithGradient:gradient] lineStyle:nil], (NSUInteger)NSNotFound, @"Gradient fill batch");
+    XCTAssertEqual(batches.batchCount, (NSUInteger)0, @"Number of batches");
+}
+
+#pragma mark -
+#pragma mark Overlap
+
+-(void)testShapeOverlapsBatches
+{
+    _CPTStyleBatches *batches = [[_CPTStyleBatches alloc] initWithMaximumBatchCount:4];
+
+    XCTAssertFalse([batches shapeOverlapsBatchesFrom:0.0 to:10.0], @"Empty batches");
+
+    [batches addShapeExtentFrom:10.0 to:20.0];
+    [batches addShapeExtentFrom:30.0 to:40.0];
+
+    XCTAssertEqual(batches.minimumExtent, CPTFloat(10.0), @"Minimum extent");
+    XCTAssertEqual(batches.maximumExtent, CPTFloat(40.0), @"Maximum extent");
+
+    XCTAssertFalse([batches shapeOverlapsBatchesFrom:0.0 to:10.0], @"Touching the lower edge");
+    XCTAssertFalse([batches shapeOverlapsBatchesFrom:40.0 to:50.0], @"Touching the upper edge");
+    XCTAssertTrue([batches shapeOverlapsBatchesFrom:5.0 to:15.0], @"Overlapping the lower edge");
+    XCTAssertTrue([batches shapeOverlapsBatchesFrom:35.0 to:45.0], @"Overlapping the upper edge");
+    XCTAssertTrue([batches shapeOverlapsBatchesFrom:0.0 to:50.0], @"Covering the batches");
+
+    // only the overall range is tracked, so gaps between shapes count as covered
+    XCTAssertTrue([batches shapeOverlapsBatchesFrom:22.0 to:28.0], @"Between shapes");
+}
+
+-(void)testFlushRemovesBatches
+{
+    _CPTStyleBatches *batches = [[_CPTStyleBatches alloc] initWithMaximumBatchCount:1];
+
+    CPTFill *redFill  = [CPTFill fillWithColor:[CPTColor redColor]];
+    CPTFill *blueFill = [CPTFill fillWithColor:[CPTColor blueColor]];
+
+    NSUInteger batch = [batches batchIndexForFill:redFill lineStyle:nil];
+
+    CGPathAddRect([batches sharedPathForBatchAtIndex:batch], NULL, CPTRectMake(10.0, 10.0, 20.0, 20.0));
+    [batches addShapeExtentFrom:10.0 to:30.0];
+
+    XCTAssertEqual([batches batchIndexForFill:blueFill lineStyle:nil], (NSUInteger)NSNotFound, @"Full batches");
+
+    const size_t width  = 40;
+    const size_t height = 40;
+
+    size_t bytesPerRow = 4 * width;
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context       = CGBitmapContextCreate(NULL, width, height, 8, bytesPerRow, colorSpace, (CGBitmapInfo)kCGImageAlphaPremultipliedLast);
+
+    [batches flushInContext:context];
+
+    const uint8_t *pixels = (const uint8_t *)CGBitmapContextGetData(context);
+    const uint8_t *pixel  = pixels + (height - 1 - 20) * bytesPerRow + 4 * 20;
+
+    XCTAssertGreaterThan(pixel[0], 200, @"Batch drawn");
+    XCTAssertLessThan(pixel[2], 50, @"Batch drawn");
+
+    CGContextRelease(context);
+    CGColorSpaceRelease(colorSpace);
+
+    XCTAssertEqual(batches.batchCount, (NSUInteger)0, @"Number of batches after flushing");
+    XCTAssertFalse([batches shapeOverlapsBatchesFrom:10.0 to:30.0], @"Extent after flushing");
+    XCTAssertEqual([batches batchIndexForFill:blueFill lineStyle:nil], (NSUInteger)0, @"New style after flushing");
+}
+
+@end
@@ -0,0 +1,26 @@
+@class CPTTextStyle;
+
+@interface _CPTTextCache : NSObject
+
+/// @name Shared Cache
+/// @{
++(nonnull instancetype)sharedCache;
+/// @}
+
+/// @name Text Measurement
+/// @{
+-(CGSize)sizeOfText:(nonnull NSString *)text style:(nullable CPTTextStyle *)style;
+-(CGSize)sizeOfAttributedText:(nonnull NSAttributedString *)text;
+/// @}
+
+/// @name Rasterized Text
+/// @{
+-(nullable CGImageRef)newImageOfText:(nullable NSString *)text attributedText:(nullable NSAttributedString *)attributedText style:(nullable CPTTextStyle *)style size:(CGSize)size scale:(CGFloat)scale CF_RETURNS_RETAINED;
+/// @}
+
+/// @name Memory Management
+/// @{
+-(void)removeAllObjects;
+/// @}
+
+@end
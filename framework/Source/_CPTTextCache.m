@@ -0,0 +1,326 @@
+#import "_CPTTextCache.h"
+
+#import "CPTColorSpace.h"
+#import "CPTPlatformSpecificCategories.h"
+#import "CPTTextStylePlatformSpecific.h"
+#import "CPTUtilities.h"
+#import <tgmath.h>
+
+static const NSUInteger kCPTTextCacheSizeCountLimit   = 4096;             // measured sizes kept
+static const NSUInteger kCPTTextCacheImageCostLimit   = 16 * 1024 * 1024; // bytes of bitmaps kept
+static const NSUInteger kCPTTextCacheMaximumImageCost = 256 * 1024;      // larger text is drawn directly
+
+/// @cond
+
+#pragma mark -
+
+/**
+ *  @brief The key of a measured size or rasterized bitmap in the text cache.
+ *
+ *  The text style is captured by its string drawing attributes, so equal styles share entries
+ *  and later changes to a mutable style do not affect existing keys.
+ **/
+@interface _CPTTextCacheKey : NSObject<NSCopying>
+
+@property (nonatomic, readonly, copy, nullable) NSString *text;
+@property (nonatomic, readonly, copy, nullable) NSAttributedString *attributedText;
+@property (nonatomic, readonly, copy, nullable) CPTDictionary *attributes;
+@property (nonatomic, readonly) CGSize size;
+@property (nonatomic, readonly) CGFloat scale;
+@property (nonatomic, readonly) NSUInteger hashValue;
+
+-(nonnull instancetype)initWithText:(nullable NSString *)newText attributedText:(nullable NSAttributedString *)newAttributedText style:(nullable CPTTextStyle *)style size:(CGSize)newSize scale:(CGFloat)newScale NS_DESIGNATED_INITIALIZER;
+-(nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
+
+#pragma mark -
+
+@implementation _CPTTextCacheKey
+
+@synthesize text;
+@synthesize attributedText;
+@synthesize attributes;
+@synthesize size;
+@synthesize scale;
+@synthesize hashValue;
+
+-(nonnull instancetype)initWithText:(nullable NSString *)newText attributedText:(nullable NSAttributedString *)newAttributedText style:(nullable CPTTextStyle *)style size:(CGSize)newSize scale:(CGFloat)newScale
+{
+    if ((self = [super init])) {
+        text           = [newText copy];
+        attributedText = [newAttributedText copy];
+        attributes     = newAttributedText ? nil : [style.attributes copy];
+        size           = newSize;
+        scale          = newScale;
+
+        hashValue = text.hash ^ (attributedText.string.hash * 31) ^ (style.fontName.hash * 17) ^
+                    ((NSUInteger)(style.fontSize * CPTFloat(64.0)) * 7) ^
+                    ((NSUInteger)(newSize.width + newSize.height * CPTFloat(8192.0)) * 3) ^
+                    (NSUInteger)(newScale * CPTFloat(8.0));
+    }
+    return self;
+}
+
+-(nonnull id)copyWithZone:(nullable NSZone *__unused)zone
+{
+    // immutable
+    return self;
+}
+
+-(NSUInteger)hash
+{
+    return self.hashValue;
+}
+
+-(BOOL)isEqual:(nullable id)object
+{
+    if ( self == object ) {
+        return YES;
+    }
+    if ( ![object isKindOfClass:[_CPTTextCacheKey class]] ) {
+        return NO;
+    }
+
+    _CPTTextCacheKey *otherKey = (_CPTTextCacheKey *)object;
+
+    if ((self.hashValue != otherKey.hashValue) || !CGSizeEqualToSize(self.size, otherKey.size) || (self.scale != otherKey.scale)) {
+        return NO;
+    }
+
+    NSString *myText    = self.text;
+    NSString *theirText = otherKey.text;
+    if ((myText != theirText) && ![myText isEqualToString:theirText] ) {
+        return NO;
+    }
+
+    NSAttributedString *myAttributedText    = self.attributedText;
+    NSAttributedString *theirAttributedText = otherKey.attributedText;
+    if ((myAttributedText != theirAttributedText) && ![myAttributedText isEqualToAttributedString:theirAttributedText] ) {
+        return NO;
+    }
+
+    CPTDictionary *myAttributes    = self.attributes;
+    CPTDictionary *theirAttributes = otherKey.attributes;
+
+    return (myAttributes == theirAttributes) || [myAttributes isEqualToDictionary:theirAttributes];
+}
+
+@end
+
+#pragma mark -
+
+@interface _CPTTextCache()
+
+@property (nonatomic, readonly, strong, nonnull) NSCache<_CPTTextCacheKey *, NSValue *> *sizes;
+@property (nonatomic, readonly, strong, nonnull) NSCache<_CPTTextCacheKey *, id> *images;
+
+@end
+
+/// @endcond
+
+#pragma mark -
+
+/** @brief A process-wide cache of measured and rasterized text.
+ *
+ *  Axis and data labels repeat the same short strings in the same few text styles every time
+ *  they are relabeled. The cache keeps the measured size of each string and style so text
+ *  layers can size themselves without laying out the text again. It also keeps bitmaps of
+ *  drawn text, keyed by the drawing size and the contents scale of the layer, which text
+ *  layers draw instead of the glyphs when rendering into their own backing store.
+ *
+ *  Entries are held in NSCache instances with count and memory limits, so the cache is safe
+ *  to use from any thread and shrinks automatically when the system is short of memory.
+ *  Rotation is applied by the layer transform, so it is not part of the key.
+ **/
+@implementation _CPTTextCache
+
+/** @property nonnull NSCache<_CPTTextCacheKey *, NSValue *> *sizes
+ *  @brief The measured sizes of text.
+ **/
+@synthesize sizes;
+
+/** @property nonnull NSCache<_CPTTextCacheKey *, id> *images
+ *  @brief The rasterized text bitmaps, stored as @ref CGImageRef objects.
+ **/
+@synthesize images;
+
+#pragma mark -
+#pragma mark Init/Dealloc
+
+/** @brief Returns the shared text cache.
+ *  @return The shared text cache.
+ **/
++(nonnull instancetype)sharedCache
+{
+    static dispatch_once_t once = 0;
+    static _CPTTextCache *shared;
+
+    dispatch_once(&once, ^{
+        shared = [[self alloc] init];
+    });
+
+    return shared;
+}
+
+/// @cond
+
+-(nonnull instancetype)init
+{
+    if ((self = [super init])) {
+        sizes  = [[NSCache alloc] init];
+        images = [[NSCache alloc] init];
+
+        sizes.name            = @"CorePlot.textSizes";
+        sizes.countLimit      = kCPTTextCacheSizeCountLimit;
+        images.name           = @"CorePlot.textImages";
+        images.totalCostLimit = kCPTTextCacheImageCostLimit;
+    }
+    return self;
+}
+
+/// @endcond
+
+#pragma mark -
+#pragma mark Text Measurement
+
+/** @brief Measures a string drawn in a text style.
+ *  @param text The text to measure.
+ *  @param style The text style.
+ *  @return The size of the text, rounded up to whole points.
+ **/
+-(CGSize)sizeOfText:(nonnull NSString *)text style:(nullable CPTTextStyle *)style
+{
+    _CPTTextCacheKey *key = [[_CPTTextCacheKey alloc] initWithText:text attributedText:nil style:style size:CGSizeZero scale:CPTFloat(0.0)];
+
+    NSValue *cachedSize = [self.sizes objectForKey:key];
+
+    if ( cachedSize ) {
+        CGSize textSize = CGSizeZero;
+        [cachedSize getValue:&textSize];
+        return textSize;
+    }
+
+    CGSize textSize = [text sizeWithTextStyle:style];
+
+    [self.sizes setObject:[NSValue valueWithBytes:&textSize objCType:@encode(CGSize)] forKey:key];
+
+    return textSize;
+}
+
+/** @brief Measures an attributed string.
+ *  @param text The text to measure.
+ *  @return The size of the text as drawn.
+ **/
+-(CGSize)sizeOfAttributedText:(nonnull NSAttributedString *)text
+{
+    _CPTTextCacheKey *key = [[_CPTTextCacheKey alloc] initWithText:nil attributedText:text style:nil size:CGSizeZero scale:CPTFloat(0.0)];
+
+    NSValue *cachedSize = [self.sizes objectForKey:key];
+
+    if ( cachedSize ) {
+        CGSize textSize = CGSizeZero;
+        [cachedSize getValue:&textSize];
+        return textSize;
+    }
+
+    CGSize textSize = [text sizeAsDrawn];
+
+    [self.sizes setObject:[NSValue valueWithBytes:&textSize objCType:@encode(CGSize)] forKey:key];
+
+    return textSize;
+}
+
+#pragma mark -
+#pragma mark Rasterized Text
+
+/** @brief Returns a bitmap of text drawn into a rectangle, rendering it if it is not in the cache.
+ *
+ *  The bitmap covers the rectangle @par{(0, 0, size.width, size.height)} in a y-up coordinate
+ *  system, drawn the same way as CPTTextLayer draws its text. If @par{attributedText} is not @nil and
+ *  can be drawn, it is used in place of @par{text} and @par{style}.
+ *
+ *  @param text The text to draw.
+ *  @param attributedText The attributed text to draw.
+ *  @param style The text style of @par{text}.
+ *  @param size The size of the rectangle the text is drawn into.
+ *  @param scale The number of pixels per point.
+ *  @return A new bitmap that the caller must release, or @NULL if the text is too large to cache or could not be drawn.
+ **/
+-(nullable CGImageRef)newImageOfText:(nullable NSString *)text attributedText:(nullable NSAttributedString *)attributedText style:(nullable CPTTextStyle *)style size:(CGSize)size scale:(CGFloat)scale
+{
+    if ( ![attributedText respondsToSelector:@selector(drawInRect:inContext:)] ) {
+        attributedText = nil;
+    }
+    if ((attributedText.length == 0) && ((text.length == 0) || !style.color)) {
+        return NULL;
+    }
+
+    size_t pixelWidth  = (size_t)ceil(size.width * scale);
+    size_t pixelHeight = (size_t)ceil(size.height * scale);
+
+    if ((pixelWidth == 0) || (pixelHeight == 0) || (pixelWidth * pixelHeight * 4 > kCPTTextCacheMaximumImageCost)) {
+        return NULL;
+    }
+
+    _CPTTextCacheKey *key = [[_CPTTextCacheKey alloc] initWithText:(attributedText ? nil : text)
+                                                    attributedText:attributedText
+                                                             style:(attributedText ? nil : style)
+                                                              size:size
+                                                             scale:scale];
+
+    CGImageRef image = (__bridge CGImageRef)[self.images objectForKey:key];
+
+    if ( image ) {
+        return CGImageRetain(image);
+    }
+
+    CGContextRef context = CGBitmapContextCreate(NULL, pixelWidth, pixelHeight, 8, 0, [CPTColorSpace genericRGBSpace].cgColorSpace, (CGBitmapInfo)kCGImageAlphaPremultipliedLast);
+
+    if ( !context ) {
+        return NULL;
+    }
+
+    CGContextScaleCTM(context, scale, scale);
+
+#if TARGET_OS_SIMULATOR || TARGET_OS_IPHONE
+    CGContextTranslateCTM(context, CPTFloat(0.0), size.height);
+    CGContextScaleCTM(context, CPTFloat(1.0), CPTFloat(-1.0));
+#endif
+
+    CGRect textRect = CPTRectMake(0.0, 0.0, size.width, size.height);
+
+    if ( attributedText ) {
+        [attributedText drawInRect:textRect
+                         inContext:context];
+    }
+    else {
+        [text drawInRect:textRect
+           withTextStyle:style
+               inContext:context];
+    }
+
+    image = CGBitmapContextCreateImage(context);
+    CGContextRelease(context);
+
+    if ( image ) {
+        [self.images setObject:(__bridge id)image
+                        forKey:key
+                          cost:CGImageGetBytesPerRow(image) * CGImageGetHeight(image)];
+    }
+
+    return image;
+}
+
+#pragma mark -
+#pragma mark Memory Management
+
+/** @brief Removes all measured sizes and bitmaps from the cache.
+ **/
+-(void)removeAllObjects
+{
+    [self.sizes removeAllObjects];
+    [self.images removeAllObjects];
+}
+
+@end
@@ -0,0 +1,69 @@
+#import "_CPTTextCacheTests.h"
+
+#import "_CPTTextCache.h"
+#import "CPTDefinitions.h"
+#import "CPTMutableTextStyle.h"
+#import "CPTTextStylePlatformSpecific.h"
+
+@implementation _CPTTextCacheTests
+
+#pragma mark -
+#pragma mark Sizes
+
+-(void)testSizeMatchesMeasuredSize
+{
+    _CPTTextCache *textCache = [_CPTTextCache sharedCache];
+    CPTTextStyle *textStyle  = [CPTTextStyle textStyle];
+
+    [textCache removeAllObjects];
+
+    CGSize measuredSize = [@"1.5" sizeWithTextStyle:textStyle];
+
+    XCTAssertTrue(CGSizeEqualToSize([textCache sizeOfText:@"1.5" style:textStyle], measuredSize), @"Uncached size");
+    XCTAssertTrue(CGSizeEqualToSize([textCache sizeOfText:@"1.5" style:textStyle], measuredSize), @"Cached size");
+}
+
+-(void)testSizeKeysOnStyleAttributes
+{
+    _CPTTextCache *textCache = [_CPTTextCache sharedCache];
+
+    CPTMutableTextStyle *textStyle = [CPTMutableTextStyle textStyle];
+
+    [textCache removeAllObjects];
+
+    CGSize smallSize = [textCache sizeOfText:@"100.0" style:textStyle];
+
+    textStyle.fontSize = CPTFloat(36.0);
+    CGSize largeSize = [textCache sizeOfText:@"100.0" style:textStyle];
+
+    XCTAssertGreaterThan(largeSize.width, smallSize.width, @"Changing the style must not reuse the old size");
+    XCTAssertTrue(CGSizeEqualToSize(largeSize, [@"100.0" sizeWithTextStyle:textStyle]), @"Size of the changed style");
+}
+
+#pragma mark -
+#pragma mark Images
+
+-(void)testEqualTextSharesImages
+{
+    _CPTTextCache *textCache = [_CPTTextCache sharedCache];
+    CPTTextStyle *textStyle  = [CPTTextStyle textStyle];
+    CGSize textSize          = CPTSizeMake(40.0, 20.0);
+
+    [textCache removeAllObjects];
+
+    CGImageRef image1 = [textCache newImageOfText:@"2.0" attributedText:nil style:textStyle size:textSize scale:CPTFloat(2.0)];
+    CGImageRef image2 = [textCache newImageOfText:@"2.0" attributedText:nil style:[textStyle copy] size:textSize scale:CPTFloat(2.0)];
+    CGImageRef image3 = [textCache newImageOfText:@"2.0" attributedText:nil style:textStyle size:textSize scale:CPTFloat(1.0)];
+
+    XCTAssertTrue(image1 != NULL, @"Image not drawn");
+    XCTAssertTrue(image1 == image2, @"Equal text and style must share an image");
+    XCTAssertTrue(image1 != image3, @"Different scales must not share an image");
+    XCTAssertEqual(CGImageGetWidth(image1), (size_t)80, @"Image width in pixels");
+    XCTAssertEqual(CGImageGetHeight(image3), (size_t)20, @"Image height in pixels");
+
+    CGImageRelease(image1);
+    CGImageRelease(image2);
+    CGImageRelease(image3);
+}
+
+@end